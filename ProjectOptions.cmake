@@ -708,6 +708,13 @@ set(DEBUG_WITH_BEEPS
     )
 define_boolean_option(DEBUG_WITH_BEEPS ${DEBUG_WITH_BEEPS})
 
+set(BENCHMARKS
+    "OFF"
+    CACHE BOOL
+          "Run on-device microbenchmarks after boot, emitting results to the serial console log"
+    )
+define_boolean_option(BENCHMARKS ${BENCHMARKS})
+
 # Use websocket to talk to Connect instead of many http requests.
 #
 # The server part is not ready and the protocol is in a flux too. For that reason, this is not
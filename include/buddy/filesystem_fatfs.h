@@ -1,5 +1,6 @@
 #pragma once
 
+#include <stdint.h>
 #include <stdio.h>
 #include "ff.h"
 
@@ -11,6 +12,14 @@ int filesystem_fatfs_init();
 
 FIL *filesystem_fastfs_get_underlying_struct(FILE *file);
 
+/// Drop the cache of recently stat-ed paths; to be called whenever the
+/// filesystem may change behind FatFS' back (media insert/eject).
+void filesystem_fatfs_cache_invalidate();
+
+/// Bumped on every cache invalidation. Consumers caching anything derived
+/// from directory listings (see lfn.cpp) compare it to notice staleness.
+uint32_t filesystem_fatfs_cache_generation();
+
 #if defined(__cplusplus)
 } // extern "C"
 #endif // defined(__cplusplus)
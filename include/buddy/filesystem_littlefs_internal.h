@@ -1,11 +1,30 @@
 #pragma once
 
+#include <stddef.h>
+
 #if defined(__cplusplus)
 extern "C" {
 #endif // defined(__cplusplus)
 
 int filesystem_littlefs_internal_init();
 
+/// Keep a full copy of the given file in RAM; subsequent reads of it are
+/// served by memcpy instead of flash transactions. Intended for small files
+/// that are read in many tiny chunks (translations, hot resources).
+///
+/// The copy is dropped automatically when the file is opened for writing,
+/// unlinked or renamed. Best effort: the call fails (and reads keep going to
+/// flash) when the file is larger than \p max_size, the RAM budget is spent
+/// or all pin slots are taken.
+///
+/// \param path full path including the mount point ("/internal/...")
+/// \return 0 on success, -1 otherwise
+int filesystem_littlefs_internal_pin(const char *path, size_t max_size);
+
+/// Drop the pinned copy of the given file, if any. Handles that are already
+/// open keep reading the old copy until they close.
+void filesystem_littlefs_internal_unpin(const char *path);
+
 #if defined(__cplusplus)
 } // extern "C"
 #endif // defined(__cplusplus)
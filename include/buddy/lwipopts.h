@@ -57,7 +57,27 @@ extern "C" {
 #define DEFAULT_ACCEPTMBOX_SIZE   TCPIP_MBOX_SIZE
 #define RECV_BUFSIZE_DEFAULT      2000000000
 #define LWIP_HTTPD                0
-#define LWIP_STATS                0
+/*
+ * Stats for the memory pools only. We want the occupancy, high-water marks
+ * and allocation failures so the pool sizes above can be tuned from real
+ * data (exported as the lwip_pool metric in wui.cpp). The memp counters are
+ * touched only on alloc/free, which is cheap; the per-protocol packet
+ * counters would cost extra writes on every single packet, so those stay
+ * off, as does the textual display support.
+ */
+#define LWIP_STATS                1
+#define LWIP_STATS_DISPLAY        0
+#define MEMP_STATS                1
+#define LINK_STATS                0
+#define ETHARP_STATS              0
+#define IP_STATS                  0
+#define IPFRAG_STATS              0
+#define ICMP_STATS                0
+#define IGMP_STATS                0
+#define UDP_STATS                 0
+#define TCP_STATS                 0
+#define MEM_STATS                 0
+#define SYS_STATS                 0
 #define CHECKSUM_GEN_IP           1
 #define CHECKSUM_GEN_UDP          1
 #define CHECKSUM_GEN_TCP          1
@@ -118,6 +138,14 @@ extern "C" {
 #define TCP_OOSEQ_MAX_PBUFS               3
 
 #define LWIP_DNS 1
+/*
+ * The resolver's cache honors the records' TTLs, but the default table has
+ * only 2 entries. We regularly talk to more names than that (Connect, the two
+ * syslog endpoints for metrics and logs, ...) and an evicted entry means a
+ * full DNS round-trip on the next reconnect. An entry is mostly its name
+ * buffer (DNS_MAX_NAME_LENGTH above), so we pay ~150B per extra slot.
+ */
+#define DNS_TABLE_SIZE 4
 /*
  * We have a HTTP server (PrusaLink). The browsers tend to keep few
  * connections at ready and take up the slots. In general it works better
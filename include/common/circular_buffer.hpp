@@ -1,5 +1,6 @@
 #pragma once
 
+#include <atomic>
 #include <cstddef>
 #include <array>
 
@@ -54,3 +55,56 @@ public:
         }
     }
 };
+
+// Single-producer single-consumer variant of CircularBuffer.
+// Lock-free: safe for handing items from an ISR (or one thread) to one
+// consuming thread without any synchronization; any other combination of
+// concurrent access is not supported.
+// Note that actual capacity is N-1.
+template <class T, size_t N>
+class SpscCircularBuffer {
+private:
+    static constexpr bool is_power_of_2(size_t n) {
+        return n && ((n & (n - 1)) == 0);
+    }
+
+    // Ensure that indices are advanced using bit operations
+    static_assert(is_power_of_2(N));
+
+    std::atomic<size_t> write_index = 0;
+    std::atomic<size_t> read_index = 0;
+    std::array<T, N> buffer;
+
+public:
+    [[nodiscard]] bool try_put(const T &item) {
+        const size_t old_write_index = write_index.load(std::memory_order_relaxed);
+        const size_t new_write_index = (old_write_index + 1) % N;
+        if (new_write_index == read_index.load(std::memory_order_acquire)) {
+            return false; // buffer is full
+        }
+        buffer[old_write_index] = item;
+        write_index.store(new_write_index, std::memory_order_release);
+        return true;
+    }
+
+    [[nodiscard]] bool try_get(T &item) {
+        const size_t old_read_index = read_index.load(std::memory_order_relaxed);
+        if (old_read_index == write_index.load(std::memory_order_acquire)) {
+            return false; // buffer is empty
+        }
+        item = buffer[old_read_index];
+        read_index.store((old_read_index + 1) % N, std::memory_order_release);
+        return true;
+    }
+
+    // Only a snapshot when producer or consumer runs concurrently
+    size_t size() const {
+        const size_t write = write_index.load(std::memory_order_acquire);
+        const size_t read = read_index.load(std::memory_order_acquire);
+        if (read > write) {
+            return N + write - read;
+        } else {
+            return write - read;
+        }
+    }
+};
@@ -63,4 +63,31 @@ static_assert(sizeof(BaseData) == BaseDataSZ, "Wrong size of BaseData");
 
 #pragma pack(pop)
 
+/// Bitmask of BaseData fields that differ between two snapshots.
+/// Bit 0 is the phase, bit 1 + i is data byte i; lets FSM consumers skip
+/// re-layout when e.g. only a progress byte ticked.
+using ChangeMask = uint8_t;
+
+inline constexpr ChangeMask phase_changed_bit = 1 << 0;
+
+constexpr ChangeMask data_changed_bit(size_t data_index) {
+    return 1 << (1 + data_index);
+}
+
+/// Phase and all data bytes, used when there is no older snapshot to diff against
+inline constexpr ChangeMask all_changed = (1 << BaseDataSZ) - 1;
+
+constexpr ChangeMask changes(const BaseData &older, const BaseData &newer) {
+    ChangeMask mask = 0;
+    if (older.GetPhase() != newer.GetPhase()) {
+        mask |= phase_changed_bit;
+    }
+    for (size_t i = 0; i < std::tuple_size_v<PhaseData>; i++) {
+        if (older.GetData()[i] != newer.GetData()[i]) {
+            mask |= data_changed_bit(i);
+        }
+    }
+    return mask;
+}
+
 }; // namespace fsm
@@ -1217,9 +1217,14 @@
 
 // The number of linear motions that can be in the plan at any give time.
 // THE BLOCK_BUFFER_SIZE NEEDS TO BE A POWER OF 2 (e.g. 8, 16, 32) because shifts and ors are used to do the ring-buffering.
-#define BLOCK_BUFFER_SIZE 32
-
-#define MOVE_SEGMENT_QUEUE_SIZE (2 * BLOCK_BUFFER_SIZE)
+// A deeper queue smooths junction planning on paths made of many short segments;
+// trapezoid recalculation only revisits blocks whose junction speeds changed, so
+// planning cost does not grow with the queue depth.
+#define BLOCK_BUFFER_SIZE 64
+
+// Kept at its former size (2 * 32): the move segment queue only needs to stay
+// ahead of the step generator, it does not benefit from the deeper planning horizon.
+#define MOVE_SEGMENT_QUEUE_SIZE 64
 #define STEP_EVENT_QUEUE_SIZE   1024
 #define ADVANCED_STEP_GENERATORS 1
 
@@ -70,6 +70,12 @@
 // For symmetric connect transfer encrypiton
 #define MBEDTLS_CIPHER_MODE_CTR
 
+// TLS session resumption (session IDs always work, this adds session tickets
+// on top). A full ECDHE handshake costs seconds of bignum math on our CPU
+// after every dropped connection; a resumed one skips the asymmetric crypto
+// entirely. See the session cache in src/connect/tls/tls.cpp.
+#define MBEDTLS_SSL_SESSION_TICKETS
+
 #define MBEDTLS_BASE64_C
 
 /*
@@ -148,9 +148,19 @@ public:
     [[nodiscard]] inline bool refresh_discrete_general_status() {
         // Preset very old value to timestamp so it passes any age check in refresh()
         DiscreteGeneralStatus.last_read_timestamp_ms = last_ticks_ms() - (std::numeric_limits<uint32_t>::max() / 2);
+        status_read_request.store(true, std::memory_order_relaxed);
         return true;
     }
 
+    /**
+     * @brief Serve a discrete status read requested by another thread.
+     * Priority lane of the puppy task: park/pick and button state requests
+     * are served ahead of the background telemetry round-robin.
+     * @return CommunicationStatus::OK on successful read and
+     *   CommunicationStatus::SKIPPED when no read was requested.
+     */
+    CommunicationStatus refresh_requested_status();
+
     bool is_picked() const;
     bool is_parked() const;
     inline bool refresh_park_pick_status() { return refresh_discrete_general_status(); }
@@ -370,7 +380,7 @@ private:
             float d {};
         } pid;
     };
-    ModbusHoldingRegisterBlock<GENERAL_WRITE_REQUEST, GeneralWrite_t> GeneralWrite;
+    ModbusHoldingRegisterBlock<GENERAL_WRITE_REQUEST, GeneralWrite_t, true> GeneralWrite;
     // Because they can be set from an interrupt.
     std::array<std::atomic<uint16_t>, NUM_FANS> fan_pwm_desired { 0, 0 };
 
@@ -449,12 +459,15 @@ private:
     // Register refresh control
     uint32_t last_update_ms = 0; ///< Last time we updated registers
     uint32_t refresh_nr = 0; ///< Switch of different refresh cases
+    std::atomic<bool> status_read_request = false; ///< Another thread asked for a discrete status refresh
     uint32_t last_pull_ms = 0; ///< Last time we pulled data from fifo
+    uint16_t last_reported_fifo_drops = 0; ///< Last dwarf-side drop counter surfaced as a metric
 
 protected:
     void decode_log(const LogData &data) final;
     void decode_loadcell(const LoadcellRecord &data) final;
     void decode_accelerometer_fast(const AccelerometerFastData &data) final;
+    void decode_fifo_stream_status(const FifoStreamStatus &data) final;
     void decode_accelerometer_freq(const AccelerometerSamplingRate &data) final;
 };
 
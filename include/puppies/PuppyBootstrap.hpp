@@ -135,14 +135,27 @@ private:
 
     /**
      * @brief Check fingerprint and if needed, flash new firmware.
+     * When firmware was flashed, the puppy is left computing its new fingerprint
+     * and the verification is deferred to verify_flashed_puppies() so the
+     * computation overlaps with bootstrapping the remaining docks.
      * @param dock check puppy in this dock
      * @param fw_fingerprints salts already given to puppies and each corresponding fingerprint
      * @param chunk_offset do initial fingerprint check only with chunk starting at offset
      * @param chunk_size do initial fingerprint check only with chunk of this size bytes
      * @param percent_offset start position of the progress trackbar
      * @param percent_span length on the progress trackbar filled with this check
+     * @return true when firmware was flashed and its verification is pending
      */
-    void flash_firmware(Dock dock, fingerprints_t &fw_fingerprints, uint8_t chunk_offset, uint8_t chunk_size, int percent_offset, int percent_span);
+    bool flash_firmware(Dock dock, fingerprints_t &fw_fingerprints, uint8_t chunk_offset, uint8_t chunk_size, int percent_offset, int percent_span);
+
+    /**
+     * @brief Verify fingerprints of puppies freshly flashed by flash_firmware().
+     * The buddy-side fingerprint calculation runs while the puppies compute theirs.
+     * @param flashed docks with flashed firmware awaiting verification
+     * @param fw_fingerprints salts already given to puppies, fingerprints are recalculated
+     * @param wait_starts per dock time of ticks_ms() when the puppy started its calculation
+     */
+    void verify_flashed_puppies(BootstrapResult flashed, fingerprints_t &fw_fingerprints, const std::array<uint32_t, DOCKS.size()> &wait_starts);
 
     /**
      * @brief Tell puppy to check fingerprint and start application.
@@ -1,5 +1,7 @@
 #pragma once
 
+#include <atomic>
+#include <cstdint>
 #include <cstdlib>
 #include <device/peripherals.h>
 
@@ -26,6 +28,22 @@ namespace puppies {
             ~LockGuard();
         };
 
+        /**
+         * @brief Marker for motion-critical bus traffic from other threads.
+         *
+         * While any instance is alive, the puppy task skips background polling
+         * at its preemption points, so the critical request does not queue up
+         * behind a chain of telemetry transactions.
+         */
+        class PriorityLane {
+        public:
+            [[nodiscard]] PriorityLane();
+            ~PriorityLane();
+        };
+
+        /// @return true while any thread holds a PriorityLane
+        static bool HasPriorityTraffic();
+
         /// Prepare puppy bus
         static void Open();
 
@@ -54,6 +72,9 @@ namespace puppies {
         /// Time when last operation was done
         static uint32_t last_operation_time_us;
 
+        /// Number of PriorityLane instances currently alive
+        static std::atomic<uint8_t> priority_traffic;
+
         /// Minimal pause that EnsurePause will enforce
         static constexpr uint32_t MINIMAL_PAUSE_BETWEEN_REQUESTS_US = 350;
     };
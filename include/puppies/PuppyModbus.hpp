@@ -62,9 +62,18 @@ struct ModbusInputRegisterBlock : ModbusRegisterBlock<ADDRESS, DATA_T>, ModbusIn
 
 /**
  * Description of holding register block data
+ *
+ * WRITE_CHANGES_ONLY keeps a shadow image of the registers as last written and
+ * narrows each write to the span of registers that actually differ, dropping
+ * no-op writes entirely. Only enable it for level-style registers where
+ * rewriting an unchanged value has no effect on the device - command-style
+ * registers need every write to reach the wire.
  */
-template <uint16_t ADDRESS, typename DATA_T>
-struct ModbusHoldingRegisterBlock : ModbusRegisterBlock<ADDRESS, DATA_T>, ModbusInputBase, ModbusOutputBase {};
+template <uint16_t ADDRESS, typename DATA_T, bool WRITE_CHANGES_ONLY = false>
+struct ModbusHoldingRegisterBlock : ModbusRegisterBlock<ADDRESS, DATA_T>, ModbusInputBase, ModbusOutputBase {
+    uint16_t shadow[sizeof(DATA_T) / sizeof(uint16_t)]; // Register image as last successfully written to the device
+    bool shadow_valid = false; // Whether shadow matches the device, false forces a full block write
+};
 
 /**
  * Description of coil data
@@ -127,13 +136,47 @@ public:
         return read_input(unit, value.registers, std::size(value.registers), ADDRESS, timing, value.last_read_timestamp_ms, max_age_ms);
     }
 
+    /// Largest register gap worth bridging in a merged read. Transferring a few
+    /// unwanted registers in between is still cheaper than a second request with
+    /// its RS485 turnaround, request frame and response header.
+    static constexpr uint16_t MAX_MERGED_READ_GAP = 8;
+
+    /**
+     * Synchronize two nearby input register blocks with a single request
+     *
+     * The blocks are fetched as one register range covering both, so the
+     * per-request overhead is paid only once. A successful read refreshes
+     * both blocks at the same time; the read is skipped only when both
+     * blocks are fresher than max_age_ms.
+     */
+    template <uint16_t ADDRESS_A, typename DATA_A, uint16_t ADDRESS_B, typename DATA_B>
+    CommunicationStatus read(uint8_t unit, ModbusInputRegisterBlock<ADDRESS_A, DATA_A> &first, ModbusInputRegisterBlock<ADDRESS_B, DATA_B> &second, uint32_t max_age_ms = 0, RequestTiming *const timing = nullptr) {
+        constexpr uint16_t first_count = sizeof(DATA_A) / sizeof(uint16_t);
+        constexpr uint16_t second_count = sizeof(DATA_B) / sizeof(uint16_t);
+        static_assert(ADDRESS_B >= ADDRESS_A + first_count, "Blocks need to be ordered by address and must not overlap");
+        static_assert(ADDRESS_B - (ADDRESS_A + first_count) <= MAX_MERGED_READ_GAP, "Bridging the gap costs more than a separate request, read the blocks individually");
+        constexpr uint16_t count = ADDRESS_B - ADDRESS_A + second_count;
+        static_assert(count < 125, "Max register read size as defined by Modbus 584-844");
+
+        uint16_t merged[count];
+        const CommunicationStatus status = read_input_merged(unit, merged, count, ADDRESS_A, timing, first.last_read_timestamp_ms, second.last_read_timestamp_ms, max_age_ms);
+        if (status == CommunicationStatus::SKIPPED) {
+            return status;
+        }
+
+        // Scatter the merged range back into the blocks (on error this propagates the invalid value fill)
+        memcpy(first.registers, merged, sizeof(first.registers));
+        memcpy(second.registers, merged + (ADDRESS_B - ADDRESS_A), sizeof(second.registers));
+        return status;
+    }
+
     /**
      * Synchronize holding register with device
      *
      * This expects holding registers to be write only. Cached data are writtent to remote holding registers.
      */
-    template <uint16_t ADDRESS, typename DATA_T>
-    CommunicationStatus read(uint8_t unit, ModbusHoldingRegisterBlock<ADDRESS, DATA_T> &value, uint32_t max_age_ms = 0) {
+    template <uint16_t ADDRESS, typename DATA_T, bool WRITE_CHANGES_ONLY>
+    CommunicationStatus read(uint8_t unit, ModbusHoldingRegisterBlock<ADDRESS, DATA_T, WRITE_CHANGES_ONLY> &value, uint32_t max_age_ms = 0) {
         return read_holding(unit, value.registers, std::size(value.registers), ADDRESS, value.last_read_timestamp_ms, max_age_ms);
     }
 
@@ -141,10 +184,36 @@ public:
      * Synchronize holding register with device
      *
      * This expects holding registers to be write only. Cached data are writtent to remote holding registers.
+     * With WRITE_CHANGES_ONLY only the span of registers differing from the shadow image goes to the wire.
      */
-    template <uint16_t ADDRESS, typename DATA_T>
-    CommunicationStatus write(uint8_t unit, ModbusHoldingRegisterBlock<ADDRESS, DATA_T> &value) {
-        return write_holding(unit, value.registers, std::size(value.registers), ADDRESS, value.dirty);
+    template <uint16_t ADDRESS, typename DATA_T, bool WRITE_CHANGES_ONLY>
+    CommunicationStatus write(uint8_t unit, ModbusHoldingRegisterBlock<ADDRESS, DATA_T, WRITE_CHANGES_ONLY> &value) {
+        if constexpr (WRITE_CHANGES_ONLY) {
+            constexpr uint16_t count = sizeof(DATA_T) / sizeof(uint16_t);
+            uint16_t first = 0;
+            uint16_t last = count - 1;
+            if (value.dirty && value.shadow_valid) {
+                while (first < count && value.registers[first] == value.shadow[first]) {
+                    first++;
+                }
+                if (first == count) {
+                    // Nothing changed since the last successful write
+                    value.dirty = false;
+                    return CommunicationStatus::SKIPPED;
+                }
+                while (value.registers[last] == value.shadow[last]) {
+                    last--;
+                }
+            }
+            const CommunicationStatus status = write_holding(unit, value.registers + first, last - first + 1, ADDRESS + first, value.dirty);
+            if (status == CommunicationStatus::OK) {
+                memcpy(value.shadow, value.registers, sizeof(value.shadow));
+                value.shadow_valid = true;
+            }
+            return status;
+        } else {
+            return write_holding(unit, value.registers, std::size(value.registers), ADDRESS, value.dirty);
+        }
     }
 
     /**
@@ -205,6 +274,7 @@ private:
     ModbusError data_callback(const ModbusDataCallbackArgs *args);
     void log_internal_error(ModbusErrorInfo error);
     CommunicationStatus read_input(uint8_t unit, uint16_t *data, uint16_t count, uint16_t address, RequestTiming *const timing, uint32_t &timestamp_ms, uint32_t max_age_ms);
+    CommunicationStatus read_input_merged(uint8_t unit, uint16_t *data, uint16_t count, uint16_t address, RequestTiming *const timing, uint32_t &first_timestamp_ms, uint32_t &second_timestamp_ms, uint32_t max_age_ms);
 
 public:
     CommunicationStatus read_holding(uint8_t unit, uint16_t *data, uint16_t count, uint16_t address, uint32_t &timestamp_ms, uint32_t max_age_ms);
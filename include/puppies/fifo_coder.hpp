@@ -30,6 +30,7 @@ enum class MessageType : uint8_t {
     loadcell = 2,
     accelerometer_fast = 4, ///< Multiple samples without timestamp
     accelerometer_sampling_rate = 5, /// Single floating point number with frequency in Hz
+    fifo_stream_status = 6, ///< Pending data and drop counters, appended as the last message of a transfer
     // ...
 };
 
@@ -55,6 +56,20 @@ typedef struct {
     float frequency;
 } AccelerometerSamplingRate;
 
+/**
+ * Stream status trailer
+ *
+ * Encoded as the last message of a transfer when it fits. Tells the receiver
+ * exactly whether more data is waiting (instead of guessing from the fill
+ * level of the transfer) and carries a running counter of samples the sender
+ * had to drop because its buffers were full. When the transfer is packed so
+ * full the trailer doesn't fit, there clearly is more data pending.
+ */
+typedef struct __attribute__((packed)) {
+    uint16_t pending_bytes; ///< Encoded bytes still waiting in the sender's buffers after this transfer
+    uint16_t dropped_samples; ///< Samples dropped due to full buffers since boot (wraps around)
+} FifoStreamStatus;
+
 // Payload to message type mapping using template specialization
 template <typename T>
 inline constexpr MessageType message_type() {
@@ -80,6 +95,11 @@ template <>
 inline constexpr MessageType message_type<AccelerometerSamplingRate>() {
     return MessageType::accelerometer_sampling_rate;
 }
+
+template <>
+inline constexpr MessageType message_type<FifoStreamStatus>() {
+    return MessageType::fifo_stream_status;
+}
 } // namespace common::puppies::fifo
 
 namespace dwarf::accelerometer {
@@ -3,6 +3,7 @@
 #include <cstdint>
 #include <cstring>
 #include <array>
+#include <optional>
 
 #include <logging/log.hpp>
 #include "fifo_coder.hpp"
@@ -27,6 +28,7 @@ public:
         virtual void decode_loadcell(const LoadcellRecord &) {}
         virtual void decode_accelerometer_fast(const AccelerometerFastData &) {}
         virtual void decode_accelerometer_freq(const AccelerometerSamplingRate &) {}
+        virtual void decode_fifo_stream_status(const FifoStreamStatus &) {}
 
     protected:
         ~Callbacks() = default;
@@ -36,7 +38,8 @@ public:
     void decode(Callbacks &callbacks);
 
     /**
-     * @brief Guess if there is more data in FIFO.
+     * @brief Tell if there is more data in FIFO.
+     * Exact when the transfer carried a stream status trailer, a guess otherwise.
      * @return true if there is
      */
     bool more() const;
@@ -45,6 +48,7 @@ private:
     std::array<uint16_t, MODBUS_FIFO_LEN> &fifo;
     uint8_t *data;
     size_t len;
+    std::optional<FifoStreamStatus> stream_status; ///< Captured by decode() when the transfer carries one
 
     template <typename T>
     bool can_get() {
@@ -9,8 +9,20 @@
 #define LIGHTMODBUS_F16M
 #define LIGHTMODBUS_F24M
 
+// modbusCRC is provided by modbus.cpp, table driven instead of the library's bitwise loop
+#define LIGHTMODBUS_CUSTOM_CRC
+
 // #define LIGHTMODBUS_DEBUG
 
 // No implementation here
 #include <lightmodbus/lightmodbus.h>
 #include <device/board.h>
+
+#include "crc16.hpp"
+
+namespace buddy::puppies {
+
+/// Modbus CRC tables kept in RAM, shared by modbusCRC() and the bootloader protocol
+extern common::puppies::crc::crc_tables_t crc_tables;
+
+} // namespace buddy::puppies
@@ -117,7 +117,7 @@ private:
     ModbusDiscreteInputBlock<GENERAL_DISCRETE_INPUTS_ADDR, GeneralStatus> general_status {};
     ModbusInputRegisterBlock<STATIC_INPUT_REGISTERS_ADDR, GeneralStatic> general_static {};
     ModbusInputRegisterBlock<BEDLET_INPUT_REGISTERS_ADDR, BedletData> bedlet_data {};
-    ModbusHoldingRegisterBlock<BEDLET_TARGET_TEMP_ADDR, uint16_t[BEDLET_COUNT]> bedlet_target_temp {};
+    ModbusHoldingRegisterBlock<BEDLET_TARGET_TEMP_ADDR, uint16_t[BEDLET_COUNT], true> bedlet_target_temp {};
     ModbusHoldingRegisterBlock<BEDLET_MEASURED_MAX_CURRENT_ADDR, uint16_t[BEDLET_COUNT]> bedlet_measured_max_current {};
     ModbusInputRegisterBlock<CURRENTS_ADDR, CurrentsData> currents {};
     ModbusDiscreteInputBlock<BEDLET_DISCRETE_INPUTS_ADDR, bool> general_ready {};
@@ -161,12 +161,11 @@ private:
     CommunicationStatus write_print_fan_active();
     CommunicationStatus read_general_status();
     CommunicationStatus read_general_ready();
-    CommunicationStatus read_currents();
     CommunicationStatus read_bedlet_data();
     CommunicationStatus read_general_fault();
     CommunicationStatus write_bedlet_target_temp();
     CommunicationStatus read_bedlet_measured_max_current();
-    CommunicationStatus read_mcu_temperature();
+    CommunicationStatus read_currents_and_mcu_temperature();
 };
 
 extern ModularBed modular_bed;
@@ -19,12 +19,32 @@ public:
     uint32_t buddy_time_us(const uint32_t puppy_time_us) const;
     bool is_time_sync_valid() const;
 
+    /**
+     * @brief Tell whether the next poll should carry a sync round.
+     *
+     * The interval between sync rounds adapts: while the drift model is still
+     * learning, every poll syncs; once consecutive rounds agree with the
+     * model, the interval doubles up to a cap, cutting the sync traffic to a
+     * fraction. A round that disagrees drops back to syncing every poll.
+     */
+    bool sync_due() const;
+
+    /// Upper bound of the time conversion error at the given time [us]
+    uint32_t accuracy_bound_us(uint32_t now_us) const;
+
 private:
     static constexpr auto ROUNDTRIP_DURATION_SAMPLES = 10;
 
     // Threshold for considering a sync roundtrip too long - inaccurate
     static constexpr auto LONG_ROUNDTRIP_THRESHOLD = 1.05;
 
+    // Bounds of the adaptive interval between sync rounds
+    static constexpr uint32_t MIN_SYNC_INTERVAL_US = 250'000;
+    static constexpr uint32_t MAX_SYNC_INTERVAL_US = 8'000'000;
+
+    // A sync round within this band around the filtered drift counts as agreeing with the model
+    static constexpr int32_t DRIFT_STABLE_BAND_PPB = 50'000;
+
     const uint8_t id;
 
     uint32_t last_sync_us;
@@ -32,11 +52,19 @@ private:
     int32_t average_drift_ppb;
     int32_t average_puppy_offset_us;
     uint32_t average_roundtrip_us;
+    uint32_t sync_interval_us; ///< Current adaptive interval between sync rounds
+
+    /// Q12 keeps sub-unit precision of the us/ppb estimates while leaving
+    /// headroom for the extreme drift values a misbehaving puppy can report
+    using Filter = FixedPointKalmanFilter<12>;
 
-    KalmanFilter drift_filter;
-    KalmanFilter offset_filter;
+    Filter drift_filter;
+    Filter offset_filter;
 
     int32_t correct_offset(const int32_t offset_us, const uint32_t now_us) const;
+
+    /// Offset change expected from the filtered drift since the last sync round [us]
+    int32_t drift_correction_us(const uint32_t now_us) const;
 };
 
 } // namespace buddy::puppies
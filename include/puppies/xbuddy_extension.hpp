@@ -146,7 +146,7 @@ private:
         // technicaly a boolean - sets the MMU port non-reset pin
         uint16_t mmu_nreset = true;
     };
-    ModbusHoldingRegisterBlock<0x9000, Requiremnt> requirement;
+    ModbusHoldingRegisterBlock<0x9000, Requiremnt, true> requirement;
 
     MODBUS_REGISTER Status {
         std::array<uint16_t, FAN_CNT> fan_rpm = { 0, 0, 0 };
@@ -8,4 +8,6 @@ using Hash = std::array<uint8_t, 32>;
 
 bool calculate_directory_hash(Hash &hash, const char *root);
 
+bool calculate_file_hash(Hash &hash, const char *filepath);
+
 } // namespace buddy::resources
@@ -1,2 +1,5 @@
 add_library(heatshrink_decoder heatshrink/heatshrink_decoder.c)
 target_include_directories(heatshrink_decoder PUBLIC heatshrink)
+
+add_library(heatshrink_encoder heatshrink/heatshrink_encoder.c)
+target_include_directories(heatshrink_encoder PUBLIC heatshrink)
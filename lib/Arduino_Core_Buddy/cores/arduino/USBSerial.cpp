@@ -1,5 +1,7 @@
 #include "USBSerial.h"
 #include "tusb.h"
+#include <algorithm>
+#include <cstring>
 #include <task.h>
 #include <timing.h>
 
@@ -11,6 +13,9 @@ void USBSerial::disable() {
     enabled = false;
     tud_cdc_write_clear();
     lineBufferUsed = 0;
+    txBufferUsed = 0;
+    rxBufferUsed = 0;
+    rxBufferPos = 0;
 }
 
 void USBSerial::write_timeout(int32_t us) {
@@ -22,12 +27,22 @@ void USBSerial::setIsWriteOnly(bool writeOnly) {
     isWriteOnly = writeOnly;
 }
 
+bool USBSerial::RxBufferRefill() {
+    if (rxBufferPos < rxBufferUsed) {
+        return true;
+    }
+
+    rxBufferPos = 0;
+    rxBufferUsed = tud_cdc_read(rxBuffer.data(), rxBuffer.size());
+    return rxBufferUsed > 0;
+}
+
 int USBSerial::available(void) {
     if (!enabled || isWriteOnly) {
         return 0;
     }
 
-    return tud_cdc_available();
+    return (rxBufferUsed - rxBufferPos) + tud_cdc_available();
 }
 
 int USBSerial::peek(void) {
@@ -35,7 +50,10 @@ int USBSerial::peek(void) {
         return 0;
     }
 
-    return tud_cdc_peek(0);
+    if (!RxBufferRefill()) {
+        return -1;
+    }
+    return rxBuffer[rxBufferPos];
 }
 
 int USBSerial::read(void) {
@@ -43,7 +61,10 @@ int USBSerial::read(void) {
         return 0;
     }
 
-    return tud_cdc_read_char();
+    if (!RxBufferRefill()) {
+        return -1;
+    }
+    return rxBuffer[rxBufferPos++];
 }
 
 size_t USBSerial::readBytes(char *buffer, size_t length) {
@@ -51,10 +72,25 @@ size_t USBSerial::readBytes(char *buffer, size_t length) {
         return 0;
     }
 
-    return tud_cdc_read(buffer, length);
+    // drain what was already chunked out of the fifo first
+    const size_t buffered = std::min<size_t>(rxBufferUsed - rxBufferPos, length);
+    if (buffered) {
+        memcpy(buffer, &rxBuffer[rxBufferPos], buffered);
+        rxBufferPos += buffered;
+    }
+    if (buffered == length) {
+        return buffered;
+    }
+
+    return buffered + tud_cdc_read(buffer + buffered, length - buffered);
 }
 
 void USBSerial::flush(void) {
+    if (enabled && txBufferUsed) {
+        cdc_write_sync(&txBuffer[0], txBufferUsed);
+    }
+    txBufferUsed = 0;
+
     if (enabled) {
         tud_cdc_write_flush();
     }
@@ -76,27 +112,24 @@ void USBSerial::LineBufferAppend(char character) {
     }
 }
 
+void USBSerial::TxBufferAppend(char character) {
+    if (txBufferUsed == txBuffer.size()) {
+        // accumulator full mid-line, hand it over in one piece and carry on
+        if (enabled) {
+            cdc_write_sync(&txBuffer[0], txBufferUsed);
+        }
+        txBufferUsed = 0;
+    }
+    txBuffer[txBufferUsed++] = character;
+}
+
 size_t USBSerial::write(uint8_t ch) {
     // its not possible to write to USB-CDC from ISR, so skip the write alltogether
     if (xPortIsInsideInterrupt()) {
         return 0;
     }
 
-    if (enabled) {
-        uint32_t ts = ticks_us();
-        while (tud_cdc_write_char(ch) != 1) {
-            // TX is full, yield to lower-priority (which usb is part of) threads until ready
-            vTaskDelay(1);
-
-            // Ensure we do not wait indefinitely
-            int32_t us_diff = ticks_diff(ticks_us(), ts);
-            if (us_diff > writeTimeoutUs) {
-                write_timeout(us_diff);
-                break;
-            }
-        }
-    }
-
+    TxBufferAppend(ch);
     LineBufferAppend(ch);
     if (ch == '\n') {
         flush();
@@ -132,26 +165,16 @@ size_t USBSerial::write(const uint8_t *buffer, size_t size) {
         return 0;
     }
 
-    size_t beg = 0;
-    size_t end = 0;
-
-    for (end = 0; end != size; ++end) {
-        uint8_t ch = buffer[end];
+    for (size_t i = 0; i != size; ++i) {
+        uint8_t ch = buffer[i];
+        TxBufferAppend(ch);
         LineBufferAppend(ch);
         if (ch == '\n') {
-            // batch the last chunk up to the current \n
-            if (enabled) {
-                cdc_write_sync(buffer + beg, end - beg + 1);
-            }
-            beg = end + 1;
+            // the accumulated line goes out as one write
             flush();
         }
     }
 
-    // complete the cdc write
-    if (enabled) {
-        cdc_write_sync(buffer + beg, end - beg);
-    }
     return size;
 }
 
@@ -10,16 +10,34 @@ private:
     bool isWriteOnly;
     std::array<uint8_t, 128> lineBuffer;
     decltype(lineBuffer)::size_type lineBufferUsed;
+    // Accumulates outgoing characters so the CDC stack is poked once per
+    // line instead of once per character. Unlike lineBuffer this one never
+    // truncates - a full buffer is drained mid-line.
+    std::array<uint8_t, 128> txBuffer;
+    decltype(txBuffer)::size_type txBufferUsed;
+    // Incoming bytes are drained from the CDC fifo in whole chunks and the
+    // per-character readers below are then served from this plain array,
+    // instead of paying the fifo critical section for every single byte.
+    std::array<uint8_t, 64> rxBuffer;
+    decltype(rxBuffer)::size_type rxBufferUsed;
+    decltype(rxBuffer)::size_type rxBufferPos;
     static constexpr int32_t writeTimeoutUs = 3'000'000;
 
     void LineBufferAppend(char character);
+    void TxBufferAppend(char character);
+    bool RxBufferRefill();
 
 public:
     USBSerial()
         : enabled(false)
         , isWriteOnly(false)
         , lineBuffer()
-        , lineBufferUsed(0) {}
+        , lineBufferUsed(0)
+        , txBuffer()
+        , txBufferUsed(0)
+        , rxBuffer()
+        , rxBufferUsed(0)
+        , rxBufferPos(0) {}
 
     void enable();
     void disable();
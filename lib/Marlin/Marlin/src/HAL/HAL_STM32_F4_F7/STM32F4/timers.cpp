@@ -26,6 +26,7 @@
 #include "timers.h"
 #include "buddy/priorities_config.h"
 #include "bsod.h"
+#include <segger/SEGGER_SYSVIEW_FreeRTOS.h>
 
 // ------------------------
 // Local defines
@@ -122,14 +123,24 @@ void HAL_timer_start(const uint8_t timer_num, const uint32_t frequency) {
   }
 }
 
+bool hal_timer_sysview_trace = false;
+
+static FORCE_INLINE void run_timer_callback(const uint8_t timer_num) {
+  // Read the switch once - the ISR must emit either both tracepoints or none.
+  const bool traced = hal_timer_sysview_trace;
+  if (traced) traceISR_ENTER();
+  ((void(*)())TimerHandle[timer_num].callback)();
+  if (traced) traceISR_EXIT();
+}
+
 extern "C" void TIM8_BRK_TIM12_IRQHandler() {
-  ((void(*)())TimerHandle[STEP_TIMER_NUM].callback)();
+  run_timer_callback(STEP_TIMER_NUM);
 }
 extern "C" void TIM7_IRQHandler() {
-  ((void(*)())TimerHandle[TEMP_TIMER_NUM].callback)();
+  run_timer_callback(TEMP_TIMER_NUM);
 }
 extern "C" void TIM6_DAC_IRQHandler() {
-  ((void(*)())TimerHandle[MOVE_TIMER_NUM].callback)();
+  run_timer_callback(MOVE_TIMER_NUM);
 }
 
 void HAL_timer_enable_interrupt(const uint8_t timer_num) {
@@ -28,3 +28,9 @@
 #else
   #include "STM32F7/timers.h"
 #endif
+
+// Runtime switch for SystemView tracing of the step/move/temp timer ISRs.
+// These fire far too often to trace unconditionally - even the "is recording
+// active" check inside the tracepoints costs cycles on every step - so a
+// capture session has to turn them on explicitly (M9170).
+extern bool hal_timer_sysview_trace;
@@ -27,7 +27,6 @@
 #include "babystep.h"
 #include "../Marlin.h"
 #include "../module/planner.h"
-#include "../module/stepper.h"
 
 #if ENABLED(BABYSTEP_ALWAYS_AVAILABLE)
   #include "../gcode/gcode.h"
@@ -41,22 +40,6 @@ volatile int16_t Babystep::steps[BS_TODO_AXIS(Z_AXIS) + 1];
 #endif
 int16_t Babystep::accum;
 
-void Babystep::step_axis(const AxisEnum axis) {
-  const int16_t curTodo = steps[BS_TODO_AXIS(axis)]; // get rid of volatile for performance
-  if (curTodo) {
-    stepper.babystep((AxisEnum)axis, curTodo > 0);
-    if (curTodo > 0) steps[BS_TODO_AXIS(axis)]--; else steps[BS_TODO_AXIS(axis)]++;
-  }
-}
-
-void Babystep::task() {
-  #if EITHER(BABYSTEP_XY, I2C_POSITION_ENCODERS)
-    LOOP_XYZ(axis) step_axis((AxisEnum)axis);
-  #else
-    step_axis(Z_AXIS);
-  #endif
-}
-
 void Babystep::add_mm(const AxisEnum axis, const float &mm) {
   add_steps(axis, mm * planner.settings.axis_steps_per_mm[axis]);
 }
@@ -39,6 +39,8 @@
 
 class Babystep {
 public:
+  // Pending steps, drained by the step ISR which folds them into the
+  // generated step stream (see PreciseStepping).
   static volatile int16_t steps[BS_TODO_AXIS(Z_AXIS) + 1];
   static int16_t accum;                                     // Total babysteps in current edit
 
@@ -55,9 +57,6 @@ public:
 
   static void add_steps(const AxisEnum axis, const int16_t distance);
   static void add_mm(const AxisEnum axis, const float &mm);
-  static void task();
-private:
-  static void step_axis(const AxisEnum axis);
 };
 
 extern Babystep babystep;
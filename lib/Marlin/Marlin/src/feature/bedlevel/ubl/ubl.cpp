@@ -72,6 +72,8 @@
 
   volatile int unified_bed_leveling::encoder_diff;
 
+  unified_bed_leveling::z_correction_cache_t unified_bed_leveling::z_correction_cache;
+
   unified_bed_leveling::unified_bed_leveling() {
     reset();
   }
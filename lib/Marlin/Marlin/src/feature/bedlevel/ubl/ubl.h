@@ -121,6 +121,23 @@ class unified_bed_leveling {
 
     static volatile int encoder_diff; // Volatile because it's changed at interrupt time.
 
+    /**
+     * Last-cell cache for get_z_correction(). Successive per-segment
+     * corrections overwhelmingly land in the same mesh cell, so the plane
+     * coefficients are precomputed once per cell and reused while the cell
+     * and its corner values stay the same. Mesh edits write z_values[][]
+     * directly from many places, so staleness is detected by comparing the
+     * corners on each call instead of relying on invalidation hooks.
+     */
+    struct z_correction_cache_t {
+      int8_t cx = -1, cy = -1;          // mesh cell of the cached coefficients
+      float x0, y0;                     // mesh position of the cell origin
+      float z_x0y0, z_x1y0;             // corner values the coefficients were built from
+      float z_x0y1, z_x1y1;
+      float z_xmy0, z_xmy1;             // z slope per x along y0 and y1
+    };
+    static z_correction_cache_t z_correction_cache;
+
     /// Tracked on probe_major_points. You have to reset it yourself before the procedure
     static std::optional<std::pair<float, float>> g29_min_max_measured_z;
 
@@ -278,17 +295,31 @@ class unified_bed_leveling {
           return UBL_Z_RAISE_WHEN_OFF_MESH;
       #endif
 
-      const float z1 = calc_z0(irx0,
-                               mesh_index_to_xpos(cx), z_values[cx][cy],
-                               mesh_index_to_xpos(cx + 1), z_values[cap_cell_index_x(cx + 1)][cy]);
+      const int8_t cx1 = cap_cell_index_x(cx + 1), cy1 = cap_cell_index_y(cy + 1);
+      const float z_x0y0 = z_values[cx][cy], z_x1y0 = z_values[cx1][cy],
+                  z_x0y1 = z_values[cx][cy1], z_x1y1 = z_values[cx1][cy1];
+
+      // Rebuild the plane coefficients only when leaving the cached cell or
+      // when a corner changed underneath us. NAN corners never compare equal,
+      // so meshes with undefined points just fall back to rebuilding.
+      z_correction_cache_t &cache = z_correction_cache;
+      if (cx != cache.cx || cy != cache.cy
+          || z_x0y0 != cache.z_x0y0 || z_x1y0 != cache.z_x1y0
+          || z_x0y1 != cache.z_x0y1 || z_x1y1 != cache.z_x1y1) {
+        cache.cx = cx; cache.cy = cy;
+        cache.x0 = mesh_index_to_xpos(cx);
+        cache.y0 = mesh_index_to_ypos(cy);
+        cache.z_x0y0 = z_x0y0; cache.z_x1y0 = z_x1y0;
+        cache.z_x0y1 = z_x0y1; cache.z_x1y1 = z_x1y1;
+        cache.z_xmy0 = (z_x1y0 - z_x0y0) * RECIPROCAL(MESH_X_DIST);
+        cache.z_xmy1 = (z_x1y1 - z_x0y1) * RECIPROCAL(MESH_X_DIST);
+      }
 
-      const float z2 = calc_z0(irx0,
-                               mesh_index_to_xpos(cx), z_values[cx][cap_cell_index_y(cy + 1)],
-                               mesh_index_to_xpos(cx + 1), z_values[cap_cell_index_x(cx + 1)][cap_cell_index_y(cy + 1)]);
+      const float cell_x = irx0 - cache.x0,
+                  z1 = z_x0y0 + cache.z_xmy0 * cell_x,       // z height along y0 at cell_x
+                  z2 = z_x0y1 + cache.z_xmy1 * cell_x;       // z height along y1 at cell_x
 
-      float z0 = calc_z0(iry0,
-                         mesh_index_to_ypos(cy), z1,
-                         mesh_index_to_ypos(cy + 1), z2);
+      float z0 = z1 + (z2 - z1) * ((iry0 - cache.y0) * RECIPROCAL(MESH_Y_DIST));
 
       if (DEBUGGING(MESH_ADJUST)) {
         DEBUG_ECHOPAIR(" raw get_z_correction(", rx0);
@@ -66,8 +66,29 @@ static input_shaper_pulses_t get_input_shaper(const input_shaper::Type input_sha
     }
 }
 
+/// Computed pulse sets cached per parameter set.
+/// Profile switches via M593 cycle through a handful of per-material/speed-mode
+/// configurations mid-print; on a cache hit the switch just copies the stored
+/// pulses instead of recomputing them in the motion-critical window.
+struct PulsesCacheEntry {
+    AxisConfig config;
+    input_shaper_pulses_t pulses;
+};
+static std::array<std::optional<PulsesCacheEntry>, 8> pulses_cache;
+static uint8_t pulses_cache_next_slot = 0;
+
 static input_shaper_pulses_t get_input_shaper(const AxisConfig &c) {
-    return get_input_shaper(c.type, c.frequency, c.damping_ratio, c.vibration_reduction);
+    for (const auto &entry : pulses_cache) {
+        if (entry && entry->config == c) {
+            return entry->pulses;
+        }
+    }
+    const input_shaper_pulses_t pulses = get_input_shaper(c.type, c.frequency, c.damping_ratio, c.vibration_reduction);
+
+    // Replace the oldest entry
+    pulses_cache[pulses_cache_next_slot] = PulsesCacheEntry { c, pulses };
+    pulses_cache_next_slot = (pulses_cache_next_slot + 1) % pulses_cache.size();
+    return pulses;
 }
 
 #ifdef COREXY
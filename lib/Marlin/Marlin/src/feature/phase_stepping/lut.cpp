@@ -13,7 +13,12 @@ using namespace phase_stepping::opts;
 
 // Module definitions
 
-static const auto sin_lut_values = []() {
+// The table holds just the first quadrant as uint8 - the remaining three are
+// reconstructed by reflection in sin_lut(). It is built at startup into CCM
+// (the section is NOLOAD, so a runtime initializer is required anyway): the
+// stepper ISR hits this table on every current refresh and the core reaches
+// CCM in a single cycle without contending with DMA on the main SRAM.
+static __attribute__((section(".ccmram"))) const auto sin_lut_values = []() {
     // Build 1/4 of sin period
     static constexpr int QUARTER = SIN_PERIOD / 4;
     std::array<uint8_t, QUARTER + 1> values;
@@ -21,8 +21,10 @@
 
 #include <Pin.hpp>
 #include <logging/log.hpp>
+#include "metric.h"
 
 #include <cassert>
+#include <cinttypes>
 #include <cmath>
 
 #include <timing_precise.hpp>
@@ -34,7 +36,13 @@ using namespace phase_stepping::opts;
 using namespace buddy::hw;
 
 // Global definitions
-std::array<AxisState, SUPPORTED_AXIS_COUNT> phase_stepping::axis_states = { X_AXIS, Y_AXIS };
+//
+// The axis states carry the per-direction current LUTs: a 1 KiB phase-shift
+// image per direction, expanded from the 16-harmonic correction spectrum when
+// a correction is loaded or modified. Keeping them in CCM gives the refresh
+// ISR single-cycle, DMA-contention-free access to the tables it walks on
+// every tick; nothing in here is accessed by DMA.
+std::array<AxisState, SUPPORTED_AXIS_COUNT> __attribute__((section(".ccmram"))) phase_stepping::axis_states = { X_AXIS, Y_AXIS };
 static bool initialized = false;
 
 // Module definitions
@@ -741,6 +749,29 @@ static FORCE_INLINE FORCE_OFAST void refresh_axis(
     axis_state.last_timer_tick = last_timer_tick;
 }
 
+// ISR cycle budget accounting: aggregated over a window of refreshes so that
+// the report costs the ISR a few additions, not a metric call per tick. The
+// cycle counter is enabled at boot in main().
+METRIC_DEF(metric_phstep_isr, "phstep_isr", METRIC_VALUE_CUSTOM, 0, METRIC_DISABLED);
+static constexpr uint32_t ISR_REPORT_PERIOD = 4096; // ~0.1 s at 40 kHz
+static uint32_t isr_cycles_acc = 0;
+static uint32_t isr_cycles_max = 0;
+static uint32_t isr_cycles_cnt = 0;
+
+static FORCE_INLINE void account_isr_cycles(uint32_t cycles) {
+    isr_cycles_acc += cycles;
+    if (cycles > isr_cycles_max) {
+        isr_cycles_max = cycles;
+    }
+    if (++isr_cycles_cnt == ISR_REPORT_PERIOD) {
+        metric_record_custom(&metric_phstep_isr, " a=%" PRIu32 "i,m=%" PRIu32 "i",
+            isr_cycles_acc / ISR_REPORT_PERIOD, isr_cycles_max);
+        isr_cycles_acc = 0;
+        isr_cycles_max = 0;
+        isr_cycles_cnt = 0;
+    }
+}
+
 FORCE_OFAST void phase_stepping::handle_periodic_refresh() {
     // This routine is extremely time sensitive and it should be as fast as
     // possible.
@@ -753,6 +784,7 @@ FORCE_OFAST void phase_stepping::handle_periodic_refresh() {
     // - post to phase: 1.3 µs
     // - current lookup: 800 ns
     // - Quick transmission: 900ns (time from call to first bit) + 1µs transaction termination
+    const uint32_t cycles_start = DWT->CYCCNT;
     uint32_t now = ticks_us() + REFRESH_PERIOD_US;
 
     // always refresh the last_timer_tick
@@ -780,6 +812,8 @@ FORCE_OFAST void phase_stepping::handle_periodic_refresh() {
         refresh_axis(axis_states[axis_num_to_refresh], now, old_tick);
     }
 #endif
+
+    account_isr_cycles(DWT->CYCCNT - cycles_start);
 }
 
 bool phase_stepping::any_axis_enabled() {
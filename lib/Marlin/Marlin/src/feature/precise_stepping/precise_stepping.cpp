@@ -16,6 +16,9 @@
 #include "../../module/endstops.h"
 
 #include "bsod.h"
+#include "metric.h"
+
+#include <cinttypes>
 
 #include <timing_precise.hpp>
 #include <timing.h>
@@ -27,6 +30,10 @@ LOG_COMPONENT_DEF(PreciseStepping, logging::Severity::debug);
     #include <sound.hpp>
 #endif
 
+#if ENABLED(BABYSTEPPING)
+    #include "../babystep.h"
+#endif
+
 move_segment_queue_t PreciseStepping::move_segment_queue;
 step_event_queue_t PreciseStepping::step_event_queue;
 
@@ -54,6 +61,7 @@ volatile uint8_t PreciseStepping::step_ev_miss = 0;
 
 #if !BOARD_IS_DWARF()
 std::atomic<uint32_t> PreciseStepping::stall_count = 0;
+step_isr_cycle_stats_t PreciseStepping::step_isr_cycle_stats;
 #endif
 
 FORCE_INLINE xyze_long_t get_oriented_msteps_from_block(const block_t &block) {
@@ -485,10 +493,76 @@ HAL_MOVE_TIMER_ISR() {
     HAL_timer_isr_epilogue(MOVE_TIMER_NUM);
 }
 
+#if !BOARD_IS_DWARF()
+// Always-on cycle accounting of the step ISR: windowed min/avg/max plus a
+// coarse log2 histogram are cheap enough to keep enabled in production and
+// let us correlate ISR headroom with the enabled feature set.
+METRIC_DEF(metric_step_isr, "step_isr", METRIC_VALUE_CUSTOM, 0, METRIC_ENABLED);
+METRIC_DEF(metric_step_isr_hist, "step_isrh", METRIC_VALUE_CUSTOM, 0, METRIC_DISABLED);
+
+static constexpr uint32_t STEP_ISR_REPORT_PERIOD = 4096; // ISR runs per reporting window
+
+static FORCE_INLINE void account_step_isr_cycles(const uint32_t cycles) {
+    static uint32_t cycles_acc = 0;
+    static uint32_t cycles_min = UINT32_MAX;
+    static uint32_t cycles_max = 0;
+    static uint32_t count = 0;
+    static uint32_t histogram[step_isr_cycle_stats_t::HISTOGRAM_SIZE] = {};
+
+    cycles_acc += cycles;
+    if (cycles < cycles_min) {
+        cycles_min = cycles;
+    }
+    if (cycles > cycles_max) {
+        cycles_max = cycles;
+    }
+
+    // log2 bucket: everything below 64 cycles lands in bucket 0, then one bucket per power of two
+    uint32_t bucket = 0;
+    if (cycles >= 64) {
+        bucket = 26u - uint32_t(__builtin_clz(cycles));
+        if (bucket >= step_isr_cycle_stats_t::HISTOGRAM_SIZE) {
+            bucket = step_isr_cycle_stats_t::HISTOGRAM_SIZE - 1;
+        }
+    }
+    ++histogram[bucket];
+
+    if (++count < STEP_ISR_REPORT_PERIOD) {
+        return;
+    }
+
+    // Close the window: publish the snapshot for the debug screen and record the metrics
+    step_isr_cycle_stats_t &stats = PreciseStepping::step_isr_cycle_stats;
+    stats.count = count;
+    stats.min_cycles = cycles_min;
+    stats.avg_cycles = cycles_acc / count;
+    stats.max_cycles = cycles_max;
+    metric_record_custom(&metric_step_isr, " mi=%" PRIu32 "i,a=%" PRIu32 "i,mx=%" PRIu32 "i",
+        stats.min_cycles, stats.avg_cycles, stats.max_cycles);
+    for (size_t i = 0; i != step_isr_cycle_stats_t::HISTOGRAM_SIZE; ++i) {
+        stats.histogram[i] = histogram[i];
+        metric_record_custom(&metric_step_isr_hist, ",b=%u v=%" PRIu32 "i", unsigned(i), histogram[i]);
+        histogram[i] = 0;
+    }
+
+    cycles_acc = 0;
+    cycles_min = UINT32_MAX;
+    cycles_max = 0;
+    count = 0;
+}
+#endif
+
 HAL_STEP_TIMER_ISR() {
     if (__HAL_TIM_GET_FLAG(&TimerHandle[STEP_TIMER_NUM].handle, TIM_FLAG_CC1) != RESET) {
         __HAL_TIM_CLEAR_IT(&TimerHandle[STEP_TIMER_NUM].handle, TIM_IT_CC1);
+#if !BOARD_IS_DWARF()
+        // DWT is running since boot; integer-only accounting as the ISR must not touch the FPU
+        const uint32_t cycles_start = DWT->CYCCNT;
         PreciseStepping::step_isr();
+        account_step_isr_cycles(DWT->CYCCNT - cycles_start);
+#else
+        PreciseStepping::step_isr();
+#endif
 
 #if (__FPU_PRESENT == 1) && (__FPU_USED == 1)
         // ensure FPU wasn't accidentally used in this ISR for performance reasons
@@ -608,6 +682,44 @@ void update_step_generator_state_current_flags() {
     }
 }
 
+#if ENABLED(BABYSTEPPING)
+// Fold pending babysteps into the generated step stream: drain at most one
+// step per ISR invocation, inserted between the regular queue events. This
+// keeps live-adjust-Z entirely inside the step generation layer - no planner
+// interaction and no interrupt-blocking pin banging from the temperature ISR.
+//
+// Only Z is handled: BABYSTEP_XY is not enabled on any printer and Z maps to
+// a plain motor on CoreXY as well. A babystep is an offset outside the
+// logical coordinate space, so the step counters are deliberately left
+// untouched, same as the old Stepper::babystep().
+FORCE_INLINE static void insert_pending_babystep() {
+    const int16_t todo = Babystep::steps[BS_TODO_AXIS(Z_AXIS)];
+    if (!todo)
+        return;
+
+    const bool forward = todo > 0;
+    Babystep::steps[BS_TODO_AXIS(Z_AXIS)] = todo + (forward ? -1 : 1);
+
+    if (phase_stepping::is_enabled(Z_AXIS))
+        return; // can't inject classic pulses under phase stepping
+
+    // Record the direction in last_direction_bits so the next queued Z move
+    // re-applies its own direction when it differs.
+    constexpr uint8_t z_dir_bit = _BV(Z_AXIS);
+    const uint8_t new_dir_bits = (Stepper::last_direction_bits & ~z_dir_bit)
+        | ((forward != bool(BABYSTEP_INVERT_Z)) ? 0 : z_dir_bit);
+
+    if (new_dir_bits != Stepper::last_direction_bits) {
+        Stepper::last_direction_bits = new_dir_bits;
+        Z_APPLY_DIR(((StepEventFlag_t(new_dir_bits) << STEP_EVENT_FLAG_DIR_SHIFT) ^ PreciseStepping::inverted_dirs) & STEP_EVENT_FLAG_Z_DIR);
+        Stepper::count_direction.z = (new_dir_bits & z_dir_bit) ? -1 : 1;
+    }
+
+    Z_STEP_SET();
+    Z_STEP_RESET();
+}
+#endif // BABYSTEPPING
+
 uint16_t PreciseStepping::process_one_step_event_from_queue() {
     // If no queued step event, just wait some time for the next move.
     uint16_t ticks_to_next_isr = STEPPER_ISR_PERIOD_IN_TICKS;
@@ -729,6 +841,12 @@ void PreciseStepping::step_isr() {
     }
 #endif
 
+#if ENABLED(BABYSTEPPING)
+    if (!stop_pending) {
+        insert_pending_babystep();
+    }
+#endif
+
     const uint32_t compare = __HAL_TIM_GET_COMPARE(&TimerHandle[STEP_TIMER_NUM].handle, TIM_CHANNEL_1);
 
     uint32_t next = 0;
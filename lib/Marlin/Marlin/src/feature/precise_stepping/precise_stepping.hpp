@@ -68,6 +68,23 @@ static_assert(MoveFlag::MOVE_FLAG_Y_ACTIVE == (MoveFlag)PreciseSteppingFlag::PRE
 static_assert(MoveFlag::MOVE_FLAG_Z_ACTIVE == (MoveFlag)PreciseSteppingFlag::PRECISE_STEPPING_FLAG_Z_USED);
 static_assert(MoveFlag::MOVE_FLAG_E_ACTIVE == (MoveFlag)PreciseSteppingFlag::PRECISE_STEPPING_FLAG_E_USED);
 
+#if !BOARD_IS_DWARF()
+// Aggregated execution times of the step ISR in CPU cycles over one reporting
+// window. Filled by the ISR, consumed by the metric handler and the step ISR
+// info debug screen.
+struct step_isr_cycle_stats_t {
+    // Bucket 0 counts ISR runs shorter than 64 cycles, every following bucket
+    // doubles the range and the last one is open-ended.
+    static constexpr size_t HISTOGRAM_SIZE = 8;
+
+    uint32_t count = 0; // number of ISR runs aggregated in the window
+    uint32_t min_cycles = 0;
+    uint32_t avg_cycles = 0;
+    uint32_t max_cycles = 0;
+    uint32_t histogram[HISTOGRAM_SIZE] = {};
+};
+#endif
+
 class PreciseStepping {
 
 public:
@@ -108,6 +125,12 @@ public:
     /// The idea is that the "subscriber" compares the value to the previous value it has seen and if they differ, the planner has stalled during the time
     /// This doesn't even have to be volatile, even though we're accessing from other threads, as we're only checking for difference and it's only informative.
     static std::atomic<uint32_t> stall_count;
+
+    /// Cycle statistics of the last completed step ISR reporting window.
+    /// Updated in place by the ISR when a window closes; a reader may very
+    /// rarely see a mix of two consecutive windows, which is acceptable for
+    /// the informative consumers (metrics, debug screen).
+    static step_isr_cycle_stats_t step_isr_cycle_stats;
 #endif
 
     PreciseStepping() = default;
@@ -23,6 +23,7 @@
 #include <numbers>
 #include <limits>
 #include <bit>
+#include <vector>
 #include <utility_extensions.hpp>
 #include <marlin_server.hpp>
 
@@ -148,29 +149,27 @@ private:
     float m_step_us_fraction;
 };
 
-template <size_t max_samples>
-class FixedLengthSpectrum final : public Spectrum {
+class DynamicSpectrum final : public Spectrum {
 public:
-    FixedLengthSpectrum(float start_frequency, float frequency_step)
-        : m_gain()
-        , m_start_frequency(start_frequency)
-        , m_frequency_step(frequency_step)
-        , m_size(0) {}
+    DynamicSpectrum(float start_frequency, float frequency_step, size_t point_count)
+        : m_start_frequency(start_frequency)
+        , m_frequency_step(frequency_step) {
+        m_gain.reserve(point_count);
+    }
 
-    constexpr size_t max_size() const { return max_samples; }
+    size_t max_size() const { return m_gain.capacity(); }
 
-    size_t size() const final { return m_size; }
+    size_t size() const final { return m_gain.size(); }
 
     void put(float gain) {
-        if (m_size >= max_samples) {
+        if (m_gain.size() >= m_gain.capacity()) {
             return;
         }
-        m_gain[m_size] = gain;
-        ++m_size;
+        m_gain.push_back(gain);
     }
     FrequencyGain get(size_t index) const final {
         FrequencyGain retval = { 0.f, 0.f };
-        if (index < m_size) {
+        if (index < m_gain.size()) {
             retval.frequency = m_start_frequency + index * m_frequency_step;
             retval.gain = m_gain[index];
         }
@@ -178,19 +177,18 @@ public:
     }
     float max() const final {
         float maximum = std::numeric_limits<float>::min();
-        for (size_t i = 0; i < m_size; ++i) {
-            if (m_gain[i] > maximum) {
-                maximum = m_gain[i];
+        for (const float gain : m_gain) {
+            if (gain > maximum) {
+                maximum = gain;
             }
         }
         return maximum;
     }
 
 private:
-    float m_gain[max_samples];
+    std::vector<float> m_gain;
     float m_start_frequency;
     float m_frequency_step;
-    size_t m_size;
 };
 } // anonymous namespace
 
@@ -1232,8 +1230,13 @@ input_shaper::AxisConfig find_best_shaper(const FindBestShaperProgressHook &prog
  */
 static void klipper_tune(VibrateMeasureParams &args, VibrateMeasureRange range, bool subtract_excitation) {
     // Power spectrum density
-    FixedLengthSpectrum<146> psd(range.start_frequency, range.frequency_increment);
-    range.end_frequency = limit_end_frequency(range.start_frequency, range.end_frequency, range.frequency_increment, psd.max_size());
+    // Sized to the requested sweep, so a finer frequency step no longer
+    // truncates the sweep range; the cap only guards against runaway
+    // parameters as each point costs one excitation measurement.
+    static constexpr size_t max_sweep_points = 1024;
+    range.end_frequency = limit_end_frequency(range.start_frequency, range.end_frequency, range.frequency_increment, max_sweep_points);
+    const size_t sweep_points = (range.end_frequency - range.start_frequency + epsilon) / range.frequency_increment + 1;
+    DynamicSpectrum psd(range.start_frequency, range.frequency_increment, sweep_points);
     const AxisEnum logicalAxis = get_logical_axis(args.axis_flag);
     if (logicalAxis == NO_AXIS_ENUM) {
         SERIAL_ECHOLN("error: not moving along one logical axis");
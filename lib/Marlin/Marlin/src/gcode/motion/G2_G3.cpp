@@ -255,6 +255,13 @@ void plan_arc(
 
   xyze_pos_t raw;
 
+  #if HAS_LEVELING && !PLANNER_LEVELING
+    // The arc is submitted as a batch of short segments sharing state: carry
+    // the mesh-cell interpolation cache across them so the leveling setup is
+    // amortized over the whole batch instead of redone per segment
+    Planner::leveling_cache_t leveling_cache;
+  #endif
+
   // do not calculate rotation parameters for trivial single-segment arcs
   if (segments > 1) {
     // Vector rotation matrix values
@@ -352,7 +359,7 @@ void plan_arc(
       apply_motion_limits(raw);
 
       #if HAS_LEVELING && !PLANNER_LEVELING
-        planner.apply_leveling(raw);
+        planner.apply_leveling(raw, leveling_cache);
       #endif
 
       #if ENABLED(HINTS_SAFE_EXIT_SPEED)
@@ -374,7 +381,7 @@ void plan_arc(
   apply_motion_limits(raw);
 
   #if HAS_LEVELING && !PLANNER_LEVELING
-    planner.apply_leveling(raw);
+    planner.apply_leveling(raw, leveling_cache);
   #endif
 
   hints.curve_radius = 0;
@@ -198,8 +198,9 @@ bool GCodeQueue::process_injected_command() {
       // Empty inject_queue -> continue parsing standard G-Code queue
       return false;
     } else {
-      // Inject G-Code is not ready yet (buffering from file)
-      // or loading error occurred, in both cases skip standard G-Code queue
+      // Direct callback record already executed, inject G-Code is not ready
+      // yet (buffering from file) or loading error occurred; in all cases
+      // skip standard G-Code queue
       return true;
     }
   }
@@ -232,10 +233,10 @@ bool GCodeQueue::process_injected_command() {
 void GCodeQueue::inject_P(ConstexprString pgcode) { inject(GCodeLiteral(pgcode)); }
 
 /**
- * Enqueue action to inject_queue, if inject_queue isn't already full
+ * Enqueue action to inject_queue, if its priority lane isn't already full
  */
-bool GCodeQueue::inject(InjectQueueRecord request) { 
-  return inject_queue.try_push(request);
+bool GCodeQueue::inject(InjectQueueRecord request, InjectPriority priority) {
+  return inject_queue.try_push(request, priority);
 }
 
 /**
@@ -93,10 +93,11 @@ public:
   static void inject_P(ConstexprString pgcode);
 
   /**
-   * Enqueue action to inject_queue, if inject_queue isn't already full
+   * Enqueue action to inject_queue, if its priority lane isn't already full
    * @param record [in] record variant
+   * @param priority [in] priority class the record is queued under
    */
-  static bool inject(InjectQueueRecord record);
+  static bool inject(InjectQueueRecord record, InjectPriority priority = InjectPriority::background);
 
   /**
    * Enqueue and return only when commands are actually enqueued
@@ -66,6 +66,7 @@
  */
 
 #include "planner.h"
+#include "planner_jerk.h"
 #include "stepper.h"
 #include "motion.h"
 #include "temperature.h"
@@ -671,32 +672,40 @@ void Planner::recalculate_trapezoids(TERN_(HINTS_SAFE_EXIT_SPEED, const_float_t
   }
 
   // Go from the tail (currently executed block) to the first block, without including it)
+  // Entry speed square roots are computed lazily: blocks whose junction speeds did not
+  // change are only visited for their flag check, so a deeper queue does not make this
+  // scan proportionally more expensive.
   block_t *block = nullptr, *next = nullptr;
   float current_entry_speed = 0.0f, next_entry_speed = 0.0f;
+  bool entry_speed_valid = false; // current_entry_speed holds SQRT of the current block entry speed
   while (block_index != head_block_index) {
 
     next = &block_buffer[block_index];
 
     // Only process movement blocks
     if (next->is_move()) {
-      next_entry_speed = SQRT(next->entry_speed_sqr);
 
-      if (block) {
+      // Recalculate if current block entry or exit junction speed has changed.
+      if (block && block->flag.recalculate) {
+        if (!entry_speed_valid)
+          current_entry_speed = SQRT(block->entry_speed_sqr);
+        next_entry_speed = SQRT(next->entry_speed_sqr);
 
-        // Recalculate if current block entry or exit junction speed has changed.
-        if (block->flag.recalculate) {
+        // NOTE: Entry and exit factors always > 0 by all previous logic operations.
+        calculate_trapezoid_for_block(block, current_entry_speed, next_entry_speed);
 
-          // NOTE: Entry and exit factors always > 0 by all previous logic operations.
-          calculate_trapezoid_for_block(block, current_entry_speed, next_entry_speed);
+        // Reset current only to ensure next trapezoid is computed - The
+        // stepper is free to use the block from now on.
+        block->flag.recalculate = false;
 
-          // Reset current only to ensure next trapezoid is computed - The
-          // stepper is free to use the block from now on.
-          block->flag.recalculate = false;
-        }
+        // The exit speed of this block is the entry speed of the next one
+        current_entry_speed = next_entry_speed;
+        entry_speed_valid = true;
       }
+      else
+        entry_speed_valid = false;
 
       block = next;
-      current_entry_speed = next_entry_speed;
     }
 
     block_index = next_block_index(block_index);
@@ -704,6 +713,9 @@ void Planner::recalculate_trapezoids(TERN_(HINTS_SAFE_EXIT_SPEED, const_float_t
 
   // Last/newest block in buffer. Always recalculated.
   if (block) {
+    if (!entry_speed_valid)
+      current_entry_speed = SQRT(block->entry_speed_sqr);
+
     // Exit speed is set with MINIMUM_PLANNER_SPEED unless some code higher up knows better.
     next_entry_speed = _MAX(TERN0(HINTS_SAFE_EXIT_SPEED, SQRT(safe_exit_speed_sqr)), float(MINIMUM_PLANNER_SPEED));
 
@@ -976,6 +988,67 @@ void Planner::check_axes_activity() {
     #endif
   }
 
+  void Planner::apply_leveling(xyz_pos_t &raw, leveling_cache_t &cache) {
+    #if ENABLED(AUTO_BED_LEVELING_UBL)
+
+      if (!leveling_active) return;
+
+      #if ENABLED(ENABLE_LEVELING_FADE_HEIGHT)
+        const float fade_scaling_factor = fade_scaling_factor_for_z(raw.z);
+        if (!fade_scaling_factor) return;
+      #else
+        constexpr float fade_scaling_factor = 1.0;
+      #endif
+
+      // Same clamping as ubl.get_z_correction(): consider the non-meshed area flat
+      const float irx0 = constrain(raw.x, MESH_MIN_X, MESH_MAX_X);
+      const float iry0 = constrain(raw.y, MESH_MIN_Y, MESH_MAX_Y);
+
+      #ifdef UBL_Z_RAISE_WHEN_OFF_MESH
+        if (!WITHIN(raw.x, MESH_MIN_X, MESH_MAX_X) || !WITHIN(raw.y, MESH_MIN_Y, MESH_MAX_Y)) {
+          raw.z += fade_scaling_factor * (UBL_Z_RAISE_WHEN_OFF_MESH);
+          return;
+        }
+      #endif
+
+      const int8_t cx = unified_bed_leveling::cell_index_x(irx0),
+                   cy = unified_bed_leveling::cell_index_y(iry0);
+
+      if (cx != cache.cx || cy != cache.cy) {
+        // Entered a new mesh cell: cache its bilinear patch coefficients
+        const int8_t cx1 = unified_bed_leveling::cap_cell_index_x(cx + 1),
+                     cy1 = unified_bed_leveling::cap_cell_index_y(cy + 1);
+        cache.cx = cx;
+        cache.cy = cy;
+        cache.x0 = unified_bed_leveling::mesh_index_to_xpos(cx);
+        cache.y0 = unified_bed_leveling::mesh_index_to_ypos(cy);
+        cache.z00 = unified_bed_leveling::z_values[cx][cy];
+        cache.zx0 = unified_bed_leveling::z_values[cx1][cy] - cache.z00;
+        cache.z01 = unified_bed_leveling::z_values[cx][cy1];
+        cache.zx1 = unified_bed_leveling::z_values[cx1][cy1] - cache.z01;
+      }
+
+      // Interpolate within the cached cell; no per-segment divisions, the mesh
+      // spacing reciprocals are compile-time constants
+      const float tx = (irx0 - cache.x0) * RECIPROCAL(MESH_X_DIST),
+                  ty = (iry0 - cache.y0) * RECIPROCAL(MESH_Y_DIST),
+                  z1 = cache.z00 + cache.zx0 * tx,
+                  z2 = cache.z01 + cache.zx1 * tx,
+                  z0 = z1 + (z2 - z1) * ty;
+
+      // Undefined mesh points show up as NAN: throw the correction out, just
+      // like ubl.get_z_correction() does
+      if (!isnan(z0)) raw.z += fade_scaling_factor * z0;
+
+    #else
+
+      // The other mesh types have no per-cell setup worth caching
+      UNUSED(cache);
+      apply_leveling(raw);
+
+    #endif
+  }
+
   void Planner::unapply_leveling(xyz_pos_t &raw) {
 
     if (leveling_active) {
@@ -1910,85 +1983,27 @@ bool Planner::_populate_block(block_t * const block,
 
   #if HAS_CLASSIC_JERK
 
-    /**
-     * Adapted from Průša MKS firmware
-     * https://github.com/prusa3d/Prusa-Firmware
-     */
     // Exit speed limited by a jerk to full halt of a previous last segment
     static float previous_safe_speed;
 
-    // Start with a safe speed (from which the machine may halt to stop immediately).
-    float safe_speed = block->nominal_speed;
-
-    uint8_t limited = 0;
+    // The kernel is specialized at compile time on the number of jerk-limited
+    // axes: with linear E jerk the E axis is governed by LIN_ADVANCE instead.
     #if HAS_LINEAR_E_JERK
-      LOOP_XYZ(i)
+      constexpr int num_jerk_axes = XYZ;
     #else
-      LOOP_XYZE(i)
+      constexpr int num_jerk_axes = XYZE;
     #endif
-    {
-      const float jerk = ABS(current_speed[i]),   // cs : Starting from zero, change in speed for this axis
-                  maxj = settings.max_jerk[i];             // mj : The max jerk setting for this axis
-      if (jerk > maxj) {                          // cs > mj : New current speed too fast?
-        if (limited) {                            // limited already?
-          const float mjerk = block->nominal_speed * maxj; // ns*mj
-          if (jerk * safe_speed > mjerk) safe_speed = mjerk / jerk; // ns*mj/cs
-        }
-        else {
-          safe_speed *= maxj / jerk;              // Initial limit: ns*mj/cs
-          ++limited;                              // Initially limited
-        }
-      }
-    }
+
+    // Start with a safe speed (from which the machine may halt to stop immediately).
+    const float safe_speed = classic_jerk::safe_halt_speed<num_jerk_axes>(block->nominal_speed, current_speed, settings.max_jerk);
 
     float vmax_junction;
     if (moves_queued && !UNEAR_ZERO(previous_nominal_speed)) {
       // Estimate a maximum velocity allowed at a joint of two successive segments.
-      // If this maximum velocity allowed is lower than the minimum of the entry / exit safe velocities,
-      // then the machine is not coasting anymore and the safe entry / exit velocities shall be used.
-
-      // Factor to multiply the previous / current nominal velocities to get componentwise limited velocities.
-      float v_factor = 1;
-      limited = 0;
-
-      // The junction velocity will be shared between successive segments. Limit the junction velocity to their minimum.
-      // Pick the smaller of the nominal speeds. Higher speed shall not be achieved at the junction during coasting.
-      vmax_junction = _MIN(block->nominal_speed, previous_nominal_speed);
-
-      // Now limit the jerk in all axes.
-      const float smaller_speed_factor = vmax_junction / previous_nominal_speed;
-      #if HAS_LINEAR_E_JERK
-        LOOP_XYZ(axis)
-      #else
-        LOOP_XYZE(axis)
-      #endif
-      {
-        // Limit an axis. We have to differentiate: coasting, reversal of an axis, full stop.
-        float v_exit = previous_speed[axis] * smaller_speed_factor,
-              v_entry = current_speed[axis];
-        if (limited) {
-          v_exit *= v_factor;
-          v_entry *= v_factor;
-        }
-
-        // Calculate jerk depending on whether the axis is coasting in the same direction or reversing.
-        const float jerk = (v_exit > v_entry)
-            ? //                                  coasting             axis reversal
-              ( (v_entry > 0 || v_exit < 0) ? (v_exit - v_entry) : _MAX(v_exit, -v_entry) )
-            : // v_exit <= v_entry                coasting             axis reversal
-              ( (v_entry < 0 || v_exit > 0) ? (v_entry - v_exit) : _MAX(-v_exit, v_entry) );
-
-        if (jerk > settings.max_jerk[axis]) {
-          v_factor *= settings.max_jerk[axis] / jerk;
-          ++limited;
-        }
-      }
-      if (limited) vmax_junction *= v_factor;
-      // Now the transition velocity is known, which maximizes the shared exit / entry velocity while
-      // respecting the jerk factors, it may be possible, that applying separate safe exit / entry velocities will achieve faster prints.
-      const float vmax_junction_threshold = vmax_junction * 0.99f;
-      if (previous_safe_speed > vmax_junction_threshold && safe_speed > vmax_junction_threshold)
-        vmax_junction = safe_speed;
+      vmax_junction = classic_jerk::junction_speed<num_jerk_axes>(
+        block->nominal_speed, previous_nominal_speed,
+        current_speed, previous_speed,
+        settings.max_jerk, safe_speed, previous_safe_speed);
     }
     else
       vmax_junction = safe_speed;
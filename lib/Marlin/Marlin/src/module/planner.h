@@ -544,6 +544,27 @@ class Planner {
         unapply_leveling(raw);
         leveling_active = false;
       }
+
+      /**
+       * Per-batch state for apply_leveling(raw, cache). A logical move that is
+       * submitted as many short segments (arcs) keeps the interpolation
+       * coefficients of the last touched mesh cell here, so the cell lookup
+       * and interpolation setup are amortized across the whole batch instead
+       * of being redone for every segment.
+       */
+      struct leveling_cache_t {
+        int8_t cx = -1, cy = -1; // mesh cell the cached coefficients belong to
+        float x0, y0;            // mesh position of the cell origin
+        float z00, zx0;          // Z and X-slope along the cell bottom edge
+        float z01, zx1;          // Z and X-slope along the cell top edge
+      };
+
+      /**
+       * Same as apply_leveling(), for tight segment-submission loops:
+       * consecutive segments tend to stay within one mesh cell, whose
+       * coefficients are carried in the caller-provided cache.
+       */
+      static void apply_leveling(xyz_pos_t &raw, leveling_cache_t &cache);
     #endif
 
     #if ENABLED(FWRETRACT)
@@ -0,0 +1,107 @@
+/**
+ * planner_jerk.h - Classic-jerk junction speed kernel
+ *
+ * Adapted from Průša MKS firmware
+ * https://github.com/prusa3d/Prusa-Firmware
+ *
+ * Extracted from Planner::_populate_block() so the per-block junction
+ * computation is a straight-line kernel specialized at compile time on the
+ * number of jerk-limited axes (with linear E jerk the E axis is governed by
+ * LIN_ADVANCE instead), and so it can be compiled, verified and benchmarked
+ * on the host without the rest of the planner
+ * (see tests/unit/lib/Marlin/classic_jerk).
+ *
+ * The kernel deliberately has no Marlin dependencies: speeds and jerk limits
+ * are anything indexable by axis, which covers xyze_float_t and xyz(e)_pos_t
+ * in the firmware and plain arrays in the host tests.
+ */
+#pragma once
+
+#include <stdint.h>
+#include <algorithm>
+#include <cmath>
+
+namespace classic_jerk {
+
+/**
+ * Compute the safe speed of a segment: the speed from which the machine may
+ * halt to stop immediately, with no axis exceeding its jerk limit.
+ */
+template <int num_jerk_axes, class SpeedVec, class JerkVec>
+inline float safe_halt_speed(const float nominal_speed, const SpeedVec &current_speed, const JerkVec &max_jerk) {
+  float safe_speed = nominal_speed;
+  uint8_t limited = 0;
+  for (int i = 0; i < num_jerk_axes; ++i) {
+    const float jerk = std::abs(current_speed[i]),  // cs : Starting from zero, change in speed for this axis
+                maxj = max_jerk[i];                 // mj : The max jerk setting for this axis
+    if (jerk > maxj) {                              // cs > mj : New current speed too fast?
+      if (limited) {                                // limited already?
+        const float mjerk = nominal_speed * maxj;   // ns*mj
+        if (jerk * safe_speed > mjerk) safe_speed = mjerk / jerk; // ns*mj/cs
+      }
+      else {
+        safe_speed *= maxj / jerk;                  // Initial limit: ns*mj/cs
+        ++limited;                                  // Initially limited
+      }
+    }
+  }
+  return safe_speed;
+}
+
+/**
+ * Estimate the maximum velocity allowed at the joint of two successive
+ * segments. If this maximum velocity allowed is lower than the minimum of
+ * the entry / exit safe velocities, then the machine is not coasting
+ * anymore and the safe entry / exit velocities shall be used.
+ *
+ * The caller is expected to have computed both segments' safe speeds with
+ * safe_halt_speed() and to only call this when a previous segment exists
+ * (otherwise the junction speed is simply the safe speed).
+ */
+template <int num_jerk_axes, class SpeedVec, class JerkVec>
+inline float junction_speed(const float nominal_speed, const float previous_nominal_speed,
+                            const SpeedVec &current_speed, const SpeedVec &previous_speed,
+                            const JerkVec &max_jerk,
+                            const float safe_speed, const float previous_safe_speed) {
+  // Factor to multiply the previous / current nominal velocities to get componentwise limited velocities.
+  float v_factor = 1;
+  uint8_t limited = 0;
+
+  // The junction velocity will be shared between successive segments. Limit the junction velocity to their minimum.
+  // Pick the smaller of the nominal speeds. Higher speed shall not be achieved at the junction during coasting.
+  float vmax_junction = std::min(nominal_speed, previous_nominal_speed);
+
+  // Now limit the jerk in all axes.
+  const float smaller_speed_factor = vmax_junction / previous_nominal_speed;
+  for (int axis = 0; axis < num_jerk_axes; ++axis) {
+    // Limit an axis. We have to differentiate: coasting, reversal of an axis, full stop.
+    float v_exit = previous_speed[axis] * smaller_speed_factor,
+          v_entry = current_speed[axis];
+    if (limited) {
+      v_exit *= v_factor;
+      v_entry *= v_factor;
+    }
+
+    // Calculate jerk depending on whether the axis is coasting in the same direction or reversing.
+    const float jerk = (v_exit > v_entry)
+        ? //                                  coasting             axis reversal
+          ( (v_entry > 0 || v_exit < 0) ? (v_exit - v_entry) : std::max(v_exit, -v_entry) )
+        : // v_exit <= v_entry                coasting             axis reversal
+          ( (v_entry < 0 || v_exit > 0) ? (v_entry - v_exit) : std::max(-v_exit, v_entry) );
+
+    if (jerk > max_jerk[axis]) {
+      v_factor *= max_jerk[axis] / jerk;
+      ++limited;
+    }
+  }
+  if (limited) vmax_junction *= v_factor;
+  // Now the transition velocity is known, which maximizes the shared exit / entry velocity while
+  // respecting the jerk factors, it may be possible, that applying separate safe exit / entry velocities will achieve faster prints.
+  const float vmax_junction_threshold = vmax_junction * 0.99f;
+  if (previous_safe_speed > vmax_junction_threshold && safe_speed > vmax_junction_threshold)
+    vmax_junction = safe_speed;
+
+  return vmax_junction;
+}
+
+} // namespace classic_jerk
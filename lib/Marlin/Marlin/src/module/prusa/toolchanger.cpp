@@ -610,10 +610,11 @@ bool PrusaToolChanger::park(Dwarf &dwarf) {
         return !dwarf.is_picked();
     };
 
-    const PrusaToolInfo &info = get_tool_info(dwarf, /*check_calibrated=*/true);
+    get_tool_info(dwarf, /*check_calibrated=*/true); // redscreens when dock is not calibrated
+    const DockWaypoints &waypoints = get_dock_waypoints(dwarf);
 
     // safe target dock position
-    const xy_pos_t target_pos = { info.dock_x + PARK_X_OFFSET_1, SAFE_Y_WITH_TOOL };
+    const xy_pos_t &target_pos = waypoints.park_target;
 
     // reduce maximum parking speed to improve reliability during constant toolchanging
     float target_fr = limit_stealth_feedrate(fminf(PARKING_FINAL_MAX_SPEED, feedrate_mm_s));
@@ -638,7 +639,7 @@ bool PrusaToolChanger::park(Dwarf &dwarf) {
 
     // go in front of the tool dock
     move(target_pos.x, target_pos.y, target_fr);
-    move(target_pos.x, info.dock_y, target_fr);
+    move(waypoints.park_entry.x, waypoints.park_entry.y, target_fr);
     planner.synchronize(); // this creates a pause which allow the resonance in the tool to be damped before insertion of the tool in the dock
     conf_restorer.restore_jerk();
 
@@ -652,13 +653,13 @@ bool PrusaToolChanger::park(Dwarf &dwarf) {
     stepperY.rms_current(PARKING_CURRENT_MA);
     stepperY.stall_sensitivity(PARKING_STALL_SENSITIVITY);
 
-    move(info.dock_x + PARK_X_OFFSET_2, info.dock_y, SLOW_MOVE_MM_S);
+    move(waypoints.park_unlock.x, waypoints.park_unlock.y, SLOW_MOVE_MM_S);
     {
         auto s = planner.user_settings;
         s.travel_acceleration = SLOW_ACCELERATION_MM_S2;
         planner.apply_settings(s);
     }
-    move(info.dock_x + PARK_X_OFFSET_3, info.dock_y, SLOW_MOVE_MM_S);
+    move(waypoints.park_unlocked.x, waypoints.park_unlocked.y, SLOW_MOVE_MM_S);
     planner.synchronize();
     conf_restorer.restore_acceleration(); // back to high acceleration
 
@@ -668,15 +669,15 @@ bool PrusaToolChanger::park(Dwarf &dwarf) {
     stepperY.rms_current(y_current_ma);
     stepperY.stall_sensitivity(y_stall_sensitivity);
 
-    move(info.dock_x, info.dock_y, SLOW_MOVE_MM_S);
+    move(waypoints.dock.x, waypoints.dock.y, SLOW_MOVE_MM_S);
     planner.synchronize();
 
     // Wait until dwarf is registering as parked
     if (!wait(dwarf_parked, WAIT_TIME_TOOL_PARKED_PICKED)) {
         log_warning(PrusaToolChanger, "Dwarf %u not parked, trying to wiggle it in", dwarf.get_dwarf_nr());
 
-        move(info.dock_x - DOCK_WIGGLE_OFFSET, info.dock_y, SLOW_MOVE_MM_S); // wiggle left
-        move(info.dock_x, info.dock_y, SLOW_MOVE_MM_S); // wiggle back
+        move(waypoints.dock.x - DOCK_WIGGLE_OFFSET, waypoints.dock.y, SLOW_MOVE_MM_S); // wiggle left
+        move(waypoints.dock.x, waypoints.dock.y, SLOW_MOVE_MM_S); // wiggle back
         planner.synchronize();
 
         if (!wait(dwarf_parked, WAIT_TIME_TOOL_PARKED_PICKED)) {
@@ -686,7 +687,7 @@ bool PrusaToolChanger::park(Dwarf &dwarf) {
         }
     }
 
-    move(info.dock_x, SAFE_Y_WITHOUT_TOOL, feedrate_mm_s); // release tool
+    move(waypoints.front_clear.x, waypoints.front_clear.y, feedrate_mm_s); // release tool
 
     // Wait until dwarf is registering as not picked
     if (!wait(dwarf_not_picked, WAIT_TIME_TOOL_PARKED_PICKED)) {
@@ -770,12 +771,13 @@ bool PrusaToolChanger::pickup(Dwarf &dwarf) {
         return !dwarf.is_parked();
     };
 
-    const PrusaToolInfo &info = get_tool_info(dwarf, /*check_calibrated=*/true);
+    get_tool_info(dwarf, /*check_calibrated=*/true); // redscreens when dock is not calibrated
+    const DockWaypoints &waypoints = get_dock_waypoints(dwarf);
 
     const auto limited_feedrate = limit_stealth_feedrate(feedrate_mm_s);
 
-    move(info.dock_x, SAFE_Y_WITHOUT_TOOL, limited_feedrate); // go in front of the tool
-    move(info.dock_x, info.dock_y + PICK_Y_OFFSET, limited_feedrate); // pre-insert fast the tool
+    move(waypoints.front_clear.x, waypoints.front_clear.y, limited_feedrate); // go in front of the tool
+    move(waypoints.pick_preinsert.x, waypoints.pick_preinsert.y, limited_feedrate); // pre-insert fast the tool
 
     {
         auto s = planner.user_settings;
@@ -783,15 +785,15 @@ bool PrusaToolChanger::pickup(Dwarf &dwarf) {
         planner.apply_settings(s);
     }
 
-    move(info.dock_x, info.dock_y, SLOW_MOVE_MM_S); // insert slowly the last mm to allow part fitting + soft touch between TCM and tool thanks to the gentle deceleration
+    move(waypoints.dock.x, waypoints.dock.y, SLOW_MOVE_MM_S); // insert slowly the last mm to allow part fitting + soft touch between TCM and tool thanks to the gentle deceleration
     planner.synchronize();
 
     // Wait until dwarf is registering as picked
     if (!wait(dwarf_picked, WAIT_TIME_TOOL_PARKED_PICKED)) {
         log_warning(PrusaToolChanger, "Dwarf %u not picked, trying to wiggle it in", dwarf.get_dwarf_nr());
 
-        move(info.dock_x, info.dock_y + DOCK_WIGGLE_OFFSET, SLOW_MOVE_MM_S); // wiggle pull
-        move(info.dock_x, info.dock_y, SLOW_MOVE_MM_S); // wiggle back
+        move(waypoints.dock.x, waypoints.dock.y + DOCK_WIGGLE_OFFSET, SLOW_MOVE_MM_S); // wiggle pull
+        move(waypoints.dock.x, waypoints.dock.y, SLOW_MOVE_MM_S); // wiggle back
         planner.synchronize();
 
         if (!wait(dwarf_picked, WAIT_TIME_TOOL_PARKED_PICKED)) {
@@ -811,10 +813,10 @@ bool PrusaToolChanger::pickup(Dwarf &dwarf) {
     stepperY.rms_current(PARKING_CURRENT_MA);
     stepperY.stall_sensitivity(PARKING_STALL_SENSITIVITY);
 
-    move(info.dock_x + PICK_X_OFFSET_1, info.dock_y, SLOW_MOVE_MM_S); // accelerate gently to low speed to gently place the tool against the TCM
+    move(waypoints.pick_lock.x, waypoints.pick_lock.y, SLOW_MOVE_MM_S); // accelerate gently to low speed to gently place the tool against the TCM
     conf_restorer.restore_acceleration(); // back to high acceleration
-    move(info.dock_x + PICK_X_OFFSET_2, info.dock_y, SLOW_MOVE_MM_S); // this line is just to allow a gentle acceleration and a quick deceleration
-    move(info.dock_x + PICK_X_OFFSET_3, info.dock_y, SLOW_MOVE_MM_S);
+    move(waypoints.pick_locked.x, waypoints.pick_locked.y, SLOW_MOVE_MM_S); // this line is just to allow a gentle acceleration and a quick deceleration
+    move(waypoints.pick_exit.x, waypoints.pick_exit.y, SLOW_MOVE_MM_S);
     planner.synchronize();
 
     // set motor current and stall sensitivity to old value
@@ -830,7 +832,7 @@ bool PrusaToolChanger::pickup(Dwarf &dwarf) {
         return false;
     }
 
-    move(info.dock_x + PICK_X_OFFSET_3, SAFE_Y_WITH_TOOL, limited_feedrate); // tool extracted
+    move(waypoints.pick_extracted.x, waypoints.pick_extracted.y, limited_feedrate); // tool extracted
 
     log_info(PrusaToolChanger, "Dwarf %u picked successfully", dwarf.get_dwarf_nr());
     Odometer_s::instance().add_toolpick(dwarf.get_dwarf_nr() - 1); // Count picks
@@ -281,6 +281,7 @@ void PrusaToolChangerUtils::load_tool_info() {
             tool_info[i].dock_y = 0;
         }
     }
+    precompute_dock_waypoints();
 }
 
 void PrusaToolChangerUtils::save_tool_info() {
@@ -340,6 +341,7 @@ bool PrusaToolChangerUtils::load_tool_info_from_usb() {
             tool_info[i].dock_y = atof(second);
         }
     }
+    precompute_dock_waypoints();
 
     return fclose(file) == 0;
 }
@@ -445,6 +447,31 @@ void PrusaToolChangerUtils::set_tool_info(const buddy::puppies::Dwarf &dwarf, co
     assert(dwarf.get_dwarf_nr() > 0);
 
     tool_info[dwarf.get_dwarf_nr() - 1] = info;
+    precompute_dock_waypoints();
+}
+
+const DockWaypoints &PrusaToolChangerUtils::get_dock_waypoints(const Dwarf &dwarf) const {
+    assert(dwarf.get_dwarf_nr() <= dock_waypoints.size());
+    assert(dwarf.get_dwarf_nr() > 0);
+    return dock_waypoints[dwarf.get_dwarf_nr() - 1];
+}
+
+void PrusaToolChangerUtils::precompute_dock_waypoints() {
+    for (size_t i = 0; i < tool_info.size(); ++i) {
+        const PrusaToolInfo &info = tool_info[i];
+        DockWaypoints &waypoints = dock_waypoints[i];
+        waypoints.park_target = { info.dock_x + PARK_X_OFFSET_1, SAFE_Y_WITH_TOOL };
+        waypoints.park_entry = { info.dock_x + PARK_X_OFFSET_1, info.dock_y };
+        waypoints.park_unlock = { info.dock_x + PARK_X_OFFSET_2, info.dock_y };
+        waypoints.park_unlocked = { info.dock_x + PARK_X_OFFSET_3, info.dock_y };
+        waypoints.dock = { info.dock_x, info.dock_y };
+        waypoints.front_clear = { info.dock_x, SAFE_Y_WITHOUT_TOOL };
+        waypoints.pick_preinsert = { info.dock_x, info.dock_y + PICK_Y_OFFSET };
+        waypoints.pick_lock = { info.dock_x + PICK_X_OFFSET_1, info.dock_y };
+        waypoints.pick_locked = { info.dock_x + PICK_X_OFFSET_2, info.dock_y };
+        waypoints.pick_exit = { info.dock_x + PICK_X_OFFSET_3, info.dock_y };
+        waypoints.pick_extracted = { info.dock_x + PICK_X_OFFSET_3, SAFE_Y_WITH_TOOL };
+    }
 }
 
 void PrusaToolChangerUtils::toolchanger_error(const char *message) const {
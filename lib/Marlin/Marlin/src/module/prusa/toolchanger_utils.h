@@ -11,6 +11,27 @@ struct PrusaToolInfo {
     float dock_y;
 };
 
+/**
+ * @brief Dock-fixed waypoints of the park and pickup sequences.
+ * The dock geometry only changes with dock calibration, so these are
+ * precomputed whenever tool_info is updated and a toolchange just looks them
+ * up. The approach and departure arcs depend on the run-time head position
+ * and still have to be planned per change.
+ */
+struct DockWaypoints {
+    xy_pos_t park_target; ///< in front of the dock, tool still clear of it
+    xy_pos_t park_entry; ///< tool level with the dock, still clear of it
+    xy_pos_t park_unlock; ///< tool is being unlocked
+    xy_pos_t park_unlocked; ///< tool fully unlocked
+    xy_pos_t dock; ///< calibrated dock position
+    xy_pos_t front_clear; ///< in front of the dock, head clear of any tool
+    xy_pos_t pick_preinsert; ///< fast pre-insert stop before the final slow touch
+    xy_pos_t pick_lock; ///< tool is being locked
+    xy_pos_t pick_locked; ///< tool fully locked
+    xy_pos_t pick_exit; ///< tool can be pulled from the dock area
+    xy_pos_t pick_extracted; ///< tool extracted, clear of the dock
+};
+
 class PrusaToolChangerUtils {
 public:
     static constexpr uint8_t MARLIN_NO_TOOL_PICKED = EXTRUDERS - 1;
@@ -91,6 +112,7 @@ public:
     bool is_tool_info_valid(const buddy::puppies::Dwarf &dwarf, const PrusaToolInfo &info) const;
     bool is_tool_info_valid(const buddy::puppies::Dwarf &dwarf) const;
     void set_tool_info(const buddy::puppies::Dwarf &dwarf, const PrusaToolInfo &info);
+    const DockWaypoints &get_dock_waypoints(const buddy::puppies::Dwarf &dwarf) const;
 
     /**
      * @brief Get binary mask of all enabled dwarfs.
@@ -164,6 +186,10 @@ protected:
     std::atomic<buddy::puppies::Dwarf *> active_dwarf = nullptr; ///< what tool is active in puppytask
 
     std::array<PrusaToolInfo, EXTRUDERS> tool_info;
+    std::array<DockWaypoints, EXTRUDERS> dock_waypoints;
+
+    /// Rebuilds dock_waypoints from tool_info, to be called on every tool_info update
+    void precompute_dock_waypoints();
 
     [[nodiscard]] PrusaToolInfo compute_synthetic_tool_info(const buddy::puppies::Dwarf &dwarf) const;
 
@@ -238,6 +264,11 @@ protected:
             return false;
         }
 
+        /**
+         * @brief Check whether a configuration is sampled and not yet restored.
+         */
+        bool is_sampled() const { return sampled.load(); }
+
         /**
          * @brief Restore and clear planner feedrate and acceleration.
          */
@@ -266,6 +297,13 @@ public:
      * @return true if feedrate and acceleration were restored
      */
     bool try_restore() { return conf_restorer.try_restore(); }
+
+    /**
+     * @brief Check whether a toolchange temporarily replaced the planner config.
+     * This is for powerpanic to avoid snapshotting the temporary values.
+     * @return true if the original config is sampled and not yet restored
+     */
+    bool is_conf_restore_pending() const { return conf_restorer.is_sampled(); }
 };
 
 #endif /*ENABLED(PRUSA_TOOLCHANGER)*/
@@ -54,13 +54,6 @@
   #include "stepper.h"
 #endif
 
-#if ENABLED(BABYSTEPPING)
-  #include "../feature/babystep.h"
-  #if ENABLED(BABYSTEP_ALWAYS_AVAILABLE)
-    #include "../gcode/gcode.h"
-  #endif
-#endif
-
 #include "printcounter.h"
 
 #if ENABLED(FILAMENT_WIDTH_SENSOR)
@@ -3211,7 +3204,6 @@ void Temperature::readings_ready() {
  *  - Manage PWM to all the heaters and fan
  *  - Prepare or Measure one of the raw ADC sensor values
  *  - Check new temperature values for MIN/MAX errors (kill on error)
- *  - Step the babysteps value for each axis towards 0
  *  - For PINS_DEBUGGING, monitor and report endstop pins
  *  - For ENDSTOP_INTERRUPTS_FEATURE check endstops if flagged
  *  - Call planner.tick to count down its "ignore" time
@@ -3542,14 +3534,33 @@ void Temperature::isr() {
   if ((do_buttons ^= true)) ui.update_buttons();
 
   /**
-   * One sensor is sampled on every other call of the ISR.
+   * All temperature sensors are sampled in a single batch pass of the ISR.
    * Each sensor is read 16 (OVERSAMPLENR) times, taking the average.
    *
-   * On each Prepare pass, ADC is started for a sensor pin.
-   * On the next pass, the ADC value is read and accumulated.
+   * The ADC+DMA engine converts every channel continuously in the
+   * background, so reading a sensor is just a buffer fetch - there is no
+   * charge-up time to wait out and no reason to burn an ISR call per
+   * sensor on starting a conversion.
    *
-   * This gives each ADC 0.9765ms to charge up.
+   * Channels with a large thermal mass need not be read on every
+   * oversampling pass. A channel decimated by 1 << shift is sampled on
+   * every (1 << shift)th pass with the sample scaled up to keep the
+   * accumulator in the same units as the undecimated channels.
    */
+  #define SAMPLE_ADC(pin, obj) do{ \
+    HAL_START_ADC(pin); obj.sample(HAL_READ_ADC()); \
+  }while(0)
+
+  #define SAMPLE_ADC_DECIMATED(pin, obj, shift) do{ \
+    if (!(temp_count & ((1 << (shift)) - 1))) { \
+      HAL_START_ADC(pin); obj.sample(HAL_READ_ADC() << (shift)); \
+    } \
+  }while(0)
+
+  // Decimation shifts for the slow-moving channels. The control loops
+  // (hotend, bed, heatbreak) always run at the full oversampling rate.
+  [[maybe_unused]] constexpr uint8_t ADC_DECIMATION_AUX = 2; // board, chamber, PSU, ambient
+
   #define ACCUMULATE_ADC(obj) do{ \
     if (!HAL_ADC_READY()) next_sensor_state = adc_sensor_state; \
     else obj.sample(HAL_READ_ADC()); \
@@ -3583,63 +3594,42 @@ void Temperature::isr() {
       }
       break;
 
-    #if HAS_TEMP_ADC_0
-      case PrepareTemp_0: HAL_START_ADC(TEMP_0_PIN); break;
-      case MeasureTemp_0: ACCUMULATE_ADC(temp_hotend[0]); break;
-    #endif
-
-    #if HAS_HEATED_BED
-      case PrepareTemp_BED: HAL_START_ADC(TEMP_BED_PIN); break;
-      case MeasureTemp_BED: ACCUMULATE_ADC(temp_bed); break;
-    #endif
-
-    #if HAS_TEMP_CHAMBER
-      case PrepareTemp_CHAMBER: HAL_START_ADC(TEMP_CHAMBER_PIN); break;
-      case MeasureTemp_CHAMBER: ACCUMULATE_ADC(temp_chamber); break;
-    #endif
-
-    #if HAS_TEMP_HEATBREAK
-      case PrepareTemp_HEATBREAK: HAL_START_ADC(TEMP_HEATBREAK_PIN); break;
-      case MeasureTemp_HEATBREAK: ACCUMULATE_ADC(temp_heatbreak[0]); break;
-    #endif
-
-    #if HAS_TEMP_BOARD
-      case PrepareTemp_BOARD: HAL_START_ADC(TEMP_BOARD_PIN); break;
-      case MeasureTemp_BOARD: ACCUMULATE_ADC(temp_board); break;
-    #endif
-
-
-    #if PRINTER_IS_PRUSA_iX()
-      case PrepareTemp_PSU: HAL_START_ADC(TEMP_PSU_PIN); break;
-      case MeasureTemp_PSU: ACCUMULATE_ADC(temp_psu); break;
-      case PrepareTemp_AMBIENT: HAL_START_ADC(TEMP_AMBIENT_PIN); break;
-      case MeasureTemp_AMBIENT: ACCUMULATE_ADC(temp_ambient); break;
-    #endif
-
-    #if HAS_TEMP_ADC_1
-      case PrepareTemp_1: HAL_START_ADC(TEMP_1_PIN); break;
-      case MeasureTemp_1: ACCUMULATE_ADC(temp_hotend[1]); break;
-    #endif
-
-    #if HAS_TEMP_ADC_2
-      case PrepareTemp_2: HAL_START_ADC(TEMP_2_PIN); break;
-      case MeasureTemp_2: ACCUMULATE_ADC(temp_hotend[2]); break;
-    #endif
-
-    #if HAS_TEMP_ADC_3
-      case PrepareTemp_3: HAL_START_ADC(TEMP_3_PIN); break;
-      case MeasureTemp_3: ACCUMULATE_ADC(temp_hotend[3]); break;
-    #endif
-
-    #if HAS_TEMP_ADC_4
-      case PrepareTemp_4: HAL_START_ADC(TEMP_4_PIN); break;
-      case MeasureTemp_4: ACCUMULATE_ADC(temp_hotend[4]); break;
-    #endif
-
-    #if HAS_TEMP_ADC_5
-      case PrepareTemp_5: HAL_START_ADC(TEMP_5_PIN); break;
-      case MeasureTemp_5: ACCUMULATE_ADC(temp_hotend[5]); break;
-    #endif
+    case MeasureSensors:
+      #if HAS_TEMP_ADC_0
+        SAMPLE_ADC(TEMP_0_PIN, temp_hotend[0]);
+      #endif
+      #if HAS_TEMP_ADC_1
+        SAMPLE_ADC(TEMP_1_PIN, temp_hotend[1]);
+      #endif
+      #if HAS_TEMP_ADC_2
+        SAMPLE_ADC(TEMP_2_PIN, temp_hotend[2]);
+      #endif
+      #if HAS_TEMP_ADC_3
+        SAMPLE_ADC(TEMP_3_PIN, temp_hotend[3]);
+      #endif
+      #if HAS_TEMP_ADC_4
+        SAMPLE_ADC(TEMP_4_PIN, temp_hotend[4]);
+      #endif
+      #if HAS_TEMP_ADC_5
+        SAMPLE_ADC(TEMP_5_PIN, temp_hotend[5]);
+      #endif
+      #if HAS_HEATED_BED
+        SAMPLE_ADC(TEMP_BED_PIN, temp_bed);
+      #endif
+      #if HAS_TEMP_HEATBREAK
+        SAMPLE_ADC(TEMP_HEATBREAK_PIN, temp_heatbreak[0]);
+      #endif
+      #if HAS_TEMP_CHAMBER
+        SAMPLE_ADC_DECIMATED(TEMP_CHAMBER_PIN, temp_chamber, ADC_DECIMATION_AUX);
+      #endif
+      #if HAS_TEMP_BOARD
+        SAMPLE_ADC_DECIMATED(TEMP_BOARD_PIN, temp_board, ADC_DECIMATION_AUX);
+      #endif
+      #if PRINTER_IS_PRUSA_iX()
+        SAMPLE_ADC_DECIMATED(TEMP_PSU_PIN, temp_psu, ADC_DECIMATION_AUX);
+        SAMPLE_ADC_DECIMATED(TEMP_AMBIENT_PIN, temp_ambient, ADC_DECIMATION_AUX);
+      #endif
+      break;
 
     #if ENABLED(FILAMENT_WIDTH_SENSOR)
       case Prepare_FILWIDTH: HAL_START_ADC(FILWIDTH_PIN); break;
@@ -3700,10 +3690,6 @@ void Temperature::isr() {
   // Additional ~1KHz Tasks
   //
 
-  #if ENABLED(BABYSTEPPING)
-    babystep.task();
-  #endif
-
   // Poll endstops state, if required
   endstops.poll();
 
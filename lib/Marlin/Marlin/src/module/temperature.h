@@ -101,40 +101,11 @@ typedef struct { float Kp, Ki, Kd, Kc; } PIDC_t;
  */
 enum ADCSensorState : char {
   StartSampling,
-  #if HAS_TEMP_ADC_0
-    PrepareTemp_0, MeasureTemp_0,
-  #endif
-  #if HAS_HEATED_BED
-    PrepareTemp_BED, MeasureTemp_BED,
-  #endif
-  #if HAS_TEMP_CHAMBER
-    PrepareTemp_CHAMBER, MeasureTemp_CHAMBER,
-  #endif
-  #if HAS_TEMP_HEATBREAK
-    PrepareTemp_HEATBREAK, MeasureTemp_HEATBREAK,
-  #endif
-  #if HAS_TEMP_BOARD
-    PrepareTemp_BOARD, MeasureTemp_BOARD,
-  #endif
-  #if PRINTER_IS_PRUSA_iX()
-    PrepareTemp_PSU, MeasureTemp_PSU,
-    PrepareTemp_AMBIENT, MeasureTemp_AMBIENT,
-  #endif
-  #if HAS_TEMP_ADC_1
-    PrepareTemp_1, MeasureTemp_1,
-  #endif
-  #if HAS_TEMP_ADC_2
-    PrepareTemp_2, MeasureTemp_2,
-  #endif
-  #if HAS_TEMP_ADC_3
-    PrepareTemp_3, MeasureTemp_3,
-  #endif
-  #if HAS_TEMP_ADC_4
-    PrepareTemp_4, MeasureTemp_4,
-  #endif
-  #if HAS_TEMP_ADC_5
-    PrepareTemp_5, MeasureTemp_5,
-  #endif
+  // All temperature channels are converted continuously by the ADC+DMA in
+  // the background, so one batch state accumulates every sensor at once
+  // instead of walking a Prepare/Measure pair per sensor. This keeps the
+  // sampling loop length independent of the sensor count.
+  MeasureSensors,
   #if HAS_JOY_ADC_X
     PrepareJoy_X, MeasureJoy_X,
   #endif
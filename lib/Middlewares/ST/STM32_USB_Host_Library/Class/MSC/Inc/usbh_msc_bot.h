@@ -200,6 +200,12 @@ USBH_StatusTypeDef USBH_MSC_BOT_Init(USBH_HandleTypeDef *phost);
 USBH_StatusTypeDef USBH_MSC_BOT_Process(USBH_HandleTypeDef *phost, uint8_t lun);
 USBH_StatusTypeDef USBH_MSC_BOT_Error(USBH_HandleTypeDef *phost, uint8_t lun);
 
+/* Called from the URB-done interrupt: if the BOT data stage has more chunks to
+   transfer, submits the next bulk URB right away instead of going through a
+   worker task wakeup. Returns 1U when the next URB was pre-staged (no task
+   wakeup needed), 0U otherwise. */
+uint8_t USBH_MSC_BOT_PrestageDataUrb(USBH_HandleTypeDef *phost, uint8_t chnum);
+
 
 
 /**
@@ -167,6 +167,86 @@ uint32_t calc_transfer_length(uint32_t length) {
     return packets * 64;
 }
 
+/**
+  * @brief  USBH_MSC_BOT_PrestageDataUrb
+  *         Advances the BOT data stage directly from the URB-done interrupt.
+  *         The worker task only ever sees URB_DONE on the last chunk of the
+  *         data stage; the intermediate chunks are re-submitted here, which
+  *         removes the ISR -> task wakeup -> resubmit turnaround from every
+  *         chunk of a multi-chunk transfer.
+  *
+  *         Safe to call from the ISR: while a data stage is in flight, the
+  *         issuing task is blocked inside USBH_MSC_Read/Write (holding the
+  *         class mutex), so nobody else touches the hbot state. Anything but
+  *         a URB_DONE on the matching data pipe (STALL, NAK, errors) is left
+  *         for the worker task to handle.
+  * @param  phost: Host handle
+  * @param  chnum: host channel number the URB event belongs to
+  * @retval 1U when the next URB was pre-staged (no task wakeup needed), 0U otherwise
+  */
+uint8_t USBH_MSC_BOT_PrestageDataUrb(USBH_HandleTypeDef *phost, uint8_t chnum)
+{
+  MSC_HandleTypeDef *MSC_Handle;
+  uint32_t transfer_length;
+
+  if ((phost == NULL) || (phost->gState != HOST_CLASS) || (phost->pActiveClass == NULL))
+  {
+    return 0U;
+  }
+
+  MSC_Handle = (MSC_HandleTypeDef *) phost->pActiveClass->pData;
+  if (MSC_Handle == NULL)
+  {
+    return 0U;
+  }
+
+  if ((MSC_Handle->hbot.state == BOT_DATA_IN_WAIT) && (chnum == MSC_Handle->InPipe))
+  {
+    if (USBH_LL_GetURBState(phost, MSC_Handle->InPipe) != USBH_URB_DONE)
+    {
+      return 0U;
+    }
+
+    transfer_length = calc_transfer_length(MSC_Handle->hbot.cbw.field.DataTransferLength);
+    if (MSC_Handle->hbot.cbw.field.DataTransferLength <= transfer_length)
+    {
+      /* Last chunk - let the worker task receive the CSW */
+      return 0U;
+    }
+
+    MSC_Handle->hbot.pbuf += transfer_length;
+    MSC_Handle->hbot.cbw.field.DataTransferLength -= transfer_length;
+
+    (void)USBH_BulkReceiveData(phost, MSC_Handle->hbot.pbuf,
+                               calc_transfer_length(MSC_Handle->hbot.cbw.field.DataTransferLength),
+                               MSC_Handle->InPipe);
+    return 1U;
+  }
+
+  if ((MSC_Handle->hbot.state == BOT_DATA_OUT_WAIT) && (chnum == MSC_Handle->OutPipe))
+  {
+    if (USBH_LL_GetURBState(phost, MSC_Handle->OutPipe) != USBH_URB_DONE)
+    {
+      return 0U;
+    }
+
+    if (MSC_Handle->hbot.cbw.field.DataTransferLength <= USBH_MSC_TRANSFER_SIZE)
+    {
+      /* Last chunk - let the worker task receive the CSW */
+      return 0U;
+    }
+
+    MSC_Handle->hbot.pbuf += USBH_MSC_TRANSFER_SIZE;
+    MSC_Handle->hbot.cbw.field.DataTransferLength -= USBH_MSC_TRANSFER_SIZE;
+
+    (void)USBH_BulkSendData(phost, MSC_Handle->hbot.pbuf,
+                            USBH_MSC_TRANSFER_SIZE, MSC_Handle->OutPipe, 1U);
+    return 1U;
+  }
+
+  return 0U;
+}
+
 /**
   * @brief  USBH_MSC_BOT_Process
   *         The function handle the BOT protocol.
@@ -5490,6 +5490,75 @@ FRESULT f_setlabel (
 
 
 #if FF_USE_EXPAND && !FF_FS_READONLY
+/*-----------------------------------------------------------------------*/
+/* Free Cluster Extent Summary                                           */
+/*-----------------------------------------------------------------------*/
+/* f_expand() originally located a contiguous block by walking the FAT one
+/  cluster at a time, which on a large fragmented volume means seconds of FAT
+/  reads for every preallocation. The summary below is built lazily by one
+/  full FAT walk on the first f_expand() after mount and remembers the largest
+/  free extents. Later preallocations pick a best-fit extent from the summary
+/  and only verify that its clusters are still free (sequential get_fat()
+/  reads served from the FAT window), so they finish in milliseconds.
+/
+/  Entries are hints, not truth: clusters allocated outside f_expand() (e.g.
+/  by create_chain() during ordinary writes) may overlap an entry, which the
+/  verification pass catches and drops the entry. Clusters freed elsewhere are
+/  simply unknown to the summary until the next rebuild; the worst case is the
+/  pre-summary behaviour (one full FAT walk), never a wrong allocation. */
+
+#define FREE_EXT_COUNT	8	/* Number of remembered free extents */
+
+typedef struct {
+	DWORD start;	/* First cluster of the free extent */
+	DWORD count;	/* Number of clusters in the extent (0:empty entry) */
+} FREE_EXT;
+
+#if FF_VOLUMES != 1
+#error The free cluster extent summary assumes a single volume
+#endif
+static struct {
+	WORD fs_id;		/* Mount id the summary was built for */
+	BYTE built;		/* 1:Summary describes the whole FAT */
+	FREE_EXT ext[FREE_EXT_COUNT];
+} FreeExtSummary;
+
+
+static void free_ext_note (	/* Record a free extent, keeping the largest ones */
+	DWORD start,	/* First cluster of the free run */
+	DWORD count		/* Number of clusters in the free run */
+)
+{
+	UINT i, smallest = 0;
+
+	for (i = 1; i < FREE_EXT_COUNT; i++) {
+		if (FreeExtSummary.ext[i].count < FreeExtSummary.ext[smallest].count) smallest = i;
+	}
+	if (FreeExtSummary.ext[smallest].count < count) {
+		FreeExtSummary.ext[smallest].start = start;
+		FreeExtSummary.ext[smallest].count = count;
+	}
+}
+
+
+static FREE_EXT* free_ext_pick (	/* 0:No fitting extent, else the best-fit summary entry */
+	FATFS* fs,		/* Filesystem object */
+	DWORD tcl		/* Number of contiguous clusters needed */
+)
+{
+	UINT i;
+	FREE_EXT *best = 0;
+
+	if (!FreeExtSummary.built || FreeExtSummary.fs_id != fs->id) return 0;	/* Not built for this mount */
+	for (i = 0; i < FREE_EXT_COUNT; i++) {	/* Best fit keeps the big extents for the big files */
+		if (FreeExtSummary.ext[i].count >= tcl && (!best || FreeExtSummary.ext[i].count < best->count)) best = &FreeExtSummary.ext[i];
+	}
+	return best;
+}
+
+
+
+
 /*-----------------------------------------------------------------------*/
 /* Allocate a Contiguous Blocks to the File                              */
 /*-----------------------------------------------------------------------*/
@@ -5503,7 +5572,9 @@ FRESULT f_expand (
 {
 	FRESULT res;
 	FATFS *fs;
-	DWORD n, clst, stcl, scl, ncl, tcl, lclst;
+	DWORD n, clst, scl, ncl, tcl, lclst, run;
+	FREE_EXT *ext;
+	BYTE rebuilt;
 
 #if FF_FS_EXFAT
 	#error FF_USE_EXPAND is not supported for exFAT (yield parameter)
@@ -5517,8 +5588,7 @@ FRESULT f_expand (
 #endif
 	n = (DWORD)fs->csize * SS(fs);	/* Cluster size */
 	tcl = (DWORD)(fsz / n) + ((fsz & (n - 1)) ? 1 : 0);	/* Number of clusters required */
-	stcl = fs->last_clst; lclst = 0;
-	if (stcl < 2 || stcl >= fs->n_fatent) stcl = 2;
+	lclst = 0;
 
 #if FF_FS_EXFAT
 	if (fs->fs_type == FS_EXFAT) {
@@ -5536,24 +5606,55 @@ FRESULT f_expand (
 	} else
 #endif
 	{
-		scl = clst = stcl; ncl = 0;
-		for (;;) {	/* Find a contiguous cluster block */
-			n = get_fat(&fp->obj, clst);
-			if (++clst >= fs->n_fatent) clst = 2;
-			if (n == 1) { res = FR_INT_ERR; break; }
-			if (n == 0xFFFFFFFF) { res = FR_DISK_ERR; break; }
-			if (n == 0) {	/* Is it a free cluster? */
-				if (++ncl == tcl) break;	/* Break if a contiguous cluster block is found */
-			} else {
-				scl = clst; ncl = 0;		/* Not a free cluster */
-				if (yield) {
-					unlock_fs(fs, FR_OK);	/* release disk lock so others can use the fs */
-					res = validate(&fp->obj, &fs);	/* acquire the lock again and re-check the file */
-					if (res != FR_OK || (res = (FRESULT)fp->err) != FR_OK) LEAVE_FF(fs, res);
-					if (fp->obj.objsize != 0 || !(fp->flag & FA_WRITE)) LEAVE_FF(fs, FR_DENIED);
+		scl = 0; rebuilt = 0;
+		for (;;) {	/* Take a contiguous cluster block from the extent summary */
+			ext = free_ext_pick(fs, tcl);
+			if (!ext) {
+				if (rebuilt) { res = FR_DENIED; break; }	/* Fresh summary has no fitting extent */
+				/* (Re)build the summary with one full FAT walk. This is the
+				   slow path, taken once per mount or when the volume got too
+				   fragmented for the remembered extents. */
+				memset(&FreeExtSummary, 0, sizeof FreeExtSummary);
+				ncl = 0; run = 0;
+				for (clst = 2; clst < fs->n_fatent; clst++) {
+					n = get_fat(&fp->obj, clst);
+					if (n == 1) { res = FR_INT_ERR; break; }
+					if (n == 0xFFFFFFFF) { res = FR_DISK_ERR; break; }
+					if (n == 0) {	/* Is it a free cluster? */
+						if (ncl++ == 0) run = clst;	/* Start of a free run */
+					} else {
+						if (ncl) { free_ext_note(run, ncl); ncl = 0; }	/* End of a free run */
+						if (yield) {	/* Only yield with no run in flight: clusters counted free must stay locked until recorded */
+							unlock_fs(fs, FR_OK);	/* release disk lock so others can use the fs */
+							res = validate(&fp->obj, &fs);	/* acquire the lock again and re-check the file */
+							if (res != FR_OK || (res = (FRESULT)fp->err) != FR_OK) LEAVE_FF(fs, res);
+							if (fp->obj.objsize != 0 || !(fp->flag & FA_WRITE)) LEAVE_FF(fs, FR_DENIED);
+						}
+					}
 				}
+				if (res != FR_OK) break;
+				if (ncl) free_ext_note(run, ncl);
+				FreeExtSummary.fs_id = fs->id;
+				FreeExtSummary.built = 1;
+				rebuilt = 1;
+				continue;	/* Pick again from the fresh summary */
+			}
+			/* Verify the extent is still free; clusters allocated outside
+			   f_expand() since the summary was built may overlap it */
+			for (clst = ext->start; clst < ext->start + tcl; clst++) {
+				n = get_fat(&fp->obj, clst);
+				if (n == 1) { res = FR_INT_ERR; break; }
+				if (n == 0xFFFFFFFF) { res = FR_DISK_ERR; break; }
+				if (n != 0) break;	/* No longer free */
+			}
+			if (res != FR_OK) break;
+			if (clst == ext->start + tcl) {	/* Still free; consume it */
+				scl = ext->start;
+				ext->start += tcl;
+				ext->count -= tcl;
+				break;
 			}
-			if (clst == stcl) { res = FR_DENIED; break; }	/* No contiguous cluster? */
+			ext->count = 0;	/* Stale entry; drop it and pick another */
 		}
 		if (res == FR_OK) {	/* A contiguous free area is found */
 			if (opt) {		/* Allocate it now */
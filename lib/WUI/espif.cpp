@@ -231,6 +231,21 @@ static bool can_recieve_data(ESPIFOperatingMode mode) {
 static freertos::BinarySemaphore tx_semaphore;
 static std::atomic<freertos::BinarySemaphore *> tx_semaphore_active;
 
+// Scatter-gather transmit chain.
+//
+// When a message payload consists of several pbuf segments, we don't copy
+// them together, nor do we wake the sending task after each one. Instead the
+// DMA completion interrupt starts the transfer of the next segment directly,
+// so the whole frame streams over the UART back to back and the task is woken
+// (through the semaphore above) only once the last segment is out.
+//
+// Written by the sending task only while no transfer is in flight, then
+// consumed by the interrupt.
+static std::atomic<const pbuf *> tx_chain_next = nullptr;
+// Set by the interrupt when it fails to start a segment (the task can't see
+// the HAL status from there).
+static std::atomic<bool> tx_chain_failed = false;
+
 struct PBufDeleter {
     inline void operator()(pbuf *data) {
         pbuf_free(data);
@@ -241,6 +256,16 @@ using pbuf_variant = std::variant<pbuf *, pbuf_smart>;
 static pbuf_variant tx_pbuf = nullptr; // only valid when tx_waiting == true
 
 void espif_tx_callback() {
+    if (const pbuf *segment = tx_chain_next.load(); segment != nullptr) {
+        tx_chain_next = segment->next;
+        assert(can_be_used_by_dma((const uint8_t *)segment->payload));
+        if (HAL_UART_Transmit_DMA(&uart_handle_for_esp, (uint8_t *)segment->payload, segment->len) == HAL_OK) {
+            // The chain goes on, the task gets woken by the last segment.
+            return;
+        }
+        tx_chain_failed = true;
+        tx_chain_next = nullptr;
+    }
     if (auto *semaphore = tx_semaphore_active.exchange(nullptr); semaphore != nullptr) {
         long woken = semaphore->release_from_isr();
         portYIELD_FROM_ISR(woken);
@@ -273,6 +298,21 @@ static err_t espif_tx_buffer(const uint8_t *data, size_t len) {
     return tx_result;
 }
 
+// Like espif_tx_buffer, but streams all segments of the pbuf chain as one
+// scatter-gather DMA chain (see tx_chain_next) ‒ without assembling them into
+// a linear buffer and without a task wakeup in between.
+static err_t espif_tx_chain(const pbuf *chain) {
+    tx_chain_failed = false;
+    tx_chain_next = chain->next;
+    err_t tx_result = espif_tx_buffer((const uint8_t *)chain->payload, chain->len);
+    if (tx_result == HAL_OK && tx_chain_failed.load()) {
+        // Some later segment failed to start from the interrupt.
+        tx_result = ERR_IF;
+    }
+    tx_chain_next = nullptr;
+    return tx_result;
+}
+
 // FIXME: This casually uses HAL_StatusTypeDef as a err_t, which works for the OK case (both 0), but it is kinda sketchy.
 [[nodiscard]] static err_t espif_tx_raw(uint8_t message_type, uint8_t message_byte, pbuf_variant p) {
     std::lock_guard lock { uart_write_mutex };
@@ -296,17 +336,20 @@ static err_t espif_tx_buffer(const uint8_t *data, size_t len) {
         tx_pbuf = std::get<pbuf_smart>(p).get();
     }
 
-    while (tx_pbuf != nullptr) {
+    if (tx_pbuf != nullptr) {
         // Predictive flow control - delay for ESP to load big enough buffer into UART driver
         // This is hotfix for not supplying buffers fast enough
         // Possibly, this slows down upload a little bit, but it is still faster than handling corruption.
+        //
+        // One pause per message is enough: the segments below stream from the
+        // DMA completion interrupt as one continuous UART transfer, so the
+        // ESP sees the same byte stream as if they came from a single buffer.
         osDelay(1);
-        tx_result = espif_tx_buffer((const uint8_t *)tx_pbuf->payload, tx_pbuf->len);
+        tx_result = espif_tx_chain(tx_pbuf);
         if (tx_result != HAL_OK) {
             log_error(ESPIF, "HAL_UART_Transmit_DMA() failed: %d", tx_result);
             return tx_result;
         }
-        tx_pbuf = tx_pbuf->next;
     }
 
     return tx_result;
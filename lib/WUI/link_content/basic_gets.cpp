@@ -334,9 +334,12 @@ JsonResult get_job_octoprint(size_t resume_point, JsonOutput &output) {
     char lfn_buffer[FILE_NAME_MAX_LEN];
     char sfn_buffer[FILE_PATH_MAX_LEN];
     {
-        auto lock = MarlinVarsLockGuard();
-        marlin_vars().media_LFN.copy_to(lfn_buffer, sizeof(lfn_buffer), lock);
-        marlin_vars().media_SFN_path.copy_to(sfn_buffer, sizeof(sfn_buffer), lock);
+        // sample LFN+SFN atomically
+        MarlinVarsSnapshot snapshot;
+        do {
+            marlin_vars().media_LFN.copy_to(lfn_buffer, sizeof(lfn_buffer), snapshot);
+            marlin_vars().media_SFN_path.copy_to(sfn_buffer, sizeof(sfn_buffer), snapshot);
+        } while (snapshot.retry());
     }
 
     // Keep the indentation of the JSON in here!
@@ -394,9 +397,12 @@ json::JsonResult get_job_v1(size_t resume_point, json::JsonOutput &output) {
     char filename[FILE_NAME_MAX_LEN];
     char sfn_path[FILE_PATH_MAX_LEN];
     {
-        auto lock = MarlinVarsLockGuard();
-        marlin_vars().media_LFN.copy_to(filename, sizeof(filename), lock);
-        marlin_vars().media_SFN_path.copy_to(sfn_path, sizeof(sfn_path), lock);
+        // sample LFN+SFN atomically
+        MarlinVarsSnapshot snapshot;
+        do {
+            marlin_vars().media_LFN.copy_to(filename, sizeof(filename), snapshot);
+            marlin_vars().media_SFN_path.copy_to(sfn_path, sizeof(sfn_path), snapshot);
+        } while (snapshot.retry());
     }
 
     bool has_stat { true };
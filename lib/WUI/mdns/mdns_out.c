@@ -55,6 +55,133 @@
 /* Function prototypes */
 static void mdns_clear_outmsg(struct mdns_outmsg *outmsg);
 
+/* Local adjustment, not present in upstream lwIP:
+ *
+ * A single-entry cache of the last fully serialized answer packet.
+ *
+ * On a flat LAN with many discovery clients the same questions arrive over
+ * and over, and the records were serialized (domains, compression and all)
+ * again for every single one of them. An answer built purely from our own
+ * records is fully determined by the reply bitmasks, our address and our
+ * hostname, so its wire form can be kept around and repeated. The stack
+ * writes its headers into whatever pbuf it is handed, so a cache hit still
+ * costs one clone of the packet ‒ but that is a plain memcpy, much cheaper
+ * than the serialization.
+ *
+ * Anything that echoes parts of the incoming packet (legacy queries, probes,
+ * outgoing questions) is not cached. A hostname or address change simply
+ * stops matching the stored key, no explicit invalidation hooks needed.
+ */
+struct mdns_reply_cache {
+    u8_t valid;
+    struct netif *netif;
+    u8_t flags;
+    u8_t cache_flush;
+    u8_t host_replies;
+    u8_t host_reverse_v6_replies;
+    u8_t serv_replies[MDNS_MAX_SERVICES];
+    /* What the records were built from; a mismatch invalidates the entry. */
+    #if LWIP_IPV4
+    ip4_addr_t addr4;
+    #endif
+    char hostname[MDNS_LABEL_MAXLEN + 1];
+    /* The serialized packet, including the DNS header, shrunk to size. */
+    struct pbuf *pbuf;
+};
+
+static struct mdns_reply_cache reply_cache;
+
+/**
+ * Check if a message is eligible for the reply cache.
+ * Only pure answers built from our own records qualify.
+ */
+static u8_t
+mdns_reply_cacheable(struct mdns_outmsg *msg) {
+    int i;
+    u8_t any_reply = msg->host_replies;
+
+    if (msg->tx_id != 0 || msg->legacy_query || msg->host_questions) {
+        return 0;
+    }
+    #if LWIP_MDNS_SEARCH
+    if (msg->query) {
+        return 0;
+    }
+    #endif
+    #if LWIP_IPV6
+    /* The IPv6 answers depend on the whole (stateful) address list of the
+     * netif; not worth keying the cache on all of it. */
+    if ((msg->host_replies & (REPLY_HOST_AAAA | REPLY_HOST_PTR_V6)) || msg->host_reverse_v6_replies) {
+        return 0;
+    }
+    #endif
+    for (i = 0; i < MDNS_MAX_SERVICES; i++) {
+        if (msg->serv_questions[i]) {
+            return 0;
+        }
+        any_reply |= msg->serv_replies[i];
+    }
+    return any_reply != 0;
+}
+
+/**
+ * Check whether the cached packet answers the message as-is.
+ */
+static u8_t
+mdns_reply_cache_hit(struct mdns_outmsg *msg, struct netif *netif) {
+    if (!reply_cache.valid || reply_cache.netif != netif) {
+        return 0;
+    }
+    if (reply_cache.flags != msg->flags || reply_cache.cache_flush != msg->cache_flush) {
+        return 0;
+    }
+    if (reply_cache.host_replies != msg->host_replies || reply_cache.host_reverse_v6_replies != msg->host_reverse_v6_replies) {
+        return 0;
+    }
+    if (memcmp(reply_cache.serv_replies, msg->serv_replies, sizeof(reply_cache.serv_replies)) != 0) {
+        return 0;
+    }
+    #if LWIP_IPV4
+    if (!ip4_addr_cmp(&reply_cache.addr4, netif_ip4_addr(netif))) {
+        return 0;
+    }
+    #endif
+    if (strncmp(reply_cache.hostname, netif->hostname, sizeof(reply_cache.hostname)) != 0) {
+        return 0;
+    }
+    return 1;
+}
+
+/**
+ * Remember a just finalized packet together with its key.
+ * Shall be called before the packet is sent (sending pollutes the pbuf with
+ * the lower layer headers), so it takes a clone.
+ */
+static void
+mdns_reply_cache_store(struct mdns_outmsg *msg, struct netif *netif, struct pbuf *pkt) {
+    if (reply_cache.pbuf) {
+        pbuf_free(reply_cache.pbuf);
+        reply_cache.pbuf = NULL;
+        reply_cache.valid = 0;
+    }
+    reply_cache.pbuf = pbuf_clone(PBUF_TRANSPORT, PBUF_RAM, pkt);
+    if (!reply_cache.pbuf) {
+        return;
+    }
+    reply_cache.netif = netif;
+    reply_cache.flags = msg->flags;
+    reply_cache.cache_flush = msg->cache_flush;
+    reply_cache.host_replies = msg->host_replies;
+    reply_cache.host_reverse_v6_replies = msg->host_reverse_v6_replies;
+    memcpy(reply_cache.serv_replies, msg->serv_replies, sizeof(reply_cache.serv_replies));
+    #if LWIP_IPV4
+    ip4_addr_copy(reply_cache.addr4, *netif_ip4_addr(netif));
+    #endif
+    strncpy(reply_cache.hostname, netif->hostname, sizeof(reply_cache.hostname) - 1);
+    reply_cache.hostname[sizeof(reply_cache.hostname) - 1] = '\0';
+    reply_cache.valid = 1;
+}
+
     #if 0
 Abusing to hardcode prusalink service
 /**
@@ -744,6 +871,20 @@ err_t mdns_create_outpacket(struct netif *netif, struct mdns_outmsg *msg,
 err_t mdns_send_outpacket(struct mdns_outmsg *msg, struct netif *netif) {
     struct mdns_outpacket outpkt;
     err_t res;
+    u8_t cacheable = mdns_reply_cacheable(msg);
+
+    if (cacheable && mdns_reply_cache_hit(msg, netif)) {
+        /* Sending prepends the lower layer headers into the pbuf, so hand
+         * the stack a throwaway copy of the cached packet. */
+        struct pbuf *copy = pbuf_clone(PBUF_TRANSPORT, PBUF_RAM, reply_cache.pbuf);
+        if (copy) {
+            LWIP_DEBUGF(MDNS_DEBUG, ("MDNS: Sending cached packet, len=%d\n", copy->tot_len));
+            res = udp_sendto_if(get_mdns_pcb(), copy, &msg->dest_addr, msg->dest_port, netif);
+            pbuf_free(copy);
+            return res;
+        }
+        /* Out of memory for the clone; build the packet the usual way. */
+    }
 
     memset(&outpkt, 0, sizeof(outpkt));
 
@@ -768,6 +909,10 @@ err_t mdns_send_outpacket(struct mdns_outmsg *msg, struct netif *netif) {
         /* Shrink packet */
         pbuf_realloc(outpkt.pbuf, outpkt.write_offset);
 
+        if (cacheable) {
+            mdns_reply_cache_store(msg, netif, outpkt.pbuf);
+        }
+
         /* Send created packet */
         LWIP_DEBUGF(MDNS_DEBUG, ("MDNS: Sending packet, len=%d\n", outpkt.write_offset));
 
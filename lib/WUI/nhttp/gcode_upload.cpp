@@ -8,6 +8,8 @@
 #include <transfers/files.hpp>
 #include <transfers/changed_path.hpp>
 
+#include <heatshrink_decoder.h>
+
 #include <sys/stat.h>
 #include <cassert>
 #include <cstring>
@@ -46,7 +48,7 @@ using transfers::USB_MOUNT_POINT_LENGTH;
 using Type = ChangedPath::Type;
 using Incident = ChangedPath::Incident;
 
-GcodeUpload::GcodeUpload(PutParams &&uploader, Monitor::Slot &&slot, bool json_errors, size_t length, size_t upload_idx, PartialFile::Ptr &&file, UploadedNotify *uploaded)
+GcodeUpload::GcodeUpload(PutParams &&uploader, Monitor::Slot &&slot, bool json_errors, size_t length, size_t upload_idx, PartialFile::Ptr &&file, UploadedNotify *uploaded, bool compressed)
     : upload(move(uploader))
     , monitor_slot(move(slot))
     , uploaded_notify(uploaded)
@@ -55,7 +57,8 @@ GcodeUpload::GcodeUpload(PutParams &&uploader, Monitor::Slot &&slot, bool json_e
     , cleanup_temp_file(true)
     , tmp_upload_file(move(file))
     , file_idx(upload_idx)
-    , filename_checked(false) {
+    , filename_checked(false)
+    , compressed(compressed) {
 }
 
 GcodeUpload::GcodeUpload(GcodeUpload &&other)
@@ -67,7 +70,8 @@ GcodeUpload::GcodeUpload(GcodeUpload &&other)
     , cleanup_temp_file(other.cleanup_temp_file)
     , tmp_upload_file(move(other.tmp_upload_file))
     , file_idx(other.file_idx)
-    , filename_checked(other.filename_checked) {
+    , filename_checked(other.filename_checked)
+    , compressed(other.compressed) {
     // The ownership of the temp file is passed to the new instance.
     other.cleanup_temp_file = false;
 }
@@ -85,6 +89,7 @@ GcodeUpload &GcodeUpload::operator=(GcodeUpload &&other) {
     tmp_upload_file = move(other.tmp_upload_file);
     file_idx = other.file_idx;
     filename_checked = other.filename_checked;
+    compressed = other.compressed;
 
     return *this;
 }
@@ -121,7 +126,21 @@ GcodeUpload::UploadResult GcodeUpload::start(const RequestParser &parser, Upload
         return StatusPage(Status::LengthRequired, StatusPage::CloseHandling::ErrorClose, json_errors);
     }
 
-    if (parser.content_length.value() == 0) {
+    if (parser.content_encoding == RequestParser::ContentEncoding::Unknown) {
+        // Better to refuse than to store the body undecoded.
+        return StatusPage(Status::UnsupportedMediaType, StatusPage::CloseHandling::ErrorClose, json_errors, nullopt, "Unsupported Content-Encoding");
+    }
+
+    const bool compressed = parser.content_encoding == RequestParser::ContentEncoding::Heatshrink;
+    if (compressed && !parser.uncompressed_length.has_value()) {
+        // We pre-allocate the file, for which the Content-Length (the wire
+        // form) is of no use.
+        return StatusPage(Status::LengthRequired, StatusPage::CloseHandling::ErrorClose, json_errors, nullopt, "Missing Uncompressed-Length");
+    }
+
+    const size_t file_size = compressed ? *parser.uncompressed_length : *parser.content_length;
+
+    if (parser.content_length.value() == 0 || file_size == 0) {
         // Somehow, we never get our ::step called later on due to that. We
         // could hack around it, but supporting 0-sized files seems like a
         // niche thing to spend the time on. At least report it doesn't work
@@ -141,11 +160,14 @@ GcodeUpload::UploadResult GcodeUpload::start(const RequestParser &parser, Upload
     const size_t file_idx = next_transfer_idx();
     const auto fname = transfer_name(file_idx);
 
-    auto preallocated = PartialFile::create(fname.begin(), *parser.content_length);
+    auto preallocated = PartialFile::create(fname.begin(), file_size);
     if (const char **err = get_if<const char *>(&preallocated); err != nullptr) {
         return StatusPage(Status::InsufficientStorage, StatusPage::CloseHandling::ErrorClose, json_errors, nullopt, *err);
     } else {
-        return GcodeUpload(move(uploadParams), move(*slot), json_errors, *parser.content_length, file_idx, move(get<PartialFile::Ptr>(preallocated)), uploaded);
+        // Note: The length we track here is the wire one ‒ that's how much we
+        // expect to read from the connection (and the monitor slot measures
+        // its progress in the same units).
+        return GcodeUpload(move(uploadParams), move(*slot), json_errors, *parser.content_length, file_idx, move(get<PartialFile::Ptr>(preallocated)), uploaded, compressed);
     }
 }
 
@@ -285,12 +307,53 @@ namespace {
 
     class PutTransfer final : public splice::Transfer {
     public:
+        // Parameters of the Content-Encoding: heatshrink decoder. Fixed by
+        // our protocol extension ‒ the client must encode with the same
+        // window and lookahead.
+        static constexpr uint16_t decoder_input_buffer = 256;
+        static constexpr uint8_t decoder_window_sz = 11;
+        static constexpr uint8_t decoder_lookahead_sz = 4;
+
+        struct DecoderDeleter {
+            void operator()(heatshrink_decoder *ptr) {
+                heatshrink_decoder_free(ptr);
+            }
+        };
+
         GcodeUpload::UploadedNotify *uploaded_notify = nullptr;
         PartialFile::Ptr f;
         array<char, FILE_PATH_BUFFER_LEN> filepath;
         bool print_after_upload;
         bool overwrite;
         size_t file_idx;
+        // Set for compressed uploads, null ones take the plain memcpy path.
+        std::unique_ptr<heatshrink_decoder, DecoderDeleter> decoder;
+
+        // Write out whatever is still buffered inside the decoder (the tail
+        // of the stream is produced only after the last input byte is sunk)
+        // and check the stream ended at a byte boundary.
+        bool drain_decoder() {
+            assert(decoder);
+            f->select_cursor(file_cursor);
+            for (;;) {
+                auto buff = f->get_current_buffer(true);
+                if (!holds_alternative<PartialFile::BufferAndSizes>(buff)) {
+                    return false;
+                }
+                const auto buffer = get<PartialFile::BufferAndSizes>(buff);
+                size_t out_used = 0;
+                const auto poll_res = heatshrink_decoder_poll(decoder.get(), buffer.buffer + buffer.offset, buffer.size - buffer.offset, &out_used);
+                if (poll_res == HSDR_POLL_ERROR_NULL || poll_res == HSDR_POLL_ERROR_UNKNOWN) {
+                    return false;
+                }
+                if (out_used > 0 && !f->advance_written(out_used)) {
+                    return false;
+                }
+                if (poll_res != HSDR_POLL_MORE) {
+                    return heatshrink_decoder_finish(decoder.get()) == HSDR_FINISH_DONE;
+                }
+            }
+        }
 
         virtual PartialFile *file() const override {
             return f.get();
@@ -304,6 +367,11 @@ namespace {
             tuple<http::Status, const char *> error { Status::InternalServerError, "Unknown error" };
             switch (result) {
             case Result::Ok: {
+                if (decoder && !drain_decoder()) {
+                    error = { Status::BadRequest, "Corrupt compressed data" };
+                    goto CLEANUP;
+                }
+
                 // Remove the "/usb/" prefix
                 // FIXME: Why? Relict of old / Post / multipart upload?
                 const char *final_filename = filepath.data() + USB_MOUNT_POINT_LENGTH;
@@ -350,6 +418,7 @@ namespace {
             }
         CLEANUP:
             f.reset();
+            decoder.reset();
             if (cleanup_temp_file) {
                 remove(fname.begin());
             }
@@ -357,9 +426,24 @@ namespace {
         }
 
         virtual tuple<size_t, size_t> write(const uint8_t *in, size_t in_size, uint8_t *out, size_t out_size) override {
-            const size_t write_size = std::min(in_size, out_size);
-            memcpy(out, in, write_size);
-            return make_tuple(write_size, write_size);
+            if (!decoder) {
+                const size_t write_size = std::min(in_size, out_size);
+                memcpy(out, in, write_size);
+                return make_tuple(write_size, write_size);
+            }
+
+            size_t in_used = 0;
+            // The heatshrink API is not const-correct, but sink only reads
+            // the buffer.
+            const auto sink_res = heatshrink_decoder_sink(decoder.get(), const_cast<uint8_t *>(in), in_size, &in_used);
+            size_t out_used = 0;
+            const auto poll_res = heatshrink_decoder_poll(decoder.get(), out, out_size, &out_used);
+            if (sink_res < 0 || poll_res == HSDR_POLL_ERROR_NULL || poll_res == HSDR_POLL_ERROR_UNKNOWN) {
+                result = Result::CantWrite;
+            }
+            // Note: Even when the input buffer is full and nothing got sunk,
+            // the poll above produces some output, so we do make progress.
+            return make_tuple(in_used, out_used);
         }
 
         virtual bool progress(size_t len) override {
@@ -477,6 +561,15 @@ void GcodeUpload::step(string_view input, bool terminated_by_client, uint8_t *,
     }
 
     assert(put_transfer.f == nullptr); // No other transfer is happening at the moment.
+    if (compressed) {
+        put_transfer.decoder.reset(heatshrink_decoder_alloc(PutTransfer::decoder_input_buffer, PutTransfer::decoder_window_sz, PutTransfer::decoder_lookahead_sz));
+        if (put_transfer.decoder == nullptr) {
+            out = Step { read, 0, StatusPage(Status::ServiceTemporarilyUnavailable, StatusPage::CloseHandling::ErrorClose, json_errors, nullopt, "Out of memory") };
+            return;
+        }
+    } else {
+        put_transfer.decoder.reset();
+    }
     put_transfer.f = move(tmp_upload_file);
     tmp_upload_file.reset(); // Does move really set it to nullptr, or is it just a copy?
     put_transfer.set_monitor_slot(move(monitor_slot));
@@ -54,12 +54,15 @@ namespace printer {
         // A way how to reconstruct the name of the temporary file.
         size_t file_idx;
         bool filename_checked;
+        // The body comes with Content-Encoding: heatshrink and needs to be
+        // run through the decoder on its way to the file.
+        bool compressed;
 
         virtual Result data(std::string_view data) override;
         virtual Result finish(const char *final_filename, bool start_print) override;
         virtual Result check_filename(const char *filename) const override;
 
-        GcodeUpload(PutParams &&uploader, transfers::Monitor::Slot &&slot, bool json_errors, size_t length, size_t upload_idx, transfers::PartialFile::Ptr &&file, UploadedNotify *uploaded);
+        GcodeUpload(PutParams &&uploader, transfers::Monitor::Slot &&slot, bool json_errors, size_t length, size_t upload_idx, transfers::PartialFile::Ptr &&file, UploadedNotify *uploaded, bool compressed);
 
     public:
         bool want_read() const { return size_rest > 0; }
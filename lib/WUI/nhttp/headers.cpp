@@ -1,5 +1,6 @@
 #include "headers.h"
 
+#include <array>
 #include <cassert>
 #include <cstdlib>
 #include <cstdio>
@@ -49,6 +50,58 @@ namespace {
     };
 
     constexpr const size_t content_buffer_len = 128;
+
+    /*
+     * A complete status line (eg. "HTTP/1.1 200 OK\r\n"), put together at
+     * compile time from the table above. Sending one is then a single memcpy
+     * instead of a snprintf round ‒ and the status-poll endpoints do that
+     * several times a second per client.
+     */
+    struct StatusLine {
+        char text[48] = {};
+        size_t len = 0;
+
+        constexpr StatusLine() = default;
+        constexpr StatusLine(const StatusText &source) {
+            append("HTTP/1.1 ");
+            /*
+             * All the statuses in the table are three-digit (UnknownStatus is
+             * diverted to the runtime fallback before it could get here).
+             */
+            const unsigned code = static_cast<unsigned>(source.status);
+            append_char(static_cast<char>('0' + code / 100));
+            append_char(static_cast<char>('0' + code / 10 % 10));
+            append_char(static_cast<char>('0' + code % 10));
+            append_char(' ');
+            append(source.text);
+            append("\r\n");
+        }
+
+    private:
+        /*
+         * Note: Overflowing the text buffer fails the compilation (an
+         * out-of-bounds access is not a valid constant expression), so a too
+         * long status text can't go unnoticed.
+         */
+        constexpr void append_char(char c) {
+            text[len++] = c;
+        }
+        constexpr void append(const char *s) {
+            for (; *s; s++) {
+                append_char(*s);
+            }
+        }
+    };
+
+    constexpr auto build_status_lines() {
+        std::array<StatusLine, sizeof(texts) / sizeof(*texts)> result = {};
+        for (size_t i = 0; i < result.size(); i++) {
+            result[i] = StatusLine(texts[i]);
+        }
+        return result;
+    }
+
+    constexpr auto status_lines = build_status_lines();
 } // namespace
 
 const StatusText &StatusText::find(Status status) {
@@ -67,33 +120,52 @@ size_t write_headers(uint8_t *buffer, size_t buffer_len, Status status, ContentT
     buffer_len -= 2;
 
     char *buf = reinterpret_cast<char *>(buffer);
+    size_t pos = 0;
+
+    // Copies the string in, truncating silently just as snprintf would.
+    const auto append = [&](const char *text, size_t len) {
+        const size_t copy = std::min(buffer_len - pos, len);
+        memcpy(buf + pos, text, copy);
+        pos += copy;
+    };
+    const auto append_str = [&](const char *text) {
+        append(text, strlen(text));
+    };
+
     const StatusText &text = StatusText::find(status);
-    size_t pos = snprintf(buf, buffer_len,
-        "HTTP/1.1 %u %s\r\n"
-        "Content-Type: %s\r\n"
-        "Connection: %s\r\n",
-        static_cast<unsigned>(status),
-        text.text,
-        to_str(content_type),
-        handling == ConnectionHandling::Close ? "close" : "keep-alive");
-    // snprintf likes to return how much it _would_ print were there enough space.
-    pos = std::min(buffer_len, pos);
+    if (text.status == status && static_cast<unsigned>(status) >= 100) {
+        // The common path ‒ the whole line pre-assembled at compile time.
+        const StatusLine &line = status_lines[&text - texts];
+        append(line.text, line.len);
+    } else {
+        /*
+         * A status outside of our table. The client cares about the number,
+         * not the text, so take the slow path and render the real one.
+         */
+        pos = snprintf(buf, buffer_len, "HTTP/1.1 %u %s\r\n", static_cast<unsigned>(status), text.text);
+        // snprintf likes to return how much it _would_ print were there enough space.
+        pos = std::min(buffer_len, pos);
+    }
+
+    append_str("Content-Type: ");
+    append_str(to_str(content_type));
+    append_str("\r\nConnection: ");
+    append_str(handling == ConnectionHandling::Close ? "close" : "keep-alive");
+    append_str("\r\n");
+
     if (content_length.has_value() && pos < buffer_len) {
         pos += snprintf(buf + pos, buffer_len - pos, "Content-Length: %" PRIu64 "\r\n", *content_length);
         pos = std::min(buffer_len, pos);
     }
-    if (handling == ConnectionHandling::ChunkedKeep && pos < buffer_len) {
-        pos += snprintf(buf + pos, buffer_len - pos, "Transfer-Encoding: chunked\r\n");
-        pos = std::min(buffer_len, pos);
+    if (handling == ConnectionHandling::ChunkedKeep) {
+        append_str("Transfer-Encoding: chunked\r\n");
     }
     if (etag.has_value() && pos < buffer_len) {
         pos += snprintf(buf + pos, buffer_len - pos, "ETag: \"%" PRIu32 "\"\r\n", *etag);
         pos = std::min(buffer_len, pos);
     }
     for (; extra_hdrs && *extra_hdrs; extra_hdrs++) {
-        size_t copy = std::min(buffer_len - pos, strlen(*extra_hdrs));
-        memcpy(buf + pos, *extra_hdrs, copy);
-        pos += copy;
+        append_str(*extra_hdrs);
     }
 
     // That 2 fits, reserved at the top of the function.
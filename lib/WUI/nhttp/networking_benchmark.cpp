@@ -4,6 +4,8 @@
 #include "handler.h"
 #include "headers.h"
 
+#include <cstring>
+
 namespace nhttp::handler {
 
 namespace {
@@ -29,15 +31,18 @@ void NetworkingBenchmark::update_stats() {
 size_t NetworkingBenchmark::print_stats(uint8_t *output, size_t output_size) const {
     const uint32_t duration_ms = ticks_ms() - ticks_ms_started;
     return snprintf(
-        (char *)output, output_size, R"({"duration_ms":%u,"cpu_usage":{"max":%u,"min":%u,"avg":%u,"total":%u,"samples":%u}})",
-        (unsigned)duration_ms, cpu_usage_max, cpu_usage_min, cpu_usage_total / cpu_usage_samples, cpu_usage_total, cpu_usage_samples);
+        (char *)output, output_size, R"({"duration_ms":%u,"bytes":%u,"cpu_usage":{"max":%u,"min":%u,"avg":%u,"total":%u,"samples":%u}})",
+        (unsigned)duration_ms, (unsigned)bytes_transferred, cpu_usage_max, cpu_usage_min, cpu_usage_total / cpu_usage_samples, cpu_usage_total, cpu_usage_samples);
 }
 
 bool NetworkingBenchmark::want_read() const {
     switch (mode) {
     case Mode::Get:
+    case Mode::Latency:
+    case Mode::GetFile:
         return false;
     case Mode::Put:
+    case Mode::PutFile:
         return size_rest > 0;
     }
     return false;
@@ -46,8 +51,11 @@ bool NetworkingBenchmark::want_read() const {
 bool NetworkingBenchmark::want_write() const {
     switch (mode) {
     case Mode::Get:
+    case Mode::Latency:
+    case Mode::GetFile:
         return true;
     case Mode::Put:
+    case Mode::PutFile:
         return size_rest == 0;
     }
     return false;
@@ -72,29 +80,104 @@ void NetworkingBenchmark::step(std::string_view input, bool terminated_by_client
             const size_t written = std::min(output_size, size_rest);
             std::fill(output, output + written, ' ');
             size_rest -= written;
+            bytes_transferred += written;
             return step_continue(0, written, out);
         } else {
             const size_t written = print_stats(output, output_size);
             out = Step { 0, written, Terminating { false, Done::Close } };
             return;
         }
+    case Mode::GetFile:
+        if (!output) {
+            step_continue(0, 0, out);
+            return;
+        }
+        if (!headers_sent) {
+            const size_t written = write_headers(output, output_size, http::Status::Ok, http::ContentType::ApplicationOctetStream, http::ConnectionHandling::Close);
+            headers_sent = true;
+            step_continue(0, written, out);
+            return;
+        }
+        if (size_rest > 0) {
+            const size_t to_read = std::min(output_size, size_rest);
+            const size_t got = fread(output, 1, to_read, source_file.get());
+            if (got == 0) {
+                // Short file or a read error; either way, we can't fulfill
+                // what the headers promised.
+                source_file.reset();
+                step_error(http::Status::InternalServerError, out);
+                return;
+            }
+            size_rest -= got;
+            bytes_transferred += got;
+            step_continue(0, got, out);
+            return;
+        } else {
+            source_file.reset();
+            const size_t written = print_stats(output, output_size);
+            out = Step { 0, written, Terminating { false, Done::Close } };
+            return;
+        }
+    case Mode::Latency: {
+        if (!output) {
+            step_continue(0, 0, out);
+            return;
+        }
+        // Everything in a single step (and a single packet), so the client
+        // measures one round trip. The body is rendered first, because
+        // keep-alive needs a valid Content-Length in the headers.
+        uint8_t body[128];
+        const size_t body_len = print_stats(body, sizeof body);
+        size_t written = write_headers(output, output_size, http::Status::Ok, http::ContentType::ApplicationJson, handling, body_len);
+        if (written + body_len <= output_size) {
+            memcpy(output + written, body, body_len);
+            written += body_len;
+        }
+        out = Step { 0, written, Terminating::for_handling(handling) };
+        return;
+    }
     case Mode::Put:
+    case Mode::PutFile:
         if (terminated_by_client && size_rest > 0) {
+            sink_file.reset();
             step_error(http::Status::BadRequest, out);
             return;
         }
         if (size_rest > 0) {
             const size_t read = std::min(input.size(), size_rest);
-            volatile char dummy_write;
-            for (char c : input.substr(0, read)) {
-                dummy_write = c;
+            if (mode == Mode::PutFile) {
+                if (!sink_file->write(reinterpret_cast<const uint8_t *>(input.data()), read)) {
+                    sink_file.reset();
+                    step_error(http::Status::InsufficientStorage, out);
+                    return;
+                }
+            } else {
+                volatile char dummy_write;
+                for (char c : input.substr(0, read)) {
+                    dummy_write = c;
+                }
+                (void)dummy_write;
             }
-            (void)dummy_write;
             size_rest -= read;
+            bytes_transferred += read;
             step_continue(read, 0, out);
+            return;
+        }
+        if (!output) {
+            step_continue(0, 0, out);
+            return;
         }
         if (!headers_sent) {
-            const size_t written = write_headers(output, output_size, http::Status::Ok, http::ContentType::ApplicationOctetStream, http::ConnectionHandling::Close);
+            if (sink_file) {
+                // Count the flush to storage into the measured time.
+                const bool synced = sink_file->sync();
+                sink_file.reset();
+                if (!synced) {
+                    step_error(http::Status::InsufficientStorage, out);
+                    return;
+                }
+            }
+            const size_t written = write_headers(output, output_size, http::Status::Ok, http::ContentType::ApplicationJson, http::ConnectionHandling::Close);
             headers_sent = true;
             step_continue(0, written, out);
             return;
@@ -6,35 +6,79 @@
 #include "step.h"
 #include "timing.h"
 
+#include <http/types.h>
+#include <transfers/partial_file.hpp>
+#include <unique_file_ptr.hpp>
+
 namespace nhttp::handler {
 
+/// Benchmark surface for on-device measurements of the networking stack.
+///
+/// The point is to be able to compare the ESP link, the lwip configuration
+/// and the server itself across firmware releases on real hardware, without
+/// the storage (or with it, in the File modes) getting in the way. Every
+/// mode finishes its response with a small JSON report of what the server
+/// itself observed (duration, bytes moved, CPU usage), so the client can
+/// compute both ends of the story.
 class NetworkingBenchmark {
 public:
     enum class Mode {
+        /// Source ‒ sends the requested amount of dummy payload, then the report.
         Get,
+        /// Sink ‒ eats the request body without storing it, then sends the report.
         Put,
+        /// A minimal response produced in a single step, for round-trip
+        /// measurements (supports keep-alive, so the TCP handshake can be
+        /// excluded from the measurement).
+        Latency,
+        /// Sink that goes through the real storage path ‒ the same
+        /// PartialFile machinery the uploads use.
+        PutFile,
+        /// Source that reads the benchmark file (left by PutFile) back from
+        /// the flash drive.
+        GetFile,
     };
 
+    /// Where the File modes keep their data. Can be cleaned up by DELETE.
+    static constexpr const char *FILE_PATH = "/usb/networking-benchmark.tmp";
+
 private:
     Mode mode;
     size_t size_rest;
     bool headers_sent;
+    http::ConnectionHandling handling;
     uint32_t ticks_ms_started;
     int cpu_usage_max = 0;
     int cpu_usage_min = 100;
     int cpu_usage_total = 0;
     int cpu_usage_samples = 0;
+    size_t bytes_transferred = 0;
+    /// Set in the PutFile mode, null otherwise.
+    transfers::PartialFile::Ptr sink_file;
+    /// Set in the GetFile mode, null otherwise.
+    unique_file_ptr source_file;
 
     void update_stats();
     size_t print_stats(uint8_t *output, size_t output_size) const;
 
 public:
-    NetworkingBenchmark(Mode mode, size_t size_rest)
+    NetworkingBenchmark(Mode mode, size_t size_rest, http::ConnectionHandling handling = http::ConnectionHandling::Close)
         : mode { mode }
         , size_rest { size_rest }
         , headers_sent { false }
+        , handling { handling }
         , ticks_ms_started { ticks_ms() } {}
 
+    NetworkingBenchmark(size_t size_rest, transfers::PartialFile::Ptr &&file)
+        : NetworkingBenchmark(Mode::PutFile, size_rest) {
+        sink_file = std::move(file);
+    }
+
+    NetworkingBenchmark(size_t size_rest, unique_file_ptr &&file)
+        : NetworkingBenchmark(Mode::GetFile, size_rest) {
+        source_file = std::move(file);
+    }
+
     bool want_read() const;
     bool want_write() const;
     void step(std::string_view input, bool terminated_by_client, uint8_t *output, size_t output_size, Step &out);
@@ -2,12 +2,56 @@
 
 #include "networking_benchmark.h"
 
+#include <str_utils.hpp>
+#include <transfers/partial_file.hpp>
+#include <unique_file_ptr.hpp>
+
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
+
 namespace nhttp::handler {
 
+using std::get;
+using std::get_if;
+using std::string_view;
+using transfers::PartialFile;
+
+namespace {
+
+    // How much a GET can ask for. Anything bigger is likely a typo and would
+    // just hog the connection for ages.
+    constexpr size_t max_get_size = 256 * 1024 * 1024;
+    constexpr size_t default_get_size = 1024 * 1024;
+
+    // Extract the desired payload size from the query part of the url
+    // (eg. /networking-benchmark?size=16777216).
+    size_t get_size(string_view query) {
+        const size_t pos = query.find("size=");
+        if (pos == query.npos) {
+            return default_get_size;
+        }
+        const string_view value = query.substr(pos + strlen("size="));
+        size_t result = 0;
+        if (from_chars_light(value.begin(), value.end(), result).ec != std::errc {}) {
+            return default_get_size;
+        }
+        return std::min(result, max_get_size);
+    }
+
+} // namespace
+
 const NetworkingBenchmarkSelector networking_benchmark_selector;
 
 Selector::Accepted NetworkingBenchmarkSelector::accept(const handler::RequestParser &parser, Step &out) const {
-    if (parser.uri() == "/networking-benchmark") {
+    string_view path = parser.uri();
+    string_view query;
+    if (const size_t q = path.find('?'); q != path.npos) {
+        query = path.substr(q + 1);
+        path = path.substr(0, q);
+    }
+
+    if (path == "/networking-benchmark") {
         switch (parser.method) {
         case http::Method::Put:
             if (parser.content_length.has_value()) {
@@ -17,13 +61,68 @@ Selector::Accepted NetworkingBenchmarkSelector::accept(const handler::RequestPar
             }
             return Accepted::Accepted;
         case http::Method::Get:
-            out.next = NetworkingBenchmark(NetworkingBenchmark::Mode::Get, 1024 * 1024);
+            out.next = NetworkingBenchmark(NetworkingBenchmark::Mode::Get, get_size(query));
             return Accepted::Accepted;
         default:
             out.next = StatusPage(http::Status::MethodNotAllowed, parser);
             return Accepted::Accepted;
         }
     }
+
+    if (path == "/networking-benchmark/latency") {
+        if (parser.method == http::Method::Get) {
+            const auto handling = parser.can_keep_alive() ? http::ConnectionHandling::ContentLengthKeep : http::ConnectionHandling::Close;
+            out.next = NetworkingBenchmark(NetworkingBenchmark::Mode::Latency, 0, handling);
+        } else {
+            out.next = StatusPage(http::Status::MethodNotAllowed, parser);
+        }
+        return Accepted::Accepted;
+    }
+
+    if (path == "/networking-benchmark/file") {
+        switch (parser.method) {
+        case http::Method::Put: {
+            if (!parser.content_length.has_value()) {
+                out.next = StatusPage(http::Status::LengthRequired, parser);
+                return Accepted::Accepted;
+            }
+            auto preallocated = PartialFile::create(NetworkingBenchmark::FILE_PATH, *parser.content_length);
+            if (const char **err = get_if<const char *>(&preallocated); err != nullptr) {
+                out.next = StatusPage(http::Status::InsufficientStorage, StatusPage::CloseHandling::ErrorClose, parser.accepts_json, std::nullopt, *err);
+            } else {
+                out.next = NetworkingBenchmark(*parser.content_length, std::move(get<PartialFile::Ptr>(preallocated)));
+            }
+            return Accepted::Accepted;
+        }
+        case http::Method::Get: {
+            unique_file_ptr f(fopen(NetworkingBenchmark::FILE_PATH, "rb"));
+            if (!f) {
+                out.next = StatusPage(http::Status::NotFound, parser);
+                return Accepted::Accepted;
+            }
+            fseek(f.get(), 0, SEEK_END);
+            const long size = ftell(f.get());
+            fseek(f.get(), 0, SEEK_SET);
+            if (size <= 0) {
+                out.next = StatusPage(http::Status::NotFound, parser);
+                return Accepted::Accepted;
+            }
+            out.next = NetworkingBenchmark(size_t(size), std::move(f));
+            return Accepted::Accepted;
+        }
+        case http::Method::Delete:
+            if (remove(NetworkingBenchmark::FILE_PATH) == 0) {
+                out.next = StatusPage(http::Status::NoContent, parser);
+            } else {
+                out.next = StatusPage(http::Status::NotFound, parser);
+            }
+            return Accepted::Accepted;
+        default:
+            out.next = StatusPage(http::Status::MethodNotAllowed, parser);
+            return Accepted::Accepted;
+        }
+    }
+
     return Accepted::NextSelector;
 }
 
@@ -61,6 +61,7 @@ RequestParser::RequestParser(const Server &server)
     , print_after_upload(false)
     , overwrite_file(false)
     , create_folder(false)
+    , content_encoding(ContentEncoding::Identity)
     // default authentication method when none comes
     , auth_status(DigestAuthParams()) {}
 
@@ -178,6 +179,25 @@ ExecutionControl RequestParser::event(Event event) {
         }
         *content_length = 10 * *content_length + (event.payload - '0');
         return ExecutionControl::Continue;
+    case Names::UncompressedLength:
+        if (!uncompressed_length.has_value()) {
+            uncompressed_length = 0;
+        }
+        *uncompressed_length = 10 * *uncompressed_length + (event.payload - '0');
+        return ExecutionControl::Continue;
+    case Names::ContentEncodingHeader:
+        /*
+         * The header is present. Unless one of the tokens we know follows,
+         * it stays an encoding we can't decode.
+         */
+        content_encoding = ContentEncoding::Unknown;
+        return ExecutionControl::Continue;
+    case Names::ContentEncodingIdentity:
+        content_encoding = ContentEncoding::Identity;
+        return ExecutionControl::Continue;
+    case Names::ContentEncodingHeatshrink:
+        content_encoding = ContentEncoding::Heatshrink;
+        return ExecutionControl::Continue;
     case Names::Version:
         switch (event.payload) {
         case '.':
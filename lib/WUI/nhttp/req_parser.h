@@ -51,7 +51,27 @@ private:
 
 public:
     /*************   These are the parsed variables that can be used by the selector *******/
+    /**
+     * \brief Content-Encoding of the request body.
+     */
+    enum class ContentEncoding : uint8_t {
+        /// No header or an explicit identity ‒ the body is as-is.
+        Identity,
+        /// Compressed by heatshrink (our own extension, see gcode_upload).
+        Heatshrink,
+        /// Some encoding we don't implement. A body in it shall be refused.
+        Unknown,
+    };
+
     std::optional<size_t> content_length;
+    /**
+     * \brief Size of the body after decompression.
+     *
+     * Our Uncompressed-Length header. With a compressed body, the
+     * Content-Length describes only the wire form, but handlers that
+     * pre-allocate the file need to know how big it'll get once decoded.
+     */
+    std::optional<size_t> uncompressed_length;
     /**
      * \brief Decoded etag.
      *
@@ -93,6 +113,7 @@ public:
     bool print_after_upload : 1;
     bool overwrite_file : 1;
     bool create_folder : 1;
+    ContentEncoding content_encoding : 2;
 
 private:
     struct DigestAuthParams {
@@ -39,10 +39,11 @@ bool Server::InactivityTimeout::past() const {
 }
 
 void Server::ConnectionSlot::release_buffer() {
-    if (buffer) {
-        buffer->reset();
-        buffer = nullptr;
+    for (size_t i = 0; i < buffer_queue_size; i++) {
+        buffer_queue[i]->reset();
+        buffer_queue[i] = nullptr;
     }
+    buffer_queue_size = 0;
 }
 
 void Server::ConnectionSlot::release_partial() {
@@ -64,7 +65,7 @@ uint16_t Server::ConnectionSlot::send_space() const {
 }
 
 bool Server::ConnectionSlot::has_unacked_data() const {
-    return buffer != nullptr;
+    return buffer_queue_size > 0;
 }
 
 bool Server::ConnectionSlot::want_read() const {
@@ -109,6 +110,7 @@ void Server::ConnectionSlot::release() {
     release_partial();
     release_buffer();
     client_closed = false;
+    idle_warm = false;
     Slot::release();
     server->try_send_transfer_response(this);
 }
@@ -143,11 +145,17 @@ bool Server::ConnectionSlot::take_pbuf(pbuf *data) {
 }
 
 void Server::inject_transfer(altcp_pcb *conn, pbuf *data, uint16_t data_offset, splice::Transfer *transfer, size_t expected_data) {
-    TransferSlot *dest = &transfer_slot;
     // We are asked to perform a transfer from socket -> file. For that we:
-    // * Assume the transfer slot is free (must be ensured by the caller).
+    // * Assume a transfer slot is free (must be ensured by the caller).
     // * Migrate an existing connection into it.
-    assert(dest->transfer == nullptr);
+    TransferSlot *dest = nullptr;
+    for (auto &slot : transfer_slots) {
+        if (slot.transfer == nullptr) {
+            dest = &slot;
+            break;
+        }
+    }
+    assert(dest != nullptr);
     // We are not allowed to go to the transfer at the same time as writing
     // data (too complex and not needed).
     dest->transfer = transfer;
@@ -167,7 +175,7 @@ void Server::inject_transfer(altcp_pcb *conn, pbuf *data, uint16_t data_offset,
         dest->pbuf_processed = data_offset;
     }
 
-    transfer_slot.forward_progress();
+    dest->forward_progress();
 }
 
 void Server::ConnectionSlot::step(string_view input, uint8_t *output, size_t out_size) {
@@ -179,9 +187,12 @@ void Server::ConnectionSlot::step(string_view input, uint8_t *output, size_t out
 
     assert(s.read <= input.size());
     assert(s.written <= out_size);
-    assert(s.written == 0 || buffer);
+    assert(s.written == 0 || output != nullptr);
     partial_consumed += s.read;
     if (s.written > 0) {
+        // The output points into the newest buffer in the queue.
+        assert(buffer_queue_size > 0);
+        Buffer *buffer = buffer_queue[buffer_queue_size - 1];
         assert(buffer->write_len == 0);
         assert(buffer->write_pos == 0);
         assert(buffer->acked == 0);
@@ -235,7 +246,7 @@ bool Server::ConnectionSlot::step() {
          * retransmits to send buffer now belonging to someone else. Abort in
          * that case.
          */
-        if (buffer) {
+        if (buffer_queue_size > 0) {
             release();
             remove_callbacks(conn);
             altcp_abort(conn);
@@ -249,16 +260,26 @@ bool Server::ConnectionSlot::step() {
         return true;
     }
 
-    if (buffer) {
-        if (buffer->acked == buffer->write_len) {
-            release_buffer();
-            return true;
+    if (buffer_queue_size > 0 && buffer_queue[0]->acked == buffer_queue[0]->write_len) {
+        // The oldest buffer is fully acked, return it to the pool.
+        buffer_queue[0]->reset();
+        for (size_t i = 1; i < buffer_queue_size; i++) {
+            buffer_queue[i - 1] = buffer_queue[i];
         }
+        buffer_queue_size--;
+        buffer_queue[buffer_queue_size] = nullptr;
+        return true;
+    }
 
-        /*
-         * Try to advance in/out buffers as much as possible. This'll get us closer
-         * to releasing resources.
-         */
+    /*
+     * Try to advance in/out buffers as much as possible. This'll get us closer
+     * to releasing resources.
+     *
+     * The response must go out in order, so we can't submit data from a later
+     * buffer before the earlier ones are fully handed over to LwIP.
+     */
+    for (size_t i = 0; i < buffer_queue_size; i++) {
+        Buffer *buffer = buffer_queue[i];
         assert(buffer->write_pos <= buffer->write_len);
         const auto to_send = std::min(static_cast<uint16_t>(buffer->write_len - buffer->write_pos), send_space());
         if (to_send > 0 && altcp_write(conn, buffer->data.begin() + buffer->write_pos, to_send, 0) == ERR_OK) {
@@ -266,17 +287,22 @@ bool Server::ConnectionSlot::step() {
             altcp_output(conn);
             server->activity(conn, this);
             return true;
-        } else {
-            /*
-             * Couldn't send more (no space? Nothing to send?), but we are
-             * still waiting for some acks. Keep waiting, don't do anything
-             * else until we get rid of that data.
-             *
-             * (We could probably still try consuming more input, but being
-             * able to and having it would be rare and would complicate things.)
-             */
-            return false;
         }
+        if (buffer->write_pos < buffer->write_len) {
+            break;
+        }
+    }
+
+    if (buffer_queue_size == buffer_queue.size()) {
+        /*
+         * All buffers in flight and couldn't send more (no space? Nothing
+         * to send?), but we are still waiting for some acks. Keep waiting,
+         * don't do anything else until we get rid of some of that data.
+         *
+         * (We could probably still try consuming more input, but being
+         * able to and having it would be rare and would complicate things.)
+         */
+        return false;
     }
 
     /*
@@ -309,19 +335,27 @@ bool Server::ConnectionSlot::step() {
         }
     }
 
-    if (wr) {
-        const uint16_t queue_size = send_space();
+    if (wr && buffer_queue_size < buffer_queue.size()) {
         Buffer *empty = server->find_empty_buffer();
 
-        if (queue_size > 0 && empty) {
-            buffer = empty;
-            buffer->owned = true;
-            output = buffer->data.begin();
-            output_size = buffer->data.size();
+        /*
+         * The first buffer is worth taking only if we can send something out
+         * right away. The further ones are prepared in advance even with the
+         * window full ‒ that's their whole point, having the next chunk ready
+         * the moment acks free some space.
+         */
+        if (empty && (buffer_queue_size > 0 || send_space() > 0)) {
+            empty->owned = true;
+            buffer_queue[buffer_queue_size++] = empty;
+            output = empty->data.begin();
+            output_size = empty->data.size();
         }
     }
 
     if (!input.empty() || invoke_client_close || output) {
+        // No longer sitting around waiting for a request, the slot is earning
+        // its keep again.
+        idle_warm = false;
         server->activity(conn, this);
         step(input, output, output_size);
         // Note: The step can take extensive amount of time - specifically, it
@@ -332,6 +366,31 @@ bool Server::ConnectionSlot::step() {
         return true;
     }
 
+    if (buffer_queue_size > 0) {
+        /*
+         * Some response data still in flight. LwIP may need the buffers for
+         * retransmits, so we can't shut down or close yet.
+         *
+         * But if the client already pipelined its next request and the whole
+         * response has been handed over to LwIP, we can start parsing right
+         * away ‒ the buffers of the next response queue up behind the current
+         * one, so the ordering stays intact.
+         */
+        bool all_submitted = true;
+        for (size_t i = 0; i < buffer_queue_size; i++) {
+            if (buffer_queue[i]->write_pos < buffer_queue[i]->write_len) {
+                all_submitted = false;
+                break;
+            }
+        }
+        if (const Terminating *t = get_if<Terminating>(&state); t && t->how == Done::KeepAlive && partial && all_submitted) {
+            state.emplace<handler::RequestParser>(*server);
+            server->activity(conn, this);
+            return true;
+        }
+        return false;
+    }
+
     if (!wr) {
         if (Terminating *t = get_if<Terminating>(&state); t && t->shutdown_send) {
             t->shutdown_send = false;
@@ -357,6 +416,24 @@ bool Server::ConnectionSlot::step() {
                     altcp_setprio(conn, ACTIVE_PRIO);
                     altcp_arg(conn, this);
                     server->activity(conn, this);
+                } else if (server->find_empty_slot() != nullptr) {
+                    /*
+                     * There's still a free slot left for any newcomer, so we
+                     * can afford to keep this connection warm in ours. The
+                     * next request on it (the status-polling clients send one
+                     * every second or so) skips the round trip through the
+                     * idle pool and the slot reacquisition.
+                     *
+                     * If nothing comes, the inactivity timeout demotes us to
+                     * the idle pool, just like releasing here would. And if
+                     * someone else needs the slot sooner, they take it (see
+                     * evict_warm_slot).
+                     */
+                    state.emplace<handler::RequestParser>(*server);
+                    idle_warm = true;
+                    altcp_setprio(conn, ACTIVE_PRIO);
+                    altcp_arg(conn, this);
+                    server->activity(conn, this);
                 } else {
                     release();
                 }
@@ -398,7 +475,9 @@ Server::Server(const ServerDefs &defs)
     for (auto &slot : active_slots) {
         slot.server = this;
     }
-    transfer_slot.server = this;
+    for (auto &slot : transfer_slots) {
+        slot.server = this;
+    }
 }
 
 err_t Server::accept_wrap(void *me, struct altcp_pcb *new_conn, err_t err) {
@@ -488,6 +567,20 @@ err_t Server::idle_conn_wrap(void *slot, altcp_pcb *conn) {
     Slot *active_slot = nullptr;
     if (is_active_slot(slot)) {
         active_slot = static_cast<Slot *>(slot);
+        if (active_slot->get_slot_type() == BaseSlot::SlotType::ConnectionSlot && static_cast<ConnectionSlot *>(active_slot)->idle_warm) {
+            /*
+             * A kept-warm keep-alive connection that got no new request. It
+             * is not broken, just quiet ‒ demote it to the idle pool (where
+             * it would have gone right away without the keeping warm) instead
+             * of killing it.
+             */
+            Server *server = active_slot->server;
+            altcp_setprio(conn, IDLE_PRIO);
+            altcp_arg(conn, server->idle_slots.begin());
+            server->activity(conn, server->idle_slots.begin());
+            active_slot->release();
+            return ERR_OK;
+        }
         send_goodbye = active_slot->want_read();
         has_unacked_data = active_slot->has_unacked_data();
     }
@@ -543,10 +636,16 @@ err_t Server::received_wrap(void *raw_slot, struct altcp_pcb *conn, pbuf *data,
         /*
          * The connection was not yet active. Find a slot for it and activate it.
          */
-        if (ConnectionSlot *active_slot = base_slot->server->find_empty_slot(); active_slot != nullptr) {
+        ConnectionSlot *active_slot = base_slot->server->find_empty_slot();
+        if (active_slot == nullptr) {
+            // Kept-warm keep-alive connections are idle in practice; kick one
+            // back to the idle pool to make room for the actual traffic.
+            active_slot = base_slot->server->evict_warm_slot();
+        }
+        if (active_slot != nullptr) {
             assert(!active_slot->partial);
             assert(active_slot->partial_consumed == 0);
-            assert(!active_slot->buffer);
+            assert(active_slot->buffer_queue_size == 0);
             assert(holds_alternative<Idle>(active_slot->state));
 
             active_slot->state.emplace<handler::RequestParser>(*active_slot->server);
@@ -602,12 +701,17 @@ err_t Server::sent_wrap(void *raw_slot, altcp_pcb *conn, uint16_t len) {
 }
 
 void Server::ConnectionSlot::sent(uint16_t len) {
-    assert(buffer != nullptr);
-    assert(buffer->write_pos >= buffer->acked);
-    const uint16_t unacked = buffer->write_pos - buffer->acked;
-    assert(len <= unacked);
-    (void)unacked; // No warnings on release
-    buffer->acked += len;
+    assert(buffer_queue_size > 0);
+    // Acks belong to the oldest data and the queue is in the send order.
+    for (size_t i = 0; i < buffer_queue_size && len > 0; i++) {
+        Buffer *buffer = buffer_queue[i];
+        assert(buffer->write_pos >= buffer->acked);
+        const uint16_t unacked = buffer->write_pos - buffer->acked;
+        const uint16_t acked_here = std::min<uint16_t>(len, unacked);
+        buffer->acked += acked_here;
+        len -= acked_here;
+    }
+    assert(len == 0);
 }
 
 void Server::sent(Slot *slot, uint16_t len) {
@@ -633,7 +737,9 @@ void Server::step() {
         }
     }
 
-    transfer_slot.forward_progress();
+    for (auto &slot : transfer_slots) {
+        slot.forward_progress();
+    }
 }
 
 bool Server::is_active_slot(void *slot) {
@@ -671,6 +777,24 @@ Server::ConnectionSlot *Server::find_empty_slot() {
     return nullptr;
 }
 
+Server::ConnectionSlot *Server::evict_warm_slot() {
+    for (auto &slot : active_slots) {
+        if (slot.idle_warm) {
+            assert(slot.conn != nullptr);
+            altcp_setprio(slot.conn, IDLE_PRIO);
+            altcp_arg(slot.conn, idle_slots.begin());
+            activity(slot.conn, idle_slots.begin());
+            slot.release();
+            // The release may have handed the slot over to a pending transfer
+            // response; only a slot that stayed empty is of any use.
+            if (slot.is_empty()) {
+                return &slot;
+            }
+        }
+    }
+    return nullptr;
+}
+
 Server::Buffer *Server::find_empty_buffer() {
     for (auto &buffer : buffers) {
         if (!buffer.owned) {
@@ -706,11 +830,21 @@ void Server::stop() {
     // Note: Letting the rest of the connections to live on!
 }
 
+void Server::TransferSlot::detach_written_callback() {
+    for (auto &other : server->transfer_slots) {
+        if (&other != this && other.transfer != nullptr && other.transfer->file() == transfer->file()) {
+            transfer->file()->set_written_callback(send_segment_written, &other);
+            return;
+        }
+    }
+    transfer->file()->set_written_callback(nullptr, nullptr);
+}
+
 void Server::TransferSlot::release() {
     if (transfer != nullptr) {
         // Just make sure each file gets closed and transfer gets done.
         transfer->result = splice::Result::Timeout;
-        transfer->file()->set_written_callback(nullptr, nullptr);
+        detach_written_callback();
         if (expected_data != 0 && transfer->result == splice::Result::Ok) {
             transfer->result = splice::Result::ClosedByClient;
         }
@@ -750,7 +884,7 @@ bool Server::TransferSlot::step() {
 
     if (expected_data == 0) {
         // Peer closed or we received all the data
-        transfer->file()->set_written_callback(nullptr, nullptr);
+        detach_written_callback();
         auto res = transfer->done();
 
         if (res.has_value()) {
@@ -919,8 +1053,12 @@ void Server::TransferSlot::sent(uint16_t) {
 }
 
 void Server::try_send_transfer_response(ConnectionSlot *slot) {
-    if (transfer_slot.has_response()) {
-        transfer_slot.make_response(slot);
+    for (auto &transfer_slot : transfer_slots) {
+        if (transfer_slot.has_response()) {
+            transfer_slot.make_response(slot);
+            // Further responses (if any) need to find their own connection slot.
+            slot = nullptr;
+        }
     }
 }
 
@@ -962,7 +1100,11 @@ void Server::TransferSlot::segment_written(void *arg) {
     assert(arg != nullptr);
     TransferSlot *slot = static_cast<TransferSlot *>(arg);
     assert(slot->get_slot_type() == SlotType::TransferSlot);
-    slot->forward_progress();
+    // The slots may share one file (the parallel download), in which case the
+    // notification is registered on behalf of only one of them - wake up all.
+    for (auto &other : slot->server->transfer_slots) {
+        other.forward_progress();
+    }
 }
 
 void Server::TransferSlot::send_segment_written(void *arg) {
@@ -263,8 +263,28 @@ private:
 
     public:
         handler::ConnectionState state;
-        // Owning a buffer?
-        Buffer *buffer = nullptr;
+        static constexpr size_t BufferQueueMax = 2;
+        // Buffers holding parts of the response, oldest first.
+        //
+        // The 0 index is the oldest one (closest to being acked and
+        // returned to the pool), new ones are appended at the end.
+        //
+        // All the data is handed to LwIP without TCP_WRITE_FLAG_COPY, so
+        // each buffer stays with us until the other side acks it. Keeping
+        // more than one lets the handler prepare the next chunk of the
+        // response (which often means a slow file read) while the previous
+        // one still waits for the acks, overlapping the IO with the
+        // network round trip.
+        std::array<Buffer *, BufferQueueMax> buffer_queue = {};
+        // # of buffers in the queue.
+        size_t buffer_queue_size = 0;
+        // A keep-alive connection we kept in the slot after finishing a
+        // request, with a parser ready for the next one (clients polling the
+        // status endpoints reuse the connection all the time and this way
+        // they skip the round trip through the idle pool). Cleared the moment
+        // any input shows up; while set, the slot can be taken back (demoted
+        // to the idle pool) whenever someone else needs it.
+        bool idle_warm = false;
         // Do we have a partially processed pbuf, with data left for later?
         PbufPtr partial;
         size_t partial_consumed = 0;
@@ -332,9 +352,17 @@ private:
         static void segment_written(void *arg);
         // The same, but not in our thread (this one is wrapper that sends it to tcpip thread).
         static void send_segment_written(void *arg);
+
+    private:
+        // Stop receiving the written notifications for our file - or, in case
+        // another slot has the same file open (the parallel download), hand
+        // them over to that one.
+        void detach_written_callback();
     };
 
-    TransferSlot transfer_slot;
+    // Two slots so the parallel download can run both its connections through
+    // us at the same time; everything else uses just one of them.
+    std::array<TransferSlot, 2> transfer_slots;
 
     /*
      * There's an activity on the given connection. Reset appropriate timeouts.
@@ -362,6 +390,9 @@ private:
     void try_send_transfer_response(ConnectionSlot *slot);
 
     ConnectionSlot *find_empty_slot();
+    // Frees up a slot kept warm for a keep-alive connection (if any), by
+    // demoting its connection to the idle pool. Returns the freed slot.
+    ConnectionSlot *evict_warm_slot();
     Buffer *find_empty_buffer();
     void step();
 
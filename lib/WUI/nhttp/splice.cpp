@@ -20,6 +20,7 @@ tuple<size_t, Result> Transfer::write(const uint8_t *in, size_t in_size) {
 
     // Get out buffer
     auto f = file();
+    f->select_cursor(file_cursor);
     auto buff = f->get_current_buffer(false);
     if (holds_alternative<PartialFile::WouldBlock>(buff)) {
         return make_tuple(0, res);
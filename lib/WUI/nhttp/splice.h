@@ -39,6 +39,12 @@ namespace splice {
         //
         // Successive writes shall be skipped, the connection aborted.
         Result result = Result::Ok;
+        // Which write cursor of the PartialFile this transfer writes through.
+        //
+        // The parallel download gives each of its connections a separate
+        // cursor, so their writes can interleave here (on the tcpip thread)
+        // without stealing each other's buffered sector.
+        uint8_t file_cursor = 0;
         // Called from whatever thread!
         virtual transfers::PartialFile *file() const = 0;
 
@@ -48,8 +54,9 @@ namespace splice {
         //
         // It may be a simple memcpy, but it also can do an arbitrary
         // transformation. It returns how much of in-buffer and out-buffer was
-        // actually used. At least one of them must be non-zero and these
-        // numbers can be different.
+        // actually used; the numbers can be different. Both may be zero only
+        // in case the transfer can't accept data right now (eg. it is being
+        // rate-limited) ‒ that propagates as the would-block result.
         virtual std::tuple<size_t, size_t> write(const uint8_t *in, size_t in_size, uint8_t *out, size_t out_size) = 0;
 
         // Is supposed to close the file.
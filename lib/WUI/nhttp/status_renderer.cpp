@@ -19,7 +19,10 @@ namespace nhttp::handler {
 json::JsonResult StatusRenderer::renderState(size_t resume_point, json::JsonOutput &output, StatusState &state) const {
     // Note: We allow stale, because if it was not there the state.transfer_id
     // will be nullopt and we will not send it anyway
-    auto transfer_status = Monitor::instance.status(true);
+    //
+    // A lock-free snapshot, so this frequent polling doesn't block the
+    // transfer thread.
+    auto transfer_status = Monitor::instance.snapshot(true);
     if (transfer_status.has_value() && transfer_status->id != state.transfer_id) {
         // if transfer changes mid report, bail out
         transfer_status.reset();
@@ -27,7 +27,9 @@ JsonResult TransferRenderer::renderState(size_t resume_point, json::JsonOutput &
 JsonResult TransferRenderer::renderStateV1(size_t resume_point, json::JsonOutput &output, TransferState &state) const {
     // Note: We allow stale, because we already checked there was a trasnfer running
     // in prusa_link_api, so even if it ended, we want to report it.
-    auto transfer_status = Monitor::instance.status(true);
+    //
+    // A lock-free snapshot, so polling this doesn't block the transfer thread.
+    auto transfer_status = Monitor::instance.snapshot(true);
     if (transfer_status.has_value() && transfer_status->id != state.transfer_id) {
         // if transfer changes mid report, bail out
         transfer_status.reset();
@@ -39,8 +41,8 @@ JsonResult TransferRenderer::renderStateV1(size_t resume_point, json::JsonOutput
     //  transfer information anyway, so maybe not a big deal?
     char filepath[FILE_PATH_BUFFER_LEN];
     char lfn[FILE_NAME_BUFFER_LEN];
-    if (transfer_status.has_value() && transfer_status->destination) {
-        strlcpy(filepath, transfer_status->destination, sizeof(filepath));
+    if (transfer_status.has_value() && transfer_status->destination()) {
+        strlcpy(filepath, transfer_status->destination(), sizeof(filepath));
         get_SFN_path(filepath);
         get_LFN(lfn, sizeof(lfn), filepath);
         dirname(filepath);
@@ -70,7 +72,9 @@ JsonResult TransferRenderer::renderStateV1(size_t resume_point, json::JsonOutput
 JsonResult TransferRenderer::renderStateOctoprint(size_t resume_point, json::JsonOutput &output, TransferState &state) const {
     // Note: We allow stale, because we already checked there was a trasnfer running
     // in prusa_link_api, so even if it ended, we want to report it.
-    auto transfer_status = Monitor::instance.status(true);
+    //
+    // A lock-free snapshot, so polling this doesn't block the transfer thread.
+    auto transfer_status = Monitor::instance.snapshot(true);
     if (transfer_status.has_value() && transfer_status->id != state.transfer_id) {
         // if transfer changes mid report, bail out
         transfer_status.reset();
@@ -90,8 +94,8 @@ JsonResult TransferRenderer::renderStateOctoprint(size_t resume_point, json::Jso
             JSON_FIELD_BOOL_G(transfer_status.has_value(), "to_print", transfer_status->print_after_upload) JSON_COMMA;
             // Note: This works, because destination cannot go from non null to null
             // (if one transfer ends and another starts mid report, we bail out)
-            if (transfer_status->destination) {
-                JSON_FIELD_STR_G(transfer_status.has_value(), "destination", transfer_status->destination) JSON_COMMA;
+            if (transfer_status->destination()) {
+                JSON_FIELD_STR_G(transfer_status.has_value(), "destination", transfer_status->destination()) JSON_COMMA;
             }
             JSON_FIELD_FFIXED_G(transfer_status.has_value(), "progress", transfer_status->progress_estimate(), 2) JSON_COMMA;
             JSON_FIELD_INT_G(transfer_status.has_value(), "remaining_time", transfer_status->time_remaining_estimate());
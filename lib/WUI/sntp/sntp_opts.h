@@ -56,6 +56,14 @@
     #define SNTP_SET_SYSTEM_TIME(sec) sntp_set_system_time(sec)
 #endif
 
+/** Take the microsecond variant - besides the RTC, the samples also feed the
+ * smoothed wall clock (src/common/wall_clock.hpp), which wants the extra
+ * precision for drift estimation.
+ */
+#if !defined SNTP_SET_SYSTEM_TIME_US || defined __DOXYGEN__
+    #define SNTP_SET_SYSTEM_TIME_US(sec, us) sntp_set_system_time_us(sec, us)
+#endif
+
 /** The maximum number of SNTP servers that can be set */
 #if !defined SNTP_MAX_SERVERS || defined __DOXYGEN__
     #define SNTP_MAX_SERVERS LWIP_DHCP_MAX_NTP_SERVERS
@@ -28,6 +28,8 @@
 #include <lwip/netifapi.h>
 #include <lwip/netif.h>
 #include <lwip/tcpip.h>
+#include <lwip/stats.h>
+#include <lwip/memp.h>
 #include <freertos/mutex.hpp>
 #include <mutex>
 #include "http_lifetime.h"
@@ -41,6 +43,7 @@
 #include <config_store/store_instance.hpp>
 #include <nhttp/server.h>
 #include <random.h>
+#include "metric.h"
 
 LOG_COMPONENT_DEF(WUI, logging::Severity::debug);
 LOG_COMPONENT_DEF(Network, logging::Severity::info);
@@ -83,6 +86,41 @@ void prusalink_password_init(void) {
     }
 }
 
+#if MEMP_STATS
+// Descriptions of the lwip memory pools, in the same order as
+// lwip_stats.memp. The stats entries themselves carry no names unless the
+// (much heavier) textual display support is compiled in, so we build our
+// own table from the same X-macro list lwip does ‒ that way it also covers
+// the custom pools from lwippools.h, like PBUF_POOL_SMALL.
+constexpr const char *memp_pool_names[MEMP_MAX] = {
+    #define LWIP_MEMPOOL(name, num, size, desc) desc,
+    #include <lwip/priv/memp_std.h>
+};
+
+METRIC_DEF(metric_lwip_pool, "lwip_pool", METRIC_VALUE_CUSTOM, 0, METRIC_ENABLED);
+
+// How often to sample the pools. The interesting parts ‒ high-water marks
+// and failure counters ‒ are cumulative, so sampling rarely loses nothing,
+// it only makes the momentary occupancy a bit coarser.
+const constexpr uint32_t POOL_STATS_INTERVAL = 5 * 1000;
+
+void record_pool_stats() {
+    for (size_t i = 0; i < MEMP_MAX; i++) {
+        const struct stats_mem *stats = lwip_stats.memp[i];
+        // Pools that were never touched are not worth the bandwidth.
+        if (stats->max == 0 && stats->err == 0) {
+            continue;
+        }
+        metric_record_custom(&metric_lwip_pool, ",n=%s used=%ui,max=%ui,err=%ui,avail=%ui",
+            memp_pool_names[i],
+            static_cast<unsigned>(stats->used),
+            static_cast<unsigned>(stats->max),
+            static_cast<unsigned>(stats->err),
+            static_cast<unsigned>(stats->avail));
+    }
+}
+#endif
+
 // This is the top-level manager of network settings and interfaces.
 //
 // It is responsible for bringing up all the interfaces with the right settings
@@ -397,6 +435,9 @@ private:
         bool initialized = false;
 
         uint32_t last_poll = 0;
+#if MEMP_STATS
+        uint32_t last_pool_stats = 0;
+#endif
 
         while (true) {
             events |= ulTaskNotifyTake(pdTRUE, LOOP_EVT_TIMEOUT);
@@ -493,6 +534,15 @@ private:
                 }
             }
 
+#if MEMP_STATS
+            // Here (after the init is done) the lwip core ‒ and therefore
+            // the pools and their stats ‒ is guaranteed to exist.
+            if (now - last_pool_stats >= POOL_STATS_INTERVAL) {
+                last_pool_stats = now;
+                record_pool_stats();
+            }
+#endif
+
 #if MDNS()
             if (events & MdnsInitCheck) {
                 // We can afford to have only one interface active for the responder.
@@ -17,6 +17,7 @@
 
 #include <lfn.h>
 #include <state/printer_state.hpp>
+#include <wall_clock.hpp>
 
 #include <cassert>
 #include <ctime>
@@ -36,8 +37,8 @@ static bool sntp_time_init = false;
 
 void wui_marlin_client_init(void) {
     marlin_client::init(); // init the client
-    // force update variables when starts
-    marlin_client::set_event_notify(marlin_server::EVENT_MSK_DEF);
+    // link only issues requests; broadcast events would wake it for nothing
+    marlin_client::set_event_notify(marlin_server::EVENT_MSK_ACK_ONLY);
 }
 
 struct ini_load_def {
@@ -230,7 +231,10 @@ void get_MAC_address(mac_address_t *dest, uint32_t netdev_id) {
     }
 }
 
-void sntp_set_system_time(uint32_t sec) {
+void sntp_set_system_time_us(uint32_t sec, uint32_t us) {
+    // The monotonic wall clock gets the full-precision sample, the RTC below
+    // only stores whole seconds
+    wall_clock::sync_from_sntp(sec, us);
 
     // RTC_TimeTypeDef has attributes like TimeFormat (AM/PM) and DayLightSaving, which we don't use
     RTC_TimeTypeDef currTime {};
@@ -108,11 +108,13 @@ uint32_t load_ini_file_wifi(netif_config_t *config, ap_entry_t *ap);
 void get_MAC_address(mac_address_t *dest, uint32_t netdev_id);
 
 /*!**********************************************************************************************************
- * \brief Sets time and date in device's RTC on some other time storage
+ * \brief Sets time and date in device's RTC and feeds the smoothed wall clock
  *
- * \param [in] sec - number of seconds from 1.1.1900
+ * \param [in] sec - number of seconds from 1.1.1970
+ *
+ * \param [in] us - microsecond part of the SNTP sample
  ************************************************************************************************************/
-void sntp_set_system_time(uint32_t sec);
+void sntp_set_system_time_us(uint32_t sec, uint32_t us);
 
 /*!********************************************************************************
  * \brief Adds time in seconds to given timestamp
@@ -117,6 +117,7 @@ LIGHTMODBUS_WARN_UNUSED ModbusError modbusBufferAllocateADU(ModbusBuffer *buffer
 	return err;
 }
 
+#ifndef LIGHTMODBUS_CUSTOM_CRC
 /**
 	\brief Calculates 16-bit Modbus CRC of provided data
 	\param data A pointer to the data to be processed
@@ -144,5 +145,6 @@ LIGHTMODBUS_WARN_UNUSED uint16_t modbusCRC(const uint8_t *data, uint16_t length)
 
 	return crc;
 }
+#endif
 
 #endif
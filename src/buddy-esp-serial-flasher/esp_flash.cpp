@@ -178,10 +178,14 @@ static Result run_rom() {
     return Result::success;
 }
 
-static const uint32_t FLASH_UART_BAUDRATE = 115200;
+// Rate used for the flash data upload itself. Targets whose ROM loader can
+// renegotiate the baudrate (embedded ESP32) switch to it right after entering
+// the bootloader; the ESP8266 ROM has no such command (and flashing through
+// its stub does not work, see below), so it stays at the 115200 connect rate.
+static const uint32_t FLASH_UART_BAUDRATE = 921600;
 static const uint32_t NIC_UART_BAUDRATE = 4600000;
 
-[[maybe_unused]] // for now, this is not used because we do not need it, but it can be enabled
+[[maybe_unused]] // ESP8266 builds cannot use this, see FLASH_UART_BAUDRATE
 static Result
 change_baudrate() {
     if (esp_loader_change_baudrate(FLASH_UART_BAUDRATE) != ESP_LOADER_SUCCESS) {
@@ -259,6 +263,14 @@ Result flash() {
         // ESP32 doesn't need the stub so we can wait for resources here.
         // This makes the verification happend during the Install phase so we don't need to wait at the end for it
         TaskDeps::wait(TaskDeps::make(TaskDeps::Dependency::resources_ready));
+
+        // The ROM loader boots at 115200, which makes the upload itself the
+        // bottleneck of the whole flashing - renegotiate before sending data.
+        // Each run_rom() resets both sides back to 115200, so this has to be
+        // done again on every pass through the loop.
+        if (const Result result = change_baudrate(); result != Result::success) {
+            return result;
+        }
 #endif
 
         // Flash everything that needs to be flashed
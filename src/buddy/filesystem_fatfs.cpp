@@ -10,10 +10,14 @@
 #include <sys/syslimits.h>
 #include <buddy/filesystem.h>
 #include <buddy/filesystem_fatfs.h>
+#include <freertos/mutex.hpp>
 #include <logging/log.hpp>
 #include <marlin_client.hpp>
 #include <usb_host.h>
 
+#include <atomic>
+#include <mutex>
+
 // #define FATFS_FSTAT 1
 
 LOG_COMPONENT_REF(FileSystem);
@@ -39,6 +43,7 @@ LOG_COMPONENT_REF(FileSystem);
 #define FF_VALUE(value, type) ((value & type) >> type##_OFFSET)
 
 #define FLAG_SYNC 0b00000001
+#define FLAG_WRITABLE 0b00000010
 #define PREPARE_FIL_EX(f, fs) \
     FIL_EX *f = fs;           \
     if (f == NULL) {          \
@@ -66,6 +71,96 @@ namespace {
 extern const devoptab_t devoptab_fatfs;
 }
 
+/// Cache of recently f_stat-ed paths.
+///
+/// gcode_info and the file browser stat the same handful of files over and
+/// over, and every f_stat walks the directory entries from the start - with a
+/// 500-file dump on the drive that is a lot of repeated work. An entry lives
+/// until anything writes to the filesystem, the current directory changes or
+/// the media is remounted; FAT on a removable drive cannot change under us in
+/// any other way.
+namespace stat_cache {
+
+constexpr size_t entry_count = 16;
+/// Matches the longest path the GUI can produce (FILE_PATH_BUFFER_LEN);
+/// pathological longer paths simply stay uncached.
+constexpr size_t path_buffer = 104;
+
+struct Entry {
+    char path[path_buffer];
+    FSIZE_t fsize;
+    WORD fdate;
+    WORD ftime;
+    BYTE fattrib;
+    bool valid;
+    uint32_t last_used;
+};
+
+static Entry entries[entry_count];
+static uint32_t use_counter = 0;
+static freertos::Mutex mutex;
+/// Bumped on every invalidation; lets the LFN memo in lfn.cpp notice that
+/// its entries went stale without having to know why.
+static std::atomic<uint32_t> generation = 1;
+
+static bool lookup(const char *path, FILINFO *finfo) {
+    std::unique_lock lock(mutex);
+    for (Entry &entry : entries) {
+        // FAT paths are case-insensitive
+        if (entry.valid && strcasecmp(entry.path, path) == 0) {
+            entry.last_used = ++use_counter;
+            finfo->fsize = entry.fsize;
+            finfo->fdate = entry.fdate;
+            finfo->ftime = entry.ftime;
+            finfo->fattrib = entry.fattrib;
+            return true;
+        }
+    }
+    return false;
+}
+
+static void insert(const char *path, const FILINFO *finfo) {
+    if (strlen(path) >= path_buffer) {
+        return;
+    }
+    std::unique_lock lock(mutex);
+    Entry *victim = &entries[0];
+    for (Entry &entry : entries) {
+        if (!entry.valid) {
+            victim = &entry;
+            break;
+        }
+        if (entry.last_used < victim->last_used) {
+            victim = &entry;
+        }
+    }
+    strlcpy(victim->path, path, sizeof(victim->path));
+    victim->fsize = finfo->fsize;
+    victim->fdate = finfo->fdate;
+    victim->ftime = finfo->ftime;
+    victim->fattrib = finfo->fattrib;
+    victim->last_used = ++use_counter;
+    victim->valid = true;
+}
+
+static void invalidate() {
+    std::unique_lock lock(mutex);
+    for (Entry &entry : entries) {
+        entry.valid = false;
+    }
+    generation.fetch_add(1, std::memory_order_relaxed);
+}
+
+} // namespace stat_cache
+
+void filesystem_fatfs_cache_invalidate() {
+    stat_cache::invalidate();
+}
+
+uint32_t filesystem_fatfs_cache_generation() {
+    return stat_cache::generation.load(std::memory_order_relaxed);
+}
+
 static int get_errno(FRESULT result) {
     switch (result) {
     case FR_OK:
@@ -227,6 +322,11 @@ static int open_r(struct _reent *r, void *fileStruct, const char *path, int flag
         return -1;
     }
 
+    if (ff_mode & (FA_WRITE | FA_OPEN_APPEND | FA_OPEN_ALWAYS | FA_CREATE_NEW | FA_CREATE_ALWAYS)) {
+        // The file may change or come into existence under our hands
+        stat_cache::invalidate();
+    }
+
 #ifdef FATFS_FSTAT
     size_t len = strlen(path) + 1; // +1 for the termination char
     f->path = malloc(len);
@@ -251,6 +351,10 @@ static int open_r(struct _reent *r, void *fileStruct, const char *path, int flag
     if (flags & O_SYNC) {
         f->flags |= FLAG_SYNC;
     }
+    if (ff_mode & (FA_WRITE | FA_OPEN_APPEND | FA_OPEN_ALWAYS | FA_CREATE_NEW | FA_CREATE_ALWAYS)) {
+        // so that close_r throws away whatever got cached while we were writing
+        f->flags |= FLAG_WRITABLE;
+    }
 
     return result == FR_OK;
 }
@@ -266,6 +370,12 @@ static int close_r(struct _reent *r, void *fileStruct) {
     result = f_close(&(f->fil));
     r->_errno = get_errno(result);
 
+    if (f->flags & FLAG_WRITABLE) {
+        // a stat() issued while the file was open re-populated the cache with
+        // the transient size; only now are the final size and mtime on record
+        stat_cache::invalidate();
+    }
+
     return result == FR_OK ? 0 : -1;
 }
 
@@ -401,10 +511,13 @@ static int stat_r(struct _reent *r, const char *path, struct stat *st) {
 
     path = process_path(path, devoptab_fatfs.name);
 
-    result = f_stat(path, &finfo);
-    if (result != FR_OK) {
-        r->_errno = get_errno(result);
-        return -1;
+    if (!stat_cache::lookup(path, &finfo)) {
+        result = f_stat(path, &finfo);
+        if (result != FR_OK) {
+            r->_errno = get_errno(result);
+            return -1;
+        }
+        stat_cache::insert(path, &finfo);
     }
 
     st->st_mode = S_IRUSR | S_IRGRP | S_IROTH; // Everybody can read
@@ -471,6 +584,7 @@ static int unlink_r(struct _reent *r, const char *path) {
 
     path = process_path(path, devoptab_fatfs.name);
 
+    stat_cache::invalidate();
     result = f_unlink(path);
     r->_errno = get_errno(result);
 
@@ -491,6 +605,8 @@ static int chdir_r(struct _reent *r, const char *path) {
 
     path = process_path(path, devoptab_fatfs.name);
 
+    // Relative paths resolve differently from now on
+    stat_cache::invalidate();
     result = f_chdir(path);
     r->_errno = get_errno(result);
 
@@ -512,6 +628,7 @@ static int rename_r(struct _reent *r, const char *oldName, const char *newName)
     oldName = process_path(oldName, devoptab_fatfs.name);
     newName = process_path(newName, devoptab_fatfs.name);
 
+    stat_cache::invalidate();
     result = f_rename(oldName, newName);
     r->_errno = get_errno(result);
 
@@ -539,6 +656,7 @@ static int chmod_r(struct _reent *r, __attribute__((unused)) const char *path, _
     BYTE attr = (mode & IS_IWALL) ? 0 : AM_RDO; // Read only when no write enabled
     // Ignoring Archive, System and Hidden attributes
 
+    stat_cache::invalidate();
     result = f_chmod(path, attr, AM_RDO);
     r->_errno = get_errno(result);
 
@@ -572,6 +690,7 @@ static int mkdir_r(struct _reent *r, const char *path, int mode) {
 
     path = process_path(path, devoptab_fatfs.name);
 
+    stat_cache::invalidate();
     result = f_mkdir(path);
     errno = get_errno(result);
     r->_errno = errno;
@@ -731,6 +850,7 @@ static int ftruncate_r(struct _reent *r, void *fileStruct, off_t len) {
     }
 
     // Truncate the file size to the current position
+    stat_cache::invalidate();
     result = f_truncate(&(f->fil));
     r->_errno = get_errno(result);
 
@@ -763,6 +883,7 @@ static int utimes_r(struct _reent *r, __attribute__((unused)) const char *filena
     FILINFO finfo;
 
     finfo = get_fatfs_time(times[0], times[1]);
+    stat_cache::invalidate();
     result = f_utime(filename, &finfo);
     r->_errno = get_errno(result);
 
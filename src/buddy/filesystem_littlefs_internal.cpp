@@ -1,17 +1,149 @@
 #include <logging/log.hpp>
+#include <buddy/filesystem.h>
 #include <buddy/filesystem_littlefs.h>
+#include <buddy/filesystem_littlefs_internal.h>
 #include <sys/iosupport.h>
 #include <buddy/littlefs_internal.h>
+#include <freertos/mutex.hpp>
+#include <printers.h>
+
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fcntl.h>
+#include <mutex>
 
 static filesystem_littlefs_ctx_t internal_ctx;
 
 LOG_COMPONENT_REF(FileSystem);
 
+/// Pinned-file cache.
+///
+/// Files on the internal flash that are read in many tiny chunks (current
+/// translation records, hot resources) pay a w25x transaction for nearly
+/// every read. A pinned file is loaded into RAM once and all reads of it are
+/// served by memcpy; the littlefs file stays open as usual, only its data
+/// path is short-circuited, so positions, stat and friends keep working.
+///
+/// The copy is dropped when the file is opened for writing, unlinked or
+/// renamed. Handles that were already open keep reading the old copy until
+/// they close - the same semantics POSIX gives an unlinked file.
+namespace pin_cache {
+
+constexpr size_t slot_count = 4;
+constexpr size_t handle_count = 4;
+constexpr size_t path_buffer = 64;
+#if PRINTER_IS_PRUSA_MINI()
+constexpr size_t budget = 0; // no RAM to spare on MINI, pinning is disabled
+#else
+constexpr size_t budget = 16384; ///< Total RAM the pinned copies may take
+#endif
+
+struct PinnedFile {
+    char path[path_buffer]; ///< Mount-relative path
+    uint8_t *data; ///< malloc'd copy of the content, nullptr = free slot
+    size_t size;
+    uint8_t refs; ///< Open handles served from this copy
+    bool valid; ///< false = unpinned, freed once refs drops to zero
+};
+
+static PinnedFile files[slot_count];
+static size_t used_bytes = 0;
+static freertos::Mutex mutex;
+
+/// Open handles currently backed by a pinned copy
+struct Handle {
+    void *file_struct;
+    PinnedFile *file;
+};
+
+static Handle handles[handle_count];
+
+/// Requires the mutex to be held
+static void release(PinnedFile *file) {
+    if (file->refs == 0 && !file->valid && file->data != nullptr) {
+        free(file->data);
+        file->data = nullptr;
+        used_bytes -= file->size;
+    }
+}
+
+/// Requires the mutex to be held
+static PinnedFile *find(const char *canonical_path) {
+    for (PinnedFile &file : files) {
+        if (file.data != nullptr && file.valid && strcmp(file.path, canonical_path) == 0) {
+            return &file;
+        }
+    }
+    return nullptr;
+}
+
+/// Requires the mutex to be held
+static void unpin(const char *canonical_path) {
+    if (PinnedFile *file = find(canonical_path)) {
+        file->valid = false;
+        release(file);
+    }
+}
+
+static void attach(void *file_struct, const char *canonical_path) {
+    std::unique_lock lock(mutex);
+    PinnedFile *file = find(canonical_path);
+    if (file == nullptr) {
+        return;
+    }
+    for (Handle &handle : handles) {
+        if (handle.file == nullptr) {
+            handle.file_struct = file_struct;
+            handle.file = file;
+            file->refs += 1;
+            return;
+        }
+    }
+    // No free handle slot - the reads just take the regular path
+}
+
+static void detach(void *file_struct) {
+    std::unique_lock lock(mutex);
+    for (Handle &handle : handles) {
+        if (handle.file != nullptr && handle.file_struct == file_struct) {
+            handle.file->refs -= 1;
+            release(handle.file);
+            handle.file = nullptr;
+            return;
+        }
+    }
+}
+
+static PinnedFile *lookup_handle(void *file_struct) {
+    std::unique_lock lock(mutex);
+    for (Handle &handle : handles) {
+        if (handle.file != nullptr && handle.file_struct == file_struct) {
+            return handle.file;
+        }
+    }
+    return nullptr;
+}
+
+} // namespace pin_cache
+
 static int open_r(struct _reent *r, void *fileStruct, const char *path, int flags, int mode) {
-    return filesystem_littlefs_open_r(&internal_ctx, r, fileStruct, path, flags, mode);
+    int result = filesystem_littlefs_open_r(&internal_ctx, r, fileStruct, path, flags, mode);
+    if (result >= 0) {
+        const char *canonical = process_path(path, internal_ctx.devoptab->name);
+        if ((flags & O_ACCMODE) == O_RDONLY) {
+            pin_cache::attach(fileStruct, canonical);
+        } else {
+            // The file is about to change, the pinned copy would go stale
+            std::unique_lock lock(pin_cache::mutex);
+            pin_cache::unpin(canonical);
+        }
+    }
+    return result;
 }
 
 static int close_r(struct _reent *r, void *fileStruct) {
+    pin_cache::detach(fileStruct);
     return filesystem_littlefs_close_r(&internal_ctx, r, fileStruct);
 }
 
@@ -24,6 +156,20 @@ static ssize_t write_r(struct _reent *r, void *fileStruct, const char *ptr, size
 }
 
 static ssize_t read_r(struct _reent *r, void *fileStruct, char *ptr, size_t len) {
+    if (pin_cache::PinnedFile *pinned = pin_cache::lookup_handle(fileStruct)) {
+        FIL_EX *f = static_cast<FIL_EX *>(fileStruct);
+        lfs_soff_t pos = lfs_file_tell(internal_ctx.lfs, &f->fil);
+        if (pos >= 0 && static_cast<size_t>(pos) <= pinned->size) {
+            size_t n = len < pinned->size - pos ? len : pinned->size - pos;
+            // Keep the littlefs position honest, so tell/seek still work;
+            // for a file open for reading this is just bookkeeping.
+            if (n == 0 || lfs_file_seek(internal_ctx.lfs, &f->fil, pos + n, LFS_SEEK_SET) >= 0) {
+                memcpy(ptr, pinned->data + pos, n);
+                r->_errno = 0;
+                return n;
+            }
+        }
+    }
     return filesystem_littlefs_read_r(&internal_ctx, r, fileStruct, ptr, len);
 }
 
@@ -44,6 +190,10 @@ static int link_r(struct _reent *r, const char *existing, const char *newLink) {
 }
 
 static int unlink_r(struct _reent *r, const char *path) {
+    {
+        std::unique_lock lock(pin_cache::mutex);
+        pin_cache::unpin(process_path(path, internal_ctx.devoptab->name));
+    }
     return filesystem_littlefs_unlink_r(&internal_ctx, r, path);
 }
 
@@ -52,6 +202,11 @@ static int chdir_r(struct _reent *r, __attribute__((unused)) const char *path) {
 }
 
 static int rename_r(struct _reent *r, const char *oldName, const char *newName) {
+    {
+        std::unique_lock lock(pin_cache::mutex);
+        pin_cache::unpin(process_path(oldName, internal_ctx.devoptab->name));
+        pin_cache::unpin(process_path(newName, internal_ctx.devoptab->name));
+    }
     return filesystem_littlefs_rename_r(&internal_ctx, r, oldName, newName);
 }
 
@@ -133,6 +288,76 @@ static const devoptab_t internal_devoptab = {
     .utimes_r = utimes_r,
 };
 
+extern "C" int filesystem_littlefs_internal_pin(const char *path, size_t max_size) {
+    if (strncmp(path, "/internal/", 10) != 0) {
+        return -1; // only files on this mount can be pinned
+    }
+
+    const char *canonical = process_path(path, internal_devoptab.name);
+    if (strlen(canonical) >= pin_cache::path_buffer) {
+        return -1;
+    }
+
+    {
+        std::unique_lock lock(pin_cache::mutex);
+        if (pin_cache::find(canonical) != nullptr) {
+            return 0; // already pinned
+        }
+    }
+
+    // Load through the regular mount, this is just another reader
+    FILE *file = fopen(path, "rb");
+    if (file == nullptr) {
+        return -1;
+    }
+
+    long size = -1;
+    if (fseek(file, 0, SEEK_END) == 0) {
+        size = ftell(file);
+    }
+    if (size <= 0 || static_cast<size_t>(size) > max_size
+        || static_cast<size_t>(size) > pin_cache::budget
+        || fseek(file, 0, SEEK_SET) != 0) {
+        fclose(file);
+        return -1;
+    }
+
+    uint8_t *data = static_cast<uint8_t *>(malloc(size));
+    if (data == nullptr || fread(data, 1, size, file) != static_cast<size_t>(size)) {
+        free(data);
+        fclose(file);
+        return -1;
+    }
+    fclose(file);
+
+    std::unique_lock lock(pin_cache::mutex);
+    if (pin_cache::used_bytes + size > pin_cache::budget) {
+        lock.unlock();
+        free(data);
+        return -1;
+    }
+    for (pin_cache::PinnedFile &pinned : pin_cache::files) {
+        if (pinned.data == nullptr) {
+            strlcpy(pinned.path, canonical, sizeof(pinned.path));
+            pinned.data = data;
+            pinned.size = size;
+            pinned.refs = 0;
+            pinned.valid = true;
+            pin_cache::used_bytes += size;
+            log_info(FileSystem, "Pinned %s (%ld bytes)", path, size);
+            return 0;
+        }
+    }
+    lock.unlock();
+    free(data); // all slots taken
+    return -1;
+}
+
+extern "C" void filesystem_littlefs_internal_unpin(const char *path) {
+    std::unique_lock lock(pin_cache::mutex);
+    pin_cache::unpin(process_path(path, internal_devoptab.name));
+}
+
 extern "C" int filesystem_littlefs_internal_init() {
     if (internal_ctx.device > 0) {
         // Already initialized
@@ -142,12 +142,12 @@ extern "C" _ssize_t _read_r(struct _reent *r, int fileDesc, void *ptr, size_t le
 static int _read(const struct lfs_config *c, lfs_block_t block,
     lfs_off_t off, void *out_buffer, lfs_size_t size) {
 
-    LruCache &cache = bbf_context.block_cache.value();
-
     if (bbf_context.block_cache.has_value() == false) {
         fatal_error(ErrCode::ERR_SYSTEM_BBF_INIT_FAILED);
     }
 
+    LruCache &cache = bbf_context.block_cache.value();
+
     LruCache::Slot *slot;
     if (!cache.has(block)) {
         slot = &cache.alloc();
@@ -228,7 +228,12 @@ lfs_t *littlefs_bbf_init(FILE *bbf, uint8_t bbf_tlv_entry) {
 
     littlefs_config.read_size = 1;
     littlefs_config.prog_size = 1;
-    littlefs_config.cache_size = 16;
+    // Metadata traversal reads in cache_size chunks; 16 B chunks meant a
+    // block-cache lookup + memcpy for every few bytes of metadata. Large data
+    // reads bypass this cache and are served straight from the block cache.
+    // The mount is read-only and short-lived (bootstrap), so the extra RAM is
+    // fine even on MINI.
+    littlefs_config.cache_size = 512;
     littlefs_config.lookahead_size = 16;
     littlefs_config.block_cycles = 500;
 
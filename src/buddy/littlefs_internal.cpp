@@ -1,4 +1,5 @@
 #include <buddy/littlefs_internal.h>
+#include <printers.h>
 #include "w25x.h"
 
 #define BLOCK_SIZE W25X_BLOCK_SIZE
@@ -29,6 +30,20 @@ static int erase(const struct lfs_config *c, lfs_block_t block);
 // are propagated to the user.
 static int sync(const struct lfs_config *c);
 
+// Cache tuning profile for the internal-flash mount.
+//
+// The knobs below trade RAM for fewer w25x transactions; resource and
+// translation reads during GUI rendering are the main beneficiaries. Each
+// mount owns its own lfs_config, so other mounts (the BBF one, for example)
+// are free to pick different numbers.
+#if PRINTER_IS_PRUSA_MINI()
+static const lfs_size_t CACHE_SIZE = 128; // need to save RAM on MINI, also PNG draw is faster due smaller and more efficient display
+static const lfs_size_t LOOKAHEAD_SIZE = 16;
+#else
+static const lfs_size_t CACHE_SIZE = 512; // PNG draws about 4% faster compared to cache_size 128
+static const lfs_size_t LOOKAHEAD_SIZE = 32; // one allocation scan covers 256 blocks instead of 128
+#endif
+
 // configuration of the filesystem is provided by this struct
 static struct lfs_config littlefs_config = {
     // block device operations
@@ -44,12 +59,8 @@ static struct lfs_config littlefs_config = {
     .block_size = BLOCK_SIZE,
     .block_count = 0, // to be initialized at runtime
     .block_cycles = 500,
-#if PRINTER_IS_PRUSA_MINI()
-    .cache_size = 128, // need to save RAM on MINI, also PNG draw is faster due smaller and more efficient display
-#else
-    .cache_size = 512, // PNG draws about 4% faster compared to cache_size 128
-#endif
-    .lookahead_size = 16,
+    .cache_size = CACHE_SIZE,
+    .lookahead_size = LOOKAHEAD_SIZE,
     .read_buffer = nullptr,
     .prog_buffer = nullptr,
     .lookahead_buffer = nullptr,
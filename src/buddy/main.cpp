@@ -24,9 +24,11 @@
 #include "thread_measurement.h"
 #include <logging/log_dest_syslog.hpp>
 #include "metric_handlers.h"
+#include "boot_timing.h"
 #include "hwio_pindef.h"
 #include "gui.hpp"
 #include "display.hpp"
+#include "led_lcd_cs_selector.hpp"
 #include <stdint.h>
 #include "printers.h"
 #include "MarlinPin.h"
@@ -442,6 +444,8 @@ extern "C" void main_cpp(void) {
 
     filesystem_init();
 
+    buddy::boot_timing::mark(buddy::boot_timing::Stage::hw_init);
+
     if (option::has_gui) {
         osThreadStaticDef(displayTask, StartDisplayTask, TASK_PRIORITY_DISPLAY_TASK, 0, displayTask_stacksz, displayTask_buffer, &displayTask_control);
         displayTaskHandle = osThreadCreate(osThread(displayTask), NULL);
@@ -449,6 +453,8 @@ extern "C" void main_cpp(void) {
     // wait for gui to init and render loading screen before starting flashing. We need to init bootstrap screen so we can send process percentage to it. Also it would look laggy without it.
     TaskDeps::wait(TaskDeps::Tasks::bootstrap_start);
 
+    buddy::boot_timing::mark(buddy::boot_timing::Stage::gui_up);
+
 #if ENABLED(RESOURCES()) && ENABLED(BOOTLOADER_UPDATE())
     if (bootloader_update()) {
         // Wait a while, before restart (this prevents some older board without appendix to enter internal bootloader on reset)
@@ -458,6 +464,8 @@ extern "C" void main_cpp(void) {
     }
 #endif
 
+    buddy::boot_timing::mark(buddy::boot_timing::Stage::bootloader);
+
     usb_device_init();
 
 #if ENABLED(RESOURCES())
@@ -465,6 +473,8 @@ extern "C" void main_cpp(void) {
 #endif
     filesystem_semihosting_deinit();
 
+    buddy::boot_timing::mark(buddy::boot_timing::Stage::resources);
+
     metric_system_init();
     if (running_in_tester_mode()) {
         manufacture_report_endless_loop();
@@ -507,6 +517,8 @@ extern "C" void main_cpp(void) {
     power_panic::ac_fault_task = osThreadCreate(osThread(acFaultTask), NULL);
 #endif
 
+    buddy::boot_timing::mark(buddy::boot_timing::Stage::tasks);
+
 #if HAS_PUPPIES()
     buddy::puppies::start_puppy_task();
     #if HAS_MMU2()
@@ -546,6 +558,9 @@ extern "C" void main_cpp(void) {
     TaskDeps::wait(TaskDeps::Tasks::syslog);
     logging::syslog_reconfigure();
     metrics_reconfigure();
+    metrics_apply_sampling_overrides();
+
+    buddy::boot_timing::mark(buddy::boot_timing::Stage::network);
 
     if constexpr (option::filament_sensor != option::FilamentSensor::no) {
         /* definition and creation of measurementTask */
@@ -562,6 +577,13 @@ void HAL_SPI_TxCpltCallback(SPI_HandleTypeDef *hspi) {
     }
 #endif
 
+#if BOARD_IS_XLBUDDY() || PRINTER_IS_PRUSA_iX()
+    // side LED strip on its own SPI (revisions where it is not muxed with the LCD)
+    if (hspi == hw_get_spi_side_strip() && hspi != &SPI_HANDLE_FOR(lcd)) {
+        SideStripWriter::spi_tx_complete();
+    }
+#endif
+
     if (hspi == &SPI_HANDLE_FOR(flash)) {
         w25x_spi_transfer_complete_callback();
     }
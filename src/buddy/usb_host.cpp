@@ -3,6 +3,7 @@
 #include "usbh_msc.h"
 
 #include <buddy/fatfs.h>
+#include <buddy/filesystem_fatfs.h>
 #include <device/board.h>
 #include "common/timing.h"
 
@@ -167,6 +168,7 @@ void USBH_UserProcess([[maybe_unused]] USBH_HandleTypeDef *phost, uint8_t id) {
         media_inserted = false;
         media_inserted_since_startup = false;
         f_mount(0, (TCHAR const *)USBHPath, 1); // umount
+        filesystem_fatfs_cache_invalidate();
         break;
 
     case HOST_USER_CLASS_ACTIVE: {
@@ -174,6 +176,8 @@ void USBH_UserProcess([[maybe_unused]] USBH_HandleTypeDef *phost, uint8_t id) {
         if (result != FR_OK) {
             break;
         }
+        // The new drive may reuse paths of the old one
+        filesystem_fatfs_cache_invalidate();
 
         media_inserted_since_startup = (media_on_startup_detection_timeout != 0);
         media_inserted = true;
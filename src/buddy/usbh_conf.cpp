@@ -1,4 +1,5 @@
 #include "usbh_core.h"
+#include "usbh_msc_bot.h"
 
 #include <buddy/main.h>
 #include <logging/log.hpp>
@@ -90,11 +91,17 @@ void HAL_HCD_Disconnect_Callback(HCD_HandleTypeDef *hhcd) {
     USBH_LL_Disconnect(static_cast<USBH_HandleTypeDef *>(hhcd->pData));
 }
 
-void HAL_HCD_HC_NotifyURBChange_Callback(HCD_HandleTypeDef *hhcd, [[maybe_unused]] uint8_t chnum, [[maybe_unused]] HCD_URBStateTypeDef urb_state) {
+void HAL_HCD_HC_NotifyURBChange_Callback(HCD_HandleTypeDef *hhcd, uint8_t chnum, [[maybe_unused]] HCD_URBStateTypeDef urb_state) {
     /* To be used with OS to sync URB state with the global state machine */
 #if (USBH_USE_OS == 1)
     USBH_LL_NotifyURBChange(static_cast<USBH_HandleTypeDef *>(hhcd->pData));
 #endif
+    // Pre-stage the next bulk URB of a multi-chunk MSC data stage right here
+    // in the interrupt; waking the worker task just to resubmit the next chunk
+    // would add a full scheduling round-trip to every chunk of the transfer.
+    if (USBH_MSC_BOT_PrestageDataUrb(static_cast<USBH_HandleTypeDef *>(hhcd->pData), chnum)) {
+        return;
+    }
     if (USBH_MSC_WorkerTaskHandle) {
         BaseType_t pxHigherPriorityTaskWoken;
         vTaskNotifyGiveFromISR(USBH_MSC_WorkerTaskHandle, &pxHigherPriorityTaskWoken);
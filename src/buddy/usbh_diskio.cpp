@@ -134,8 +134,136 @@ static void USBH_StartMSCWorkerTask() {
     USBH_MSC_WorkerTaskHandle = osThreadCreate(osThread(USBH_MSC_WorkerTask), NULL);
 }
 
+static USBH_StatusTypeDef USBH_MSC_GetLUNInfo_synchronized(
+    USBH_HandleTypeDef *phost,
+    uint8_t lun,
+    MSC_LUNTypeDef *info);
+
+/// Read-ahead of the sectors that follow a sequential read.
+///
+/// FatFS clips multi-sector reads at cluster boundaries, so even a perfectly
+/// contiguous g-code stream arrives here as a train of short requests. Each
+/// MSC transfer pays a fixed command/status overhead; by fetching the next run
+/// of sectors while the caller is still digesting the previous one, the train
+/// is served from RAM and the bus carries fewer, larger transactions.
+///
+/// Only reads continuing exactly where the previous one ended start a
+/// read-ahead - FAT and directory traffic does not look like that, so it does
+/// not trigger useless transfers.
+class UsbhReadAhead {
+public:
+    /// Serve the requested range from the buffer, if it is (or is about to
+    /// be) there. A range that does not continue the buffered run discards
+    /// the rest of it.
+    bool try_serve(UsbhMscRequest::LunNbr lun, BYTE *buff, UsbhMscRequest::SectorNbr sector, UINT count) {
+        Lock lock(mutex);
+        if (!in_flight && !valid) {
+            return false;
+        }
+        if (this->lun != lun || this->sector + served != sector || count + served > sector_count) {
+            complete();
+            valid = false; // the stream went elsewhere, the rest is not useful
+            return false;
+        }
+        complete();
+        if (!valid) {
+            return false;
+        }
+        memcpy(buff, &buffer[served * UsbhMscRequest::SECTOR_SIZE], count * UsbhMscRequest::SECTOR_SIZE);
+        served += count;
+        if (served == sector_count) {
+            valid = false; // fully consumed
+        }
+        return true;
+    }
+
+    /// Called after a successful read; once the access pattern looks
+    /// sequential, starts fetching the sectors that will be asked for next.
+    void after_read(UsbhMscRequest::LunNbr lun, UsbhMscRequest::SectorNbr sector, UINT count) {
+        Lock lock(mutex);
+        const bool streaming = expected_lun == lun && expected_sector == sector;
+        expected_lun = lun;
+        expected_sector = sector + count;
+        // Streams of reads larger than the buffer amortize the transfer
+        // overhead on their own; a read-ahead would only get in their way.
+        if (streaming && count <= sector_count) {
+            start(lun, sector + count);
+        }
+    }
+
+    /// Drop the buffered data (and wait out a transfer in flight).
+    void invalidate() {
+        Lock lock(mutex);
+        complete();
+        valid = false;
+        expected_lun = invalid_lun;
+    }
+
+private:
+    static constexpr uint16_t sector_count = 8;
+    static constexpr UsbhMscRequest::LunNbr invalid_lun = std::numeric_limits<UsbhMscRequest::LunNbr>::max();
+
+    /// Start reading [sector, sector + sector_count) in the background.
+    /// Requires the mutex to be held.
+    void start(UsbhMscRequest::LunNbr lun, UsbhMscRequest::SectorNbr sector) {
+        if (in_flight) {
+            return; // the previous one was not reaped yet
+        }
+        if (valid && this->lun == lun && this->sector + served == sector) {
+            return; // already buffered
+        }
+        valid = false;
+        MSC_LUNTypeDef info;
+        if (USBH_MSC_GetLUNInfo_synchronized(&hUsbHostHS, lun, &info) != USBH_OK
+            || sector + sector_count > info.capacity.block_nbr) {
+            return; // never read past the end of the device
+        }
+        this->lun = lun;
+        this->sector = sector;
+        served = 0;
+        request = {
+            UsbhMscRequest::UsbhMscRequestOperation::Read,
+            lun,
+            sector_count,
+            sector,
+            buffer,
+            USBH_FAIL,
+            USBH_worker_notify,
+            &semaphore,
+            nullptr
+        };
+        in_flight = usbh_msc_submit_request(&request) == USBH_OK;
+    }
+
+    /// Wait for a transfer in flight and collect its result.
+    /// Requires the mutex to be held.
+    void complete() {
+        if (in_flight) {
+            semaphore.acquire();
+            in_flight = false;
+            valid = request.result == USBH_OK;
+        }
+    }
+
+    Mutex mutex;
+    freertos::BinarySemaphore semaphore; ///< Released by the worker when the transfer finishes
+    bool in_flight = false; ///< A request is queued, the semaphore release is pending
+    bool valid = false; ///< The buffer holds [sector + served, sector + sector_count)
+    UsbhMscRequest::LunNbr lun;
+    UsbhMscRequest::SectorNbr sector;
+    uint16_t served = 0; ///< Sectors already copied out of the buffer
+    UsbhMscRequest::LunNbr expected_lun = invalid_lun;
+    UsbhMscRequest::SectorNbr expected_sector = 0; ///< Where a sequential stream would continue
+    UsbhMscRequest request;
+    alignas(4) BYTE buffer[sector_count * UsbhMscRequest::SECTOR_SIZE];
+};
+
+static UsbhReadAhead read_ahead;
+
 DSTATUS USBH_initialize([[maybe_unused]] BYTE lun) {
     USBH_StartMSCWorkerTask();
+    // A freshly plugged drive may reuse the sector numbers of the old one
+    read_ahead.invalidate();
     /* CAUTION : USB Host library has to be initialized in the application */
     return RES_OK;
 }
@@ -190,7 +318,12 @@ DRESULT USBH_read(BYTE lun, BYTE *buff, DWORD sector, UINT count) {
             }
         }
     } else {
-        status = USBH_exec(UsbhMscRequest::UsbhMscRequestOperation::Read, lun, buff, sector, count);
+        if (!read_ahead.try_serve(lun, buff, sector, count)) {
+            status = USBH_exec(UsbhMscRequest::UsbhMscRequestOperation::Read, lun, buff, sector, count);
+        }
+        if (status == USBH_OK) {
+            read_ahead.after_read(lun, sector, count);
+        }
     }
 
     if (status == USBH_OK) {
@@ -227,6 +360,8 @@ DRESULT USBH_write(BYTE lun, const BYTE *buff, DWORD sector, UINT count) {
     DRESULT res = RES_ERROR;
     MSC_LUNTypeDef info;
     USBH_StatusTypeDef status = USBH_OK;
+    // The written sectors might be the buffered ones
+    read_ahead.invalidate();
     if ((DWORD)buff & 3) { // DMA Alignment issue, do single up to aligned buffer
         USBH_ErrLog("Suspicious DMA Alignment issue, do single up to aligned buffer");
         while (count--) {
@@ -23,9 +23,21 @@ struct HomeSample {
 
 static_assert(sizeof(HomeSample) == 4, "Doesn't fit 4 bytes.");
 
+struct [[gnu::packed]] CounterSample {
+    uint16_t seq; ///< Monotonic write sequence, wraps around
+    uint8_t id;
+    uint32_t value;
+    uint8_t crc8;
+};
+
+static_assert(sizeof(CounterSample) == 8, "Doesn't fit 8 bytes.");
+
+constexpr size_t counterRingSlots = 96;
+
 struct Data {
     uint8_t reserved_for_future_use[8];
     HomeSample homeSamples[axisCount][PersistentStorage::homeSamplesCount];
+    CounterSample counterRing[counterRingSlots];
 };
 static_assert(sizeof(Data) < config_store_ns::start_address, "Data collides with space used by config_store");
 
@@ -138,3 +150,91 @@ void PersistentStorage::erase() {
     erase_axis(0);
     erase_axis(1);
 }
+
+static decltype(CounterSample::crc8) calcCrc(CounterSample counterSample) {
+    return crc32_calc(reinterpret_cast<uint8_t *>(&counterSample), (sizeof(counterSample) - sizeof(counterSample.crc8)));
+}
+
+static bool isValid(CounterSample counterSample) {
+    return (calcCrc(counterSample) == counterSample.crc8);
+}
+
+/// @returns true if sequence number \p a is newer than \p b, accounting for wraparound
+static bool isNewerSeq(uint16_t a, uint16_t b) {
+    return static_cast<int16_t>(a - b) > 0;
+}
+
+static void readCounterRing(CounterSample (&counterRing)[counterRingSlots]) {
+    st25dv64k_user_read_bytes(reinterpret_cast<uint32_t>(data->counterRing), &counterRing, sizeof(counterRing));
+}
+
+/// Head of the counter ring, recovered from eeprom on first use so pushes don't rescan the whole ring
+static bool counterHeadKnown = false;
+static uint_fast8_t counterHeadIndex = 0; ///< Slot the next sample goes to
+static uint16_t counterHeadSeq = 0; ///< Sequence of the last written sample
+
+static void recoverCounterHead() {
+    CounterSample counterRingRead[counterRingSlots];
+    readCounterRing(counterRingRead);
+
+    bool found = false;
+    for (uint_fast8_t i = 0; i < counterRingSlots; ++i) {
+        if (!isValid(counterRingRead[i])) {
+            continue;
+        }
+        if (!found || isNewerSeq(counterRingRead[i].seq, counterHeadSeq)) {
+            counterHeadSeq = counterRingRead[i].seq;
+            counterHeadIndex = (i + 1) % counterRingSlots;
+            found = true;
+        }
+    }
+
+    if (!found) {
+        counterHeadSeq = 0;
+        counterHeadIndex = 0;
+    }
+    counterHeadKnown = true;
+}
+
+void PersistentStorage::push_counter(uint8_t id, uint32_t value) {
+    if (!counterHeadKnown) {
+        recoverCounterHead();
+    }
+
+    CounterSample counterSample;
+    counterSample.seq = ++counterHeadSeq;
+    counterSample.id = id;
+    counterSample.value = value;
+    counterSample.crc8 = calcCrc(counterSample);
+
+    st25dv64k_user_write_bytes(reinterpret_cast<uint32_t>(&(data->counterRing[counterHeadIndex])), &counterSample, sizeof(counterSample));
+    counterHeadIndex = (counterHeadIndex + 1) % counterRingSlots;
+}
+
+void PersistentStorage::load_counters(std::span<std::optional<uint32_t>> values) {
+    CounterSample counterRingRead[counterRingSlots];
+    readCounterRing(counterRingRead);
+
+    for (size_t id = 0; id < values.size(); ++id) {
+        auto &value = values[id];
+        value = std::nullopt;
+
+        uint16_t newestSeq = 0;
+        for (uint_fast8_t i = 0; i < counterRingSlots; ++i) {
+            if (!isValid(counterRingRead[i]) || counterRingRead[i].id != id) {
+                continue;
+            }
+            if (!value.has_value() || isNewerSeq(counterRingRead[i].seq, newestSeq)) {
+                newestSeq = counterRingRead[i].seq;
+                value = uint32_t { counterRingRead[i].value };
+            }
+        }
+    }
+}
+
+void PersistentStorage::erase_counter_ring() {
+    static constexpr auto empty_arr = generate_eeprom_erase_data<sizeof(Data::counterRing)>();
+
+    st25dv64k_user_unverified_write_bytes(reinterpret_cast<uint32_t>(data->counterRing), empty_arr.begin(), empty_arr.size());
+    counterHeadKnown = false;
+}
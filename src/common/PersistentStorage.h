@@ -5,6 +5,8 @@
 #pragma once
 
 #include <stdint.h>
+#include <optional>
+#include <span>
 
 class PersistentStorage {
 public:
@@ -13,4 +15,13 @@ public:
     static bool isCalibratedHome(uint16_t (&mscnt)[homeSamplesCount], uint8_t axis);
     static void erase_axis(uint8_t axis);
     static void erase();
+
+    /// Appends the current value of counter \p id to the wear-leveled counter ring.
+    /// Meant for small counters updated too often to live in the journal; the ring spreads the writes evenly over its slots.
+    static void push_counter(uint8_t id, uint32_t value);
+
+    /// Loads the last pushed value of counters 0 .. values.size() - 1 in one pass over the ring; values[id] stays nullopt for counters the ring holds no sample of
+    static void load_counters(std::span<std::optional<uint32_t>> values);
+
+    static void erase_counter_ring();
 };
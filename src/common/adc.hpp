@@ -104,7 +104,13 @@ enum AD3 { // ADC3 channels
     hotend_I,
     board_I,
     case_T,
-    ADC3_CH_CNT
+    ADC3_CH_CNT,
+    // Extra sequencer ranks: the low-impedance current channels are converted
+    // once more per scan. Readers keep using the primary rank as data index
+    // and fold the extra slot in via get_and_shift_channel_pair().
+    MMU_I_2 = ADC3_CH_CNT,
+    hotend_I_2,
+    ADC3_SEQ_CNT
 };
 
 #elif (BOARD_IS_XBUDDY())
@@ -129,7 +135,13 @@ enum AD3 { // ADC3 channels
     #elif PRINTER_IS_PRUSA_COREONE()
     door_sensor,
     #endif
-    ADC3_CH_CNT
+    ADC3_CH_CNT,
+    // Extra sequencer ranks: the low-impedance current channels are converted
+    // once more per scan. Readers keep using the primary rank as data index
+    // and fold the extra slot in via get_and_shift_channel_pair().
+    MMU_I_2 = ADC3_CH_CNT,
+    hotend_I_2,
+    ADC3_SEQ_CNT
 };
 
 #elif (BOARD_IS_XLBUDDY())
@@ -146,7 +158,8 @@ enum AD3 { // ADC3 channels
     board_T,
     mux2_y,
     mux2_x,
-    ADC3_CH_CNT
+    ADC3_CH_CNT,
+    ADC3_SEQ_CNT = ADC3_CH_CNT // no extra sequencer ranks here
 };
 
 enum PowerMonitorsHWIDAndTempMux { // Multiplexer channels
@@ -268,6 +281,12 @@ public:
         return get_channel(index) >> shift_bits;
     }
 
+    // Average of two sequencer slots carrying the same input (see the extra
+    // ranks in AdcChannel), downscaled from ADC full resolution as required by Marlin
+    [[nodiscard]] uint16_t get_and_shift_channel_pair(uint8_t index, uint8_t index2) const {
+        return ((static_cast<uint32_t>(m_data[index]) + m_data[index2]) / 2) >> shift_bits;
+    }
+
 private:
     uint16_t m_data[channels] = { reset_value };
 };
@@ -276,7 +295,7 @@ using AdcDma1 = AdcDma<hadc1, AdcChannel::ADC1_CH_CNT>;
 extern AdcDma1 adcDma1;
 
 #ifdef HAS_ADC3
-using AdcDma3 = AdcDma<hadc3, AdcChannel::ADC3_CH_CNT>;
+using AdcDma3 = AdcDma<hadc3, AdcChannel::ADC3_SEQ_CNT>;
 extern AdcDma3 adcDma3;
 #endif
 
@@ -483,8 +502,8 @@ inline uint16_t ambient_temp() { return adcDma3.get_and_shift_channel(AdcChannel
 inline uint16_t door_sensor() { return adcDma3.get_channel(AdcChannel::door_sensor); }
     #endif
 
-inline uint16_t MMUCurrent() { return adcDma3.get_and_shift_channel(AdcChannel::MMU_I); }
-inline uint16_t heaterCurrent() { return adcDma3.get_and_shift_channel(AdcChannel::hotend_I); }
+inline uint16_t MMUCurrent() { return adcDma3.get_and_shift_channel_pair(AdcChannel::MMU_I, AdcChannel::MMU_I_2); }
+inline uint16_t heaterCurrent() { return adcDma3.get_and_shift_channel_pair(AdcChannel::hotend_I, AdcChannel::hotend_I_2); }
 inline uint16_t inputCurrent() { return adcDma3.get_and_shift_channel(AdcChannel::board_I); }
 inline uint16_t vref() { return adcDma1.get_channel(AdcChannel::vref); } ///< Internal reference necessary for mcu_temperature
 inline uint16_t mcuTemperature() { return adcDma1.get_channel(AdcChannel::mcu_temperature); } ///< Raw sensor, use getMCUTemp() instead
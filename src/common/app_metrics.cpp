@@ -1,11 +1,13 @@
 #include <inttypes.h>
 #include "app_metrics.h"
+#include "boot_timing.h"
 #include "metric.h"
 #include <logging/log.hpp>
 #include <common/sensor_data.hpp>
 #include <version/version.hpp>
 #include "FreeRTOS.h"
 #include "cmsis_os.h"
+#include <freertos/resource_registry.hpp>
 #include "malloc.h"
 #include "heap.h"
 #include <adc.hpp>
@@ -20,6 +22,7 @@
 #include "printers.h"
 #include "MarlinPin.h"
 #include "otp.hpp"
+#include <algorithm>
 #include <array>
 #include "filament.hpp"
 #include "marlin_vars.hpp"
@@ -72,6 +75,8 @@ void buddy::metrics::RecordRuntimeStats() {
         metric_record_string(&buddy_bom, "%u", otp_get_bom_id().value_or(0));
     }
 
+    buddy::boot_timing::record_metrics();
+
     METRIC_DEF(metric_current_filament, "filament", METRIC_VALUE_STRING, 10 * 1007, METRIC_ENABLED);
     const FilamentType current_filament = config_store().get_filament_type(marlin_vars().active_extruder);
     metric_record_string(&metric_current_filament, "%s", current_filament.parameters().name);
@@ -133,7 +138,51 @@ void buddy::metrics::RecordRuntimeStats() {
     }
 
     METRIC_DEF(heap, "heap", METRIC_VALUE_CUSTOM, 503, METRIC_ENABLED);
-    metric_record_custom(&heap, " free=%zui,total=%zui", xPortGetFreeHeapSize(), static_cast<size_t>(heap_total_size));
+    metric_record_custom(&heap, " free=%zui,total=%zui,lfb=%" PRIu32 "i", xPortGetFreeHeapSize(), static_cast<size_t>(heap_total_size), heap_largest_free_block());
+
+    METRIC_DEF(heap_histogram, "heap_hist", METRIC_VALUE_CUSTOM, 0, METRIC_ENABLED); // Allocation size histogram
+    METRIC_DEF(heap_site, "heap_site", METRIC_VALUE_CUSTOM, 0, METRIC_ENABLED); // Top allocation sites
+    constexpr const uint32_t HEAP_STATS_RECORD_INTERVAL_MS = 10007; // Fragmentation develops over hours, no need to sample often
+    static auto should_record_heap_stats = RunApproxEvery(HEAP_STATS_RECORD_INTERVAL_MS);
+    if (should_record_heap_stats()) {
+        for (size_t bucket = 0; bucket < HEAP_ALLOC_HISTOGRAM_BUCKETS; bucket++) {
+            // The tag is the bucket's upper bound; the last bucket takes everything larger
+            metric_record_custom(&heap_histogram, ",n=%u v=%" PRIu32 "i", 16u << bucket, heap_alloc_histogram[bucket]);
+        }
+
+        // Report the three busiest allocation sites; addr2line on the tag
+        // turns them back into code locations.
+        size_t reported[3] = {};
+        for (size_t rank = 0; rank < 3; rank++) {
+            size_t best = SIZE_MAX;
+            for (size_t i = 0; i < HEAP_ALLOC_SITE_SLOTS; i++) {
+                if (heap_alloc_sites[i].count == 0 || std::find(reported, reported + rank, i) != reported + rank) {
+                    continue;
+                }
+                if (best == SIZE_MAX || heap_alloc_sites[i].count > heap_alloc_sites[best].count) {
+                    best = i;
+                }
+            }
+            if (best == SIZE_MAX) {
+                break;
+            }
+            reported[rank] = best;
+            metric_record_custom(&heap_site, ",n=%08" PRIx32 " c=%" PRIu32 "i,b=%" PRIu32 "i",
+                heap_alloc_sites[best].ret_addr, heap_alloc_sites[best].count, heap_alloc_sites[best].bytes);
+        }
+        if (heap_alloc_sites_overflow > 0) {
+            metric_record_custom(&heap_site, ",n=other c=%" PRIu32 "i,b=0i", heap_alloc_sites_overflow);
+        }
+
+        // FreeRTOS primitive wrapper counts; a steadily growing high-water
+        // means some module leaks its primitives
+        METRIC_DEF(freertos_obj, "freertos_obj", METRIC_VALUE_CUSTOM, 0, METRIC_ENABLED);
+        for (size_t i = 0; i < static_cast<size_t>(freertos::ResourceType::_count); i++) {
+            const auto type = static_cast<freertos::ResourceType>(i);
+            const auto stats = freertos::resource_stats(type);
+            metric_record_custom(&freertos_obj, ",n=%s v=%ui,m=%ui", freertos::resource_type_name(type), stats.live, stats.high_water);
+        }
+    }
 }
 
 void buddy::metrics::RecordMarlinVariables() {
@@ -19,7 +19,11 @@
 #include <device/board.h>
 #include <buddy/usb_device.hpp>
 
+#include <option/benchmarks.h>
 #include <option/has_advanced_power.h>
+#if BENCHMARKS()
+    #include <common/benchmark/benchmark.hpp>
+#endif
 #if HAS_ADVANCED_POWER()
     #include "advanced_power.hpp"
 #endif // HAS_ADVANCED_POWER()
@@ -91,6 +95,7 @@ LOG_COMPONENT_DEF(MMU2, logging::Severity::info);
 METRIC_DEF(metric_app_start, "app_start", METRIC_VALUE_EVENT, 0, METRIC_ENABLED);
 METRIC_DEF(metric_maintask_event, "maintask_loop", METRIC_VALUE_EVENT, 0, METRIC_DISABLED);
 METRIC_DEF(metric_cpu_usage, "cpu_usage", METRIC_VALUE_INTEGER, 1000, METRIC_ENABLED);
+METRIC_DEF(metric_cfg_load_duration, "cfg_load_dur", METRIC_VALUE_INTEGER, 0, METRIC_ENABLED);
 
 void app_marlin_serial_output_write_hook(const uint8_t *buffer, int size) {
     while (size && (buffer[size - 1] == '\n' || buffer[size - 1] == '\r')) {
@@ -208,11 +213,29 @@ void app_run(void) {
 
     TaskDeps::provide(TaskDeps::Dependency::default_task_ready);
 
+#if BENCHMARKS()
+    // The printer is up; run the microbenchmarks before entering the main loop
+    buddy::benchmark::run_all();
+#endif
+
+    // The journal was loaded before metrics were up; report its boot cost now
+    metric_record_integer(&metric_cfg_load_duration, config_store().get_backend().get_load_duration_us());
+
+    uint32_t last_journal_compaction_check = ticks_ms();
+
     while (1) {
         metric_record_event(&metric_maintask_event);
         metric_record_integer(&metric_cpu_usage, osGetCPUUsage());
         loop();
         marlin_server::loop();
+
+        // Journal compaction is deferred from boot; do it here, once the
+        // printer is up, so a fragmented or nearly full config bank is
+        // rewritten in the background instead of stalling boot or a save
+        if (ticks_diff(ticks_ms(), last_journal_compaction_check) > 10000) {
+            last_journal_compaction_check = ticks_ms();
+            config_store().get_backend().compact_if_needed();
+        }
     }
 }
 
@@ -14,33 +14,56 @@ bool AsyncJobBase::is_active() const {
     return (state == State::queued) || (state == State::running);
 }
 
-void AsyncJobBase::issue(const Callback &callback, AsyncJobExecutor &executor) {
+void AsyncJobBase::issue(const Callback &callback, AsyncJobExecutor &executor, std::optional<uint8_t> worker_affinity) {
     // Discard previous job this instance was holding
     discard();
 
     std::lock_guard mutex_guard(executor.mutex);
 
+    auto &ex = executor.synchronized_data;
+
+    // Determine the target worker queue
+    if (worker_affinity) {
+        // Explicit affinity - the job touches a resource bound to the worker
+        queue_ = *worker_affinity % executor.worker_count();
+        worker_pinned = true;
+
+    } else if (auto *worker = executor.worker_running_nolock(this)) {
+        // A callback issued from this instance is still running (it was just discarded above)
+        // -> pin to the same worker so callbacks of one instance never overlap
+        queue_ = worker->index;
+        worker_pinned = true;
+
+    } else {
+        // No affinity - distribute round-robin, work stealing balances the rest
+        queue_ = ex.next_queue;
+        ex.next_queue = (ex.next_queue + 1) % executor.worker_count();
+        worker_pinned = false;
+    }
+
     // Insert the job in the linked list
     {
         assert(next_job == nullptr);
         assert(previous_job == nullptr);
 
-        auto &ex = executor.synchronized_data;
+        auto &queue = ex.queues[queue_];
 
-        if (ex.first_job != nullptr) {
+        if (queue.first_job != nullptr) {
             // The linked list is not empty -> insert this after the last job
-            assert(ex.last_job != nullptr);
-            previous_job = ex.last_job;
+            assert(queue.last_job != nullptr);
+            previous_job = queue.last_job;
             previous_job->next_job = this;
 
         } else {
-            // The linked list was empty -> make this a first job and wake the executor
-            assert(!ex.first_job);
-            ex.first_job = this;
-            executor.empty_queue_condition.notify_one();
+            // The linked list was empty -> make this a first job
+            queue.first_job = this;
         }
 
-        ex.last_job = this;
+        queue.last_job = this;
+
+        // Wake all idle workers - the job might be runnable by a different
+        // worker than the one whose queue it landed in (stealing)
+        executor.empty_queue_condition.notify_all();
     }
 
     this->executor = &executor;
@@ -79,10 +102,13 @@ void AsyncJobBase::discard() {
             unqueue_nolock();
             break;
 
-        case State::running:
+        case State::running: {
             // The job is currently being processed -> mark it as discarded so that the worker task does not try to write to this structure afterwards
-            executor->synchronized_data.current_job_discarded = true;
+            auto *worker = executor->worker_running_nolock(this);
+            assert(worker);
+            worker->current_job_discarded = true;
             break;
+        }
 
         case State::finished:
             // The job is finished -> no need to do anything
@@ -103,21 +129,22 @@ void AsyncJobBase::discard() {
 void AsyncJobBase::unqueue_nolock() {
     assert(state_ == State::queued);
 
-    auto &ex = executor->synchronized_data;
+    auto &queue = executor->synchronized_data.queues[queue_];
 
     if (previous_job) {
         previous_job->next_job = next_job;
-        previous_job = nullptr;
     } else {
-        assert(ex.first_job == this);
-        ex.first_job = next_job;
+        assert(queue.first_job == this);
+        queue.first_job = next_job;
     }
 
     if (next_job) {
         next_job->previous_job = previous_job;
-        next_job = nullptr;
     } else {
-        assert(ex.last_job == this);
-        ex.last_job = previous_job;
+        assert(queue.last_job == this);
+        queue.last_job = previous_job;
     }
+
+    previous_job = nullptr;
+    next_job = nullptr;
 }
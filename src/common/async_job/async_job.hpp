@@ -2,6 +2,7 @@
 
 #include <functional>
 #include <atomic>
+#include <optional>
 
 #include "async_job_executor.hpp"
 #include "async_job_execution_control.hpp"
@@ -62,9 +63,12 @@ public:
 protected:
     /// Enqueues the callback to be executed on a worker task.
     /// If the AsyncJob already contains a running task, discards it.
+    /// \param worker_affinity pins the job to the given worker (modulo worker_count()); use for jobs touching resources that are not thread-safe.
+    ///     Jobs without affinity can run on (or be stolen by) any worker.
+    ///     Regardless of this parameter, a job issued while a previous callback of the same instance is still running is pinned to the worker running it, so callbacks of one instance never overlap.
     /// !!! The callback execution can live longer than the lifespan of the issuer AsyncJob instance. !!!
     /// !!! For returning results from the callback, use \p with_current_job_synchronized() !!!
-    void issue(const Callback &callback, Executor &executor = Executor::default_instance());
+    void issue(const Callback &callback, Executor &executor = Executor::default_instance(), std::optional<uint8_t> worker_affinity = std::nullopt);
 
 private:
     /// Unlinks this instance from the linked list.
@@ -83,6 +87,12 @@ private:
 
     AsyncJobBase *previous_job = nullptr;
 
+    /// Index of the worker queue this job is linked in (valid only in the \p queued state)
+    uint8_t queue_ = 0;
+
+    /// The job may only run on the worker owning its queue (it must not be stolen)
+    bool worker_pinned = false;
+
     /// Protected by mutex for writing, but still atomic for reading
     std::atomic<State> state_ = State::idle;
 };
@@ -108,7 +118,7 @@ public:
         return result_;
     }
 
-    void issue(const Callback &callback, Executor &executor = Executor::default_instance()) {
+    void issue(const Callback &callback, Executor &executor = Executor::default_instance(), std::optional<uint8_t> worker_affinity = std::nullopt) {
         // We cannot capture this in the lambda, because stdext::inplace_function wouldn't fit into stdext::inplace_function
         callback_with_result_ = callback;
 
@@ -129,7 +139,7 @@ public:
                 this->result_ = result;
             });
         },
-            executor);
+            executor, worker_affinity);
     }
 
 private:
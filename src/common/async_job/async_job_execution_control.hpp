@@ -1,6 +1,7 @@
 #pragma once
 
 #include <functional>
+#include <cstdint>
 
 class AsyncJobExecutor;
 
@@ -22,11 +23,15 @@ public:
     bool is_discarded();
 
 private:
-    AsyncJobExecutionControl(AsyncJobExecutor &executor)
-        : executor(executor) {}
+    AsyncJobExecutionControl(AsyncJobExecutor &executor, uint8_t worker_index)
+        : executor(executor)
+        , worker_index(worker_index) {}
 
     ~AsyncJobExecutionControl() = default;
 
 private:
     AsyncJobExecutor &executor;
+
+    /// Index of the executor worker the job is running on
+    uint8_t worker_index;
 };
@@ -7,10 +7,16 @@ static __attribute__((section(".ccmram"))) AsyncJobExecutor default_instance;
 
 AsyncJobExecutor::AsyncJobExecutor() {
     static constexpr auto thread_func = +[](const void *param) {
-        reinterpret_cast<AsyncJobExecutor *>(const_cast<void *>(param))->thread_routine();
+        auto *worker = reinterpret_cast<Worker *>(const_cast<void *>(param));
+        worker->executor->thread_routine(*worker);
     };
-    osThreadStaticDef(worker_thread, thread_func, TASK_PRIORITY_ASYNC_JOB_EXECUTOR, 0, thread_stack.size(), thread_stack.data(), &thread_def);
-    thread_id = osThreadCreate(osThread(worker_thread), this);
+    for (int i = 0; i < worker_count(); i++) {
+        Worker &worker = workers[i];
+        worker.index = i;
+        worker.executor = this;
+        osThreadStaticDef(worker_thread, thread_func, TASK_PRIORITY_ASYNC_JOB_EXECUTOR, 0, worker.thread_stack.size(), worker.thread_stack.data(), &worker.thread_def);
+        worker.thread_id = osThreadCreate(osThread(worker_thread), &worker);
+    }
 }
 
 AsyncJobExecutor::~AsyncJobExecutor() {
@@ -18,7 +24,7 @@ AsyncJobExecutor::~AsyncJobExecutor() {
     // If this is necessary, the following thins need to be considered:
     // * Assert that there are no tasks in the queue
     //   (the executor owns the mutex, so if there were any tasks in the queue possibly trying to lock to a deleted lock, things would go haywire)
-    // * Signal the thread to quit, wait for it to finish, clean up
+    // * Signal the threads to quit, wait for them to finish, clean up
     std::terminate();
 }
 
@@ -26,7 +32,34 @@ AsyncJobExecutor &AsyncJobExecutor::default_instance() {
     return ::default_instance;
 }
 
-void AsyncJobExecutor::thread_routine() {
+AsyncJobBase *AsyncJobExecutor::pick_job_nolock(const Worker &worker) {
+    // Own queue goes first - it holds all the jobs pinned to this worker
+    if (AsyncJobBase *job = synchronized_data.queues[worker.index].first_job) {
+        return job;
+    }
+
+    // Steal the oldest not-pinned job from the other queues
+    for (auto &queue : synchronized_data.queues) {
+        for (AsyncJobBase *job = queue.first_job; job; job = job->next_job) {
+            if (!job->worker_pinned) {
+                return job;
+            }
+        }
+    }
+
+    return nullptr;
+}
+
+AsyncJobExecutor::Worker *AsyncJobExecutor::worker_running_nolock(const AsyncJobBase *job) {
+    for (auto &worker : workers) {
+        if (worker.current_job == job) {
+            return &worker;
+        }
+    }
+    return nullptr;
+}
+
+void AsyncJobExecutor::thread_routine(Worker &worker) {
     using State = AsyncJobBase::State;
     using Callback = AsyncJobBase::Callback;
 
@@ -36,19 +69,18 @@ void AsyncJobExecutor::thread_routine() {
         // This pointer is unsafe to access outside mutex locked areas
         AsyncJobBase *job;
 
-        // Pop a job from the list and obtain the callback
+        // Pop a job from the queues and obtain the callback
         {
             std::unique_lock mutex_guard(mutex);
 
-            while (!synchronized_data.first_job) {
+            while (!(job = pick_job_nolock(worker))) {
                 empty_queue_condition.wait(mutex_guard);
             }
 
-            job = synchronized_data.first_job;
-            assert(job);
             assert(job->state_ == State::queued);
 
-            synchronized_data.current_job_discarded = false;
+            worker.current_job_discarded = false;
+            worker.current_job = job;
             callback = job->callback;
 
             job->unqueue_nolock();
@@ -57,7 +89,7 @@ void AsyncJobExecutor::thread_routine() {
 
         // Execute the callback
         {
-            AsyncJobExecutionControl ctrl(*this);
+            AsyncJobExecutionControl ctrl(*this, worker.index);
             callback(ctrl);
         }
 
@@ -65,8 +97,10 @@ void AsyncJobExecutor::thread_routine() {
         {
             std::lock_guard mutex_guard(mutex);
 
+            worker.current_job = nullptr;
+
             // The job was discarded -> do not update the AsyncJob instance
-            if (synchronized_data.current_job_discarded) {
+            if (worker.current_job_discarded) {
                 continue;
             }
 
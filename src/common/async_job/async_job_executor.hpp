@@ -18,36 +18,75 @@ public:
     static AsyncJobExecutor &default_instance();
 
 public:
-    /// \returns number of worker thread this executor manages
+    /// \returns number of worker threads this executor manages
     static inline constexpr int worker_count() {
-        return 1;
+        return worker_count_;
     }
 
 private:
-    /// Routine that runs on the worker task
-    void thread_routine();
+    /// Number of worker threads this executor manages
+    static constexpr int worker_count_ = 2;
 
-private:
-    /// Fields that should only be accessed with locked \p mutex
-    struct {
+    struct Worker {
+        /// Index of this worker within the executor
+        uint8_t index;
+
+        /// Backreference for the thread entry function
+        AsyncJobExecutor *executor;
+
+        /// Marks that the AsyncJob instance for the job currently running on this worker was destroyed/discarded.
+        /// Only to be accessed with locked \p mutex
+        bool current_job_discarded = false;
+
+        /// Job currently running on this worker (only compared against, never dereferenced).
+        /// Jobs re-issued from the same AsyncJob instance get pinned to this worker so that their callbacks never overlap.
+        /// Only to be accessed with locked \p mutex
+        const AsyncJobBase *current_job = nullptr;
+
+        osStaticThreadDef_t thread_def;
+        osThreadId thread_id;
+        std::array<uint32_t, 1024> thread_stack;
+    };
+
+    /// Job queue of one worker (doubly linked list)
+    struct Queue {
         /// First job in the linked list (the one to be executed)
         AsyncJobBase *first_job = nullptr;
 
         /// Last job in the queue
         AsyncJobBase *last_job = nullptr;
+    };
 
-        /// Marks that the AsyncJob instance for the currently running job was destroyed/discarded
-        bool current_job_discarded = false;
+private:
+    /// Routine that runs on each worker task
+    void thread_routine(Worker &worker);
+
+    /// Picks the next job for \p worker: its own queue first, then steals
+    /// the oldest job that is not pinned to a worker from the other queues.
+    /// \returns nullptr when there is nothing to do
+    /// !!! Assumes the mutex is locked. !!!
+    AsyncJobBase *pick_job_nolock(const Worker &worker);
+
+    /// \returns the worker whose currently running job is \p job, or nullptr
+    /// !!! Assumes the mutex is locked. !!!
+    Worker *worker_running_nolock(const AsyncJobBase *job);
+
+private:
+    /// Fields that should only be accessed with locked \p mutex
+    struct {
+        /// Per-worker job queues
+        std::array<Queue, worker_count_> queues;
+
+        /// Round-robin counter distributing jobs without a worker affinity
+        uint8_t next_queue = 0;
 
     } synchronized_data;
 
     freertos::Mutex mutex;
 
-    /// Wait condition for the executor, when the queue is empty
+    /// Wait condition for the workers, when there is nothing for them to run
     freertos::WaitCondition empty_queue_condition;
 
 private:
-    osStaticThreadDef_t thread_def;
-    osThreadId thread_id;
-    std::array<uint32_t, 1024> thread_stack;
+    std::array<Worker, worker_count_> workers;
 };
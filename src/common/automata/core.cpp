@@ -1,50 +1,63 @@
 #include "core.h"
 
 #include <cassert>
-#include <cctype>
 
 using std::nullopt;
 using std::optional;
 
 namespace {
 
-typedef bool (*SpecialCheck)(uint8_t);
-
-bool anything(uint8_t) {
-    return true;
+/*
+ * Our own ASCII-only character classification.
+ *
+ * The libc counterparts are locale-aware ‒ a function call and a table
+ * indirection for every single byte. Our protocols are ASCII by definition
+ * and this engine sits on every byte of every request, so we do the few
+ * comparisons ourselves and let the compiler inline them.
+ */
+
+constexpr uint8_t ascii_tolower(uint8_t byte) {
+    return (byte >= 'A' && byte <= 'Z') ? byte + ('a' - 'A') : byte;
 }
 
-bool whitespace(uint8_t byte) {
-    return isspace(byte);
+constexpr bool whitespace(uint8_t byte) {
+    return byte == ' ' || (byte >= '\t' && byte <= '\r');
 }
 
-bool horiz_space(uint8_t byte) {
-    return byte == ' ' or byte == '\t';
+constexpr bool horiz_space(uint8_t byte) {
+    return byte == ' ' || byte == '\t';
 }
 
-bool digit(uint8_t byte) {
-    return isdigit(byte);
+constexpr bool digit(uint8_t byte) {
+    return byte >= '0' && byte <= '9';
 }
 
-SpecialCheck specials[] = {
-    anything,
-    whitespace,
-    horiz_space,
-    digit,
-};
-
 } // namespace
 
 namespace automata {
 
-bool Transition::matches(uint8_t byte) const {
+bool Transition::matches(uint8_t byte, uint8_t byte_lower) const {
     switch (label_type) {
     case LabelType::Char:
         return byte == label;
     case LabelType::CharNoCase:
-        return tolower(byte) == label;
+        return byte_lower == label;
     case LabelType::Special:
-        return specials[label](byte);
+        // A switch instead of a table of function pointers ‒ saves the
+        // indirect call on the per-byte hot path.
+        switch (label) {
+        case SpecialLabel::All:
+            return true;
+        case SpecialLabel::Whitespace:
+            return whitespace(byte);
+        case SpecialLabel::HorizWhitespace:
+            return horiz_space(byte);
+        case SpecialLabel::Digit:
+            return digit(byte);
+        default:
+            assert(0);
+            return false;
+        }
     case LabelType::Path:
         // Paths are handled by the caller, because they need another index.
     default:
@@ -75,11 +88,12 @@ std::optional<Event> Automaton::gen_event(StateIdx old_state, StateIdx new_state
 std::optional<TransitionResult> Automaton::transition(ActiveState old, uint8_t byte) const {
     const State &state = states[old.state];
     const State &sentinel = states[old.state + 1];
+    // Converted just once, not per transition probed.
+    const uint8_t converted = ascii_tolower(byte);
     for (TransIdx i = state.first_transition; i < sentinel.first_transition; i++) {
         if (transitions[i].label_type == LabelType::Path) {
             // All paths are case-insensitive. Originaly, we did have an option
             // to have case-sensitive paths, but they were not used.
-            const uint8_t converted = tolower(byte);
             const char *path = paths[transitions[i].label].value;
             if (path[old.path] == converted) {
                 if (path[old.path + 1] == '\0') {
@@ -93,7 +107,7 @@ std::optional<TransitionResult> Automaton::transition(ActiveState old, uint8_t b
                     return TransitionResult { old.path_step(), nullopt, false };
                 }
             }
-        } else if (transitions[i].matches(byte)) {
+        } else if (transitions[i].matches(byte, converted)) {
             const auto new_state = transitions[i].target_state;
             return TransitionResult { new_state, gen_event(old.state, new_state, byte), transitions[i].fallthrough };
         }
@@ -165,7 +165,10 @@ struct Transition {
     // Do not consume the character, offer it to the next state too.
     bool fallthrough : 1;
     /// Checks a match with the given byte.
-    bool matches(uint8_t byte) const;
+    ///
+    /// The caller provides the lowercase version too ‒ it already has it at
+    /// hand and this avoids converting once per probed transition.
+    bool matches(uint8_t byte, uint8_t byte_lower) const;
 };
 
 /**
@@ -58,3 +58,49 @@ int Base64StreamDecoder::ConsumeChar(char c, uint8_t *out) {
     }
     return -1; // just in case...
 }
+
+int Base64StreamDecoder::ConsumeBlock(const char *in, size_t len, uint8_t *out, size_t &base64_chars) {
+    const char *p = in;
+    const char *const end = in + len;
+    uint8_t *o = out;
+
+    while (p != end) {
+        // Aligned fast path - whole quads straight from the table.
+        // Skip/padding/invalid characters all map to 0xff and send the quad
+        // to the per-character path below.
+        while (state == States::AwaitingFirst && end - p >= 4) {
+            const uint8_t i0 = find64(static_cast<uint8_t>(p[0]));
+            const uint8_t i1 = find64(static_cast<uint8_t>(p[1]));
+            const uint8_t i2 = find64(static_cast<uint8_t>(p[2]));
+            const uint8_t i3 = find64(static_cast<uint8_t>(p[3]));
+            if ((i0 | i1 | i2 | i3) & 0xc0) {
+                break;
+            }
+            o[0] = (i0 << 2) | (i1 >> 4);
+            o[1] = (i1 << 4) | (i2 >> 2);
+            o[2] = (i2 << 6) | i3;
+            o += 3;
+            p += 4;
+            base64_chars += 4;
+        }
+        if (p == end) {
+            break;
+        }
+
+        const char c = *p++;
+        if (c == '\r' || c == '\n' || c == ' ' || c == ';') {
+            continue;
+        }
+        ++base64_chars;
+        switch (ConsumeChar(c, o)) {
+        case 1:
+            ++o;
+            break;
+        case 0:
+            break;
+        default:
+            return -1;
+        }
+    }
+    return o - out;
+}
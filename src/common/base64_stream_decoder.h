@@ -34,6 +34,18 @@ public:
     //         -1 pokud se posralo dekodovani vstupniho znaku
     int ConsumeChar(char c, uint8_t *out);
 
+    // Decodes a whole buffer of base64 characters, 4 characters to 3 bytes at
+    // a time while the input stays aligned. Characters from the skip set
+    // ('\r', '\n', ' ', ';' - line breaks and the comment prefix of thumbnail
+    // lines) are ignored instead of failing the decode.
+    // @param in input characters
+    // @param len count of characters at in
+    // @param out output buffer, needs room for at least (len * 3) / 4 + 2 bytes
+    // @param base64_chars incremented by the count of non-skipped input characters
+    // @return count of bytes written to out
+    //         -1 on an invalid input character
+    int ConsumeBlock(const char *in, size_t len, uint8_t *out, size_t &base64_chars);
+
 private:
     uint8_t lastbits = 0;
     enum class States : uint8_t {
@@ -0,0 +1,65 @@
+#include "benchmark.hpp"
+
+#include <logging/log.hpp>
+#include <timing.h>
+
+LOG_COMPONENT_DEF(Benchmark, logging::Severity::info);
+
+namespace buddy::benchmark {
+
+// Registration order is kept (tail append); all constructors run during
+// static initialization, before any threads exist.
+static Case *first_case = nullptr;
+static Case *last_case = nullptr;
+
+Case::Case(const char *name, BenchmarkFunc func)
+    : name(name)
+    , func(func) {
+    if (last_case) {
+        last_case->next = this;
+    } else {
+        first_case = this;
+    }
+    last_case = this;
+}
+
+bool Context::next() {
+    const uint32_t now = ticks_us();
+    if (runs == 0) {
+        start_us = now;
+    } else {
+        elapsed_us = now - start_us;
+        if (elapsed_us >= min_total_us || runs >= max_iterations) {
+            return false;
+        }
+    }
+    runs++;
+    return true;
+}
+
+void run_all() {
+    log_info(Benchmark, "run begin");
+
+    for (Case *c = first_case; c; c = c->next) {
+        Context ctx;
+        c->func(ctx);
+
+        if (ctx.runs == 0 || ctx.elapsed_us == 0) {
+            log_error(Benchmark, "name=%s error=no_iterations", c->name);
+            continue;
+        }
+
+        // 64-bit intermediates: elapsed_us * 1000 overflows 32 bits well
+        // within the time budget
+        const uint32_t ns_per_iter = static_cast<uint64_t>(ctx.elapsed_us) * 1000 / ctx.runs;
+        const uint32_t kb_per_s = static_cast<uint64_t>(ctx.bytes_per_iteration) * ctx.runs * 1000 / ctx.elapsed_us;
+
+        log_info(Benchmark, "name=%s iters=%u total_us=%u ns_per_iter=%u kb_per_s=%u",
+            c->name, static_cast<unsigned>(ctx.runs), static_cast<unsigned>(ctx.elapsed_us),
+            static_cast<unsigned>(ns_per_iter), static_cast<unsigned>(kb_per_s));
+    }
+
+    log_info(Benchmark, "run end");
+}
+
+} // namespace buddy::benchmark
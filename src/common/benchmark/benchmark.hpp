@@ -0,0 +1,82 @@
+/// @file
+/// On-device microbenchmark harness.
+///
+/// Host unit tests cannot see cache and flash wait-state effects, so this
+/// runner executes registered benchmarks on the real hardware and emits one
+/// machine-readable line per benchmark to the serial console. Benchmarks
+/// register themselves Catch2-style through the BENCHMARK_DEF macro; the
+/// harness is only compiled with the BENCHMARKS cmake option.
+///
+/// A benchmark body loops over Context::next(), which handles timing and
+/// decides how many iterations are enough:
+///
+///     BENCHMARK_DEF(crc32_1k, "crc32_1k") {
+///         ctx.set_bytes_per_iteration(buffer.size());
+///         while (ctx.next()) {
+///             crc32_calc(buffer.data(), buffer.size());
+///         }
+///     }
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+namespace buddy::benchmark {
+
+class Context;
+
+using BenchmarkFunc = void (*)(Context &ctx);
+
+/// One registered benchmark. Instances append themselves to a global list on
+/// construction, so defining one in any linked translation unit is enough.
+class Case {
+public:
+    Case(const char *name, BenchmarkFunc func);
+
+private:
+    friend void run_all();
+
+    const char *name;
+    BenchmarkFunc func;
+    Case *next = nullptr;
+};
+
+/// Iteration control handed to a benchmark body
+class Context {
+public:
+    /// Loop condition of the benchmark body; starts the clock on the first
+    /// call and stops iterating once enough time has accumulated
+    bool next();
+
+    /// Reports how many bytes one iteration processes, so the result line
+    /// can include throughput
+    void set_bytes_per_iteration(size_t bytes) {
+        bytes_per_iteration = bytes;
+    }
+
+private:
+    friend void run_all();
+
+    /// Keep iterating at least this long for a stable average
+    static constexpr uint32_t min_total_us = 250'000;
+
+    /// Upper bound for bodies too fast for the time budget to ever hit
+    static constexpr uint32_t max_iterations = 100'000;
+
+    uint32_t runs = 0;
+    uint32_t start_us = 0;
+    uint32_t elapsed_us = 0;
+    size_t bytes_per_iteration = 0;
+};
+
+/// Runs all registered benchmarks and logs one result line each
+void run_all();
+
+} // namespace buddy::benchmark
+
+/// Defines and registers a benchmark; the body follows the macro and sees
+/// its Context as \c ctx
+#define BENCHMARK_DEF(fn_name, bench_name)                                        \
+    static void fn_name(buddy::benchmark::Context &);                             \
+    static const buddy::benchmark::Case fn_name##_benchmark(bench_name, fn_name); \
+    static void fn_name([[maybe_unused]] buddy::benchmark::Context &ctx)
@@ -0,0 +1,76 @@
+// Default benchmark set: hot paths whose cost on real hardware (flash wait
+// states, caches) host tests cannot measure. More cases can be registered
+// from any translation unit via BENCHMARK_DEF.
+#include "benchmark.hpp"
+
+#include <array>
+#include <cstring>
+
+#include <crc32.h>
+#include <media_prefetch/prefetch_compression.hpp>
+
+namespace {
+
+// Deterministic pseudo-random payload, so results are comparable across runs
+// and releases
+std::array<uint8_t, 4096> &payload() {
+    static std::array<uint8_t, 4096> data = []() {
+        std::array<uint8_t, 4096> d;
+        uint32_t state = 0x12345678;
+        for (auto &b : d) {
+            state = state * 1664525 + 1013904223;
+            b = state >> 24;
+        }
+        return d;
+    }();
+    return data;
+}
+
+// Representative gcode command for the prefetch compression benchmarks
+constexpr const char *gcode_line = "G1 X125.672 Y83.413 E0.02584 F3000";
+
+} // namespace
+
+BENCHMARK_DEF(bench_crc32_hw_4k, "crc32_hw_4k") {
+    auto &data = payload();
+    ctx.set_bytes_per_iteration(data.size());
+    while (ctx.next()) {
+        crc32_calc(data.data(), data.size());
+    }
+}
+
+BENCHMARK_DEF(bench_crc32_sw_4k, "crc32_sw_4k") {
+    auto &data = payload();
+    ctx.set_bytes_per_iteration(data.size());
+    while (ctx.next()) {
+        crc32_sw(data.data(), data.size(), 0);
+    }
+}
+
+BENCHMARK_DEF(bench_memcpy_4k, "memcpy_4k") {
+    // Baseline: pure memory bandwidth to relate the other results to
+    auto &data = payload();
+    static std::array<uint8_t, 4096> dst;
+    ctx.set_bytes_per_iteration(data.size());
+    while (ctx.next()) {
+        memcpy(dst.data(), data.data(), data.size());
+    }
+}
+
+BENCHMARK_DEF(bench_prefetch_compress, "prefetch_compress") {
+    std::array<uint8_t, 96> compressed;
+    ctx.set_bytes_per_iteration(strlen(gcode_line));
+    while (ctx.next()) {
+        media_prefetch::compress_gcode(gcode_line, compressed);
+    }
+}
+
+BENCHMARK_DEF(bench_prefetch_decompress, "prefetch_decompress") {
+    std::array<uint8_t, 96> compressed;
+    const auto compressed_len = media_prefetch::compress_gcode(gcode_line, compressed);
+    std::array<char, 96> decompressed;
+    ctx.set_bytes_per_iteration(strlen(gcode_line));
+    while (ctx.next()) {
+        media_prefetch::decompress_gcode(compressed.data(), *compressed_len, decompressed);
+    }
+}
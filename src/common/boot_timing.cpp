@@ -0,0 +1,59 @@
+#include "boot_timing.h"
+
+#include "metric.h"
+#include "timing.h"
+#include <logging/log.hpp>
+#include <cinttypes>
+#include <iterator>
+
+LOG_COMPONENT_REF(Buddy);
+
+namespace {
+
+// Tick of the moment the stage finished; 0 = not reached yet. The boot takes
+// long enough that a stage really finishing at tick 0 is not a concern.
+uint32_t stage_finished_at[static_cast<size_t>(buddy::boot_timing::Stage::_count)] = {};
+
+constexpr const char *stage_names[] = {
+    "hw_init",
+    "gui_up",
+    "bootloader",
+    "resources",
+    "tasks",
+    "network",
+};
+static_assert(std::size(stage_names) == std::size(stage_finished_at));
+
+} // namespace
+
+void buddy::boot_timing::mark(Stage stage) {
+    uint32_t &finished_at = stage_finished_at[static_cast<size_t>(stage)];
+    if (finished_at != 0) {
+        return;
+    }
+    finished_at = ticks_ms();
+
+    log_info(Buddy, "Boot stage %s finished at %" PRIu32 " ms", stage_names[static_cast<size_t>(stage)], finished_at);
+
+    if (stage == Stage::gui_up && finished_at > gui_up_budget_ms) {
+        log_warning(Buddy, "GUI up in %" PRIu32 " ms, over the %" PRIu32 " ms budget", finished_at, gui_up_budget_ms);
+    }
+}
+
+void buddy::boot_timing::record_metrics() {
+    METRIC_DEF(boot_time, "boot_time", METRIC_VALUE_CUSTOM, 65532, METRIC_ENABLED);
+    if (!metric_record_is_due(&boot_time)) {
+        return;
+    }
+
+    uint32_t previous = 0;
+    for (size_t i = 0; i < std::size(stage_finished_at); i++) {
+        const uint32_t finished_at = stage_finished_at[i];
+        if (finished_at == 0) {
+            continue;
+        }
+        // t = when the stage finished since boot, d = how long the stage took
+        metric_record_custom(&boot_time, ",n=%s t=%" PRIu32 ",d=%" PRIu32, stage_names[i], finished_at, finished_at - previous);
+        previous = finished_at;
+    }
+}
@@ -0,0 +1,31 @@
+#pragma once
+#include <stdint.h>
+
+namespace buddy::boot_timing {
+
+/// The boot milestones we track, in the order they are reached.
+enum class Stage : uint8_t {
+    hw_init, ///< low-level peripherals, SPI flash, filesystems
+    gui_up, ///< display task running, bootstrap screen rendered (= responsive UI)
+    bootloader, ///< bootloader reflash check (and possibly the reflash itself)
+    resources, ///< resources check (and possibly the bbf extraction)
+    tasks, ///< marlin and friends started
+    network, ///< networking tasks started, syslog/metrics configured
+    _count
+};
+
+/// Cold-boot-to-responsive-UI budget. Going over it is not an error, just a
+/// regression worth noticing ‒ it shows up in the log and the per-stage
+/// durations in the boot_time metric tell where the time went.
+inline constexpr uint32_t gui_up_budget_ms = 5000;
+
+/// Record that the stage has just finished; repeated marks of the same stage
+/// keep the first timestamp.
+void mark(Stage stage);
+
+/// Record the per-stage durations into the boot_time metric. Throttled
+/// internally, meant to be called from the periodic metrics recording so the
+/// values eventually reach the handlers configured after boot.
+void record_metrics();
+
+} // namespace buddy::boot_timing
@@ -3,6 +3,8 @@
 
 #include <stdint.h>
 #include <stddef.h>
+#include <algorithm>
+#include <bit>
 #include <iterator>
 
 class CircleBufferBase {
@@ -10,12 +12,18 @@ class CircleBufferBase {
 public:
     /**
      * @brief Add and normalize index to be in range [0, capacity).
-     * Efficient for small deviations from the range.
+     * A power-of-two capacity is reduced by masking; other capacities are
+     * efficient only for small deviations from the range.
      * @param index index
      * @param add addition to index
      * @return normalized result
      */
     size_t normalizedAddition(size_t index, int add) const {
+        if (mask_) {
+            // index + add wraps modulo 2^N even for negative additions,
+            // masking then reduces it modulo the (power-of-two) capacity
+            return (index + add) & mask_;
+        }
         add += static_cast<int>(index);
         while (add >= static_cast<int>(capacity_)) {
             add -= capacity_;
@@ -29,6 +37,9 @@ public:
 public:
     /// Returns number of elements in the circle buffer
     size_t size() const {
+        if (mask_) {
+            return (end_pos - begin_pos) & mask_;
+        }
         return (end_pos + capacity_ - begin_pos) % capacity_;
     }
 
@@ -46,11 +57,13 @@ public:
 
 protected:
     CircleBufferBase(size_t capacity)
-        : capacity_(capacity) {
+        : capacity_(capacity)
+        , mask_(std::has_single_bit(capacity) ? capacity - 1 : 0) {
     }
 
 protected:
     const size_t capacity_;
+    const size_t mask_; ///< capacity - 1 for power-of-two capacities, 0 otherwise
     size_t begin_pos = 0; // position of first element
     size_t end_pos = 0; // position behind last element == write position
 };
@@ -191,6 +204,41 @@ public:
         }
     }
 
+    /// Appends up to \p count elements from \p src.
+    /// Copies in contiguous spans across the wrap instead of element by element.
+    /// Unlike push_back, the oldest elements are never overwritten - the
+    /// operation stops when the buffer is full.
+    /// \returns number of elements actually stored
+    size_t push_back_multiple(const T *src, size_t count) {
+        count = std::min(count, capacity() - size());
+        size_t remaining = count;
+        while (remaining) {
+            // Cannot collide with begin_pos - count is limited to the free space
+            const size_t contiguous = std::min(remaining, capacity_ - end_pos);
+            std::copy_n(src, contiguous, data + end_pos);
+            src += contiguous;
+            remaining -= contiguous;
+            end_pos = normalizedAddition(end_pos, static_cast<int>(contiguous));
+        }
+        return count;
+    }
+
+    /// Removes up to \p count elements from the front of the buffer into \p dst.
+    /// Copies in contiguous spans across the wrap instead of element by element.
+    /// \returns number of elements actually copied
+    size_t consume_multiple(T *dst, size_t count) {
+        count = std::min(count, size());
+        size_t remaining = count;
+        while (remaining) {
+            const size_t contiguous = std::min(remaining, capacity_ - begin_pos);
+            std::copy_n(data + begin_pos, contiguous, dst);
+            dst += contiguous;
+            remaining -= contiguous;
+            begin_pos = normalizedAddition(begin_pos, static_cast<int>(contiguous));
+        }
+        return count;
+    }
+
     // data must be processed before next push_back
     bool ConsumeFirst(T &elem) {
         if (IsEmpty()) {
@@ -236,6 +284,8 @@ protected:
 // you can never use entire size
 // because write position (end) cannot be equal to begin
 // because begin == end == empty
+// declaring a power-of-two capacity replaces the per-element modulo
+// arithmetic with masking - prefer it for frequently accessed buffers
 template <class T, size_t capacity>
 class CircleBuffer : public CircleBufferBaseT<T> {
 
@@ -1,6 +1,6 @@
-#include "mmu2_bootloader_memory_resource.hpp"
+#include "stack_memory_resource.hpp"
 
-using namespace MMU2::bootloader;
+using namespace coro;
 
 StackMemoryResource::StackMemoryResource(void *buffer, size_t buffer_size)
     : buffer(reinterpret_cast<uint8_t *>(buffer))
@@ -1,11 +1,12 @@
 #pragma once
 
+#include <array>
 #include <memory_resource>
 
 #include <bsod.h>
 #include <assert.h>
 
-namespace MMU2::bootloader {
+namespace coro {
 
 /// Memory resource that handles allocations/deallocations in a stack-like manner.
 /// Violating the LIFO alloc/dealloc order results in UB.
@@ -42,4 +43,4 @@ private:
     alignas(8) std::array<uint8_t, num_bytes> buffer;
 };
 
-} // namespace MMU2::bootloader
+} // namespace coro
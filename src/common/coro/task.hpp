@@ -4,10 +4,15 @@
 #include <variant>
 #include <memory_resource>
 
-// Small coroutine framework
-// Basic premise is that we have tasks that can depend on other tasks
+// Small coroutine framework, originally written for the MMU bootloader protocol.
+// Basic premise is that we have tasks that can depend on other tasks.
+//
+// Coroutine frames are allocated from a manager object: the first parameter of
+// every Task coroutine function must be a reference to an object with a
+// \c co_memory_resource member (typically a StaticStackMemoryResource), so no
+// frame ever touches the heap.
 
-namespace MMU2::bootloader {
+namespace coro {
 
 struct PromiseBase;
 class TaskBase;
@@ -146,4 +151,4 @@ Task<Result> PromiseT<Result>::get_return_object() {
     return Task<Result>(std::coroutine_handle<Promise<Result>>::from_promise(static_cast<Promise<Result> &>(*this)));
 }
 
-} // namespace MMU2::bootloader
+} // namespace coro
@@ -1,11 +1,16 @@
 #include "crash_dump_distribute.hpp"
+#include <async_job/async_job.hpp>
+#include <config_store/store_instance.hpp>
+#include <device/board.h>
 #include <http/socket_connection_factory.hpp>
 #include <version/version.hpp>
 #include <otp.hpp>
 #include <printers.h>
+#include <cinttypes>
 #include <cstdio>
 #include <logging/log.hpp>
 #include <cstring>
+#include <cmsis_os.h>
 
 LOG_COMPONENT_DEF(CrashDump, logging::Severity::info);
 
@@ -13,6 +18,12 @@ namespace crash_dump {
 
 inline constexpr uint8_t socket_timeout_s { 6 };
 
+/// How much of the dump goes out in one request
+inline constexpr uint32_t upload_chunk_size { 4096 };
+
+/// Pause between the chunk requests, leaving the network path to interactive traffic
+inline constexpr uint32_t upload_chunk_pause_ms { 250 };
+
 bool escape_url_string(std::span<char> escaped_url_string, const std::array<char, url_buff_size> &url_buff) {
     // escaping of special characters, should probably be done elswhere (somewhere that handles the url string)
     size_t cur_written { 0 };
@@ -68,4 +79,106 @@ bool upload_dump_to_server(http::Request &req) {
 
     return true;
 }
+
+namespace {
+
+    /// One chunk of the dump, POSTed with its position encoded in the url query
+    class DumpChunkRequest final : public http::Request {
+    public:
+        DumpChunkRequest(const char *url_string, uint32_t offset, uint32_t chunk_size)
+            : offset(offset)
+            , chunk_size(chunk_size)
+            , hdrs {
+                { "Content-Length", static_cast<size_t>(chunk_size), std::nullopt },
+                { nullptr, nullptr, std::nullopt },
+            }
+            , url_string(url_string) {}
+
+        const char *url() const override { return url_string; }
+        http::ContentType content_type() const override {
+            return http::ContentType::ApplicationOctetStream;
+        }
+        http::Method method() const override {
+            return http::Post;
+        }
+        const http::HeaderOut *extra_headers() const override {
+            return hdrs;
+        }
+        std::variant<size_t, http::Error> write_body_chunk(char *data, size_t size) override {
+            const size_t to_read = std::min(size, static_cast<size_t>(chunk_size - read));
+            if (to_read == 0) {
+                return static_cast<size_t>(0);
+            }
+            if (!dump_read_data(offset + read, to_read, reinterpret_cast<uint8_t *>(data))) {
+                log_error(CrashDump, "error reading from flash");
+                return http::Error::InternalError;
+            }
+            read += to_read;
+            return to_read;
+        }
+
+    private:
+        uint32_t offset;
+        uint32_t chunk_size;
+        uint32_t read { 0 };
+        http::HeaderOut hdrs[2];
+        const char *url_string;
+    };
+
+    AsyncJob background_upload_job;
+
+    void background_upload_routine(AsyncJobExecutionControl &control) {
+        const uint32_t dump_size = dump_get_size();
+        auto &store = config_store();
+
+        uint32_t offset = store.crash_dump_upload_offset.get();
+        if (store.crash_dump_upload_size.get() != dump_size || offset > dump_size) {
+            // The cursor belongs to some previous dump - start over
+            offset = 0;
+            store.crash_dump_upload_offset.set(0);
+            store.crash_dump_upload_size.set(dump_size);
+        }
+
+        std::array<char, url_buff_size> url_buff;
+        std::array<char, url_buff_size> escaped_url_string;
+        create_url_string(url_buff, escaped_url_string, BOARD_STRING());
+
+        while (offset < dump_size) {
+            if (control.is_discarded()) {
+                return;
+            }
+
+            const uint32_t chunk = std::min(upload_chunk_size, dump_size - offset);
+
+            std::array<char, url_buff_size + 40> chunk_url;
+            snprintf(chunk_url.data(), chunk_url.size(), "%s&offset=%" PRIu32 "&total=%" PRIu32, escaped_url_string.data(), offset, dump_size);
+
+            DumpChunkRequest req(chunk_url.data(), offset, chunk);
+            if (!upload_dump_to_server(req)) {
+                // Keep the cursor - the next attempt resumes from here
+                return;
+            }
+
+            offset += chunk;
+            store.crash_dump_upload_offset.set(offset);
+
+            osDelay(upload_chunk_pause_ms);
+        }
+
+        dump_set_exported();
+    }
+
+} // namespace
+
+void start_background_upload() {
+    if (server[0] == '\0') {
+        // No server set up -> disable crash dumps.
+        return;
+    }
+    if (!dump_is_valid() || dump_is_exported()) {
+        return;
+    }
+    background_upload_job.issue([](AsyncJobExecutionControl &control) { background_upload_routine(control); });
+}
+
 }; // namespace crash_dump
@@ -15,4 +15,11 @@ void create_url_string(std::array<char, url_buff_size> &url_buff, std::array<cha
 
 bool upload_dump_to_server(http::Request &req);
 
+/// Issues a low-priority background job that trickles the buddy dump to the
+/// server in small chunks, pausing between them so interactive traffic is not
+/// starved after a restart. The resume cursor is persisted in config_store,
+/// so an interrupted upload (power cycle, network loss) continues where it
+/// stopped instead of resending the whole dump.
+void start_background_upload();
+
 } // namespace crash_dump
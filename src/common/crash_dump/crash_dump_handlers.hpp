@@ -8,7 +8,6 @@
 
 namespace crash_dump {
 inline constexpr const char *buddy_dump_usb_path { "/usb/dump_buddy.bin" };
-void upload_buddy_dump_to_server();
 
 struct DumpHandler {
     bool (*presence_check)();
@@ -29,7 +28,7 @@ inline constexpr auto dump_handlers { std::to_array<DumpHandler>({
         {
             .presence_check = []() { return dump_is_valid() && !dump_is_exported(); },
             .usb_save = []() { save_dump_to_usb(buddy_dump_usb_path); },
-            .server_upload = []() { upload_buddy_dump_to_server(); },
+            .server_upload = []() { start_background_upload(); },
             .remove = []() {
                 // dump is intentinaly not removed, just marked as exported. User can later export it from menu.
                 dump_set_exported(); },
@@ -12,21 +12,28 @@
 #include "safe_state.h"
 #include <wdt.hpp>
 #include <algorithm>
+#include <freertos/mutex.hpp>
+#include <mutex>
 extern "C" {
 #include "CrashCatcher.h"
+#include "heatshrink_encoder.h"
+#include "heatshrink_decoder.h"
 }
 
 #include <version/version.hpp>
 
 namespace crash_dump {
 
-/// While dumping, this stores size of already dumped data
+/// While dumping, this stores size of already dumped (compressed) data
 static uint32_t dump_size;
+/// While dumping, this stores size of the data before compression
+static uint32_t dump_raw_size;
 static bool dump_breakpoint_paused = false;
 static bool wdg_reset_safeguard = false; ///< Safeguard to prevent multiple refresh of watchdog in dump
 
 /// Just random value, used to check that dump is probably valid in flash
-inline constexpr uint32_t CRASH_DUMP_MAGIC_NR = 0x3DC53F;
+/// (changed when the compressed dump format was introduced)
+inline constexpr uint32_t CRASH_DUMP_MAGIC_NR = 0x59CD42A7;
 
 /// Just random value, used to check that message is probably valid in flash
 inline constexpr uint32_t MESSAGE_DUMP_MAGIC_NR = 0xD87FA0DF;
@@ -34,7 +41,8 @@ typedef struct __attribute__((packed)) {
     /// Magic number, that indicates that crash dump is valid
     uint32_t crash_dump_magic_nr;
     DumpFlags dump_flags;
-    uint32_t dump_size;
+    uint32_t dump_size; ///< Size of the compressed data in flash
+    uint32_t dump_raw_size; ///< Size of the dump before compression
 } info_t;
 
 typedef struct __attribute__((packed)) {
@@ -55,6 +63,59 @@ inline constexpr uint32_t dump_max_size = w25x_dump_size;
 /// Max size of dump data
 inline constexpr uint32_t dump_max_data_size = dump_max_size - sizeof(info_t);
 
+/// Dump data is compressed (heatshrink) while being written so that more of
+/// the RAM fits into the reserved flash area. The parameters have to match
+/// between the dump writer and the reader below.
+inline constexpr uint8_t dump_compression_window_bits = 9;
+inline constexpr uint8_t dump_compression_lookahead_bits = 5;
+inline constexpr size_t dump_compression_buf_size = 2 << dump_compression_window_bits;
+/// Input chunk size for the decompressor (compressed bytes read from flash at once)
+inline constexpr size_t dump_decompression_chunk_size = 64;
+
+/// Encoder state, statically allocated and initialized in place: malloc
+/// cannot be trusted while handling a crash
+static struct {
+    alignas(heatshrink_encoder) uint8_t encoder[sizeof(heatshrink_encoder) + dump_compression_buf_size];
+    alignas(struct hs_index) uint8_t search_index[sizeof(struct hs_index) + dump_compression_buf_size * sizeof(uint16_t)];
+} encoder_storage;
+
+static heatshrink_encoder *dump_encoder_reset() {
+    auto *hse = reinterpret_cast<heatshrink_encoder *>(encoder_storage.encoder);
+    hse->window_sz2 = dump_compression_window_bits;
+    hse->lookahead_sz2 = dump_compression_lookahead_bits;
+#if HEATSHRINK_USE_INDEX
+    hse->search_index = reinterpret_cast<struct hs_index *>(encoder_storage.search_index);
+    hse->search_index->size = dump_compression_buf_size * sizeof(uint16_t);
+#endif
+    heatshrink_encoder_reset(hse);
+    return hse;
+}
+
+/// Decoder state for reading the dump back, statically allocated like the
+/// encoder. The stream position is kept across calls so that sequential
+/// reads decompress in a single pass; seeking backwards restarts the stream.
+static struct {
+    alignas(heatshrink_decoder) uint8_t decoder[sizeof(heatshrink_decoder) + (1 << dump_compression_window_bits) + dump_decompression_chunk_size];
+    uint32_t comp_pos; ///< compressed bytes sunk into the decoder so far
+    uint32_t raw_pos; ///< decompressed bytes produced so far
+    bool active; ///< decoder holds a valid stream position
+} read_state;
+
+/// Guards read_state against concurrent readers (GUI and connect)
+static freertos::Mutex read_mutex;
+
+static heatshrink_decoder *dump_decoder_reset() {
+    auto *hsd = reinterpret_cast<heatshrink_decoder *>(read_state.decoder);
+    hsd->input_buffer_size = dump_decompression_chunk_size;
+    hsd->window_sz2 = dump_compression_window_bits;
+    hsd->lookahead_sz2 = dump_compression_lookahead_bits;
+    heatshrink_decoder_reset(hsd);
+    read_state.comp_pos = 0;
+    read_state.raw_pos = 0;
+    read_state.active = true;
+    return hsd;
+}
+
 static_assert(sizeof(message_t) <= (w25x_pp_start_address - w25x_error_start_adress), "Error message overflows reserved space.");
 /// Position of dump message in flash
 static const message_t *dumpmessage_flash = reinterpret_cast<message_t *>(w25x_error_start_adress);
@@ -98,7 +159,7 @@ bool dump_is_exported() {
 bool dump_is_valid() {
     info_t dumpinfo;
     dump_read_header(dumpinfo);
-    return (bool)(dumpinfo.crash_dump_magic_nr == CRASH_DUMP_MAGIC_NR) && dumpinfo.dump_size > 0 && dumpinfo.dump_size <= dump_max_data_size;
+    return (bool)(dumpinfo.crash_dump_magic_nr == CRASH_DUMP_MAGIC_NR) && dumpinfo.dump_size > 0 && dumpinfo.dump_size <= dump_max_data_size && dumpinfo.dump_raw_size > 0;
 }
 
 bool dump_is_displayed() {
@@ -113,12 +174,77 @@ size_t dump_get_size() {
     }
     info_t dumpinfo;
     dump_read_header(dumpinfo);
-    return dumpinfo.dump_size;
+    return dumpinfo.dump_raw_size;
 }
 
 bool dump_read_data(size_t offset, size_t size, uint8_t *ptr) {
-    w25x_rd_data(dump_data_addr + offset, ptr, size);
-    return !w25x_fetch_error();
+    std::lock_guard lock(read_mutex);
+
+    info_t dumpinfo;
+    if (!dump_read_header(dumpinfo)) {
+        return false;
+    }
+
+    auto *hsd = reinterpret_cast<heatshrink_decoder *>(read_state.decoder);
+    if (!read_state.active || offset < read_state.raw_pos) {
+        hsd = dump_decoder_reset();
+    }
+
+    const auto fail = [&]() {
+        read_state.active = false;
+        memset(ptr, 0, size);
+        return false;
+    };
+
+    while (size) {
+        // decompress into the caller buffer once past the requested offset,
+        // discard everything in between
+        uint8_t discard[dump_decompression_chunk_size];
+        uint8_t *dst;
+        size_t dst_cap;
+        if (read_state.raw_pos < offset) {
+            dst = discard;
+            dst_cap = std::min(sizeof(discard), (size_t)(offset - read_state.raw_pos));
+        } else {
+            dst = ptr;
+            dst_cap = size;
+        }
+
+        size_t got = 0;
+        if (heatshrink_decoder_poll(hsd, dst, dst_cap, &got) < 0) {
+            return fail();
+        }
+        read_state.raw_pos += got;
+        if (dst == ptr) {
+            ptr += got;
+            size -= got;
+        }
+        if (got) {
+            continue;
+        }
+
+        // decoder is starved, feed it more compressed data from flash
+        if (read_state.comp_pos >= dumpinfo.dump_size) {
+            if (heatshrink_decoder_finish(hsd) != HSDR_FINISH_MORE) {
+                // stream ended before producing the requested range
+                return fail();
+            }
+            continue;
+        }
+
+        uint8_t in_buf[dump_decompression_chunk_size];
+        const size_t n = std::min(sizeof(in_buf), (size_t)(dumpinfo.dump_size - read_state.comp_pos));
+        w25x_rd_data(dump_data_addr + read_state.comp_pos, in_buf, n);
+        if (w25x_fetch_error()) {
+            return fail();
+        }
+        size_t sunk = 0;
+        if (heatshrink_decoder_sink(hsd, in_buf, n, &sunk) < 0) {
+            return fail();
+        }
+        read_state.comp_pos += sunk;
+    }
+    return true;
 }
 
 /**
@@ -145,6 +271,7 @@ void dump_set_displayed() {
 
 void dump_reset() {
     static_assert(dump_header_addr % w25x_block64_size == 0 && (dump_header_addr + dump_max_size) % w25x_block_size == 0, "More than reserved area is erased.");
+    read_state.active = false; // any cached decoder position is now stale
     uint32_t addr = dump_header_addr;
     // first fast-erase multiple sectors with 64KiB blocks
     for (; addr + w25x_block64_size <= dump_max_size; addr += w25x_block64_size) {
@@ -172,9 +299,10 @@ bool save_dump_to_usb(const char *fn) {
 
     fd = fopen(fn, "w");
     if (fd != NULL) {
-        // save dumped RAM and CCMRAM from xflash
-        for (uint32_t offset = 0; offset < dump_info.dump_size;) {
-            size_t read_size = std::min(sizeof(buff), (size_t)(dump_info.dump_size - offset));
+        // save dumped RAM and CCMRAM from xflash (decompressed back into the
+        // original CrashCatcher format, so offline tooling stays unchanged)
+        for (uint32_t offset = 0; offset < dump_info.dump_raw_size;) {
+            size_t read_size = std::min(sizeof(buff), (size_t)(dump_info.dump_raw_size - offset));
 
             memset(buff, 0, read_size);
             if (!dump_read_data(offset, read_size, buff)) {
@@ -188,7 +316,7 @@ bool save_dump_to_usb(const char *fn) {
             offset += read_size;
         }
         fclose(fd);
-        if (bw_total != dump_info.dump_size) {
+        if (bw_total != dump_info.dump_raw_size) {
             return false;
         }
         dump_set_exported();
@@ -313,6 +441,52 @@ static void dump_failed() {
     HAL_NVIC_SystemReset();
 }
 
+/// Compress a block of dumped memory, programming encoder output to flash as
+/// it is produced
+static void dump_compress_sink(const uint8_t *data, size_t size) {
+    auto *hse = reinterpret_cast<heatshrink_encoder *>(encoder_storage.encoder);
+    dump_raw_size += size;
+    while (size) {
+        size_t sunk = 0;
+        if (heatshrink_encoder_sink(hse, const_cast<uint8_t *>(data), size, &sunk) < 0) {
+            dump_failed();
+        }
+        data += sunk;
+        size -= sunk;
+
+        HSE_poll_res pres;
+        do {
+            uint8_t out_buf[dump_decompression_chunk_size];
+            size_t out_size = 0;
+            pres = heatshrink_encoder_poll(hse, out_buf, sizeof(out_buf), &out_size);
+            if (pres < 0 || dump_size + out_size > dump_max_data_size) {
+                dump_failed();
+            }
+            if (out_size) {
+                w25x_program(dump_data_addr + dump_size, out_buf, out_size);
+                dump_size += out_size;
+            }
+        } while (pres == HSER_POLL_MORE);
+    }
+}
+
+/// Flush any output still buffered in the encoder
+static void dump_compress_finish() {
+    auto *hse = reinterpret_cast<heatshrink_encoder *>(encoder_storage.encoder);
+    while (heatshrink_encoder_finish(hse) == HSER_FINISH_MORE) {
+        uint8_t out_buf[dump_decompression_chunk_size];
+        size_t out_size = 0;
+        if (heatshrink_encoder_poll(hse, out_buf, sizeof(out_buf), &out_size) < 0
+            || dump_size + out_size > dump_max_data_size) {
+            dump_failed();
+        }
+        if (out_size) {
+            w25x_program(dump_data_addr + dump_size, out_buf, out_size);
+            dump_size += out_size;
+        }
+    }
+}
+
 static constexpr CrashCatcherMemoryRegion regions[] = {
     { crash_dump::SCB_ADDR, crash_dump::SCB_ADDR + crash_dump::SCB_SIZE, CRASH_CATCHER_WORD },
     { crash_dump::RAM_ADDR, crash_dump::RAM_ADDR + crash_dump::RAM_SIZE, CRASH_CATCHER_BYTE },
@@ -381,29 +555,16 @@ void CrashCatcher_DumpStart([[maybe_unused]] const CrashCatcherInfo *pInfo) {
 
     crash_dump::dump_reset();
 
+    crash_dump::dump_encoder_reset();
     crash_dump::dump_size = 0;
+    crash_dump::dump_raw_size = 0;
 }
 
 void CrashCatcher_DumpMemory(const void *pvMemory, CrashCatcherElementSizes element_size, size_t elementCount) {
     if (element_size == CRASH_CATCHER_BYTE) {
-        if (crash_dump::dump_size + elementCount > crash_dump::dump_max_data_size) {
-            crash_dump::dump_failed();
-        }
-
-        w25x_program(crash_dump::dump_data_addr + crash_dump::dump_size, (uint8_t *)pvMemory, elementCount);
-        crash_dump::dump_size += elementCount;
+        crash_dump::dump_compress_sink(reinterpret_cast<const uint8_t *>(pvMemory), elementCount);
     } else if (element_size == CRASH_CATCHER_WORD) {
-        if (crash_dump::dump_size + elementCount * sizeof(uint32_t) > crash_dump::dump_max_data_size) {
-            crash_dump::dump_failed();
-        }
-
-        const uint32_t *ptr = reinterpret_cast<const uint32_t *>(pvMemory);
-        while (elementCount) {
-            uint32_t word = *ptr++;
-            w25x_program(crash_dump::dump_data_addr + crash_dump::dump_size, (uint8_t *)ptr, sizeof(word));
-            crash_dump::dump_size += sizeof(word);
-            elementCount--;
-        }
+        crash_dump::dump_compress_sink(reinterpret_cast<const uint8_t *>(pvMemory), elementCount * sizeof(uint32_t));
     } else {
         crash_dump::dump_failed();
     }
@@ -414,11 +575,17 @@ void CrashCatcher_DumpMemory(const void *pvMemory, CrashCatcherElementSizes elem
 }
 
 CrashCatcherReturnCodes CrashCatcher_DumpEnd(void) {
+    crash_dump::dump_compress_finish();
+    if (w25x_fetch_error()) {
+        crash_dump::dump_failed();
+    }
+
     // if we got up to here with success, program dump header
     crash_dump::info_t dump_info {
         .crash_dump_magic_nr = crash_dump::CRASH_DUMP_MAGIC_NR,
         .dump_flags = crash_dump::DumpFlags::DEFAULT,
         .dump_size = crash_dump::dump_size,
+        .dump_raw_size = crash_dump::dump_raw_size,
     };
     w25x_program(crash_dump::dump_header_addr, (uint8_t *)&dump_info, sizeof(dump_info));
     if (w25x_fetch_error()) {
@@ -38,10 +38,16 @@ static uint32_t reverse_crc32(uint32_t current_crc, uint32_t desired_crc) {
 }
 
     #ifdef CRC32_USE_HW
-static uint32_t crc32_hw(const uint8_t *buffer, uint32_t length, uint32_t crc) {
-    if (length == 0) {
-        return crc;
-    }
+// How many words we feed the peripheral per one mutex hold. The peripheral
+// cannot be fed by DMA: the F4 CRC unit has no input bit reversal (REV_IN
+// only exists on later STM32 families), so the CPU has to __RBIT every word
+// to get the reflected polynomial - a mem-to-mem DMA transfer would compute
+// a different checksum. Feeding in bounded chunks at least keeps the wait of
+// concurrent users bounded when someone checksums a large buffer (bgcode
+// blocks, journal banks, BBF chunks).
+static const uint32_t crc32_hw_chunk_words = 1024;
+
+static uint32_t crc32_hw_chunk(const uint8_t *buffer, uint32_t length, uint32_t crc) {
     // ensure nobody else uses the peripheral
     osMutexWait(crc32_hw_mutex_id, osWaitForever);
 
@@ -82,6 +88,21 @@ static uint32_t crc32_hw(const uint8_t *buffer, uint32_t length, uint32_t crc) {
     return result;
 }
 
+static uint32_t crc32_hw(const uint8_t *buffer, uint32_t length, uint32_t crc) {
+    while (length > crc32_hw_chunk_words) {
+        // The intermediate result is carried over in software and
+        // reconstructed in the DR register by the next chunk, so the
+        // peripheral is free for others between the chunks
+        crc = crc32_hw_chunk(buffer, crc32_hw_chunk_words, crc);
+        buffer += crc32_hw_chunk_words * 4;
+        length -= crc32_hw_chunk_words;
+    }
+    if (length == 0) {
+        return crc;
+    }
+    return crc32_hw_chunk(buffer, length, crc);
+}
+
 uint32_t crc32_eeprom(const uint32_t *buffer, uint32_t length) {
     // ensure nobody else uses the peripheral
     osMutexWait(crc32_hw_mutex_id, osWaitForever);
@@ -119,6 +119,10 @@ CFanCtlTach::CFanCtlTach(const InputPin &inputPin)
     ticks_per_second = 1000;
     edges = 0;
     pwm_sum = 0;
+    period_sum = 0;
+    period_count = 0;
+    gap_ticks = 0;
+    gap_clean = false;
     rpm = 0;
     m_value_ready = false;
 }
@@ -128,10 +132,28 @@ bool CFanCtlTach::tick(int8_t pwm_on) {
     bool edge = ((tach ^ input_state) && (pwm_on >= 2)); // detect edge inside pwm pulse, ignore first two sub-periods after 0-1 pwm transition
     if (edge) {
         edges++;
+        // Period measurement: while the pwm stayed on between two seen edges
+        // no edge could have been lost, so gap_ticks is a true edge-to-edge
+        // period. Consecutive clean periods telescope - their sum measures
+        // the whole run with a single tick of quantization, which is much
+        // finer than counting edges, especially at low RPM.
+        if (gap_clean && gap_ticks) {
+            period_sum += gap_ticks;
+            period_count++;
+        }
+        gap_clean = true;
+        gap_ticks = 0;
+    } else if (gap_ticks < ticks_per_second) {
+        gap_ticks++;
+    }
+    if (pwm_on < 2) {
+        gap_clean = false; // an edge could pass unseen now, the running period is unusable
     }
     input_state = tach; // store current tach input state
     if (++tick_count >= ticks_per_second) {
-        if (pwm_sum) {
+        if (period_count >= 4) {
+            edges = ((uint32_t)period_count * ticks_per_second) / period_sum; // edges per second from measured periods
+        } else if (pwm_sum) {
             edges = (edges * ticks_per_second) / pwm_sum; // add lost edges
         }
         rpm = (rpm + (45 * edges)) >> 2; // calculate and filter rpm original formula
@@ -141,6 +163,8 @@ bool CFanCtlTach::tick(int8_t pwm_on) {
         edges = 0; // reset edge counter
         tick_count = 0; // reset tick counter
         pwm_sum = 0; // reset pwm_sum
+        period_sum = 0; // reset period measurement, the running gap continues into the next cycle
+        period_count = 0;
         m_value_ready = true; // set value ready = measure done
     } else if (pwm_on >= 0) {
         pwm_sum++; // inc pwm sum if pwm enabled
@@ -25,6 +25,10 @@ struct fanctl_tach_t {
     uint16_t ticks_per_second; // tacho periode in ticks
     uint16_t edges; // number of edges in current cycle
     uint16_t pwm_sum; // sum of ticks with pwm=1 in current cycle
+    uint16_t period_sum; // ticks covered by cleanly measured edge-to-edge periods
+    uint16_t period_count; // number of cleanly measured periods in current cycle
+    uint16_t gap_ticks; // ticks since the previously seen edge
+    bool gap_clean; // no unobservable (pwm off) tick since the previously seen edge
     uint16_t rpm; // calculated RPM value (filtered)
     bool m_value_ready; // measure RPM done
 };
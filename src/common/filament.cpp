@@ -1,5 +1,6 @@
 #include "filament.hpp"
 #include "filament_list.hpp"
+#include "ConstexprQuickSort.hpp"
 
 #include <cassert>
 #include <cstring>
@@ -134,6 +135,32 @@ constexpr bool temperatures_are_within_spec(const FilamentTypeParameters &filame
 }
 static_assert(std::ranges::all_of(preset_filament_parameters, temperatures_are_within_spec));
 
+/// Sorted-by-name lookup table of the preset filaments, generated at compile time.
+/// Only the names are kept next to the type id, so the binary search does not
+/// pull the full parameter records into cache.
+/// By-id lookup needs no table - preset_filament_parameters is indexed by the enum.
+struct PresetFilamentNameRecord {
+    std::array<char, filament_name_buffer_size> name {};
+    PresetFilamentType type {};
+};
+
+static constexpr auto presets_sorted_by_name = ConstexprQuickSort::sort(
+    []() {
+        std::array<PresetFilamentNameRecord, static_cast<size_t>(PresetFilamentType::_count)> result {};
+        for (size_t i = 0; i < result.size(); i++) {
+            const auto type = static_cast<PresetFilamentType>(i);
+            const char *name = preset_filament_parameters[type].name;
+            for (size_t c = 0; name[c] != '\0'; c++) {
+                result[i].name[c] = name[c];
+            }
+            result[i].type = type;
+        }
+        return result;
+    }(),
+    [](const PresetFilamentNameRecord &a, const PresetFilamentNameRecord &b) {
+        return std::string_view(a.name.data()) < std::string_view(b.name.data());
+    });
+
 FilamentTypeParameters pending_adhoc_filament_parameters;
 
 FilamentType FilamentType::from_name(const std::string_view &name) {
@@ -141,9 +168,18 @@ FilamentType FilamentType::from_name(const std::string_view &name) {
         return FilamentType::none;
     }
 
-    for (const FilamentType filament_type : all_filament_types) {
-        if (name == filament_type.parameters().name) {
-            return filament_type;
+    // Preset names are fixed, find them by binary search
+    const auto it = std::lower_bound(presets_sorted_by_name.begin(), presets_sorted_by_name.end(), name, [](const PresetFilamentNameRecord &rec, const std::string_view &n) {
+        return std::string_view(rec.name.data()) < n;
+    });
+    if (it != presets_sorted_by_name.end() && std::string_view(it->name.data()) == name) {
+        return it->type;
+    }
+
+    // User filament names live in the config store, walk them one by one
+    for (UserFilamentType ft; ft.index < user_filament_type_count; ft.index++) {
+        if (name == FilamentType(ft).parameters().name) {
+            return ft;
         }
     }
 
@@ -43,9 +43,22 @@ void FSensorADC::cycle() {
 
     // disabled FS will not enter cycle, but load_settings can disable it too
     // so better not try to change state when sensor is disabled
-    if (is_enabled()) {
-        state = FSensorADCEval::evaluate_state(filtered_value, fs_ref_nins_value, fs_ref_ins_value, fs_value_span);
+    if (!is_enabled()) {
+        return;
     }
+
+    // The filtered value only moves when the sampling interrupt delivers a new
+    // one - while it stays put, re-running the threshold evaluation cannot
+    // change the state. Not-ready values and NotInitialized (the state a sensor
+    // gets right after being enabled) must still evaluate.
+    if (filtered_value != FSensorADCEval::filtered_value_not_ready
+        && filtered_value == fs_last_evaluated_value
+        && state != FilamentSensorState::NotInitialized) {
+        return;
+    }
+
+    fs_last_evaluated_value = filtered_value;
+    state = FSensorADCEval::evaluate_state(filtered_value, fs_ref_nins_value, fs_ref_ins_value, fs_value_span);
 }
 
 void FSensorADC::set_filtered_value_from_IRQ(int32_t filtered_value) {
@@ -98,6 +111,8 @@ void FSensorADC::CalibrateInserted(int32_t filtered_value) {
 }
 
 void FSensorADC::load_settings() {
+    // reference values are about to change, force the next cycle() to evaluate
+    fs_last_evaluated_value = FSensorADCEval::filtered_value_not_ready;
     fs_value_span =
 #if HAS_ADC_SIDE_FSENSOR()
         is_side ? config_store().get_side_fs_value_span(tool_index) :
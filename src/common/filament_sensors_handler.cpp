@@ -10,6 +10,7 @@
 #include <tasks.hpp>
 #include "window_msgbox.hpp"
 #include <logging/log.hpp>
+#include <M70X.hpp>
 #include <option/has_selftest.h>
 #include <option/has_mmu2.h>
 #include <option/has_toolchanger.h>
@@ -209,7 +210,7 @@ void FilamentSensors::process_events() {
 
         m600_sent = true;
 
-        marlin_client::inject("M600 A"); // change filament
+        marlin_client::inject("M600 A", InjectPriority::safety); // change filament
 
         log_info(FSensor, "Injected runout");
         return true;
@@ -233,12 +234,9 @@ void FilamentSensors::process_events() {
         }
 
         autoload_sent = true;
-        static char buffer[sizeof("M1701 ZXXXXX")];
-        snprintf(buffer, sizeof(buffer), "M1701 Z%.2f", static_cast<double>(Z_AXIS_LOAD_POS));
         // autoload with return option and minimal Z value of 40mm
-        // This is a hack, but there is currently no nice way to do snprintf at compile  time
-        // We're always writing the same string to the buffer, so there is no race condition
-        marlin_client::inject(ConstexprString::from_str_unsafe(buffer));
+        // fixed firmware macro, injected as a direct call - no gcode text to assemble and parse
+        marlin_client::inject(GCodeCallback(filament_gcodes::M1701_autoload), InjectPriority::user_action);
         log_info(FSensor, "Injected autoload");
 
         return true;
@@ -7,7 +7,10 @@
 #include "filament_sensor_adc.hpp"
 #include "filament_sensor_adc_eval.hpp"
 #include "filters/median_filter.hpp"
+#include "filters/decimating_stats.hpp"
 #include "marlin_client.hpp"
+#include "metric.h"
+#include "timing.h"
 #include <freertos/mutex.hpp>
 #include <mutex>
 #include <puppies/Dwarf.hpp>
@@ -61,12 +64,32 @@ void fs_process_sample(int32_t fs_raw_value, uint8_t tool_index) {
 
 void side_fs_process_sample(int32_t fs_raw_value, uint8_t tool_index) {
     static MedianFilter filters[HOTENDS];
+    static DecimatingStats<8> stats[HOTENDS];
 
     FSensorADC *sensor = getSideFSensor(tool_index);
     assert(sensor);
 
     auto &filter = filters[tool_index];
 
+    const uint32_t start_us = ticks_us();
     sensor->record_raw(fs_raw_value);
-    sensor->set_filtered_value_from_IRQ(filter.filter(fs_raw_value) ? fs_raw_value : FSensorADCEval::filtered_value_not_ready);
+
+    if (!filter.filter(fs_raw_value)) {
+        sensor->set_filtered_value_from_IRQ(FSensorADCEval::filtered_value_not_ready);
+        return;
+    }
+
+    // Decimate the median-filtered samples: downstream evaluation runs way below the ADC rate, so
+    // publish the integer mean of every 8 samples instead of storing each one. The variance and the
+    // time spent in this handler go to a metric to keep an eye on sensor noise and filter overhead.
+    if (auto result = stats[tool_index].feed(fs_raw_value)) {
+        sensor->set_filtered_value_from_IRQ(result->mean);
+
+        static buddy::metrics::RunApproxEvery limit_record_filter = 1009;
+        if (limit_record_filter()) {
+            METRIC_DEF(metric_side_filter, "side_fsensor_filter", METRIC_VALUE_CUSTOM, 0, METRIC_DISABLED);
+            metric_record_custom(&metric_side_filter, ",n=%u var=%" PRId32 "i,us=%" PRId32 "i",
+                tool_index, result->variance, ticks_diff(ticks_us(), start_us));
+        }
+    }
 }
@@ -0,0 +1,47 @@
+#pragma once
+
+#include <cinttypes>
+#include <cstddef>
+#include <optional>
+
+/// Streaming mean/variance with decimation
+///
+/// Accumulates samples in integer arithmetic with O(1) work per sample and
+/// yields the mean and variance of every N consecutive samples. Meant for
+/// high-rate (IRQ) contexts: no sample windows, no repeated passes, no floats.
+template <size_t N>
+class DecimatingStats {
+public:
+    static_assert((N & (N - 1)) == 0, "Keep N a power of two so the divisions compile to shifts");
+
+    struct Result {
+        int32_t mean;
+        int32_t variance;
+    };
+
+    /// Feed one sample; returns the statistics once every N samples
+    std::optional<Result> feed(int32_t sample) {
+        sum += sample;
+        sum_sq += static_cast<int64_t>(sample) * sample;
+        if (++count < N) {
+            return std::nullopt;
+        }
+
+        Result result;
+        result.mean = static_cast<int32_t>(sum / static_cast<int64_t>(N));
+        result.variance = static_cast<int32_t>((sum_sq - sum * sum / static_cast<int64_t>(N)) / static_cast<int64_t>(N));
+        reset();
+        return result;
+    }
+
+    void reset() {
+        sum = 0;
+        sum_sq = 0;
+        count = 0;
+    }
+
+private:
+    int64_t sum = 0;
+    int64_t sum_sq = 0;
+    size_t count = 0;
+};
@@ -2,6 +2,7 @@
 
 #include <inplace_function.hpp>
 #include <cstdint>
+#include <cstdlib>
 
 class KalmanFilter {
 public:
@@ -14,6 +15,9 @@ public:
         const predictor_t predictor = nullptr);
     double filter(double value, uint32_t now_us);
 
+    /// Current estimate error - how much the filter trusts its own output
+    double get_error_estimate() const { return error_estimate; }
+
 private:
     double error_estimate;
     double error_measure;
@@ -22,3 +26,57 @@ private:
     const double error_weight;
     const predictor_t predictor;
 };
+
+/// Q-format fixed-point variant of KalmanFilter
+///
+/// Runs the same algorithm with all state kept as Q(FracBits) int64_t, so
+/// integer-only use-sites don't pay for FPU context switching. Values enter
+/// and leave filter() in natural integer units; the predictor, when provided,
+/// operates directly on the Q-format state.
+///
+/// FracBits trades precision for headroom: the intermediate products need
+/// |value| * 2^(2 * FracBits) to fit an int64_t, i.e. |value| < 2^(62 - 2 * FracBits).
+template <unsigned FracBits>
+class FixedPointKalmanFilter {
+public:
+    static constexpr unsigned frac_bits = FracBits;
+    static constexpr int64_t one = int64_t(1) << FracBits;
+
+    using predictor_t = stdext::inplace_function<int64_t(int64_t last_estimate_q, uint32_t now_us)>;
+
+    FixedPointKalmanFilter(
+        const int32_t error_estimate,
+        const int32_t error_measure,
+        const float error_weight,
+        const predictor_t predictor = nullptr)
+        : error_estimate(static_cast<int64_t>(error_estimate) << FracBits)
+        , error_measure(static_cast<int64_t>(error_measure) << FracBits)
+        , current_estimate(0)
+        , last_estimate(0)
+        , error_weight(static_cast<int64_t>(error_weight * static_cast<float>(one) + 0.5f))
+        , predictor(predictor) {}
+
+    int32_t filter(int32_t value, uint32_t now_us) {
+        if (predictor) {
+            last_estimate = predictor(last_estimate, now_us);
+        }
+        const int64_t gain = (error_estimate << FracBits) / (error_estimate + error_measure);
+        const int64_t value_q = static_cast<int64_t>(value) << FracBits;
+        current_estimate = last_estimate + ((gain * (value_q - last_estimate)) >> FracBits);
+        error_estimate = (((one - gain) * error_estimate) >> FracBits)
+            + ((std::abs(last_estimate - current_estimate) * error_weight) >> FracBits);
+        last_estimate = current_estimate;
+        return static_cast<int32_t>(current_estimate >> FracBits);
+    }
+
+    /// Current estimate error - how much the filter trusts its own output
+    int32_t get_error_estimate() const { return static_cast<int32_t>(error_estimate >> FracBits); }
+
+private:
+    int64_t error_estimate;
+    int64_t error_measure;
+    int64_t current_estimate;
+    int64_t last_estimate;
+    const int64_t error_weight;
+    const predictor_t predictor;
+};
@@ -0,0 +1,77 @@
+#pragma once
+
+#include <cinttypes>
+#include <cstddef>
+#include <cstring>
+
+/// Sliding median over a compile-time window
+///
+/// Keeps the window twice: as a ring buffer in arrival order and as a sorted
+/// array. Each update locates the outgoing and incoming sample by binary
+/// search (O(log N) comparisons) and closes/opens the gap with one bounded
+/// memmove each. For the intended window sizes (15-63 samples) the contiguous
+/// move of a few dozen int32_t beats pointer-chasing structures like skiplists
+/// or lazy dual heaps, and it needs no allocation or node pool.
+///
+/// Same calling convention as MedianFilter: filter() outputs the median of
+/// the samples collected so far and reports whether the window is full.
+template <size_t N>
+class SlidingMedian {
+public:
+    static_assert(N % 2 == 1, "Use an odd window so the median is a single sample");
+    static_assert(N >= 3 && N <= 255, "Window size out of the supported range");
+
+    /**
+     * @brief filter next sample
+     *
+     * @param [in,out] sample Input sample, outputs filtered sample
+     * @retval true output valid
+     * @retval false output not valid, insufficient number of samples collected yet
+     */
+    bool filter(int32_t &sample) {
+        if (m_count == N) {
+            // drop the oldest sample from the sorted view
+            const size_t pos = lower_bound(m_ring[m_head]);
+            std::memmove(&m_sorted[pos], &m_sorted[pos + 1], (m_count - pos - 1) * sizeof(*m_sorted));
+            --m_count;
+        }
+
+        m_ring[m_head] = sample;
+        m_head = (m_head + 1) % N;
+
+        // insert the new sample into the sorted view
+        const size_t pos = lower_bound(sample);
+        std::memmove(&m_sorted[pos + 1], &m_sorted[pos], (m_count - pos) * sizeof(*m_sorted));
+        m_sorted[pos] = sample;
+        ++m_count;
+
+        sample = m_sorted[m_count / 2];
+        return m_count == N;
+    }
+
+    void reset() {
+        m_count = 0;
+        m_head = 0;
+    }
+
+private:
+    /// Index of the first sorted sample >= value
+    size_t lower_bound(int32_t value) const {
+        size_t low = 0;
+        size_t high = m_count;
+        while (low < high) {
+            const size_t mid = (low + high) / 2;
+            if (m_sorted[mid] < value) {
+                low = mid + 1;
+            } else {
+                high = mid;
+            }
+        }
+        return low;
+    }
+
+    int32_t m_ring[N]; ///< Samples in arrival order, m_head points at the oldest
+    int32_t m_sorted[N]; ///< The same samples, sorted
+    size_t m_count = 0;
+    size_t m_head = 0;
+};
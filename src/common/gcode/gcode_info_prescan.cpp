@@ -0,0 +1,206 @@
+#include "gcode_info_prescan.hpp"
+
+#include "gcode_reader_any.hpp"
+#include <common/async_job/async_job.hpp>
+#include <freertos/mutex.hpp>
+#include <logging/log.hpp>
+
+#include <algorithm>
+#include <cstring>
+#include <mutex>
+
+LOG_COMPONENT_REF(Buddy);
+
+namespace {
+
+using PathBuffer = std::array<char, FILE_PATH_BUFFER_LEN>;
+
+struct CacheEntry {
+    PathBuffer path { "" };
+    gcode_info_prescan::Metadata metadata;
+    uint32_t last_use = 0; ///< Stamp from use_counter, for LRU eviction
+    bool valid = false;
+};
+
+/// How many files the cache holds. The browser hands us the visible files plus their neighbours,
+/// so this should be at least a screenful.
+constexpr size_t cache_size = 8;
+
+/// How many files can be waiting to be scanned
+constexpr size_t pending_queue_size = 8;
+
+/// Protects everything below
+freertos::Mutex mutex;
+
+std::array<CacheEntry, cache_size> cache;
+std::array<PathBuffer, pending_queue_size> pending_queue;
+size_t pending_count = 0;
+uint32_t use_counter = 0;
+
+AsyncJob prescan_job;
+
+/// !!! Assumes the mutex is locked
+CacheEntry *find_entry(const char *path) {
+    for (auto &entry : cache) {
+        if (entry.valid && strcmp(entry.path.data(), path) == 0) {
+            return &entry;
+        }
+    }
+    return nullptr;
+}
+
+/// Scans the basic metadata of a single file. Executed on the worker, without the mutex held.
+std::optional<gcode_info_prescan::Metadata> scan_file(const char *path, AsyncJobExecutionControl &control) {
+    AnyGcodeFormatReader file_reader(path);
+    if (!file_reader.is_open()) {
+        log_warning(Buddy, "Prescan: fail to open %s", path);
+        return std::nullopt;
+    }
+
+    auto &reader = *file_reader.get();
+    if (!reader.stream_metadata_start()) {
+        return std::nullopt;
+    }
+
+    gcode_info_prescan::Metadata result;
+    bool has_time = false, has_filament = false;
+
+    GcodeBuffer buffer;
+    while (!(has_time && has_filament && result.filament_used_g.has_value())) {
+        if (control.is_discarded()) {
+            return std::nullopt;
+        }
+
+        if (reader.stream_get_line(buffer, IGcodeReader::Continuations::Discard) != IGcodeReader::Result_t::RESULT_OK) {
+            break;
+        }
+
+        auto [name, val] = buffer.line.parse_metadata();
+        if (name.begin == nullptr || val.begin == nullptr) {
+            // not a metadata
+            continue;
+        }
+
+        if (name == gcode_info::time) {
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wformat-truncation"
+            snprintf(result.printing_time.begin(), result.printing_time.size(), "%s", val.c_str());
+#pragma GCC diagnostic pop
+            has_time = true;
+
+        } else if (name == gcode_info::filament_type) {
+            // Only the first extruder - up to the first item separator
+            const size_t len = strcspn(val.c_str(), ";");
+            snprintf(result.filament_name.begin(), result.filament_name.size(), "%.*s", static_cast<int>(len), val.c_str());
+            has_filament = true;
+
+        } else if (name == gcode_info::filament_g) {
+            float filament_used_g;
+            if (sscanf(val.c_str(), "%f", &filament_used_g) == 1) {
+                result.filament_used_g = filament_used_g;
+            }
+        }
+    }
+
+    return result;
+}
+
+void prescan_callback(AsyncJobExecutionControl &control) {
+    while (true) {
+        PathBuffer path;
+
+        {
+            std::lock_guard guard(mutex);
+            if (pending_count == 0) {
+                return;
+            }
+
+            path = pending_queue[0];
+            memmove(&pending_queue[0], &pending_queue[1], (--pending_count) * sizeof(PathBuffer));
+        }
+
+        if (control.is_discarded()) {
+            return;
+        }
+
+        const auto metadata = scan_file(path.data(), control);
+        if (!metadata) {
+            continue;
+        }
+
+        std::lock_guard guard(mutex);
+
+        // Store into the entry for the same path, or evict the least recently used one
+        CacheEntry *entry = find_entry(path.data());
+        if (!entry) {
+            entry = &*std::min_element(cache.begin(), cache.end(), [](const auto &a, const auto &b) {
+                return (a.valid ? a.last_use : 0) < (b.valid ? b.last_use : 0);
+            });
+        }
+
+        entry->path = path;
+        entry->metadata = *metadata;
+        entry->last_use = ++use_counter;
+        entry->valid = true;
+    }
+}
+
+} // namespace
+
+namespace gcode_info_prescan {
+
+void request(std::span<const char *const> paths) {
+    bool issue_job = false;
+
+    {
+        std::lock_guard guard(mutex);
+
+        for (const char *path : paths) {
+            if (pending_count >= pending_queue.size()) {
+                break;
+            }
+
+            if (find_entry(path)) {
+                // Already scanned
+                continue;
+            }
+
+            const auto is_queued = [&](const auto &queued) { return strcmp(queued.data(), path) == 0; };
+            if (std::any_of(pending_queue.begin(), pending_queue.begin() + pending_count, is_queued)) {
+                continue;
+            }
+
+            strlcpy(pending_queue[pending_count++].data(), path, sizeof(PathBuffer));
+            issue_job = true;
+        }
+    }
+
+    if (issue_job) {
+        // Re-issuing discards a possibly running scan; that's fine - anything still relevant
+        // is in the queue again, as the browser requests all files of interest every time.
+        prescan_job.issue(&prescan_callback);
+    }
+}
+
+std::optional<Metadata> get(const char *path) {
+    std::lock_guard guard(mutex);
+
+    if (CacheEntry *entry = find_entry(path)) {
+        entry->last_use = ++use_counter;
+        return entry->metadata;
+    }
+
+    return std::nullopt;
+}
+
+void invalidate() {
+    prescan_job.discard();
+
+    std::lock_guard guard(mutex);
+    pending_count = 0;
+    for (auto &entry : cache) {
+        entry.valid = false;
+    }
+}
+
+} // namespace gcode_info_prescan
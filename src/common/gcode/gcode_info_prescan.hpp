@@ -0,0 +1,36 @@
+#pragma once
+
+#include <optional>
+#include <span>
+
+#include "gcode_info.hpp"
+
+/// Background pre-scanning of basic G-code metadata for the file browser.
+///
+/// The file browser asks for the files it currently shows (plus their neighbours) via \p request.
+/// The scanning itself happens on the AsyncJob worker and results end up in a small LRU cache,
+/// so by the time the user focuses a file, \p get can serve the metadata without touching the file.
+namespace gcode_info_prescan {
+
+/// Lightweight subset of the G-code metadata, small enough to be cached for multiple files
+/// (unlike the full GCodeInfo, which is a heavyweight singleton)
+struct Metadata {
+    GCodeInfo::time_buff printing_time { "" }; ///< String representation of the print time estimate
+    GCodeInfo::filament_buff filament_name { "" }; ///< Filament type of the first extruder
+    std::optional<float> filament_used_g; ///< Grams of filament used by the first extruder
+};
+
+/// Asks the background scanner to have metadata ready for the given files (SFN paths).
+/// Paths already cached are kept, the rest gets queued for scanning, first path first -
+/// pass the focused file first, then the files around it.
+/// The paths are copied, no lifetime requirements.
+void request(std::span<const char *const> paths);
+
+/// \returns cached metadata for the given SFN path, or nullopt if the file hasn't been scanned (yet)
+std::optional<Metadata> get(const char *path);
+
+/// Drops the whole cache and the pending queue (to be called when the files might have changed,
+/// for example on media removal)
+void invalidate();
+
+} // namespace gcode_info_prescan
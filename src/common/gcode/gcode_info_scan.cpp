@@ -3,11 +3,16 @@
 #include "gcode_info.hpp"
 #include <common/async_job/async_job.hpp>
 #include <logging/log.hpp>
+#include <lfn.h>
+#include <string.h>
 
 static AsyncJob gcode_scan_async_job;
 
 static std::atomic<gcode_info_scan::ScanStartResult> scan_start_result_ = gcode_info_scan::ScanStartResult::not_started;
 
+/// Path the last prescan_file() was issued for, empty when there is no prescan to reuse
+static std::array<char, FILE_PATH_BUFFER_LEN> prescanned_path = { '\0' };
+
 LOG_COMPONENT_REF(MarlinServer);
 
 static void gcode_info_scan_callback(AsyncJobExecutionControl &control) {
@@ -62,11 +67,35 @@ ScanStartResult scan_start_result() {
 }
 
 void start_scan() {
+    // A prescan issued on media insert may already be reading this very file;
+    // keep its results instead of resetting the info and reading everything again.
+    const bool prescan_matches = strcmp(prescanned_path.data(), GCodeInfo::getInstance().GetGcodeFilepath()) == 0;
+    prescanned_path[0] = '\0';
+    if (prescan_matches && scan_start_result_ != ScanStartResult::failed) {
+        return;
+    }
+
+    scan_start_result_ = ScanStartResult::not_started;
+    gcode_scan_async_job.issue(&gcode_info_scan_callback);
+}
+
+void prescan_file(const char *filepath_sfn) {
+    // get_LFN wants the path mutable
+    std::array<char, FILE_PATH_BUFFER_LEN> filepath;
+    strlcpy(filepath.data(), filepath_sfn, filepath.size());
+
+    std::array<char, FILE_NAME_BUFFER_LEN> filename_lfn;
+    get_LFN(filename_lfn.data(), filename_lfn.size(), filepath.data());
+
+    GCodeInfo::getInstance().set_gcode_file(filepath.data(), filename_lfn.data());
+    strlcpy(prescanned_path.data(), filepath.data(), prescanned_path.size());
+
     scan_start_result_ = ScanStartResult::not_started;
     gcode_scan_async_job.issue(&gcode_info_scan_callback);
 }
 
 void cancel_scan() {
+    prescanned_path[0] = '\0';
     gcode_scan_async_job.discard();
 }
 
@@ -14,6 +14,12 @@ ScanStartResult scan_start_result();
 /// Yes, this is utterly wrong. However, it was wrong like this before, I'm just concentrating the utter-wrongness to this file, so that we can more easily eradicate it.
 void start_scan();
 
+/// One-click printing support: points GCodeInfo at \p filepath_sfn and starts the scan
+/// right when the media insertion is noticed, before the print is even requested.
+/// The start_scan() issued later by the print preview for the same file then keeps
+/// the running scan instead of resetting the info and reading the file again.
+void prescan_file(const char *filepath_sfn);
+
 /// Cancels the currently running gcode info scan, to save resources.
 void cancel_scan();
 
@@ -1,10 +1,13 @@
 #include "gcode_reader_binary.hpp"
 
+#include "crc32.h"
 #include "lang/i18n.h"
 #include "transfers/transfer.hpp"
 #include <cassert>
 #include <errno.h> // for EAGAIN
 #include <filename_type.hpp>
+#include <freertos/mutex.hpp>
+#include <mutex>
 #include <sys/stat.h>
 #include <ranges>
 #include <type_traits>
@@ -12,12 +15,175 @@
 
 using bgcode::core::BlockHeader;
 using bgcode::core::EBlockType;
+using bgcode::core::EChecksumType;
 using bgcode::core::ECompressionType;
 using bgcode::core::EGCodeEncodingType;
+using bgcode::core::EResult;
+using bgcode::core::FileHeader;
+
+namespace {
+
+/// Process-wide index of gcode block positions in the most recently streamed bgcode file.
+/// Readers get destroyed and recreated on every stream restore (power panic resume, prefetch worker resets, ...),
+/// so the index is kept here, keyed by file identity, and survives the reader instances.
+/// When the index fills up, it is decimated - every other entry is dropped and only every
+/// (2^stride_shift)-th block gets recorded from then on, so even multi-hundred-MB files stay covered.
+class BlockIndexCache {
+public:
+    struct Key {
+        uint32_t file_size = 0;
+        time_t mtime = 0;
+
+        bool operator==(const Key &) const = default;
+    };
+
+    struct Entry {
+        uint32_t block_file_pos = 0;
+        uint32_t block_start_offset = 0;
+    };
+
+    /// Records a gcode block starting at \p block_file_pos in the file, containing uncompressed stream offset \p block_start_offset
+    void append(const Key &key, uint32_t block_file_pos, uint32_t block_start_offset) {
+        std::lock_guard mutex_guard(mutex);
+
+        if (key != this->key) {
+            // Different file -> start over
+            this->key = key;
+            size = 0;
+            stride_shift = 0;
+            block_counter = 0;
+        }
+
+        // Only accept blocks past the last recorded one - re-streamed regions are already covered
+        if (size > 0 && block_start_offset <= entries[size - 1].block_start_offset) {
+            return;
+        }
+
+        // Only record every (2^stride_shift)-th block
+        if ((block_counter++ & ((1u << stride_shift) - 1)) != 0) {
+            return;
+        }
+
+        if (size == entries.size()) {
+            // Index full -> decimate, keep every other entry and double the stride
+            for (size_t i = 1; i < size / 2; i++) {
+                entries[i] = entries[2 * i];
+            }
+            size /= 2;
+            stride_shift++;
+        }
+
+        entries[size++] = Entry { block_file_pos, block_start_offset };
+    }
+
+    /// \returns the indexed block starting closest before (or at) \p offset, if the index covers \p key
+    std::optional<Entry> lookup(const Key &key, uint32_t offset) const {
+        std::lock_guard mutex_guard(mutex);
+
+        if (key != this->key) {
+            return std::nullopt;
+        }
+
+        // Entries are sorted by offset -> look for the last one that starts at or before the target
+        for (size_t i = size; i > 0; i--) {
+            if (entries[i - 1].block_start_offset <= offset) {
+                return entries[i - 1];
+            }
+        }
+
+        return std::nullopt;
+    }
+
+private:
+    mutable freertos::Mutex mutex;
+    Key key;
+    std::array<Entry, 64> entries;
+    size_t size = 0;
+    uint8_t stride_shift = 0;
+    uint32_t block_counter = 0;
+};
+
+BlockIndexCache block_index_cache;
+
+/// Periodic snapshot of the heatshrink decoder (window + input buffer) and the surrounding stream state.
+/// A stream restore re-initializes the decoder and replays the block from its very start; for crash
+/// recovery mid-block and for the periodically recreated prefetch reader that means re-reading and
+/// re-decompressing up to a whole block on every restore. With a snapshot, the restore replays only
+/// from the nearest snapshot position.
+/// The snapshot cannot live in GCodeReaderStreamRestoreInfo - the restore info is embedded in prefetch
+/// buffer records and a multi-kB decoder window would not fit there - so it is kept process-wide here,
+/// keyed by file identity, same as the block index.
+class HeatshrinkStateCache {
+public:
+    /// Stream state accompanying the decoder snapshot
+    struct StreamState {
+        /// Position of the block header the snapshot belongs to
+        uint32_t block_file_pos = 0;
+
+        /// File position of the next compressed byte to be read
+        long file_pos = 0;
+
+        uint32_t block_remaining_bytes_compressed = 0;
+        uint32_t uncompressed_offset = 0;
+        MeatPack meatpack;
+    };
+
+    void save(const BlockIndexCache::Key &key, const StreamState &state, const heatshrink_decoder &decoder) {
+        std::lock_guard mutex_guard(mutex);
+
+        const size_t size = decoder_size(decoder);
+        if (decoder_state_size != size) {
+            decoder_state.reset(new (std::nothrow) uint8_t[size]);
+            decoder_state_size = decoder_state ? size : 0;
+            if (!decoder_state) {
+                return;
+            }
+        }
+
+        this->key = key;
+        this->state = state;
+        memcpy(decoder_state.get(), &decoder, size);
+    }
+
+    /// If there is a snapshot for the given block with uncompressed offset not past \p max_offset,
+    /// copies the stored state into \p decoder and returns the accompanying stream state.
+    std::optional<StreamState> try_restore(const BlockIndexCache::Key &key, uint32_t block_file_pos, uint32_t max_offset, heatshrink_decoder &decoder) {
+        std::lock_guard mutex_guard(mutex);
+
+        if (!decoder_state || key != this->key || state.block_file_pos != block_file_pos || state.uncompressed_offset > max_offset) {
+            return std::nullopt;
+        }
+
+        // The target decoder must be configured the same way as the stored one
+        const auto &stored = *reinterpret_cast<const heatshrink_decoder *>(decoder_state.get());
+        if (decoder_size(decoder) != decoder_state_size || stored.window_sz2 != decoder.window_sz2 || stored.lookahead_sz2 != decoder.lookahead_sz2 || stored.input_buffer_size != decoder.input_buffer_size) {
+            return std::nullopt;
+        }
+
+        memcpy(&decoder, decoder_state.get(), decoder_state_size);
+        return state;
+    }
+
+private:
+    static size_t decoder_size(const heatshrink_decoder &decoder) {
+        return sizeof(heatshrink_decoder) + (size_t(1) << decoder.window_sz2) + decoder.input_buffer_size;
+    }
+
+    mutable freertos::Mutex mutex;
+    BlockIndexCache::Key key;
+    StreamState state;
+    std::unique_ptr<uint8_t[]> decoder_state;
+    size_t decoder_state_size = 0;
+};
+
+HeatshrinkStateCache heatshrink_state_cache;
+
+} // namespace
 
 PrusaPackGcodeReader::PrusaPackGcodeReader(FILE &f, const struct stat &stat_info)
     : GcodeReaderCommon(f) {
     file_size = stat_info.st_size;
+    file_mtime = stat_info.st_mtime;
 }
 
 IGcodeReader::Result_t PrusaPackGcodeReader::read_and_check_header() {
@@ -205,20 +371,66 @@ IGcodeReader::Result_t PrusaPackGcodeReader::stream_gcode_start(uint32_t offset)
 
         // pick nearest restore block from restore info
         const auto *restore_block = get_restore_block_for_offset(offset);
-        if (restore_block == nullptr) {
-            return Result_t::RESULT_ERROR;
-        }
 
-        if (fseek(file, restore_block->block_file_pos, SEEK_SET) != 0) {
-            return Result_t::RESULT_ERROR;
+        // also consult the process-wide block index; prefer whichever starts closer to the target
+        auto index_block = block_index_cache.lookup({ file_size, file_mtime }, offset);
+        if (restore_block && (!index_block || restore_block->block_start_offset >= index_block->block_start_offset)) {
+            index_block = BlockIndexCache::Entry { restore_block->block_file_pos, restore_block->block_start_offset };
         }
 
-        if (auto res = read_block_header(start_block, /*check_crc=*/verify); res != Result_t::RESULT_OK) {
-            return res;
-        }
+        if (index_block) {
+            if (fseek(file, index_block->block_file_pos, SEEK_SET) != 0) {
+                return Result_t::RESULT_ERROR;
+            }
+
+            if (auto res = read_block_header(start_block, /*check_crc=*/verify); res != Result_t::RESULT_OK) {
+                return res;
+            }
+
+            block_throwaway_bytes = offset - index_block->block_start_offset;
+            block_decompressed_offset = index_block->block_start_offset;
+
+        } else {
+            // Nothing covers the target offset - walk the block headers from the beginning
+            // to find the right block, building the index along the way so any further
+            // restore in this file jumps directly
+            struct {
+                uint32_t target_offset;
+                BlockIndexCache::Key key;
+                uint32_t walk_offset = 0;
+                uint32_t found_block_start = 0;
+            } walk { offset, { file_size, file_mtime } };
+
+            auto res = iterate_blocks(verify, [&walk](BlockHeader &block_header) {
+                if ((bgcode::core::EBlockType)block_header.type != bgcode::core::EBlockType::GCode) {
+                    return IterateResult_t::Continue;
+                }
+
+                block_index_cache.append(walk.key, block_header.get_position(), walk.walk_offset);
+
+                if (walk.target_offset < walk.walk_offset + block_header.uncompressed_size) {
+                    walk.found_block_start = walk.walk_offset;
+                    return IterateResult_t::Return;
+                }
+
+                walk.walk_offset += block_header.uncompressed_size;
+                return IterateResult_t::Continue;
+            });
+
+            auto header = std::get_if<BlockHeader>(&res);
+            if (header == nullptr) {
+                if (auto status = std::get_if<Result_t>(&res); status != nullptr) {
+                    return *status;
+                } else {
+                    // Offset is past the end of the gcode stream
+                    return Result_t::RESULT_ERROR;
+                }
+            }
 
-        block_throwaway_bytes = offset - restore_block->block_start_offset;
-        block_decompressed_offset = restore_block->block_start_offset;
+            start_block = *header;
+            block_throwaway_bytes = offset - walk.found_block_start;
+            block_decompressed_offset = walk.found_block_start;
+        }
     }
 
     stream.reset();
@@ -237,6 +449,22 @@ IGcodeReader::Result_t PrusaPackGcodeReader::stream_gcode_start(uint32_t offset)
     stream_restore_info.fill({});
     store_restore_block();
 
+    // Try to shortcut the replay using a cached decoder state snapshot
+    if (stream.hs_decoder && block_throwaway_bytes > 0) {
+        if (auto snapshot = heatshrink_state_cache.try_restore({ file_size, file_mtime }, stream.current_block_header.get_position(), offset, *stream.hs_decoder)) {
+            if (fseek(file, snapshot->file_pos, SEEK_SET) == 0) {
+                stream.block_remaining_bytes_compressed = snapshot->block_remaining_bytes_compressed;
+                stream.uncompressed_offset = snapshot->uncompressed_offset;
+                stream.meatpack = snapshot->meatpack;
+                block_throwaway_bytes = offset - snapshot->uncompressed_offset;
+
+            } else {
+                // Seek failed -> fall back to replaying the block from its start
+                heatshrink_decoder_reset(stream.hs_decoder.get());
+            }
+        }
+    }
+
     while (block_throwaway_bytes--) {
         char c;
         if (auto res = stream_getc(c); res != IGcodeReader::Result_t::RESULT_OK) {
@@ -290,6 +518,9 @@ void PrusaPackGcodeReader::store_restore_block() {
     // and store new restore info
     stream_restore_info[1].block_file_pos = stream.current_block_header.get_position();
     stream_restore_info[1].block_start_offset = stream.uncompressed_offset;
+
+    // also record the block in the process-wide index, so future readers can seek right to it
+    block_index_cache.append({ file_size, file_mtime }, stream.current_block_header.get_position(), stream.uncompressed_offset);
 }
 
 IGcodeReader::Result_t PrusaPackGcodeReader::stream_getc_file(char &out) {
@@ -384,15 +615,47 @@ IGcodeReader::Result_t PrusaPackGcodeReader::stream_getc_decompressed_heatshrink
     }
 }
 
+void PrusaPackGcodeReader::maybe_save_decoder_snapshot() {
+    // Only worth it for compressed streams, and only once per snapshot interval
+    if (!stream.hs_decoder || (stream.uncompressed_offset & (decoder_snapshot_interval - 1)) != 0) {
+        return;
+    }
+
+    heatshrink_state_cache.save(
+        { file_size, file_mtime },
+        HeatshrinkStateCache::StreamState {
+            .block_file_pos = static_cast<uint32_t>(stream.current_block_header.get_position()),
+            .file_pos = ftell(file.get()),
+            .block_remaining_bytes_compressed = stream.block_remaining_bytes_compressed,
+            .uncompressed_offset = stream.uncompressed_offset,
+            .meatpack = stream.meatpack,
+        },
+        *stream.hs_decoder);
+}
+
 IGcodeReader::Result_t PrusaPackGcodeReader::stream_getc_decode_meatpacked(char &out) {
     while (true) {
         if (stream.meatpack.has_result_char()) {
             // character is ready, return it
             out = stream.meatpack.get_result_char();
             ++stream.uncompressed_offset;
+            maybe_save_decoder_snapshot();
             return IGcodeReader::Result_t::RESULT_OK;
         }
 
+        // For uncompressed blocks, feed meatpack in bulk so it can use its word-wise decode kernel
+        if (stream.raw_input && stream.block_remaining_bytes_compressed > 0) {
+            char mp_buffer[8];
+            const size_t read_size = std::min<uint32_t>({ sizeof(mp_buffer), stream.meatpack.rx_block_capacity(), stream.block_remaining_bytes_compressed });
+            auto res = stream_current_block_read(mp_buffer, read_size);
+            if (res != Result_t::RESULT_OK) {
+                return res;
+            }
+
+            stream.meatpack.handle_rx_block(reinterpret_cast<const uint8_t *>(mp_buffer), read_size);
+            continue;
+        }
+
         // no character, uncompress next character
         char mp_char;
         auto res = (this->*ptr_stream_getc_decompressed)(mp_char);
@@ -407,6 +670,7 @@ IGcodeReader::Result_t PrusaPackGcodeReader::stream_getc_decode_none(char &out)
     auto res = (this->*ptr_stream_getc_decompressed)(out);
     if (res == Result_t::RESULT_OK) {
         ++stream.uncompressed_offset;
+        maybe_save_decoder_snapshot();
     }
 
     return res;
@@ -558,13 +822,124 @@ IGcodeReader::FileVerificationResult PrusaPackGcodeReader::verify_file(FileVerif
         return { .is_ok = true };
     }
 
-    // Check CRC
+    // Check block structure and CRC.
+    // This used to go through bgcode::core::is_valid_binary_gcode, but that computes the
+    // checksums with a bit-by-bit software loop. Walking the blocks ourselves lets us feed
+    // the payloads to crc32_calc_ex, which uses the hardware CRC unit, so the checksum
+    // computation no longer dominates the pre-print validation time (the USB reads do).
     {
         // todo: this doesn't respect file validity
-        rewind(file.get());
-        if (bgcode::core::is_valid_binary_gcode(*file, true, crc_calc_buffer.data(), crc_calc_buffer.size()) != bgcode::core::EResult::Success) {
+        auto *file = this->file.get();
+        rewind(file);
+
+        // Stack fallback when the caller doesn't provide a buffer (see read_block_header for sizing rationale)
+        uint8_t fallback_buffer[128];
+        if (crc_calc_buffer.empty()) {
+            crc_calc_buffer = fallback_buffer;
+        }
+
+        FileHeader file_header;
+        if (read_header(*file, file_header, nullptr) != EResult::Success) {
             return { .error_str = N_("The file is not a valid bgcode file.") };
         }
+        const bool has_crc = file_header.checksum_type == (uint16_t)EChecksumType::CRC32;
+
+        // Expected block sequence, per the bgcode specification
+        enum class Expect {
+            file_metadata,
+            printer_metadata,
+            thumbnail_or_print_metadata,
+            slicer_metadata,
+            first_gcode,
+            gcode_or_eof,
+        };
+        Expect expect = Expect::file_metadata;
+
+        while (true) {
+            BlockHeader block_header;
+            const auto res = read_next_block_header(*file, file_header, block_header, nullptr, 0);
+            if (res == EResult::ReadError && feof(file)) {
+                // End of file - only valid after at least one gcode block
+                if (expect != Expect::gcode_or_eof) {
+                    return { .error_str = N_("The file is not a valid bgcode file.") };
+                }
+                break;
+
+            } else if (res != EResult::Success) {
+                return { .error_str = N_("The file is not a valid bgcode file.") };
+            }
+
+            bool type_valid = false;
+            switch (expect) {
+
+            case Expect::file_metadata:
+                type_valid = (EBlockType)block_header.type == EBlockType::FileMetadata;
+                expect = Expect::printer_metadata;
+                break;
+
+            case Expect::printer_metadata:
+                type_valid = (EBlockType)block_header.type == EBlockType::PrinterMetadata;
+                expect = Expect::thumbnail_or_print_metadata;
+                break;
+
+            case Expect::thumbnail_or_print_metadata:
+                if ((EBlockType)block_header.type == EBlockType::Thumbnail) {
+                    type_valid = true; // more thumbnails may follow, keep the state
+                } else if ((EBlockType)block_header.type == EBlockType::PrintMetadata) {
+                    type_valid = true;
+                    expect = Expect::slicer_metadata;
+                }
+                break;
+
+            case Expect::slicer_metadata:
+                type_valid = (EBlockType)block_header.type == EBlockType::SlicerMetadata;
+                expect = Expect::first_gcode;
+                break;
+
+            case Expect::first_gcode:
+            case Expect::gcode_or_eof:
+                type_valid = (EBlockType)block_header.type == EBlockType::GCode;
+                expect = Expect::gcode_or_eof;
+                break;
+            }
+            if (!type_valid) {
+                return { .error_str = N_("The file is not a valid bgcode file.") };
+            }
+
+            if (!has_crc) {
+                if (skip_block(*file, file_header, block_header) != EResult::Success) {
+                    return { .error_str = N_("The file is not a valid bgcode file.") };
+                }
+                continue;
+            }
+
+            // CRC covers the block header fields (in file order) followed by the payload
+            uint32_t crc = 0;
+            const auto crc_append_field = [&](const auto &field) {
+                crc = crc32_calc_ex(crc, reinterpret_cast<const uint8_t *>(&field), sizeof(field));
+            };
+            crc_append_field(block_header.type);
+            crc_append_field(block_header.compression);
+            crc_append_field(block_header.uncompressed_size);
+            if (block_header.compression != (uint16_t)ECompressionType::None) {
+                crc_append_field(block_header.compressed_size);
+            }
+
+            size_t remaining_payload = block_payload_size(block_header);
+            while (remaining_payload > 0) {
+                const size_t chunk = std::min(remaining_payload, crc_calc_buffer.size());
+                if (fread(crc_calc_buffer.data(), 1, chunk, file) != chunk) {
+                    return { .error_str = N_("The file is not a valid bgcode file.") };
+                }
+                crc = crc32_calc_ex(crc, crc_calc_buffer.data(), chunk);
+                remaining_payload -= chunk;
+            }
+
+            uint32_t stored_crc;
+            if (fread(&stored_crc, 1, sizeof(stored_crc), file) != sizeof(stored_crc) || stored_crc != crc) {
+                return { .error_str = N_("The file is not a valid bgcode file.") };
+            }
+        }
     }
 
     return { .is_ok = true };
@@ -599,6 +974,7 @@ bool PrusaPackGcodeReader::init_decompression() {
     } else {
         // no compression, setup data returning directly from file
         set_ptr_stream_getc_decompressed(&PrusaPackGcodeReader::stream_getc_file);
+        stream.raw_input = true;
     }
 
     const auto encoding = static_cast<EGCodeEncodingType>(stream.encoding);
@@ -654,6 +1030,7 @@ void PrusaPackGcodeReader::stream_t::reset() {
     encoding = (uint16_t)bgcode::core::EGCodeEncodingType::None;
     block_remaining_bytes_compressed = 0; //< remaining bytes in current block
     uncompressed_offset = 0; //< offset of next char that will be outputted
+    raw_input = false;
     hs_decoder.reset();
     meatpack.reset_state();
 }
@@ -47,6 +47,7 @@ public:
 
 private:
     uint32_t file_size; ///< Size of PrusaPack file in bytes
+    time_t file_mtime; ///< Modification time of the file, used (with file_size) as the block index cache key
     bgcode::core::FileHeader file_header; // cached header
 
     struct stream_t {
@@ -59,6 +60,7 @@ private:
         uint16_t encoding = (uint16_t)bgcode::core::EGCodeEncodingType::None;
         uint32_t block_remaining_bytes_compressed = 0; //< remaining bytes in current block
         uint32_t uncompressed_offset = 0; //< offset of next char that will be outputted
+        bool raw_input = false; //< block data is not compressed, can be read from the file in bulk
         MeatPack meatpack;
 
         struct HSDecoderDeleter {
@@ -110,6 +112,13 @@ private:
     /// store current block position in file, for future restoration
     void store_restore_block();
 
+    /// How often (in uncompressed stream bytes) the heatshrink decoder state gets snapshotted
+    static constexpr uint32_t decoder_snapshot_interval = 4096;
+
+    /// Snapshots the decoder state into the process-wide cache once per \p decoder_snapshot_interval,
+    /// so a future stream restore doesn't have to replay the whole block
+    void maybe_save_decoder_snapshot();
+
     // initialize decompression depending on parameters in stream
     bool init_decompression();
 
@@ -1,7 +1,7 @@
 #include "gcode_reader_plaintext.hpp"
 
 #include "lang/i18n.h"
-#include <errno.h> // for EAGAIN
+#include <algorithm>
 #include <filename_type.hpp>
 #include <sys/stat.h>
 #include <type_traits>
@@ -40,6 +40,7 @@ bool PlainGcodeReader::stream_thumbnail_start(uint16_t expected_width, uint16_t
             stream_mode_ = StreamMode::thumbnail;
             thumbnail_size = num_bytes;
             base64_decoder.Reset();
+            thumbnail_decoded_size = thumbnail_decoded_pos = 0;
             ptr_stream_getc = static_cast<stream_getc_type>(&PlainGcodeReader::stream_getc_thumbnail_impl);
             return true;
         }
@@ -121,39 +122,51 @@ IGcodeReader::Result_t PlainGcodeReader::stream_get_line(GcodeBuffer &buffer, Co
 }
 
 IGcodeReader::Result_t PlainGcodeReader::stream_getc_thumbnail_impl(char &out) {
+    // serve the bytes decoded by the previous call first
+    if (thumbnail_decoded_pos < thumbnail_decoded_size) {
+        out = thumbnail_decoded[thumbnail_decoded_pos++];
+        return Result_t::RESULT_OK;
+    }
+
     auto file = this->file.get();
-    long pos = ftell(file);
     while (true) {
         if (thumbnail_size == 0) {
             return Result_t::RESULT_EOF;
         }
-        if (!range_valid(pos, pos + 1)) {
+
+        // Read the file a chunk at a time - per-character fgetc is what made
+        // thumbnail extraction slow. thumbnail_size counts the base64
+        // characters only, so a chunk capped by it can never reach past the
+        // last character of the thumbnail, no matter how much whitespace is
+        // interleaved.
+        char chunk[thumbnail_chunk_size];
+        const long pos = ftell(file);
+        const size_t want = std::min<size_t>(sizeof(chunk), thumbnail_size);
+        if (!range_valid(pos, pos + want)) {
             return Result_t::RESULT_OUT_OF_RANGE;
         }
-        int c = fgetc(file);
-        if (feof(file)) {
-            return Result_t::RESULT_EOF;
-        }
-        if (ferror(file) && errno == EAGAIN) {
+        const size_t read = fread(chunk, 1, want, file);
+        if (read == 0) {
+            if (feof(file)) {
+                return Result_t::RESULT_EOF;
+            }
             return Result_t::RESULT_ERROR;
         }
-        pos++;
 
-        // skip non-base64 characters
-        if (c == '\r' || c == '\n' || c == ' ' || c == ';') {
-            continue;
+        size_t base64_chars = 0;
+        const int decoded = base64_decoder.ConsumeBlock(chunk, read, thumbnail_decoded.data(), base64_chars);
+        if (decoded < 0) {
+            return Result_t::RESULT_ERROR;
         }
-        --thumbnail_size;
+        thumbnail_size -= base64_chars;
+        thumbnail_decoded_size = decoded;
+        thumbnail_decoded_pos = 0;
 
-        // c now contains valid base64 character - decode and return it
-        switch (base64_decoder.ConsumeChar(c, reinterpret_cast<uint8_t *>(&out))) {
-        case 1:
+        if (decoded > 0) {
+            out = thumbnail_decoded[thumbnail_decoded_pos++];
             return Result_t::RESULT_OK;
-        case 0:
-            continue;
-        case -1:
-            return Result_t::RESULT_ERROR;
         }
+        // the whole chunk was whitespace and comment prefixes, try the next one
     }
 }
 
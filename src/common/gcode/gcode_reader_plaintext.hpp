@@ -3,6 +3,8 @@
 #include "base64_stream_decoder.h"
 #include "gcode_reader_interface.hpp"
 
+#include <array>
+
 /**
  * @brief Implementation of IGcodeReader for plaintext gcodes
  */
@@ -35,9 +37,16 @@ private:
     // With increasing size of the comment section, this will have to be increased as well
     static constexpr const size_t search_last_x_bytes = 50000;
 
+    // Thumbnail characters are read from the file and decoded a chunk at a
+    // time, the decoded bytes wait here between stream_getc calls
+    static constexpr size_t thumbnail_chunk_size = 64;
+
     uint32_t gcodes_in_metadata = 0;
     uint32_t thumbnail_size = 0;
     Base64StreamDecoder base64_decoder;
+    std::array<uint8_t, (thumbnail_chunk_size * 3) / 4 + 2> thumbnail_decoded;
+    uint8_t thumbnail_decoded_size = 0;
+    uint8_t thumbnail_decoded_pos = 0;
     uint32_t file_size = 0;
     // when scanning for metadata, this will be set to position of first gcode, so subsequent calls to stream_gcode_start will start directly from gcodes
     uint32_t first_gcode_pos;
@@ -0,0 +1,274 @@
+#include "gcode_stats_scan.hpp"
+
+#include "gcode_buffer.hpp"
+#include "gcode_reader_any.hpp"
+#include <common/async_job/async_job.hpp>
+#include <freertos/mutex.hpp>
+#include <logging/log.hpp>
+
+#include <atomic>
+#include <cctype>
+#include <cinttypes>
+#include <cmath>
+#include <cstring>
+#include <file_list_defs.h>
+#include <mutex>
+
+LOG_COMPONENT_REF(MarlinServer);
+
+namespace gcode_stats_scan {
+
+static AsyncJob stats_scan_async_job;
+
+static std::atomic<ScanState> scan_state_ = ScanState::idle;
+
+/// Guards the two fields below; the worker publishes under it (nested in
+/// with_synchronized so a discarded job never publishes), readers take it in
+/// result_for()
+static freertos::Mutex result_mutex;
+static GcodeStats cached_stats;
+static std::array<char, FILE_PATH_BUFFER_LEN> cached_path = { '\0' };
+
+static FeatureType feature_from_comment(const GcodeBuffer::String &value) {
+    static constexpr std::pair<const char *, FeatureType> map[] = {
+        { "Perimeter", FeatureType::perimeter },
+        { "External perimeter", FeatureType::external_perimeter },
+        { "Overhang perimeter", FeatureType::overhang_perimeter },
+        { "Internal infill", FeatureType::internal_infill },
+        { "Solid infill", FeatureType::solid_infill },
+        { "Top solid infill", FeatureType::top_solid_infill },
+        { "Bridge infill", FeatureType::bridge_infill },
+        { "Ironing", FeatureType::ironing },
+        { "Skirt/Brim", FeatureType::skirt_brim },
+        { "Skirt", FeatureType::skirt_brim },
+        { "Brim", FeatureType::skirt_brim },
+        { "Support material", FeatureType::support_material },
+        { "Support material interface", FeatureType::support_material_interface },
+        { "Wipe tower", FeatureType::wipe_tower },
+        { "Custom", FeatureType::custom },
+    };
+    for (const auto &[name, type] : map) {
+        if (value == name) {
+            return type;
+        }
+    }
+    return FeatureType::other;
+}
+
+/// Modal state of the simple g-code walk-through
+struct ScanModalState {
+    std::array<float, 3> pos = { 0, 0, 0 }; ///< XYZ
+    std::array<bool, 3> pos_known = { false, false, false };
+    float e_pos = 0;
+    float feedrate_mm_min = 0;
+    bool xyz_relative = false;
+    bool e_relative = false;
+    FeatureType feature = FeatureType::other;
+};
+
+/// Reads one float parameter; the copy keeps parameter order in the line irrelevant
+static std::optional<float> get_param(const GcodeBuffer::String &args, char param) {
+    GcodeBuffer::String s = args;
+    if (!s.skip_to_param(param)) {
+        return std::nullopt;
+    }
+    return s.get_float();
+}
+
+static void account_move(const GcodeBuffer::String &args, ScanModalState &state, GcodeStats &stats) {
+    float dist_sq = 0;
+    static constexpr char axis_letters[3] = { 'X', 'Y', 'Z' };
+    for (size_t axis = 0; axis < 3; ++axis) {
+        const auto value = get_param(args, axis_letters[axis]);
+        if (!value.has_value()) {
+            continue;
+        }
+        const float target = state.xyz_relative ? state.pos[axis] + *value : *value;
+        if (state.pos_known[axis]) {
+            const float diff = target - state.pos[axis];
+            dist_sq += diff * diff;
+        }
+        state.pos[axis] = target;
+        state.pos_known[axis] = true;
+    }
+
+    float e_diff = 0;
+    if (const auto value = get_param(args, 'E'); value.has_value()) {
+        e_diff = state.e_relative ? *value : *value - state.e_pos;
+        state.e_pos = state.e_relative ? state.e_pos + *value : *value;
+    }
+
+    if (const auto value = get_param(args, 'F'); value.has_value() && *value > 0) {
+        state.feedrate_mm_min = *value;
+    }
+
+    const float dist = std::sqrt(dist_sq);
+    // retracts/primes move only the E axis, their duration is the E travel
+    const float duration_dist = dist > 0 ? dist : std::abs(e_diff);
+
+    FeatureBucket &bucket = stats.features[static_cast<size_t>(state.feature)];
+    ++bucket.move_count;
+    ++stats.total_moves;
+
+    if (state.feedrate_mm_min > 0) {
+        const float time_s = duration_dist / (state.feedrate_mm_min / 60.0f);
+        bucket.time_s += time_s;
+        stats.total_time_s += time_s;
+    }
+
+    if (dist > 0) {
+        size_t bucket_ix = 0;
+        float limit = 0.1f;
+        while (bucket_ix + 1 < GcodeStats::histogram_buckets && dist >= limit) {
+            limit *= 2;
+            ++bucket_ix;
+        }
+        ++stats.move_length_histogram[bucket_ix];
+    }
+}
+
+static void process_line(GcodeBuffer::String line, ScanModalState &state, GcodeStats &stats) {
+    line.skip_ws();
+    if (line.is_empty()) {
+        return;
+    }
+
+    if (line.front() == ';') {
+        // only the feature tags are interesting, metadata is gcode_info's job
+        line.pop_front();
+        static constexpr char prefix[] = "TYPE:";
+        static constexpr size_t prefix_len = sizeof(prefix) - 1;
+        if (line.len() < prefix_len || !std::equal(prefix, prefix + prefix_len, line.begin)) {
+            return;
+        }
+        line.skip(prefix_len);
+        // trim the line end manually, String::trim does not take CR of CRLF files
+        while (line.begin != line.end && isspace(*(line.end - 1))) {
+            --line.end;
+        }
+        state.feature = feature_from_comment(line);
+        return;
+    }
+
+    if (line.skip_gcode("G0") || line.skip_gcode("G1") || line.skip_gcode("G2") || line.skip_gcode("G3")) {
+        // arcs contribute their chord; close enough for bucket proportions
+        account_move(line, state, stats);
+
+    } else if (line.skip_gcode("G90")) {
+        state.xyz_relative = false;
+        state.e_relative = false;
+
+    } else if (line.skip_gcode("G91")) {
+        state.xyz_relative = true;
+        state.e_relative = true;
+
+    } else if (line.skip_gcode("G92")) {
+        // coordinate reset - adjust the tracked positions, no move happens
+        static constexpr char axis_letters[3] = { 'X', 'Y', 'Z' };
+        for (size_t axis = 0; axis < 3; ++axis) {
+            if (const auto value = get_param(line, axis_letters[axis]); value.has_value()) {
+                state.pos[axis] = *value;
+                state.pos_known[axis] = true;
+            }
+        }
+        if (const auto value = get_param(line, 'E'); value.has_value()) {
+            state.e_pos = *value;
+        }
+
+    } else if (line.skip_gcode("M82")) {
+        state.e_relative = false;
+
+    } else if (line.skip_gcode("M83")) {
+        state.e_relative = true;
+    }
+}
+
+static void stats_scan_callback(AsyncJobExecutionControl &control, const std::array<char, FILE_PATH_BUFFER_LEN> &path) {
+    const auto fail = [&control] {
+        control.with_synchronized([] {
+            scan_state_ = ScanState::failed;
+        });
+    };
+
+    AnyGcodeFormatReader file_reader(path.data());
+    if (!file_reader.is_open()) {
+        log_error(MarlinServer, "GcodeStats: fail to open");
+        fail();
+        return;
+    }
+
+    if (file_reader.get()->stream_gcode_start() != IGcodeReader::Result_t::RESULT_OK) {
+        log_error(MarlinServer, "GcodeStats: fail to start stream");
+        fail();
+        return;
+    }
+
+    GcodeStats stats;
+    ScanModalState state;
+    GcodeBuffer buffer;
+    uint32_t line_counter = 0;
+
+    while (true) {
+        const auto res = file_reader.get()->stream_get_line(buffer, IGcodeReader::Continuations::Discard);
+        if (res == IGcodeReader::Result_t::RESULT_EOF) {
+            break;
+        }
+        if (res != IGcodeReader::Result_t::RESULT_OK) {
+            // also covers files that are still downloading - the caller may
+            // simply start_scan() again later
+            log_warning(MarlinServer, "GcodeStats: stream ended with %d after %" PRIu32 " lines", static_cast<int>(res), line_counter);
+            fail();
+            return;
+        }
+
+        process_line(buffer.line, state, stats);
+
+        if ((++line_counter % 256) == 0 && control.is_discarded()) {
+            return;
+        }
+    }
+
+    log_info(MarlinServer, "GcodeStats: %" PRIu32 " moves, est %d s", stats.total_moves, static_cast<int>(stats.total_time_s));
+
+    control.with_synchronized([&] {
+        std::lock_guard lock(result_mutex);
+        cached_stats = stats;
+        strlcpy(cached_path.data(), path.data(), cached_path.size());
+        scan_state_ = ScanState::finished;
+    });
+}
+
+ScanState scan_state() {
+    return scan_state_;
+}
+
+void start_scan(const char *filepath) {
+    std::array<char, FILE_PATH_BUFFER_LEN> path;
+    strlcpy(path.data(), filepath, path.size());
+
+    {
+        // the previous result is stale now, whatever file it was for
+        std::lock_guard lock(result_mutex);
+        cached_path[0] = '\0';
+    }
+
+    scan_state_ = ScanState::running;
+    stats_scan_async_job.issue([path](AsyncJobExecutionControl &control) {
+        stats_scan_callback(control, path);
+    });
+}
+
+void cancel_scan() {
+    stats_scan_async_job.discard();
+    scan_state_ = ScanState::idle;
+}
+
+std::optional<GcodeStats> result_for(const char *filepath) {
+    std::lock_guard lock(result_mutex);
+    if (scan_state_ != ScanState::finished || strcmp(cached_path.data(), filepath) != 0) {
+        return std::nullopt;
+    }
+    return cached_stats;
+}
+
+} // namespace gcode_stats_scan
@@ -0,0 +1,87 @@
+#pragma once
+
+#include <array>
+#include <cstdint>
+#include <optional>
+
+/// Opt-in ahead-of-print statistics pass over a queued g-code file.
+///
+/// Unlike gcode_info_scan, which only reads the metadata block and the first
+/// few g-codes, this walks the whole file and aggregates the printing moves
+/// into per-feature-type buckets (driven by the ";TYPE:" comments the slicer
+/// emits) plus a histogram of move lengths. The result allows correcting the
+/// mid-print ETA by the proportion of each feature already printed instead of
+/// trusting the slicer's single total, without adding any work to the media
+/// hot path - everything happens on an async job worker before (or while) the
+/// print runs.
+///
+/// Nothing starts the scan on its own; whoever wants the data calls
+/// start_scan() and later picks the result up with result_for().
+namespace gcode_stats_scan {
+
+/// Feature types the slicer tags blocks of moves with in ";TYPE:" comments
+enum class FeatureType : uint8_t {
+    perimeter,
+    external_perimeter,
+    overhang_perimeter,
+    internal_infill,
+    solid_infill,
+    top_solid_infill,
+    bridge_infill,
+    ironing,
+    skirt_brim,
+    support_material,
+    support_material_interface,
+    wipe_tower,
+    custom,
+    /// moves before the first ";TYPE:" comment or under a tag we don't know
+    other,
+    _cnt
+};
+
+struct FeatureBucket {
+    /// G0/G1/G2/G3 commands attributed to the feature
+    uint32_t move_count = 0;
+
+    /// Commanded time: distance over feedrate, summed over the moves.
+    /// Ignores acceleration, so it is a lower bound - but the ratio between
+    /// the buckets is what the ETA correction works with.
+    float time_s = 0;
+};
+
+struct GcodeStats {
+    /// Bucket i counts moves shorter than 0.1 * 2^i mm, the last one takes
+    /// everything longer. The short end is what predicts stuttering regions.
+    static constexpr size_t histogram_buckets = 8;
+
+    std::array<FeatureBucket, static_cast<size_t>(FeatureType::_cnt)> features {};
+    std::array<uint32_t, histogram_buckets> move_length_histogram {};
+
+    uint32_t total_moves = 0;
+    float total_time_s = 0;
+};
+
+enum class ScanState : uint8_t {
+    idle,
+    running,
+    /// Result is available through result_for()
+    finished,
+    /// Could not open or read through the file
+    failed,
+};
+
+ScanState scan_state();
+
+/// Starts scanning \p filepath on an async job worker.
+/// A previous result (even for the same file) is dropped and recomputed.
+void start_scan(const char *filepath);
+
+/// Cancels the currently running scan, to save resources.
+void cancel_scan();
+
+/// Returns the cached statistics when a finished scan matches \p filepath,
+/// nullopt otherwise (no scan ran, it is still running, or it was for
+/// a different file).
+std::optional<GcodeStats> result_for(const char *filepath);
+
+} // namespace gcode_stats_scan
@@ -0,0 +1,115 @@
+#include "gcode_thumb_cache.hpp"
+
+#include <file_list_defs.h>
+#include <stat_retry.hpp>
+
+#include <algorithm>
+#include <array>
+#include <cstring>
+#include <memory>
+#include <new>
+#include <sys/stat.h>
+
+namespace {
+
+/// How many thumbnails the cache holds. Two is enough to keep both the preview
+/// and the progress-screen thumbnail of the current print hot at the same time.
+constexpr size_t entry_count = 2;
+
+/// Upper bound on a single cached stream. Thumbnails larger than this keep being
+/// drawn directly from the reader, so the limit only bounds memory usage, not correctness.
+constexpr size_t entry_capacity = 32768;
+
+struct Entry {
+    std::array<char, FILE_PATH_BUFFER_LEN> path { "" };
+
+    /// File identity at the time of caching - a changed mtime or size invalidates the entry
+    time_t mtime = 0;
+    off_t file_size = 0;
+
+    /// Dimensions the thumbnail was requested with
+    uint16_t width = 0, height = 0;
+
+    /// Cached stream data, allocated lazily from the heap on first use of the entry
+    std::unique_ptr<uint8_t[]> data;
+    size_t data_size = 0;
+
+    uint32_t last_use = 0; ///< Stamp from use_counter, for LRU eviction
+    bool valid = false;
+};
+
+std::array<Entry, entry_count> cache;
+uint32_t use_counter = 0;
+
+bool entry_matches(const Entry &entry, const char *path, uint16_t width, uint16_t height, const struct stat &st) {
+    return entry.valid
+        && entry.width == width
+        && entry.height == height
+        && entry.mtime == st.st_mtime
+        && entry.file_size == st.st_size
+        && strcmp(entry.path.data(), path) == 0;
+}
+
+} // namespace
+
+FILE *gcode_thumb_cache::open_cached(const char *path, uint16_t width, uint16_t height) {
+    struct stat st {};
+    if (stat_retry(path, &st) != 0) {
+        return nullptr;
+    }
+
+    for (auto &entry : cache) {
+        if (entry_matches(entry, path, width, height, st)) {
+            entry.last_use = ++use_counter;
+            return fmemopen(entry.data.get(), entry.data_size, "rb");
+        }
+    }
+
+    return nullptr;
+}
+
+FILE *gcode_thumb_cache::store(const char *path, uint16_t width, uint16_t height, IGcodeReader &reader) {
+    struct stat st {};
+    if (stat_retry(path, &st) != 0 || strlen(path) >= FILE_PATH_BUFFER_LEN) {
+        return nullptr;
+    }
+
+    // Evict the least recently used entry
+    auto &entry = *std::min_element(cache.begin(), cache.end(), [](const Entry &a, const Entry &b) {
+        return (a.valid ? a.last_use : 0) < (b.valid ? b.last_use : 0);
+    });
+    entry.valid = false;
+
+    if (!entry.data) {
+        entry.data.reset(new (std::nothrow) uint8_t[entry_capacity]);
+        if (!entry.data) {
+            return nullptr;
+        }
+    }
+
+    size_t size = 0;
+    while (true) {
+        char c;
+        const auto result = reader.stream_getc(c);
+        if (result == IGcodeReader::Result_t::RESULT_EOF) {
+            break;
+        } else if (result != IGcodeReader::Result_t::RESULT_OK) {
+            return nullptr;
+        } else if (size >= entry_capacity) {
+            // Does not fit - the caller draws it directly from the reader instead
+            return nullptr;
+        }
+        entry.data[size++] = c;
+    }
+
+    strlcpy(entry.path.data(), path, entry.path.size());
+    entry.mtime = st.st_mtime;
+    entry.file_size = st.st_size;
+    entry.width = width;
+    entry.height = height;
+    entry.data_size = size;
+    entry.last_use = ++use_counter;
+    entry.valid = true;
+
+    return fmemopen(entry.data.get(), entry.data_size, "rb");
+}
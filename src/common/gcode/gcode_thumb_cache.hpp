@@ -0,0 +1,32 @@
+#pragma once
+
+#include <cstdio>
+#include <cstdint>
+
+#include "gcode_reader_interface.hpp"
+
+/// Small LRU cache of decoded (QOI) thumbnail streams, keyed by file identity (path + mtime + size)
+/// and requested dimensions.
+///
+/// Extracting a thumbnail means opening the G-code file, seeking through it and (for plaintext
+/// G-codes) base64-decoding the data - all of that repeats on every redraw of the preview.
+/// The cache keeps the resulting QOI byte stream in a heap-allocated buffer, so repeated draws
+/// of the same file are served straight from RAM.
+///
+/// !!! Only to be used from the GUI thread (the cache is not synchronized)
+namespace gcode_thumb_cache {
+
+/// \returns an in-memory FILE over the cached thumbnail stream for the given file and dimensions,
+/// or nullptr on cache miss. The file identity is re-checked via stat, so a changed/replaced file
+/// misses naturally.
+/// The caller must fclose the result before the next call on the cache (the FILE borrows the cache entry).
+FILE *open_cached(const char *path, uint16_t width, uint16_t height);
+
+/// Reads the whole thumbnail stream from \p reader (which must have a thumbnail stream already
+/// started via \p stream_thumbnail_start) into the cache, evicting the least recently used entry.
+/// \returns an in-memory FILE over the freshly cached stream, or nullptr if the stream did not fit
+/// in the cache (the caller shall then restart the stream and draw directly from the reader).
+/// The caller must fclose the result before the next call on the cache (the FILE borrows the cache entry).
+FILE *store(const char *path, uint16_t width, uint16_t height, IGcodeReader &reader);
+
+} // namespace gcode_thumb_cache
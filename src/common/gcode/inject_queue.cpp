@@ -7,8 +7,8 @@ InjectQueue inject_queue; // instance
 
 GCodeLoader loader; // loader instance for async gcode loading from the InjectQueue
 
-bool InjectQueue::try_push(InjectQueueRecord record) {
-    return queue.try_put(record);
+bool InjectQueue::try_push(InjectQueueRecord record, InjectPriority priority) {
+    return lanes[ftrstd::to_underlying(priority)].try_put(record);
 }
 
 std::expected<const char *, InjectQueue::GetGCodeError> InjectQueue::get_gcode() {
@@ -24,9 +24,18 @@ std::expected<const char *, InjectQueue::GetGCodeError> InjectQueue::get_gcode()
         return std::unexpected(GetGCodeError::loading_aborted);
     }
 
-    // If we've reached here, we need to check the queue and do something
+    // If we've reached here, we need to check the queues and do something;
+    // higher priority lanes are drained first
     InjectQueueRecord item;
-    if (!queue.try_get(item)) {
+    const bool got_item = [&] {
+        for (auto &lane : lanes) {
+            if (lane.try_get(item)) {
+                return true;
+            }
+        }
+        return false;
+    }();
+    if (!got_item) {
         return std::unexpected(GetGCodeError::empty);
     }
 
@@ -35,6 +44,12 @@ std::expected<const char *, InjectQueue::GetGCodeError> InjectQueue::get_gcode()
         return val->gcode;
     }
 
+    // The item is a direct callback -> run it now, there is nothing to parse
+    if (const auto *direct = std::get_if<GCodeCallback>(&item)) {
+        direct->callback();
+        return std::unexpected(GetGCodeError::executed);
+    }
+
     if (const auto button = std::get_if<GCodeMacroButton>(&item)) {
         char filepath_buf[sizeof("btn_XXX")];
         StringBuilder filepath(filepath_buf);
@@ -2,8 +2,10 @@
 
 #include "inject_queue_actions.hpp"
 #include <common/circular_buffer.hpp>
+#include <array>
 #include <expected>
 #include <file_list_defs.h>
+#include <utils/utility_extensions.hpp>
 
 class InjectQueue {
 public:
@@ -15,6 +17,9 @@ public:
         buffering,
         /// Record was discarded, an error occurred during loading
         loading_aborted,
+        /// Record was a direct callback and has already been executed,
+        /// there is no gcode text to parse
+        executed,
 
     };
 
@@ -23,17 +28,19 @@ public:
     /**
      *  Checks record validity and queue space
      *  @retval true - record was injected
-     *  @retval false - record is invalid or inject_queue is full
+     *  @retval false - record is invalid or the priority lane is full
      */
-    bool try_push(InjectQueueRecord record);
+    bool try_push(InjectQueueRecord record, InjectPriority priority = InjectPriority::background);
 
     /**
      *  If a gcode is returned, the corresponding record is removed from the injection queue.
+     *  Lanes are drained in priority order, starting with InjectPriority::safety.
      *  @retval a gcode that is to be executed by injection or an error
      */
     std::expected<const char *, GetGCodeError> get_gcode();
 
-    CircularBuffer<InjectQueueRecord, queue_size> queue; //!< Queue (real size is queue_size - 1)
+    /// One queue per priority class (real size of each is queue_size - 1)
+    std::array<CircularBuffer<InjectQueueRecord, queue_size>, ftrstd::to_underlying(InjectPriority::_count)> lanes;
 };
 
 extern InjectQueue inject_queue;
@@ -1,8 +1,19 @@
 #pragma once
 
+#include <cstdint>
 #include <variant>
 #include <str_utils.hpp>
 
+/// Priority class of an injected gcode; the injection queue drains higher
+/// classes first, so a user-facing inject is never stuck behind a stream of
+/// background automation injects.
+enum class InjectPriority : uint8_t {
+    safety, ///< runout and similar - must run as soon as possible
+    user_action, ///< direct response to a user action (GUI buttons, autoload)
+    background, ///< automation, macro buttons, cleaning sequences
+    _count
+};
+
 struct GCodeFilename {
     ConstexprString name;
     ConstexprString fallback { nullptr };
@@ -16,4 +27,11 @@ struct GCodeMacroButton {
     uint8_t button;
 };
 
-using InjectQueueRecord = std::variant<GCodeFilename, GCodeMacroButton, GCodeLiteral>;
+/// Fixed firmware macro compiled down to a direct call. The callback runs in
+/// the marlin task when the injection queue drains, in the same slot a parsed
+/// gcode would, but without the gcode text round-trip through the parser.
+struct GCodeCallback {
+    void (*callback)();
+};
+
+using InjectQueueRecord = std::variant<GCodeFilename, GCodeMacroButton, GCodeLiteral, GCodeCallback>;
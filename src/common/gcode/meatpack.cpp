@@ -39,6 +39,9 @@
 
 #include "meatpack.h"
 
+#include <array>
+#include <cstring>
+
 #define MeatPack_ProtocolVersion "PV01"
 // #define MP_DEBUG
 
@@ -54,12 +57,57 @@ uint8_t meatPackLookupTable[16] = {
 uint8_t chars_decoded = 0; // Log the first 64 bytes after each reset
 #endif
 
+namespace {
+
+/// Both characters of a packed byte, decoded ahead of time
+struct MeatPackPair {
+    uint8_t chars[2];
+    uint8_t flags;
+};
+
+/// Builds a 256-entry table decoding a whole packed byte in a single lookup
+constexpr std::array<MeatPackPair, 256> build_pair_table(bool no_spaces) {
+    // Must match meatPackLookupTable (which is mutable because of the no-spaces mode, so cannot be used here directly)
+    constexpr uint8_t lookup[16] = {
+        '0', '1', '2', '3', '4', '5', '6', '7', '8', '9',
+        '.', ' ', '\n', 'G', 'X', '\0'
+    };
+
+    std::array<MeatPackPair, 256> table {};
+
+    for (size_t i = 0; i < table.size(); i++) {
+        auto &entry = table[i];
+
+        const auto decode_nibble = [&](uint8_t nibble) {
+            return (no_spaces && nibble == 11) ? uint8_t('E') : lookup[nibble];
+        };
+
+        if ((i & 0x0f) == 0x0f) {
+            entry.flags |= 0b00000001; // = kFirstCharIsLiteral
+        } else {
+            entry.chars[0] = decode_nibble(i & 0x0f);
+        }
+
+        if ((i & 0xf0) == 0xf0) {
+            entry.flags |= 0b00000010; // = kSecondCharIsLiteral
+        } else {
+            entry.chars[1] = decode_nibble((i >> 4) & 0x0f);
+        }
+    }
+
+    return table;
+}
+
+constexpr std::array<std::array<MeatPackPair, 256>, 2> pair_tables { build_pair_table(false), build_pair_table(true) };
+
+} // namespace
+
 void MeatPack::reset_state() {
     active = false;
     no_spaces = false;
     cmd_is_next = false;
     second_char = 0;
-    cmd_count = full_char_count = char_out_count = 0;
+    cmd_count = full_char_count = char_out_count = char_out_head = 0;
 #if defined(MP_DEBUG)
     chars_decoded = 0;
 #endif
@@ -98,22 +146,21 @@ uint8_t MeatPack::unpack_chars(const uint8_t pk, uint8_t *__restrict const chars
 void MeatPack::handle_rx_char_inner(const uint8_t c) {
     if (active) { // Is MeatPack active?
         if (!full_char_count) { // No literal characters to fetch?
-            uint8_t buf[2] = { 0, 0 };
-            const uint8_t res = unpack_chars(c, buf); // Decode the byte into one or two characters.
-            if (res & kFirstCharIsLiteral) { // The 1st character couldn't be packed.
+            const auto &pair = pair_tables[no_spaces][c]; // Decode the byte into one or two characters.
+            if (pair.flags & kFirstCharIsLiteral) { // The 1st character couldn't be packed.
                 ++full_char_count; // So the next stream byte is a full character.
-                if (res & kSecondCharIsLiteral) {
+                if (pair.flags & kSecondCharIsLiteral) {
                     ++full_char_count; // The 2nd character couldn't be packed. Another stream byte is a full character.
                 } else {
-                    second_char = buf[1]; // Retain the unpacked second character.
+                    second_char = pair.chars[1]; // Retain the unpacked second character.
                 }
             } else {
-                handle_output_char(buf[0]); // Send the unpacked first character out.
-                if (buf[0] != '\n') { // After a newline the next char won't be set
-                    if (res & kSecondCharIsLiteral) {
+                handle_output_char(pair.chars[0]); // Send the unpacked first character out.
+                if (pair.chars[0] != '\n') { // After a newline the next char won't be set
+                    if (pair.flags & kSecondCharIsLiteral) {
                         ++full_char_count; // The 2nd character couldn't be packed. The next stream byte is a full character.
                     } else {
-                        handle_output_char(buf[1]); // Send the unpacked second character out.
+                        handle_output_char(pair.chars[1]); // Send the unpacked second character out.
                     }
                 }
             }
@@ -135,7 +182,15 @@ void MeatPack::handle_rx_char_inner(const uint8_t c) {
  * GCodeQueue::get_serial_commands via calls to get_result_char
  */
 void MeatPack::handle_output_char(const uint8_t c) {
-    char_out_buf[char_out_count++] = c;
+    if (char_out_count == 0) {
+        char_out_head = 0;
+    } else if (char_out_head + char_out_count == sizeof(char_out_buf)) {
+        // No space at the end of the buffer -> compact the pending characters to the front
+        memmove(char_out_buf, char_out_buf + char_out_head, char_out_count);
+        char_out_head = 0;
+    }
+
+    char_out_buf[char_out_head + char_out_count++] = c;
 
 #if defined(MP_DEBUG)
     if (chars_decoded < 1024) {
@@ -204,14 +259,50 @@ void MeatPack::handle_rx_char(const uint8_t c) {
     handle_rx_char_inner(c); // Other characters are passed on for MeatPack decoding
 }
 
+void MeatPack::handle_rx_block(const uint8_t *data, uint8_t size) {
+    const auto &pair_table = pair_tables[no_spaces];
+
+    // Word-wise fast path - only valid in the steady packed state with no literals or command bytes pending
+    while (active && !full_char_count && !cmd_count && !cmd_is_next && size >= sizeof(uint32_t)) {
+        uint32_t word;
+        memcpy(&word, data, sizeof(word));
+
+        // Nibbles equal to 0b1111 announce a literal character
+        const uint32_t nibbles_literal = word & (word >> 1) & (word >> 2) & (word >> 3) & 0x11111111u;
+
+        // Nibbles equal to 0b1100 are packed newlines, which reset the pair sequence
+        const uint32_t diff = word ^ 0xccccccccu;
+        const uint32_t nibbles_newline = (diff - 0x11111111u) & ~diff & 0x88888888u;
+
+        if (nibbles_literal | nibbles_newline) {
+            // Fall back to the byte state machine around the special nibbles
+            break;
+        }
+
+        for (size_t i = 0; i < sizeof(word); i++) {
+            const auto &pair = pair_table[data[i]];
+            handle_output_char(pair.chars[0]);
+            handle_output_char(pair.chars[1]);
+        }
+
+        data += sizeof(word);
+        size -= sizeof(word);
+    }
+
+    while (size--) {
+        handle_rx_char(*data++);
+    }
+}
+
 uint8_t MeatPack::get_result_chars(char *const __restrict out) {
     uint8_t res = 0;
     if (char_out_count) {
         res = char_out_count;
         char_out_count = 0;
         for (uint8_t i = 0; i < res; ++i) {
-            out[i] = (char)char_out_buf[i];
+            out[i] = (char)char_out_buf[char_out_head + i];
         }
+        char_out_head = 0;
     }
     return res;
 }
@@ -221,7 +312,5 @@ char MeatPack::get_result_char() {
         return 0;
     }
     --char_out_count;
-    auto res = char_out_buf[0];
-    char_out_buf[0] = char_out_buf[1];
-    return res;
+    return char_out_buf[char_out_head++];
 }
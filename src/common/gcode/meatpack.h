@@ -85,19 +85,31 @@ class MeatPack {
     static const char kSpaceCharReplace = 'E';
 
     bool cmd_is_next; // A command is pending
-    bool active; // MeatPack encoding active
+    bool active; // MeatPack active
     bool no_spaces; // No spaces mode active
     uint8_t second_char; // Buffers a character if dealing with out-of-sequence pairs
     uint8_t cmd_count, // Counter of command bytes received (need 2)
         full_char_count, // Counter for full-width characters to be received
         char_out_count; // Stores number of characters to be read out.
-    uint8_t char_out_buf[2]; // Output buffer for caching up to 2 characters
+    uint8_t char_out_head; // Read position in char_out_buf
+    uint8_t char_out_buf[16]; // Output buffer for caching decoded characters
 
 public:
     // Pass in a character rx'd by SD card or serial. Automatically parses command/ctrl sequences,
     // and will control state internally.
     void handle_rx_char(const uint8_t c);
 
+    /**
+     * Pass in a whole block of rx'd characters at once.
+     * In the steady packed state, the block gets decoded with a word-wise table-driven kernel;
+     * the byte state machine is only used around command markers, literals and newlines.
+     * @param size must not exceed rx_block_capacity(), as every packed byte can decode into 2 characters.
+     */
+    void handle_rx_block(const uint8_t *data, uint8_t size);
+
+    /// How many rx'd bytes can be safely passed to handle_rx_block right now
+    uint8_t rx_block_capacity() const { return (sizeof(char_out_buf) - char_out_count) / 2; }
+
     /**
      * After passing in rx'd char using above method, call this to get characters out.
      * Can return from 0 to 2 characters at once.
@@ -159,6 +159,107 @@ void __malloc_unlock([[maybe_unused]] struct _reent *r) {
     }
 };
 
+//
+// malloc wrap collecting allocation statistics
+//
+// The counters are cumulative only: attributing free() back to the site that
+// allocated the pointer would need a pointer->site map, i.e. more heap
+// traffic than the problem being diagnosed. Counts and bytes since boot are
+// enough to spot the sites worth pooling.
+//
+// calloc/realloc reach the allocator through newlib's _malloc_r and bypass
+// the wrap; the dominant paths (plain malloc and operator new) go through it.
+
+uint32_t heap_alloc_histogram[HEAP_ALLOC_HISTOGRAM_BUCKETS];
+heap_alloc_site_t heap_alloc_sites[HEAP_ALLOC_SITE_SLOTS];
+uint32_t heap_alloc_sites_overflow;
+
+static void note_allocation(size_t size, uint32_t ret_addr) {
+    UBaseType_t usis;
+
+    size_t bucket = 0;
+    while (bucket < HEAP_ALLOC_HISTOGRAM_BUCKETS - 1 && size > ((size_t)16 << bucket)) {
+        bucket += 1;
+    }
+
+    ENTER_CRITICAL_SECTION(usis);
+    heap_alloc_histogram[bucket] += 1;
+    for (size_t i = 0; i < HEAP_ALLOC_SITE_SLOTS; i++) {
+        if (heap_alloc_sites[i].ret_addr == ret_addr || heap_alloc_sites[i].ret_addr == 0) {
+            heap_alloc_sites[i].ret_addr = ret_addr;
+            heap_alloc_sites[i].count += 1;
+            heap_alloc_sites[i].bytes += size;
+            EXIT_CRITICAL_SECTION(usis);
+            return;
+        }
+    }
+    heap_alloc_sites_overflow += 1;
+    EXIT_CRITICAL_SECTION(usis);
+}
+
+//
+// Task allocation watch (see heap.h)
+//
+
+static TaskHandle_t heap_watch_task = NULL;
+static uint32_t heap_watch_count;
+static uint32_t heap_watch_site;
+
+void heap_watch_current_task(void) {
+    UBaseType_t usis;
+    ENTER_CRITICAL_SECTION(usis);
+    heap_watch_task = xTaskGetCurrentTaskHandle();
+    heap_watch_count = 0;
+    heap_watch_site = 0;
+    EXIT_CRITICAL_SECTION(usis);
+}
+
+void heap_watch_disable(void) {
+    heap_watch_task = NULL;
+}
+
+uint32_t heap_watch_alloc_count(void) {
+    return heap_watch_count;
+}
+
+uint32_t heap_watch_last_site(void) {
+    return heap_watch_site;
+}
+
+static void note_watched_allocation(uint32_t ret_addr) {
+    if (heap_watch_task == NULL || xPortIsInsideInterrupt()) {
+        return;
+    }
+    if (xTaskGetCurrentTaskHandle() != heap_watch_task) {
+        return;
+    }
+    UBaseType_t usis;
+    ENTER_CRITICAL_SECTION(usis);
+    heap_watch_count += 1;
+    heap_watch_site = ret_addr;
+    EXIT_CRITICAL_SECTION(usis);
+}
+
+extern "C" void *__real_malloc(size_t size);
+
+extern "C" void *__wrap_malloc(size_t size) {
+    void *p = __real_malloc(size);
+    if (p != NULL) {
+        const uint32_t ret_addr = (uint32_t)__builtin_return_address(0);
+        note_allocation(size, ret_addr);
+        note_watched_allocation(ret_addr);
+    }
+    return p;
+}
+
+uint32_t heap_largest_free_block() {
+    struct mallinfo mi = mallinfo();
+    // keepcost is the top-most chunk, the only free-list entry whose size
+    // newlib reports; together with the memory sbrk has not claimed yet it is
+    // the largest block we can promise to hand out in one piece.
+    return mi.keepcost + heap_bytes_remaining;
+}
+
 uint32_t mem_is_heap_allocated(const void *ptr) {
     return (ptr >= (void *)&__HeapBase && ptr < (void *)&__HeapLimit);
 }
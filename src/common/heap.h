@@ -7,6 +7,47 @@ extern "C" {
 extern uint32_t heap_total_size;
 extern uint32_t heap_bytes_remaining;
 
+// Allocation statistics collected by the malloc() wrap in heap.cpp.
+// All counters are cumulative since boot; readers may load them without
+// locking (32-bit aligned loads are atomic on this platform).
+
+/// Histogram of requested allocation sizes. Bucket i covers sizes up to
+/// 16 << i bytes; the last bucket takes everything larger.
+#define HEAP_ALLOC_HISTOGRAM_BUCKETS 8
+extern uint32_t heap_alloc_histogram[HEAP_ALLOC_HISTOGRAM_BUCKETS];
+
+/// One call site of malloc(), keyed by its return address.
+typedef struct {
+    uint32_t ret_addr; ///< Return address of the malloc() caller, 0 = free slot
+    uint32_t count; ///< Allocations made from this site
+    uint32_t bytes; ///< Bytes requested by this site
+} heap_alloc_site_t;
+
+#define HEAP_ALLOC_SITE_SLOTS 16
+extern heap_alloc_site_t heap_alloc_sites[HEAP_ALLOC_SITE_SLOTS];
+
+/// Allocations from sites that did not fit into heap_alloc_sites.
+extern uint32_t heap_alloc_sites_overflow;
+
+/// Largest contiguous block guaranteed to be allocatable in one piece.
+/// Shrinking while xPortGetFreeHeapSize() stays put means fragmentation.
+uint32_t heap_largest_free_block(void);
+
+// Debug aid for catching allocations that escape static arenas: while the
+// watch is enabled, every malloc() made by the watched task is counted and
+// its call site recorded. Used by the GUI to catch screens that heap-allocate
+// instead of using their static storage.
+
+/// Starts watching the calling task; replaces any previous watch.
+void heap_watch_current_task(void);
+void heap_watch_disable(void);
+
+/// Allocations made by the watched task since the watch was enabled.
+uint32_t heap_watch_alloc_count(void);
+
+/// Return address of the watched task's most recent malloc() caller.
+uint32_t heap_watch_last_site(void);
+
 uint32_t mem_is_heap_allocated(const void *ptr);
 
 // Malloc, but returns null on failure, not a redscreen.
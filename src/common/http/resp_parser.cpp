@@ -63,6 +63,9 @@ ExecutionControl ResponseParser::event(Event event) {
     case Names::WsPrusaConnect:
         extra(event.payload, HeaderName::WebSocketPrusaConnect);
         return ExecutionControl::Continue;
+    case Names::WsHeatshrink:
+        extra(event.payload, HeaderName::WebSocketHeatshrink);
+        return ExecutionControl::Continue;
     case Names::UpgradeWebsocket:
         extra(event.payload, HeaderName::WebSocketUpgrade);
         return ExecutionControl::Continue;
@@ -13,6 +13,7 @@ enum class HeaderName {
     WebSocketUpgrade,
     ConnectionUpgrade,
     WebSocketPrusaConnect,
+    WebSocketHeatshrink,
 };
 
 class ExtraHeader {
@@ -32,9 +32,11 @@ WebSocket WebSocket::from_response(const Response &response) {
     return WebSocket(response.conn, response.body_leftover.data(), response.leftover_size);
 }
 
-optional<Error> WebSocket::send(Opcode opcode, bool last, uint8_t *data, size_t size) {
+optional<Error> WebSocket::send(Opcode opcode, bool last, uint8_t *data, size_t size, bool compressed) {
+    // RSV1 is allowed only on the first fragment of a data message.
+    assert(!compressed || opcode == Opcode::Text || opcode == Opcode::Binary);
     uint8_t header[8];
-    header[0] = static_cast<uint8_t>(last) << 7 | static_cast<uint8_t>(opcode);
+    header[0] = static_cast<uint8_t>(last) << 7 | static_cast<uint8_t>(compressed) << 6 | static_cast<uint8_t>(opcode);
     header[1] = 0b10000000;
 
     size_t pos = 2;
@@ -68,23 +70,42 @@ optional<Error> WebSocket::send(Opcode opcode, bool last, uint8_t *data, size_t
     // that. We can afford to use the potentially not cryptographically secure
     // RNG for that (it is used only in the theoretical scenario of HW RNG
     // failure anyway).
-    uint32_t key_u = rand_u();
-    const uint8_t *key = reinterpret_cast<uint8_t *>(&rand_u);
+    const uint32_t key = rand_u();
 
-    memcpy(header + pos, key, sizeof key_u);
-    pos += sizeof key_u;
+    memcpy(header + pos, &key, sizeof key);
+    pos += sizeof key;
 
     if (auto err = connection.tx_all(header, pos); err.has_value()) {
         return err;
     }
 
-    for (size_t i = 0; i < size; i++) {
-        data[i] ^= key[i % 4];
-    }
+    mask_payload(key, data, size);
 
     return connection.tx_all(data, size);
 }
 
+void WebSocket::mask_payload(uint32_t key, uint8_t *data, size_t size) {
+    /*
+     * The bulk goes a word at a time. As the key is exactly 4 bytes and we
+     * start at the beginning of the key stream, whole words need no rotation
+     * of the key at all. The memcpy deals with alignment and compiles down to
+     * plain word loads/stores.
+     */
+    size_t i = 0;
+    uint32_t word;
+    for (; i + sizeof word <= size; i += sizeof word) {
+        memcpy(&word, data + i, sizeof word);
+        word ^= key;
+        memcpy(data + i, &word, sizeof word);
+    }
+
+    // And the up to 3 bytes of tail.
+    const uint8_t *key_bytes = reinterpret_cast<const uint8_t *>(&key);
+    for (; i < size; i++) {
+        data[i] ^= key_bytes[i % 4];
+    }
+}
+
 variant<monostate, WebSocket::FragmentHeader, Error> WebSocket::receive(optional<uint32_t> poll) {
     if (poll.has_value()) {
         if (!connection.poll_readable(*poll)) {
@@ -191,6 +212,10 @@ bool WebSocketAccept::all_supported() const {
     return protocol_connect && upgrade_ws && conn_upgrade;
 }
 
+bool WebSocketAccept::heatshrink_negotiated() const {
+    return ext_heatshrink;
+}
+
 void WebSocketAccept::character(char c, HeaderName name) {
     switch (name) {
     case HeaderName::WebSocketAccept: {
@@ -207,6 +232,9 @@ void WebSocketAccept::character(char c, HeaderName name) {
     case HeaderName::WebSocketPrusaConnect:
         protocol_connect = true;
         break;
+    case HeaderName::WebSocketHeatshrink:
+        ext_heatshrink = true;
+        break;
     case HeaderName::WebSocketUpgrade:
         upgrade_ws = true;
         break;
@@ -61,10 +61,26 @@ public:
     };
 
     static WebSocket from_response(const Response &response);
+    // (Un)mask a payload in place with the given key.
+    //
+    // The key is the 4 mask bytes in the same order as they appear on the
+    // wire (just memcpy'd into the uint32_t). Masking and unmasking is the
+    // same operation (XOR), the payload is assumed to start at the beginning
+    // of the key stream.
+    //
+    // This goes word by word instead of byte by byte ‒ it runs in the
+    // network task for every outgoing telemetry frame.
+    static void mask_payload(uint32_t key, uint8_t *data, size_t size);
     // Send a fragment.
     //
     // Note that fragmenting messages is up to the caller.
-    std::optional<Error> send(Opcode opcode, bool last, uint8_t *data, size_t size);
+    //
+    // The compressed flag sets the RSV1 bit ‒ "this message is compressed",
+    // in the same way RFC 7692 uses it. It may be set only on the first
+    // fragment of a message and only when the compression extension was
+    // negotiated on the upgrade; how the payload is compressed is also the
+    // caller's responsibility.
+    std::optional<Error> send(Opcode opcode, bool last, uint8_t *data, size_t size, bool compressed = false);
 
     // Reads the header part of a message.
     //
@@ -116,6 +132,7 @@ private:
     bool conn_upgrade = false;
     bool upgrade_ws = false;
     bool protocol_connect = false;
+    bool ext_heatshrink = false;
 
 public:
     WebSocketAccept(const WebSocketKey &key)
@@ -123,6 +140,11 @@ public:
     virtual void character(char c, HeaderName name) override;
     bool key_matched() const;
     bool all_supported() const;
+    // Did the server accept the heatshrink compression extension?
+    //
+    // Unlike the above, this is optional ‒ without it we just keep sending
+    // uncompressed.
+    bool heatshrink_negotiated() const;
 };
 
 } // namespace http
@@ -17,6 +17,8 @@ void HX717Mux::init() {
     sample_interval = std::numeric_limits<float>::quiet_NaN();
     channel_switch_samples = 0;
     channel_switch_timestamp = 0;
+    dejittered_timestamp = 0;
+    dejitter_valid = false;
 
     // init HX717
     hx717.init(hx717.CHANNEL_A_GAIN_128);
@@ -24,6 +26,32 @@ void HX717Mux::init() {
     hx717Soft.enableIRQ();
 }
 
+uint32_t HX717Mux::dejitter(uint32_t raw_timestamp) {
+    if (!dejitter_valid) {
+        dejittered_timestamp = raw_timestamp;
+        dejitter_valid = true;
+        return raw_timestamp;
+    }
+
+    // The data-ready edge itself is periodic, but we only observe it after interrupt servicing:
+    // the raw timestamp is the true edge plus a one-sided latency. Predict the edge from the
+    // previous sample and the sampling cadence; an observation _earlier_ than the prediction can
+    // only mean a faster-than-before IRQ and is trusted as-is, while a later one is mostly
+    // attributed to latency, keeping a small fraction to track the drift between the HX717
+    // internal oscillator and our crystal.
+    uint32_t interval = std::isnan(sample_interval)
+        ? hx717.GetSamplingInterval()
+        : static_cast<uint32_t>(sample_interval * 1000.f);
+    uint32_t predicted = dejittered_timestamp + interval;
+    int32_t latency = ticks_diff(raw_timestamp, predicted);
+    if (latency < 0) {
+        dejittered_timestamp = raw_timestamp;
+    } else {
+        dejittered_timestamp = predicted + latency / 8;
+    }
+    return dejittered_timestamp;
+}
+
 void HX717Mux::handler() {
     // Currently set channel
     HX717::Channel current_channel = hx717.GetCurrentChannel();
@@ -69,11 +97,13 @@ void HX717Mux::handler() {
         // invalid read: invalidate
         channel_switch_samples = 0;
         sample_interval = std::numeric_limits<float>::quiet_NaN();
+        dejitter_valid = false;
     } else {
         if (current_channel != next_channel) {
-            // switching channel: reset
+            // switching channel: reset, the first conversion after a switch takes longer to settle
             channel_switch_samples = 0;
             sample_interval = std::numeric_limits<float>::quiet_NaN();
+            dejitter_valid = false;
         } else {
             // continous read on the same channel, estimate interval
             if (!channel_switch_samples) {
@@ -86,7 +116,9 @@ void HX717Mux::handler() {
         }
     }
 
-    // always forward the sample to the correct subsystem
+    // always forward the sample to the correct subsystem, with the IRQ servicing jitter removed
+    // from the timestamp so that probe Z-coordinate correlation sees the data-ready cadence
+    sample_timestamp = dejitter(sample_timestamp);
     if (current_channel == hx717.CHANNEL_A_GAIN_128) {
         if (!std::isnan(sample_interval)) {
             loadcell.analysis.SetSamplingIntervalMs(sample_interval);
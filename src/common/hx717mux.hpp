@@ -26,6 +26,11 @@ private:
     uint32_t channel_switch_samples;
     uint32_t channel_switch_timestamp;
     float sample_interval;
+
+    // data-ready edge de-jitter state
+    uint32_t dejittered_timestamp;
+    bool dejitter_valid;
+    uint32_t dejitter(uint32_t raw_timestamp);
 };
 
 extern HX717Mux hx717mux;
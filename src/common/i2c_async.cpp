@@ -0,0 +1,121 @@
+#include "i2c_async.hpp"
+
+#include <buddy/priorities_config.h>
+
+#include <cassert>
+#include <cstring>
+
+namespace i2c {
+
+AsyncEngine &AsyncEngine::instance() {
+    static AsyncEngine engine;
+    return engine;
+}
+
+AsyncEngine::AsyncEngine() {
+    static constexpr auto thread_func = +[](const void *param) {
+        reinterpret_cast<AsyncEngine *>(const_cast<void *>(param))->thread_routine();
+    };
+    osThreadStaticDef(i2c_async, thread_func, TASK_PRIORITY_I2C_ASYNC_ENGINE, 0, thread_stack.size(), thread_stack.data(), &thread_def);
+    thread_id = osThreadCreate(osThread(i2c_async), this);
+}
+
+bool AsyncEngine::Transmit(I2C_HandleTypeDef &hi2c, uint16_t DevAddress, const uint8_t *pData, uint16_t Size, uint32_t Timeout, Callback callback, void *callback_context, uint8_t delay_after_ms) {
+    return submit_write(Operation::transmit, hi2c, DevAddress, 0, pData, Size, Timeout, callback, callback_context, delay_after_ms);
+}
+
+bool AsyncEngine::Receive(I2C_HandleTypeDef &hi2c, uint16_t DevAddress, uint8_t *pData, uint16_t Size, uint32_t Timeout, Callback callback, void *callback_context, uint8_t delay_after_ms) {
+    return submit_read(Operation::receive, hi2c, DevAddress, 0, pData, Size, Timeout, callback, callback_context, delay_after_ms);
+}
+
+bool AsyncEngine::Mem_Write_8bit_Addr(I2C_HandleTypeDef &hi2c, uint16_t DevAddress, uint8_t MemAddress, const uint8_t *pData, uint16_t Size, uint32_t Timeout, Callback callback, void *callback_context, uint8_t delay_after_ms) {
+    return submit_write(Operation::mem_write_8bit, hi2c, DevAddress, MemAddress, pData, Size, Timeout, callback, callback_context, delay_after_ms);
+}
+
+bool AsyncEngine::Mem_Write_16bit_Addr(I2C_HandleTypeDef &hi2c, uint16_t DevAddress, uint16_t MemAddress, const uint8_t *pData, uint16_t Size, uint32_t Timeout, Callback callback, void *callback_context, uint8_t delay_after_ms) {
+    return submit_write(Operation::mem_write_16bit, hi2c, DevAddress, MemAddress, pData, Size, Timeout, callback, callback_context, delay_after_ms);
+}
+
+bool AsyncEngine::Mem_Read_8bit_Addr(I2C_HandleTypeDef &hi2c, uint16_t DevAddress, uint8_t MemAddress, uint8_t *pData, uint16_t Size, uint32_t Timeout, Callback callback, void *callback_context, uint8_t delay_after_ms) {
+    return submit_read(Operation::mem_read_8bit, hi2c, DevAddress, MemAddress, pData, Size, Timeout, callback, callback_context, delay_after_ms);
+}
+
+bool AsyncEngine::Mem_Read_16bit_Addr(I2C_HandleTypeDef &hi2c, uint16_t DevAddress, uint16_t MemAddress, uint8_t *pData, uint16_t Size, uint32_t Timeout, Callback callback, void *callback_context, uint8_t delay_after_ms) {
+    return submit_read(Operation::mem_read_16bit, hi2c, DevAddress, MemAddress, pData, Size, Timeout, callback, callback_context, delay_after_ms);
+}
+
+bool AsyncEngine::submit_write(Operation operation, I2C_HandleTypeDef &hi2c, uint16_t dev_address, uint16_t mem_address, const uint8_t *data, uint16_t size, uint32_t timeout, Callback callback, void *callback_context, uint8_t delay_after_ms) {
+    if (size > max_write_size) {
+        assert(false && "write payload does not fit into a transaction");
+        return false;
+    }
+
+    Transaction transaction {
+        .hi2c = &hi2c,
+        .callback = callback,
+        .callback_context = callback_context,
+        .read_buffer = nullptr,
+        .timeout_ms = timeout,
+        .dev_address = dev_address,
+        .mem_address = mem_address,
+        .size = size,
+        .delay_after_ms = delay_after_ms,
+        .operation = operation,
+        .write_data = {},
+    };
+    memcpy(transaction.write_data.data(), data, size);
+    return queue.try_send(transaction, 0);
+}
+
+bool AsyncEngine::submit_read(Operation operation, I2C_HandleTypeDef &hi2c, uint16_t dev_address, uint16_t mem_address, uint8_t *buffer, uint16_t size, uint32_t timeout, Callback callback, void *callback_context, uint8_t delay_after_ms) {
+    Transaction transaction {
+        .hi2c = &hi2c,
+        .callback = callback,
+        .callback_context = callback_context,
+        .read_buffer = buffer,
+        .timeout_ms = timeout,
+        .dev_address = dev_address,
+        .mem_address = mem_address,
+        .size = size,
+        .delay_after_ms = delay_after_ms,
+        .operation = operation,
+        .write_data = {},
+    };
+    return queue.try_send(transaction, 0);
+}
+
+void AsyncEngine::thread_routine() {
+    while (true) {
+        Transaction transaction;
+        queue.receive(transaction);
+
+        const Result result = execute(transaction);
+        if (transaction.delay_after_ms) {
+            osDelay(transaction.delay_after_ms);
+        }
+        if (transaction.callback) {
+            transaction.callback(result, transaction.callback_context);
+        }
+    }
+}
+
+Result AsyncEngine::execute(const Transaction &transaction) {
+    switch (transaction.operation) {
+    case Operation::transmit:
+        return i2c::Transmit(*transaction.hi2c, transaction.dev_address, const_cast<uint8_t *>(transaction.write_data.data()), transaction.size, transaction.timeout_ms);
+    case Operation::receive:
+        return i2c::Receive(*transaction.hi2c, transaction.dev_address, transaction.read_buffer, transaction.size, transaction.timeout_ms);
+    case Operation::mem_write_8bit:
+        return i2c::Mem_Write_8bit_Addr(*transaction.hi2c, transaction.dev_address, transaction.mem_address, const_cast<uint8_t *>(transaction.write_data.data()), transaction.size, transaction.timeout_ms);
+    case Operation::mem_read_8bit:
+        return i2c::Mem_Read_8bit_Addr(*transaction.hi2c, transaction.dev_address, transaction.mem_address, transaction.read_buffer, transaction.size, transaction.timeout_ms);
+    case Operation::mem_write_16bit:
+        return i2c::Mem_Write_16bit_Addr(*transaction.hi2c, transaction.dev_address, transaction.mem_address, const_cast<uint8_t *>(transaction.write_data.data()), transaction.size, transaction.timeout_ms);
+    case Operation::mem_read_16bit:
+        return i2c::Mem_Read_16bit_Addr(*transaction.hi2c, transaction.dev_address, transaction.mem_address, transaction.read_buffer, transaction.size, transaction.timeout_ms);
+    }
+    assert(false);
+    return Result::error;
+}
+
+} // namespace i2c
@@ -0,0 +1,104 @@
+#pragma once
+
+#include "i2c.hpp"
+
+#include <array>
+#include <freertos/queue.hpp>
+
+namespace i2c {
+
+/// Asynchronous transaction queue on top of the blocking transfer functions.
+///
+/// The transfers themselves stay synchronous: the I2C DMA requests of this
+/// MCU live exclusively on DMA1 and all of its streams already belong to
+/// other peripherals, so there is no stream left to move the bytes in the
+/// background. What can be taken off the callers is the waiting - a
+/// transaction is submitted into a queue and a dedicated worker task runs
+/// the (possibly retried) transfer and the completion callback, so the
+/// submitting task never sits in the transfer and retry loops itself.
+///
+/// Transactions execute strictly in submission order, which gives per-device
+/// sequencing for free: two writes to the same device never reorder and a
+/// read submitted after a write observes its effect.
+class AsyncEngine {
+public:
+    /// Completion callback; runs on the engine worker task, so keep it short
+    /// and never submit blocking work from it.
+    using Callback = void (*)(Result result, void *context);
+
+    /// Write payloads are copied into the transaction, so the submitter may
+    /// fire and forget. Covers the register writes of the devices sharing
+    /// the buses; anything larger has to stay on the blocking calls.
+    static constexpr size_t max_write_size = 8;
+
+    /// Returns the engine; the worker task is created on the first use
+    static AsyncEngine &instance();
+
+    /// Each of the submissions below mirrors its blocking namesake in
+    /// i2c.hpp. It returns false when the transaction queue is full - the
+    /// transaction is not enqueued, no callback will ever run and the caller
+    /// shall fall back to the blocking call or retry later.
+    ///
+    /// \param callback invoked on the worker with the transfer result
+    /// \param delay_after_ms pause on the worker after the transfer, before
+    ///        the callback and the next transaction - for devices that need
+    ///        a settle gap between the phases of a composite operation
+    [[nodiscard]] bool Transmit(I2C_HandleTypeDef &hi2c, uint16_t DevAddress, const uint8_t *pData, uint16_t Size, uint32_t Timeout, Callback callback = nullptr, void *callback_context = nullptr, uint8_t delay_after_ms = 0);
+
+    /// \param pData has to stay valid until the callback runs
+    [[nodiscard]] bool Receive(I2C_HandleTypeDef &hi2c, uint16_t DevAddress, uint8_t *pData, uint16_t Size, uint32_t Timeout, Callback callback = nullptr, void *callback_context = nullptr, uint8_t delay_after_ms = 0);
+
+    [[nodiscard]] bool Mem_Write_8bit_Addr(I2C_HandleTypeDef &hi2c, uint16_t DevAddress, uint8_t MemAddress, const uint8_t *pData, uint16_t Size, uint32_t Timeout, Callback callback = nullptr, void *callback_context = nullptr, uint8_t delay_after_ms = 0);
+    [[nodiscard]] bool Mem_Write_16bit_Addr(I2C_HandleTypeDef &hi2c, uint16_t DevAddress, uint16_t MemAddress, const uint8_t *pData, uint16_t Size, uint32_t Timeout, Callback callback = nullptr, void *callback_context = nullptr, uint8_t delay_after_ms = 0);
+
+    /// \param pData has to stay valid until the callback runs
+    [[nodiscard]] bool Mem_Read_8bit_Addr(I2C_HandleTypeDef &hi2c, uint16_t DevAddress, uint8_t MemAddress, uint8_t *pData, uint16_t Size, uint32_t Timeout, Callback callback = nullptr, void *callback_context = nullptr, uint8_t delay_after_ms = 0);
+
+    /// \param pData has to stay valid until the callback runs
+    [[nodiscard]] bool Mem_Read_16bit_Addr(I2C_HandleTypeDef &hi2c, uint16_t DevAddress, uint16_t MemAddress, uint8_t *pData, uint16_t Size, uint32_t Timeout, Callback callback = nullptr, void *callback_context = nullptr, uint8_t delay_after_ms = 0);
+
+private:
+    enum class Operation : uint8_t {
+        transmit,
+        receive,
+        mem_write_8bit,
+        mem_read_8bit,
+        mem_write_16bit,
+        mem_read_16bit,
+    };
+
+    struct Transaction {
+        I2C_HandleTypeDef *hi2c;
+        Callback callback;
+        void *callback_context;
+        uint8_t *read_buffer; ///< reads target the submitter's buffer
+        uint32_t timeout_ms;
+        uint16_t dev_address;
+        uint16_t mem_address;
+        uint16_t size;
+        uint8_t delay_after_ms;
+        Operation operation;
+        std::array<uint8_t, max_write_size> write_data; ///< writes carry their payload
+    };
+
+    static constexpr size_t queue_size = 8;
+
+    AsyncEngine();
+
+    [[nodiscard]] bool submit_write(Operation operation, I2C_HandleTypeDef &hi2c, uint16_t dev_address, uint16_t mem_address, const uint8_t *data, uint16_t size, uint32_t timeout, Callback callback, void *callback_context, uint8_t delay_after_ms);
+    [[nodiscard]] bool submit_read(Operation operation, I2C_HandleTypeDef &hi2c, uint16_t dev_address, uint16_t mem_address, uint8_t *buffer, uint16_t size, uint32_t timeout, Callback callback, void *callback_context, uint8_t delay_after_ms);
+
+    /// Routine of the worker task
+    void thread_routine();
+
+    /// Runs the blocking transfer of \p transaction
+    Result execute(const Transaction &transaction);
+
+    freertos::Queue<Transaction, queue_size> queue;
+
+    osStaticThreadDef_t thread_def;
+    osThreadId thread_id;
+    std::array<uint32_t, 512> thread_stack;
+};
+
+} // namespace i2c
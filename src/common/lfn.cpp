@@ -3,11 +3,82 @@
 #include <cassert>
 #include <cstring>
 #include <dirent.h>
+#include <mutex>
 
 #include <bsod.h>
+#include <buddy/filesystem_fatfs.h>
+#include <file_list_defs.h>
+#include <freertos/mutex.hpp>
 
 namespace {
 
+/*
+ * Memo of recently resolved LFNs.
+ *
+ * Resolving an LFN means scanning the whole parent directory (see
+ * search_file below) and the callers tend to ask about the same file
+ * repeatedly - every redraw of a print preview, for example. The FatFS
+ * stat cache generation tells us when the filesystem could have changed;
+ * entries from older generations are simply not trusted anymore.
+ *
+ * Only /usb paths are memoized, the generation doesn't track other
+ * filesystems (and those are not backed by slow directory scans anyway).
+ */
+struct LfnMemo {
+    char path[FILE_PATH_BUFFER_LEN];
+    char lfn[FILE_NAME_BUFFER_LEN];
+    uint32_t generation;
+    uint32_t last_used;
+    bool valid;
+};
+
+constexpr size_t memo_count = 4;
+LfnMemo memos[memo_count];
+uint32_t memo_use_counter = 0;
+freertos::Mutex memo_mutex;
+
+bool memo_lookup(const char *path, char *lfn, size_t lfn_size) {
+    if (strncasecmp(path, "/usb/", 5) != 0) {
+        return false;
+    }
+    const uint32_t generation = filesystem_fatfs_cache_generation();
+    std::unique_lock lock(memo_mutex);
+    for (LfnMemo &memo : memos) {
+        // Case-insensitive, it's FAT, after all.
+        if (memo.valid && memo.generation == generation && strcasecmp(memo.path, path) == 0) {
+            memo.last_used = ++memo_use_counter;
+            strlcpy(lfn, memo.lfn, lfn_size);
+            return true;
+        }
+    }
+    return false;
+}
+
+void memo_insert(const char *path, const char *lfn) {
+    if (strncasecmp(path, "/usb/", 5) != 0
+        || strlen(path) >= sizeof(LfnMemo::path)
+        || strlen(lfn) >= sizeof(LfnMemo::lfn)) {
+        return;
+    }
+    const uint32_t generation = filesystem_fatfs_cache_generation();
+    std::unique_lock lock(memo_mutex);
+    LfnMemo *victim = &memos[0];
+    for (LfnMemo &memo : memos) {
+        if (!memo.valid || memo.generation != generation) {
+            victim = &memo;
+            break;
+        }
+        if (memo.last_used < victim->last_used) {
+            victim = &memo;
+        }
+    }
+    strlcpy(victim->path, path, sizeof(victim->path));
+    strlcpy(victim->lfn, lfn, sizeof(victim->lfn));
+    victim->generation = generation;
+    victim->last_used = ++memo_use_counter;
+    victim->valid = true;
+}
+
 template <class C>
 void search_file(char *path, C &&callback) {
     /*
@@ -57,9 +128,15 @@ void search_file(char *path, C &&callback) {
 } // namespace
 
 void get_LFN(char *lfn, size_t lfn_size, char *path) {
+    if (memo_lookup(path, lfn, lfn_size)) {
+        return;
+    }
     search_file(path, [&](char *fname, struct dirent *ent) {
         if (ent != nullptr) {
             strlcpy(lfn, ent->lfn, lfn_size);
+            // Memoize the untruncated name, the next caller may have a
+            // bigger buffer than this one.
+            memo_insert(path, ent->lfn);
         } else {
             strlcpy(lfn, fname, lfn_size);
         }
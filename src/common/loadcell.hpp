@@ -188,6 +188,13 @@ private:
     };
 
     /// Implements IIR bandpass filter
+    ///
+    /// The filter is designed in floating point (see PARAM), but runs in
+    /// fixed-point arithmetic: it is fed every HX717 sample from a high-rate
+    /// context and integer multiply-accumulate is considerably cheaper there
+    /// than the float recursion. The scaling constants below are derived at
+    /// compile time from the configured gain and conversion back to float
+    /// happens only in get_output(), i.e. it is paid by the consumers.
     template <typename PARAM>
     class BandPassFilter {
     public:
@@ -219,6 +226,39 @@ private:
          */
         static constexpr size_t SETTLING_TIME = PARAM::settling_time;
 
+        /// Fractional bits the xv/yv state is kept with.
+        /// Raw samples are 24bit, so a 32bit significand still leaves 8
+        /// fractional bits even for a railed sensor - more precision than the
+        /// 24bit significand the float version had for large states.
+        static constexpr int STATE_SHIFT = 8;
+
+        /// Fractional bits of the A coefficients.
+        /// |A| < 8, so Q24 fits an int32_t while quantizing the coefficients
+        /// no coarser than their float representation. Keeps every
+        /// coefficient*state product (and their sum) well within int64_t.
+        static constexpr int COEFF_SHIFT = 24;
+
+        /// Shift of INPUT_MUL on top of STATE_SHIFT
+        static constexpr int INPUT_SHIFT = 32;
+
+        /// Round a coefficient to the given Q format
+        static constexpr int64_t to_fixed(double value, int shift) {
+            return static_cast<int64_t>(value * static_cast<double>(int64_t(1) << shift) + (value >= 0 ? 0.5 : -0.5));
+        }
+
+        /// A coefficients in Q24, A_FIXED[0] is unused (it is 1 by design)
+        static constexpr std::array<int32_t, NPOLES + 1> A_FIXED = []() {
+            std::array<int32_t, NPOLES + 1> fixed {};
+            for (size_t i = 0; i < fixed.size(); ++i) {
+                fixed[i] = static_cast<int32_t>(to_fixed(A[i], COEFF_SHIFT));
+            }
+            return fixed;
+        }();
+
+        /// 1/GAIN premultiplied so that (input * INPUT_MUL) >> INPUT_SHIFT
+        /// yields the input sample divided by the gain in the state Q format
+        static constexpr int64_t INPUT_MUL = to_fixed(1.0 / GAIN, INPUT_SHIFT + STATE_SHIFT);
+
         BandPassFilter() {
             reset();
         }
@@ -229,7 +269,7 @@ private:
             samples = 0;
         }
 
-        inline float filter(float input) {
+        inline void filter(int32_t input) {
             static_assert(NZEROS == 4, "This code works only for NZEROS == 4");
             static_assert(NPOLES == 4, "This code works only for NPOLES == 4");
             static_assert(A[0] == 1, "This code works only A[0] == 1");
@@ -241,17 +281,18 @@ private:
             xv[1] = xv[2];
             xv[2] = xv[3];
             xv[3] = xv[4];
-            xv[4] = input / GAIN;
+            xv[4] = static_cast<int32_t>((static_cast<int64_t>(input) * INPUT_MUL) >> INPUT_SHIFT);
             yv[0] = yv[1];
             yv[1] = yv[2];
             yv[2] = yv[3];
             yv[3] = yv[4];
-            yv[4] = xv[0] + -2 * xv[2] + xv[4] - A[4] * yv[0] - A[3] * yv[1] - A[2] * yv[2] - A[1] * yv[3];
-            return yv[4];
+            yv[4] = ((static_cast<int64_t>(xv[0] + -2 * xv[2] + xv[4]) << COEFF_SHIFT)
+                        - A_FIXED[4] * yv[0] - A_FIXED[3] * yv[1] - A_FIXED[2] * yv[2] - A_FIXED[1] * yv[3])
+                >> COEFF_SHIFT;
         }
 
         inline float get_output() const {
-            return yv[std::size(yv) - 1];
+            return static_cast<float>(yv[std::size(yv) - 1]) * (1.0f / (1 << STATE_SHIFT));
         }
 
         inline bool settled() const {
@@ -259,8 +300,8 @@ private:
         }
 
     private:
-        float xv[NZEROS + 1];
-        float yv[NPOLES + 1];
+        int32_t xv[NZEROS + 1]; ///< Input history, gain-corrected, Q STATE_SHIFT
+        int64_t yv[NPOLES + 1]; ///< Output history, Q STATE_SHIFT
         unsigned int samples; ///< Samples fed until SETTLING_TIME is reached
     };
 
@@ -0,0 +1,66 @@
+#include "loop_latency_monitor.hpp"
+#include "metric.h"
+#include "timing.h"
+
+#include <algorithm>
+#include <bit>
+#include <cinttypes>
+
+namespace buddy {
+
+void LoopLatencyMonitor::tick() {
+    const uint32_t now_us = ticks_us();
+    const uint32_t now_ms = ticks_ms();
+
+    if (!primed) {
+        primed = true;
+        last_tick_us = now_us;
+        last_report_ms = now_ms;
+        return;
+    }
+
+    const uint32_t delta_us = now_us - last_tick_us;
+    last_tick_us = now_us;
+    window_max_us = std::max(window_max_us, delta_us);
+
+    // delta_us >> 10 approximates milliseconds well enough for binning
+    const size_t bucket = std::min<size_t>(std::bit_width(delta_us >> 10), bucket_count - 1);
+    if (histogram[bucket] < UINT16_MAX) {
+        histogram[bucket]++;
+    }
+
+    if (now_ms - last_report_ms >= report_interval_ms) {
+        report(now_ms);
+    }
+}
+
+void LoopLatencyMonitor::report(uint32_t now_ms) {
+    uint32_t total = 0;
+    for (const auto count : histogram) {
+        total += count;
+    }
+
+    if (total > 0) {
+        // Smallest bucket upper bound under which 99 % of the iterations fit
+        const uint32_t p99_rank = total - total / 100;
+        uint32_t cumulative = 0;
+        size_t p99_bucket = bucket_count - 1;
+        for (size_t i = 0; i < bucket_count; i++) {
+            cumulative += histogram[i];
+            if (cumulative >= p99_rank) {
+                p99_bucket = i;
+                break;
+            }
+        }
+        const uint32_t p99_us = (1u << p99_bucket) * 1024u;
+
+        METRIC_DEF(loop_latency, "loop_lat", METRIC_VALUE_CUSTOM, 0, METRIC_ENABLED);
+        metric_record_custom(&loop_latency, ",n=%s p99=%" PRIu32 "i,max=%" PRIu32 "i,cnt=%" PRIu32 "i", task_name, p99_us, window_max_us, total);
+    }
+
+    last_report_ms = now_ms;
+    window_max_us = 0;
+    histogram = {};
+}
+
+} // namespace buddy
@@ -0,0 +1,44 @@
+/// @file
+/// Lightweight per-task loop latency watchdog.
+///
+/// Each instrumented task keeps one monitor and calls tick() once per
+/// iteration of its main loop. The monitor bins the time between ticks into a
+/// power-of-two histogram and periodically exports the p99 and maximum of the
+/// window as a metric, so fleet data can pinpoint which task misses its
+/// deadlines under which workload.
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+namespace buddy {
+
+class LoopLatencyMonitor {
+public:
+    /// \param task_name metric tag; keep it short, it goes out with every record
+    explicit LoopLatencyMonitor(const char *task_name)
+        : task_name(task_name) {}
+
+    /// To be called once per main loop iteration, from the monitored task only
+    void tick();
+
+private:
+    /// Bucket \c i holds iterations that took less than 2^i ms; the last one takes everything longer
+    static constexpr size_t bucket_count { 12 };
+
+    /// How often the histogram window is exported and reset
+    static constexpr uint32_t report_interval_ms { 5009 };
+
+    void report(uint32_t now_ms);
+
+private:
+    const char *task_name;
+    uint32_t last_tick_us { 0 };
+    uint32_t last_report_ms { 0 };
+    uint32_t window_max_us { 0 };
+    bool primed { false };
+    std::array<uint16_t, bucket_count> histogram {};
+};
+
+} // namespace buddy
@@ -42,6 +42,8 @@ typedef struct _marlin_client_t {
     uint32_t command; // processed command (G28,G29,M701,M702,M600)
     message_cb_t message_cb; // to register callback message
     uint8_t id; // client id (0..MARLIN_MAX_CLIENTS-1)
+    uint8_t batch_nesting; // depth of nested RequestBatch scopes
+    bool batch_pending; // a batched request was submitted and needs the closing fence
 } marlin_client_t;
 
 //-----------------------------------------------------------------------------
@@ -145,11 +147,25 @@ static bool try_send(Request &request) {
     }
 }
 
+/// Requests the server always processes successfully may skip their
+/// acknowledge round trip inside a batch; gcode enqueue can be refused when
+/// the gcode queue is full and needs the acknowledge/retry loop.
+static bool is_batchable(const Request &request) {
+    return request.type != Request::Type::Gcode;
+}
+
 static void _send_request_to_server_and_wait(Request &request) {
     marlin_client_t *client = _client_ptr();
     if (client == nullptr) {
         return;
     }
+    if (client->batch_nesting && is_batchable(request)) {
+        request.client_id = client->id;
+        request.response_required = 0;
+        server_queue.send(request);
+        client->batch_pending = true;
+        return;
+    }
     uint8_t retries_left = max_retries;
     do {
         if (try_send(request)) {
@@ -174,6 +190,29 @@ static void _send_request_to_server_noreply(Request &request) {
     server_queue.send(request);
 }
 
+RequestBatch::RequestBatch() {
+    marlin_client_t *client = _client_ptr();
+    if (client == nullptr) {
+        bsod("Marlin client used before init");
+    }
+    ++client->batch_nesting;
+}
+
+RequestBatch::~RequestBatch() {
+    marlin_client_t *client = _client_ptr();
+    if (client == nullptr) {
+        return;
+    }
+    if (--client->batch_nesting > 0 || !client->batch_pending) {
+        return;
+    }
+    client->batch_pending = false;
+    // a single fence round trip acknowledges everything batched above
+    Request request;
+    request.type = Request::Type::BatchSync;
+    _send_request_to_server_and_wait(request);
+}
+
 void set_event_notify(uint64_t event_mask) {
     Request request;
     request.type = Request::Type::EventMask;
@@ -246,10 +285,10 @@ void gcode_printf(const char *format, ...) {
     }
 }
 
-void inject(InjectQueueRecord record) {
+void inject(InjectQueueRecord record, InjectPriority priority) {
     Request request;
     request.type = Request::Type::Inject;
-    request.inject = record;
+    request.inject = { record, priority };
     _send_request_to_server_and_wait(request);
 }
 
@@ -37,6 +37,27 @@ void set_event_notify(uint64_t notify_events);
 // returns currently running command or marlin_server::Cmd::NONE
 marlin_server::Cmd get_command();
 
+/**
+ * @brief Batches requests issued from the current task while alive.
+ *
+ * Requests that cannot be refused by the server (variable setters, inject,
+ * babystep, ...) are enqueued without waiting for their individual
+ * acknowledgements; the destructor submits a single fence request and waits
+ * for its acknowledge, so one notification round trip covers the whole batch.
+ * Once the destructor returns, all batched requests have been processed.
+ * Requests that may be refused (gcode enqueue) keep their own
+ * acknowledge/retry round trip even inside a batch. May be nested.
+ */
+class RequestBatch {
+public:
+    [[nodiscard]] RequestBatch();
+    ~RequestBatch();
+
+private:
+    RequestBatch &operator=(const RequestBatch &) = delete;
+    RequestBatch(const RequestBatch &) = delete;
+};
+
 // enqueue gcode - thread-safe version
 void gcode(const char *gcode);
 
@@ -56,10 +77,10 @@ void __attribute__((format(__printf__, 1, 2)))
 gcode_printf(const char *format, ...);
 
 // inject gcode - thread-safe version
-void inject(InjectQueueRecord record);
+void inject(InjectQueueRecord record, InjectPriority priority = InjectPriority::background);
 
 // inject gcode directly - thread-safe version
-inline void inject(ConstexprString gcode) { inject(GCodeLiteral(gcode)); };
+inline void inject(ConstexprString gcode, InjectPriority priority = InjectPriority::background) { inject(GCodeLiteral(gcode), priority); };
 
 // returns current event status for evt_id
 int event(marlin_server::Event evt_id);
@@ -35,7 +35,28 @@ constexpr EventMask make_mask(Event id) {
 }
 
 inline constexpr EventMask EVENT_MSK_ALL = std::numeric_limits<EventMask>::max();
-inline constexpr EventMask EVENT_MSK_DEF = EVENT_MSK_ALL;
+
+// Subscription masks are honored at send time (see _send_notify_event), so an
+// event nobody subscribed to costs no wakeup. The server-side default for a
+// fresh client is Acknowledge only; each client subscribes to the events it
+// actually processes. Direct request responses (ack/nack) bypass the filter.
+
+/// For clients that only issue requests and wait for the result; broadcast
+/// events would just wake them to be thrown away.
+inline constexpr EventMask EVENT_MSK_ACK_ONLY = make_mask(Event::Acknowledge)
+    | make_mask(Event::NotAcknowledge);
+
+/// Events the GUI task consumes. Notably excludes StatusChanged, which fires
+/// for every status line (incl. MMU progress) and no client reads.
+inline constexpr EventMask EVENT_MSK_GUI = make_mask(Event::MediaInserted)
+    | make_mask(Event::MediaError)
+    | make_mask(Event::MediaRemoved)
+    | make_mask(Event::CommandBegin)
+    | make_mask(Event::CommandEnd)
+    | make_mask(Event::Message)
+    | make_mask(Event::RequestCalibrationsScreen)
+    | make_mask(Event::Acknowledge)
+    | make_mask(Event::NotAcknowledge);
 
 // commands
 enum class Cmd : uint32_t {
@@ -454,16 +454,14 @@ PrintPreview::Result PrintPreview::Loop() {
             // The file is not fully downloaded, wait till we have downloaded enough for printing
             ChangeState(State::download_wait);
             break;
-
-        } else if (!gcode_info.is_loaded()) {
-            // Wait for the gcode info to fully load
-            break;
         }
 
+        // Make sure we have the prefetch buffer full before starting the print.
+        // Deliberately checked before waiting for the info scan: the prefetch
+        // runs on its own thread, so issuing the fetch now lets the buffer fill
+        // while the scan is still reading metadata instead of after it.
         const auto prefetch_ready = marlin_server::media_prefetch.check_ready_to_start_print();
         if (prefetch_ready == MediaPrefetchManager::ReadyToStartPrintResult::needs_fetching) {
-            // Make sure we have the prefetch buffer full before start the print
-            // If we got into the "downloading" phase, do the prefetch checking here, because we're waiting for the file to download more
             marlin_server::media_prefetch.issue_fetch();
             break;
 
@@ -474,6 +472,11 @@ PrintPreview::Result PrintPreview::Loop() {
             break;
         }
 
+        if (!gcode_info.is_loaded()) {
+            // Prefetch is ready, wait for the gcode info to fully load
+            break;
+        }
+
         // We're ready to print now
         ChangeState((skip_if_able > marlin_server::PreviewSkipIfAble::no) ? stateFromSelftestCheck() : State::preview_wait_user);
         break;
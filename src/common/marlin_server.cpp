@@ -6,6 +6,7 @@
 #include "marlin_server_request.hpp"
 #include <inttypes.h>
 #include <stdarg.h>
+#include <atomic>
 #include <cstdint>
 #include <stdio.h>
 #include <string.h> //strncmp
@@ -20,8 +21,10 @@
 #include "module/prusa/spool_join.hpp"
 #include "print_utils.hpp"
 #include "random.h"
+#include "loop_latency_monitor.hpp"
 #include "timing.h"
 #include "cmsis_os.h"
+#include <device/cmsis.h>
 #include <logging/log.hpp>
 #include <bsod_gui.hpp>
 #include <usb_host.h>
@@ -191,7 +194,6 @@ namespace {
         uint32_t paused_ticks; // tick count in moment when printing paused
         resume_state_t resume; // resume data (state before pausing)
         bool enable_nozzle_temp_timeout; // enables nozzle temperature timeout in print pause
-        uint32_t last_update; // last update tick count
         uint32_t command; // actually running command
         uint32_t command_begin; // variable for notification
         uint32_t command_end; // variable for notification
@@ -534,9 +536,18 @@ constexpr EncodedFSMResponse empty_encoded_fsm_response = {
 static EncodedFSMResponse server_side_encoded_fsm_response = empty_encoded_fsm_response;
 
 void _add_status_msg(const char *const popup_msg) {
-    // I could check client mask here
     for (size_t i = 0; i < MARLIN_MAX_CLIENTS; ++i) {
+        // Don't bother copying for clients that don't subscribe to
+        // Event::Message; typically only the GUI does, so one copy per message
+        if (!(server.notify_events[i] & make_mask(Event::Message))) {
+            continue;
+        }
         if (server.event_messages[i]) {
+            // Same message still pending (MMU progress and friends repeat a
+            // lot) -> keep the existing allocation
+            if (strcmp(server.event_messages[i], popup_msg) == 0) {
+                continue;
+            }
             // FIXME: It would be great if we didn't lose messages there.
             //        For now, let's keep the original implementation.
             free(server.event_messages[i]);
@@ -581,30 +592,70 @@ void init(void) {
     // after a reboot.
     fsm_states.generation = rand_u();
 
-    marlin_vars().init();
 #if HAS_SHEET_PROFILES()
     SteelSheets::CheckIfCurrentValid();
 #endif
     settings_load();
 }
 
+// The server loop runs several periodic jobs, each of which used to keep its
+// own "static last tick + compare" bookkeeping with a different flavour of
+// wrap handling. This helper centralizes the idiom: wrap-safe via ticks_diff,
+// and every firing records how far past its deadline the loop actually got to
+// it. The worst slack per window is reported through the "srv_slack" metric,
+// so a starved server loop shows up in telemetry instead of being chased as a
+// missed-deadline bug. A handful of deadlines does not warrant more machinery
+// than this - each pass costs one tick read and compare per deadline.
+static uint32_t deadline_window_max_slack_ms = 0;
+
+class PeriodicDeadline {
+public:
+    constexpr explicit PeriodicDeadline(uint32_t period_ms = 0)
+        : period_ms(period_ms) {}
+
+    /// @return true when the period elapsed; advances the deadline and records the slack
+    bool due() {
+        return due(period_ms);
+    }
+
+    /// Variant for periods configurable at runtime (auto-reports)
+    bool due(uint32_t current_period_ms) {
+        const uint32_t now = ticks_ms();
+        if (!primed) {
+            // first check fires right away, without polluting the slack stats
+            primed = true;
+            last_ms = now;
+            return true;
+        }
+        const int32_t over = ticks_diff(now, last_ms + current_period_ms);
+        if (over < 0) {
+            return false;
+        }
+        if (static_cast<uint32_t>(over) > deadline_window_max_slack_ms) {
+            deadline_window_max_slack_ms = over;
+        }
+        last_ms = now;
+        return true;
+    }
+
+private:
+    uint32_t period_ms;
+    uint32_t last_ms = 0;
+    bool primed = false;
+};
+
 void print_fan_spd() {
-    static uint32_t last_fan_report = 0;
-    uint32_t current_time = ticks_s();
-    if (M123::fan_auto_report_delay && (current_time - last_fan_report) >= M123::fan_auto_report_delay) {
+    static PeriodicDeadline fan_report_deadline;
+    if (M123::fan_auto_report_delay && fan_report_deadline.due(M123::fan_auto_report_delay * 1000)) {
         M123::print_fan_speed();
-        last_fan_report = current_time;
     }
 }
 
 #if HAS_NFC()
 
 void handle_nfc() {
-    static uint32_t last_check = 0;
-    const uint32_t current_time = ticks_ms();
-    if (last_check > current_time || (current_time - last_check) >= nfc::OPTIMAL_CHECK_DIFF_MS) {
-        last_check = current_time;
-
+    static PeriodicDeadline check_deadline { nfc::OPTIMAL_CHECK_DIFF_MS };
+    if (check_deadline.due()) {
         if (nfc::has_activity()) {
             if (const std::optional<WifiCredentials> wifi_credentials = nfc::consume_data()) {
                 network_wizard::network_nfc_wizard(*wifi_credentials);
@@ -639,9 +690,8 @@ void safely_unload_filament_from_nozzle_to_mmu() {
 #endif
 
 void server_update_vars() {
-    uint32_t tick = ticks_ms();
-    if ((tick - server.last_update) > MARLIN_UPDATE_PERIOD) {
-        server.last_update = tick;
+    static PeriodicDeadline update_deadline { MARLIN_UPDATE_PERIOD };
+    if (update_deadline.due()) {
         _server_update_vars();
     }
 }
@@ -669,38 +719,139 @@ static uint8_t io_expander_button_trigger_check(uint8_t pin_states, uint8_t pin_
     return triggered_buttons;
 }
 
+// Hand-over of the asynchronously read Input register from the i2c engine
+// worker to the loop below, so the server loop never blocks on the bus
+static uint8_t io_expander_pin_states;
+static std::atomic<bool> io_expander_read_pending = false;
+static std::atomic<bool> io_expander_read_ready = false;
+
+static void io_expander_read_done(i2c::Result result, void *) {
+    if (result == i2c::Result::ok) {
+        io_expander_read_ready = true;
+    }
+    io_expander_read_pending = false;
+}
+
 void io_expander_read_loop() {
     if (!buddy::hw::io_expander2.is_initialized()) {
         return;
     }
-    if (uint8_t pin_mask = config_store().io_expander_config_register.get()) {
-        static constexpr int32_t io_expander_read_loop_delay_ms = 500;
-        static uint32_t last_tick_ms = ticks_ms();
-        uint32_t tick_ms = ticks_ms();
-        if (ticks_diff(tick_ms, last_tick_ms) >= io_expander_read_loop_delay_ms) {
-            if (const auto value = buddy::hw::io_expander2.read(pin_mask)) {
-
-                // Debouncing mechanism - after pressing a button, there have to be at least one released state before button can be pressed again
-                uint8_t pressed_buttons_mask = io_expander_button_trigger_check(*value, pin_mask);
-
-                for (uint8_t pin_number = 0; pin_number < buddy::hw::TCA6408A::pin_count; pin_number++) {
-                    // Create a mask and extract the pin from the pressed_buttons_mask
-                    const uint8_t single_pin_mask = 0x1 << pin_number;
-
-                    if (pin_mask & single_pin_mask & pressed_buttons_mask) {
-                        if (!inject(GCodeMacroButton(pin_number))) {
-                            SERIAL_ECHOLIST("Injecting Macro Button failed, pin: ", pin_number);
-                        }
-                    }
+
+    // Process the read started in an earlier pass
+    if (io_expander_read_ready.exchange(false)) {
+        const uint8_t pin_mask = config_store().io_expander_config_register.get();
+
+        // Debouncing mechanism - after pressing a button, there have to be at least one released state before button can be pressed again
+        uint8_t pressed_buttons_mask = io_expander_button_trigger_check(io_expander_pin_states & pin_mask, pin_mask);
+
+        for (uint8_t pin_number = 0; pin_number < buddy::hw::TCA6408A::pin_count; pin_number++) {
+            // Create a mask and extract the pin from the pressed_buttons_mask
+            const uint8_t single_pin_mask = 0x1 << pin_number;
+
+            if (pin_mask & single_pin_mask & pressed_buttons_mask) {
+                if (!inject(GCodeMacroButton(pin_number))) {
+                    SERIAL_ECHOLIST("Injecting Macro Button failed, pin: ", pin_number);
                 }
             }
-            last_tick_ms = tick_ms;
+        }
+    }
+
+    if (config_store().io_expander_config_register.get() != 0) {
+        static PeriodicDeadline read_deadline { 500 };
+        // pending is checked first so a blocked read does not consume the deadline
+        if (!io_expander_read_pending && read_deadline.due()) {
+            io_expander_read_pending = true;
+            if (!buddy::hw::io_expander2.read_reg_async(buddy::hw::TCA6408A::Register::Input, io_expander_pin_states, io_expander_read_done, nullptr)) {
+                io_expander_read_pending = false; // engine queue full, try again next pass
+            }
         }
     }
 }
 #endif // HAS_I2C_EXPANDER()
 
+// Per-section time accounting for cycle(). A DWT->CYCCNT delta costs a few
+// instructions, so every pass is accounted; the cycle counter is enabled at
+// boot in main(). A one second window is reported via the "srv_cycle" metric
+// as permille of the accounted time per section, totals since boot can be
+// dumped with M9160.
+enum class CycleSection : uint8_t {
+    background, ///< chamber/emergency stop/xBuddy extension steps
+    fsm_loops, ///< selftest & MMU FSM loops, warnings, enclosure
+    print_loop, ///< _server_print_loop
+    periphery, ///< FSM notifier, print fan, toolchanger, IO expander
+    requests, ///< client request queue drain
+    notifications, ///< notifications to clients, marlin_vars update
+    _count
+};
+
+static constexpr const char *cycle_section_names[] = {
+    "background",
+    "fsm_loops",
+    "print_loop",
+    "periphery",
+    "requests",
+    "notifications",
+};
+static_assert(std::size(cycle_section_names) == ftrstd::to_underlying(CycleSection::_count));
+
+static std::array<uint32_t, ftrstd::to_underlying(CycleSection::_count)> cycle_window_cycles {};
+static std::array<uint64_t, ftrstd::to_underlying(CycleSection::_count)> cycle_total_cycles {};
+
+METRIC_DEF(metric_srv_cycle, "srv_cycle", METRIC_VALUE_CUSTOM, 0, METRIC_DISABLED);
+METRIC_DEF(metric_srv_slack, "srv_slack", METRIC_VALUE_INTEGER, 0, METRIC_DISABLED);
+
+static void report_cycle_sections() {
+    static PeriodicDeadline report_deadline { 1000 };
+    if (!report_deadline.due()) {
+        return;
+    }
+
+    // worst deadline overshoot seen across all periodic server jobs this window
+    metric_record_integer(&metric_srv_slack, deadline_window_max_slack_ms);
+    deadline_window_max_slack_ms = 0;
+
+    uint64_t window_total = 0;
+    for (const uint32_t cycles : cycle_window_cycles) {
+        window_total += cycles;
+    }
+    if (window_total) {
+        // permille of the accounted window; fits the custom value buffer,
+        // unlike six absolute cycle counts
+        const auto pm = [&](CycleSection section) -> uint32_t {
+            return static_cast<uint64_t>(cycle_window_cycles[ftrstd::to_underlying(section)]) * 1000 / window_total;
+        };
+        metric_record_custom(&metric_srv_cycle, " b=%" PRIu32 "i,f=%" PRIu32 "i,p=%" PRIu32 "i,e=%" PRIu32 "i,r=%" PRIu32 "i,n=%" PRIu32 "i",
+            pm(CycleSection::background), pm(CycleSection::fsm_loops), pm(CycleSection::print_loop),
+            pm(CycleSection::periphery), pm(CycleSection::requests), pm(CycleSection::notifications));
+    }
+    cycle_window_cycles = {};
+}
+
+void dump_cycle_time_accounting() {
+    uint64_t total = 0;
+    for (const uint64_t cycles : cycle_total_cycles) {
+        total += cycles;
+    }
+    const uint32_t cycles_per_ms = SystemCoreClock / 1000;
+    for (size_t i = 0; i < cycle_total_cycles.size(); ++i) {
+        char buffer[64];
+        snprintf(buffer, sizeof(buffer), "%s: %" PRIu32 " ms (%" PRIu32 " %%)",
+            cycle_section_names[i],
+            static_cast<uint32_t>(cycle_total_cycles[i] / cycles_per_ms),
+            total ? static_cast<uint32_t>(cycle_total_cycles[i] * 100 / total) : 0);
+        SERIAL_ECHOLN(buffer);
+    }
+}
+
 static void cycle() {
+    uint32_t section_start = DWT->CYCCNT;
+    const auto account = [&section_start](CycleSection section) {
+        const uint32_t now = DWT->CYCCNT;
+        cycle_window_cycles[ftrstd::to_underlying(section)] += now - section_start;
+        cycle_total_cycles[ftrstd::to_underlying(section)] += now - section_start;
+        section_start = now;
+    };
+
     // Some things are somewhat time-sensitive and should be updated even in nested loops
 #if HAS_CHAMBER_API()
     buddy::chamber().step();
@@ -714,6 +865,8 @@ static void cycle() {
     buddy::xbuddy_extension().step();
 #endif
 
+    account(CycleSection::background);
+
     static bool is_nested = false;
     if (is_nested) {
         return;
@@ -748,10 +901,14 @@ static void cycle() {
 
 #endif
 
+    account(CycleSection::fsm_loops);
+
     if (call_print_loop) {
         _server_print_loop(); // we need call print loop here because it must be processed while blocking commands (M109)
     }
 
+    account(CycleSection::print_loop);
+
     FSM_notifier::SendNotification();
 
     print_fan_spd();
@@ -765,13 +922,26 @@ static void cycle() {
     io_expander_read_loop();
 #endif // HAS_I2C_EXPANDER()
 
-    if (Request request; server_queue.try_receive(request, 0)) {
+    account(CycleSection::periphery);
+
+    // Drain the queue (bounded), so a whole client batch is applied within one
+    // loop pass instead of one request per pass.
+    for (size_t i = 0; i < SERVER_REQUEST_QUEUE_DEPTH; ++i) {
+        Request request;
+        if (!server_queue.try_receive(request, 0)) {
+            break;
+        }
         _process_server_request(request);
     }
 
+    account(CycleSection::requests);
+
     // update variables
     send_notifications_to_clients();
     server_update_vars();
+
+    account(CycleSection::notifications);
+    report_cycle_sections();
 }
 
 void static finalize_print(bool finished) {
@@ -855,6 +1025,9 @@ static void check_crash() {
 #endif // ENABLED(CRASH_RECOVERY)
 
 void loop() {
+    static buddy::LoopLatencyMonitor loop_latency_monitor("marlin");
+    loop_latency_monitor.tick();
+
 #if ANY(CRASH_RECOVERY, POWER_PANIC)
     check_crash();
 #endif
@@ -946,8 +1119,9 @@ static void idle(void) {
 }
 
 void do_babystep_Z(float offs) {
+    // The pending steps are drained by the step ISR, which folds them into
+    // the generated step stream.
     babystep.add_steps(Z_AXIS, std::round(offs * planner.settings.axis_steps_per_mm[Z_AXIS]));
-    babystep.task();
 }
 
 extern void move_axis(float pos, float feedrate, size_t axis) {
@@ -974,8 +1148,8 @@ bool enqueue_gcode_printf(const char *gcode, ...) {
     return ret;
 }
 
-bool inject(InjectQueueRecord record) {
-    if (!queue.inject(record)) {
+bool inject(InjectQueueRecord record, InjectPriority priority) {
+    if (!queue.inject(record, priority)) {
         // TODO: If requested, figure out thread-safe way to call Sound_Play(eSOUND_TYPE::SingleBeepAlwaysLoud);
         return false;
     }
@@ -1156,7 +1330,7 @@ void print_start(const char *filename, const GCodeReaderPosition &resume_pos, ma
 
         // Update marlin vars
         {
-            MarlinVarsLockGuard lock;
+            MarlinVarsWriteGuard lock;
 
             // update media_SFN_path
             strlcpy(marlin_vars().media_SFN_path.get_modifiable_ptr(lock), filepath_sfn.data(), marlin_vars().media_SFN_path.max_length());
@@ -1396,9 +1570,16 @@ void media_print_loop() {
     metric_record_integer(&metric_gcode_queue_size, queue.length);
 
     while (queue.length < MEDIA_FETCH_GCODE_QUEUE_FILL_TARGET) {
-        MediaPrefetchManager::ReadResult data;
+        /// Up to how many commands get pulled from the prefetch under a single lock acquisition.
+        /// Static - this is only ever used from the marlin thread and the borrowed gcodes
+        /// must stay valid until they are enqueued below.
+        static constexpr size_t media_fetch_batch_size = 4;
+        static std::array<MediaPrefetchManager::ReadResult, media_fetch_batch_size> batch;
+
         using Status = MediaPrefetchManager::Status;
-        const Status status = media_prefetch.read_command(data);
+        const size_t batch_target = std::min<size_t>(media_fetch_batch_size, MEDIA_FETCH_GCODE_QUEUE_FILL_TARGET - queue.length);
+        size_t batch_size;
+        const Status status = media_prefetch.read_commands(std::span(batch.data(), batch_target), batch_size);
         const auto metrics = media_prefetch.get_metrics();
 
         /// Status of the last media_prefetch.read_command. 0 = ok, 1 = end of file, other = error (means that we're stalling)
@@ -1443,9 +1624,10 @@ void media_print_loop() {
             SERIAL_ECHOLNPAIR(MSG_SD_FILE_OPENED, marlin_vars().media_SFN_path.get_ptr(), " Size:", metrics.stream_size_estimate);
         }
 
-        switch (status) {
+        // Enqueue whatever we got, even if the batch ended with an error status
+        for (size_t i = 0; i < batch_size; i++) {
+            const auto &data = batch[i];
 
-        case Status::ok:
             if (print_state.skip_gcode) {
                 print_state.skip_gcode = false;
                 continue;
@@ -1455,18 +1637,22 @@ void media_print_loop() {
 
             print_state.media_restore_info = data.replay_pos.restore_info;
             queue.sdpos = data.replay_pos.offset;
-            queue.enqueue_one(data.gcode.data(), false);
-            log_debug(MarlinServer, "Enqueue: %" PRIu32 " %s", data.replay_pos.offset, data.gcode.data());
+            queue.enqueue_one(data.gcode, false);
+            log_debug(MarlinServer, "Enqueue: %" PRIu32 " %s", data.replay_pos.offset, data.gcode);
+
+            if (data.cropped) {
+                set_warning(WarningType::GcodeCropped);
+            }
+        }
+
+        switch (status) {
 
+        case Status::ok:
             // Issue another fetch if the media prefetch buffer is running empty
             if (metrics.buffer_occupancy_percent < 60 && metrics.tail_status != Status::end_of_file) {
                 media_prefetch.issue_fetch();
             }
 
-            if (data.cropped) {
-                set_warning(WarningType::GcodeCropped);
-            }
-
             break;
 
         case Status::end_of_file:
@@ -2009,6 +2195,10 @@ static void _server_print_loop(void) {
     case State::Printing:
         print_state.resume_pending = false;
 
+#if ENABLED(POWER_PANIC)
+        power_panic::update_checkpoint();
+#endif
+
         if (server.print_is_serial) {
             SerialPrinting::print_loop();
         } else {
@@ -3129,7 +3319,7 @@ bool _process_server_valid_request(const Request &request, int client_id) {
         //@TODO return value depending on success of enqueueing gcode
         return enqueue_gcode(request.gcode);
     case Request::Type::Inject:
-        inject(request.inject);
+        inject(request.inject.record, request.inject.priority);
         return true;
     case Request::Type::SetVariable:
         _server_set_var(request);
@@ -3186,6 +3376,10 @@ bool _process_server_valid_request(const Request &request, int client_id) {
     case Request::Type::SetWarning:
         set_warning(request.warning_type);
         return true;
+    case Request::Type::BatchSync:
+        // No-op fence: all requests of the client's batch were processed
+        // before this one, acknowledging it acknowledges the whole batch.
+        return true;
     case Request::Type::FSM:
         server_side_encoded_fsm_response = request.encoded_fsm_response;
         return true;
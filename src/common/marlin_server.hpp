@@ -46,6 +46,9 @@ void init();
 // server loop - must be called periodically in server thread
 void loop();
 
+// dump per-section cycle time accounting of the server loop to the serial line (M9160)
+void dump_cycle_time_accounting();
+
 // direct call of babystep.add_steps(Z_AXIS, ...)
 void do_babystep_Z(float offs);
 
@@ -65,7 +68,7 @@ enqueue_gcode_printf(const char *gcode, ...);
 // direct call of 'inject_action'
 // @retval true command enqueued in inject queue
 // @retval false otherwise
-bool inject(InjectQueueRecord record);
+bool inject(InjectQueueRecord record, InjectPriority priority = InjectPriority::background);
 
 // direct call of settings.save()
 void settings_save();
@@ -6,6 +6,9 @@
 #include <common/no_rtti_type_id.hpp>
 #include "marlin_server_extended_fsm_types.hpp"
 
+#include <cstddef>
+#include <cstring>
+
 LOG_COMPONENT_REF(Marlin);
 
 /**
@@ -43,8 +46,8 @@ public:
         // do simple check that get_identifier works as expected and provides diffent value for different types
         assert(get_identifier<T>() != get_identifier<FSMExtendedData>());
 
-        // all operations are done under lock
-        auto guard = MarlinVarsLockGuard();
+        // publish under an open write section so readers retry their snapshot
+        auto guard = MarlinVarsWriteGuard();
 
         static_assert(sizeof(data) <= sizeof(extended_data_buffer)); // check if data type fits into buffer
 
@@ -67,14 +70,18 @@ public:
     /// @return
     template <FSMExtendedDataSubclass T>
     static bool get(T &result) {
-        // all operations are done under lock
-        auto guard = MarlinVarsLockGuard();
-
-        size_t expected_identifier = get_identifier<T>();
+        // sample identifier and buffer consistently, the copy may be torn mid-retry
+        size_t stored_identifier;
+        alignas(std::max_align_t) uint8_t buffer_copy[buffer_size];
+        MarlinVarsSnapshot snapshot;
+        do {
+            stored_identifier = identifier;
+            memcpy(buffer_copy, extended_data_buffer, buffer_size);
+        } while (snapshot.retry());
 
-        if (expected_identifier == identifier) {
+        if (get_identifier<T>() == stored_identifier) {
             // stored identifier matches, reinterpret buffer to instance of data type, and use assignment operator to return it
-            result = *reinterpret_cast<T *>(&extended_data_buffer);
+            result = *reinterpret_cast<T *>(&buffer_copy);
             return true;
         } else {
             log_info(Marlin, "FSM extended data get fail");
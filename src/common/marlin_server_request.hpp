@@ -32,6 +32,7 @@ struct Request {
         UncancelObjectID,
         CancelCurrentObject,
         SetWarning,
+        BatchSync,
     };
 
     union {
@@ -51,7 +52,10 @@ struct Request {
             uint32_t test_data_data;
         } test_start; // Type::TestStart
         char gcode[MARLIN_MAX_REQUEST + 1]; // Type::Gcode
-        InjectQueueRecord inject; // Type::Inject
+        struct {
+            InjectQueueRecord record;
+            InjectPriority priority;
+        } inject; // Type::Inject
         EncodedFSMResponse encoded_fsm_response; // Type::FSM
         float babystep; // Type::Babystep
         struct {
@@ -68,7 +72,11 @@ struct Request {
     Type type;
 };
 
-using ServerQueue = freertos::Queue<Request, 1>;
+/// Deep enough to hold a small client batch (see marlin_client::RequestBatch),
+/// the server drains up to this many requests per loop pass.
+inline constexpr size_t SERVER_REQUEST_QUEUE_DEPTH = 4;
+
+using ServerQueue = freertos::Queue<Request, SERVER_REQUEST_QUEUE_DEPTH>;
 extern ServerQueue server_queue;
 
 } // namespace marlin_server
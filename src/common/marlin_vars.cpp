@@ -1,33 +1,68 @@
 #include "marlin_vars.hpp"
-#include <common/random.h>
 
 #include <cassert>
 
-void marlin_vars_t::lock() {
+// Single-writer seqlock: the server task bumps publish_sequence to an odd
+// value around every write section and readers retry their snapshot whenever
+// the sequence was odd or changed under them. Plain data accesses are ordered
+// against the sequence with explicit fences (the same scheme the Linux kernel
+// uses for seqcounts).
 
-    if (current_mutex_owner == osThreadGetId()) {
-        bsod("Mutex recursive lock");
+void marlin_vars_t::write_begin() {
+    if (osThreadGetId() != marlin_server::server_task) {
+        bsod("Write to marlin variables from non marlin thread");
     }
 
-    [[maybe_unused]] auto res = osMutexWait(mutex_id, osWaitForever);
-    assert(res == osOK);
-    current_mutex_owner = osThreadGetId();
+    const uint32_t sequence = publish_sequence.load(std::memory_order_relaxed);
+    if (sequence & 1) {
+        bsod("Recursive marlin_vars write section");
+    }
+    publish_sequence.store(sequence + 1, std::memory_order_relaxed);
+    // order the sequence bump before the data writes of the section
+    std::atomic_thread_fence(std::memory_order_release);
 }
 
-void marlin_vars_t::unlock() {
-    current_mutex_owner = nullptr;
-    [[maybe_unused]] auto res = osMutexRelease(mutex_id);
-    assert(res == osOK);
+void marlin_vars_t::write_end() {
+    const uint32_t sequence = publish_sequence.load(std::memory_order_relaxed);
+    assert(sequence & 1);
+    // the release store orders the data writes of the section before the closing bump
+    publish_sequence.store(sequence + 1, std::memory_order_release);
 }
 
-MarlinVarsLockGuard::MarlinVarsLockGuard() {
-    marlin_vars().lock();
+uint32_t marlin_vars_t::read_begin() const {
+    uint32_t sequence = publish_sequence.load(std::memory_order_acquire);
+    while (sequence & 1) {
+        // A write section is open, so the server task was preempted
+        // mid-publication. Sleep instead of yielding so it can finish even
+        // when this reader has the higher priority.
+        osDelay(1);
+        sequence = publish_sequence.load(std::memory_order_acquire);
+    }
+    return sequence;
 }
 
-MarlinVarsLockGuard::~MarlinVarsLockGuard() {
-    marlin_vars().unlock();
+bool marlin_vars_t::read_retry(uint32_t sequence) const {
+    // order the data reads of the snapshot before the sequence re-check
+    std::atomic_thread_fence(std::memory_order_acquire);
+    return publish_sequence.load(std::memory_order_relaxed) != sequence;
 }
 
-void marlin_vars_t::init() {
-    mutex_id = osMutexCreate(osMutex(mutex));
+MarlinVarsWriteGuard::MarlinVarsWriteGuard() {
+    marlin_vars().write_begin();
+}
+
+MarlinVarsWriteGuard::~MarlinVarsWriteGuard() {
+    marlin_vars().write_end();
+}
+
+MarlinVarsSnapshot::MarlinVarsSnapshot()
+    : sequence(marlin_vars().read_begin()) {
+}
+
+bool MarlinVarsSnapshot::retry() {
+    if (!marlin_vars().read_retry(sequence)) {
+        return false;
+    }
+    sequence = marlin_vars().read_begin();
+    return true;
 }
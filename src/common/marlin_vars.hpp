@@ -13,19 +13,57 @@
 #include "inc/MarlinConfig.h"
 #include <assert.h>
 #include <tuple>
+#include <type_traits>
 
 #if BOARD_IS_DWARF()
     #error "You're trying to add marlin_vars to Dwarf. Don't!"
 #endif /*BOARD_IS_DWARF()*/
 
-class MarlinVarsLockGuard {
+/**
+ * @brief Opens a marlin_vars write section (writer side of the seqlock).
+ *
+ * Only the marlin server task is allowed to write marlin variables. While the
+ * guard is alive, the publication sequence is odd and concurrent snapshot
+ * readers retry instead of blocking, so the server task never waits for a
+ * consumer (and a consumer never blocks the server) - no mutex, no priority
+ * inversion.
+ */
+class MarlinVarsWriteGuard {
 public:
-    [[nodiscard]] MarlinVarsLockGuard();
-    ~MarlinVarsLockGuard();
+    [[nodiscard]] MarlinVarsWriteGuard();
+    ~MarlinVarsWriteGuard();
 
 private:
-    MarlinVarsLockGuard &operator=(const MarlinVarsLockGuard &) = delete;
-    MarlinVarsLockGuard(const MarlinVarsLockGuard &) = delete;
+    MarlinVarsWriteGuard &operator=(const MarlinVarsWriteGuard &) = delete;
+    MarlinVarsWriteGuard(const MarlinVarsWriteGuard &) = delete;
+};
+
+/**
+ * @brief Consistent snapshot of marlin variables (reader side of the seqlock).
+ *
+ * Usage:
+ *   MarlinVarsSnapshot snapshot;
+ *   do {
+ *       // copy marlin variables into local storage, nothing else
+ *   } while (snapshot.retry());
+ *
+ * The body re-executes whenever the server task published during the read, so
+ * it must only copy values out - all side effects belong after the loop.
+ * Mid-retry the copies may be torn, they become valid only once retry()
+ * returns false.
+ */
+class MarlinVarsSnapshot {
+public:
+    [[nodiscard]] MarlinVarsSnapshot();
+
+    /// @return true if the server task published during the read and the snapshot body has to be re-executed
+    bool retry();
+
+private:
+    uint32_t sequence;
+
+    MarlinVarsSnapshot &operator=(const MarlinVarsSnapshot &) = delete;
+    MarlinVarsSnapshot(const MarlinVarsSnapshot &) = delete;
 };
 
 /**
@@ -86,11 +124,14 @@ private:
 };
 
 /**
- * @brief Marlin locked variable, with thread-safety. Access to it is guarded by marlin_vars mutex.
+ * @brief Marlin variable published through the marlin_vars seqlock.
+ * Writes (server task only) open a write section, reads take a consistent snapshot.
  * TODO: Merge with MarlinStringVariable
  */
 template <typename T>
 class MarlinVariableLocked {
+    static_assert(std::is_trivially_copyable_v<T>, "Snapshot readers may copy a torn value before retrying");
+
 public:
     /**
      * @brief Default constructor
@@ -113,39 +154,41 @@ public:
 
     /**
      * @brief Get current value
-     * Protected by the guard.
+     * Reads a consistent snapshot.
      * @return T contained value
      */
     T get() const {
-        auto guard = MarlinVarsLockGuard();
-        return value;
+        T copy;
+        MarlinVarsSnapshot snapshot;
+        do {
+            copy = value;
+        } while (snapshot.retry());
+        return copy;
     }
 
     /**
      * @brief Set current value
-     * Protected by the guard.
+     * Opens a write section, snapshot readers retry.
      */
     void set(T value) {
         if (osThreadGetId() != marlin_server::server_task) {
             bsod("Write to marlin variable from non marlin thread");
         }
-        auto guard = MarlinVarsLockGuard();
+        auto guard = MarlinVarsWriteGuard();
         this->value = value;
     }
 
     /**
      * @brief Call a callback with the current value.
      *
-     * Calls the callback with the contained value (without copying it),
-     * protected by the guard. Returns the result of the callback.
-     *
-     * Do not "exfiltrate" the pointer from the callback (it is not guaranteed
-     * to be valid outside the callback).
+     * The callback may have side effects, so it must not re-execute on a
+     * snapshot retry; the value is copied out first and the callback runs
+     * exactly once on the copy. Returns the result of the callback.
      */
     template <class C>
     auto execute_with(C &&c) {
-        auto guard = MarlinVarsLockGuard();
-        return c(std::as_const(value));
+        const T copy = get();
+        return c(copy);
     }
 
 private:
@@ -153,7 +196,7 @@ private:
 };
 
 /**
- * @brief Marlin string variable, with thread-safety. Access to it is guarded by marlin_vars mutex.
+ * @brief Marlin string variable, with thread-safety. Published through the marlin_vars seqlock.
  *
  * @tparam LENGTH
  */
@@ -171,36 +214,45 @@ public:
      * @param max_len
      */
     void copy_to(char *to, size_t max_len) const {
-        auto guard = MarlinVarsLockGuard();
-        copy_to(to, max_len, guard);
+        MarlinVarsSnapshot snapshot;
+        do {
+            copy_to(to, max_len, snapshot);
+        } while (snapshot.retry());
     }
 
     /**
      * @brief Copy contents of this variable to other string.
      *
-     * You acquire lock yourself. Use this if you want to atomically sample multiple values.
+     * You run the snapshot loop yourself. Use this if you want to atomically sample multiple values.
      *
      * @param to
      * @param max_len
      */
-    void copy_to(char *to, size_t max_len, MarlinVarsLockGuard &guard) const {
-        (void)guard; // Lock argument is here just to make sure lock is acquired.
-        strlcpy(to, value, max_len);
+    void copy_to(char *to, size_t max_len, MarlinVarsSnapshot &snapshot) const {
+        (void)snapshot; // Snapshot argument is here just to make sure the read happens inside a snapshot loop.
+        // Mid-write the buffer may temporarily lack a terminator, so a plain
+        // strlcpy could read past it; copy with a hard bound instead, the
+        // snapshot retry discards any torn result.
+        const size_t n = std::min(max_len, LENGTH);
+        if (n == 0) {
+            return;
+        }
+        memcpy(to, value, n);
+        to[n - 1] = '\0';
     }
 
     /**
      * @brief Call a callback with the current value.
      *
-     * Calls the callback with the contained value (without copying it),
-     * protected by the guard. Returns the result of the callback.
-     *
-     * Do not "exfiltrate" the pointer from the callback (it is not guaranteed
-     * to be valid outside the callback).
+     * The callback may have side effects, so it must not re-execute on a
+     * snapshot retry; the string is copied out first and the callback runs
+     * exactly once on the copy. Returns the result of the callback.
      */
     template <class C>
     auto execute_with(C &&c) {
-        auto guard = MarlinVarsLockGuard();
-        return c(value);
+        char copy[LENGTH];
+        copy_to(copy, LENGTH);
+        return c(copy);
     }
 
     /**
@@ -210,19 +262,19 @@ public:
      * @param max_len use max this number of characters (not counting '\0')
      */
     void set(const char *from, size_t max_len = LENGTH) {
-        auto guard = MarlinVarsLockGuard();
+        auto guard = MarlinVarsWriteGuard();
         set(from, max_len, guard);
     }
 
     /**
      * @brief Atomically change contents of this string
-     * You acquire lock yourself. Use this if you want to atomically sample multiple values.
+     * You open the write section yourself. Use this if you want to atomically publish multiple values.
      * @param from string to copy
      * @param max_len use max this number of characters (not counting '\0')
      * @param guard
      */
-    void set(const char *from, size_t max_len, MarlinVarsLockGuard &guard) {
-        (void)guard; // Lock argument is here just to make sure lock is acquired.
+    void set(const char *from, size_t max_len, MarlinVarsWriteGuard &guard) {
+        (void)guard; // Guard argument is here just to make sure a write section is open.
         strlcpy(value, from, std::min(max_len + 1, LENGTH));
     }
 
@@ -231,17 +283,21 @@ public:
      * @param with compare to this null-terminated string
      */
     bool equals(const char *with) const {
-        auto guard = MarlinVarsLockGuard();
-        return equals(with, guard);
+        bool result;
+        MarlinVarsSnapshot snapshot;
+        do {
+            result = equals(with, snapshot);
+        } while (snapshot.retry());
+        return result;
     }
 
     /**
      * @brief Check if this string is equal to another.
-     * You acquire lock yourself. Use this if you want to atomically sample multiple values.
+     * You run the snapshot loop yourself. Use this if you want to atomically sample multiple values.
      * @param with compare to this null-terminated string
      */
-    bool equals(const char *with, MarlinVarsLockGuard &guard) const {
-        (void)guard; // Lock argument is here just to make sure lock is acquired.
+    bool equals(const char *with, MarlinVarsSnapshot &snapshot) const {
+        (void)snapshot; // Snapshot argument is here just to make sure the read happens inside a snapshot loop.
         return std::strncmp(value, with, LENGTH) == 0;
     }
 
@@ -260,14 +316,14 @@ public:
     }
 
     /**
-     * @brief Get modifiable pointer to string, only call from default task and mutex has to be acquired beforehand.
+     * @brief Get modifiable pointer to string, only call from default task with a write section open.
      *
      * It is only possible to call this from default task, because only default task can write this variable.
      */
-    char *get_modifiable_ptr(MarlinVarsLockGuard &guard) {
-        (void)guard; // Lock argument is here just to make sure lock is acquired.
+    char *get_modifiable_ptr(MarlinVarsWriteGuard &guard) {
+        (void)guard; // Guard argument is here just to make sure a write section is open.
 
-        // marlin server thread can get non-const pointer, but it has to hold mutex during writing, so only provide it when LockGuard is acquired
+        // marlin server thread can get non-const pointer, but it has to keep the write section open while writing, so only provide it when the guard is held
         if (osThreadGetId() != marlin_server::server_task) {
             bsod("get_ptr");
         }
@@ -295,8 +351,6 @@ private:
     friend marlin_vars_t &marlin_vars();
 
 public:
-    void init();
-
     /**
      * @brief Printer position.
      * @note Not using structures to not lock Marlin too often.
@@ -341,12 +395,16 @@ public:
         if (osThreadGetId() != marlin_server::server_task) {
             bsod("set_cancel_object_mask");
         }
-        auto guard = MarlinVarsLockGuard();
+        auto guard = MarlinVarsWriteGuard();
         cancel_object_mask = mask;
     }
     uint64_t get_cancel_object_mask() {
-        auto guard = MarlinVarsLockGuard();
-        return cancel_object_mask;
+        uint64_t mask;
+        MarlinVarsSnapshot snapshot;
+        do {
+            mask = cancel_object_mask;
+        } while (snapshot.retry());
+        return mask;
     }; ///< Copy of mask of canceled objects
     MarlinVariable<int8_t> cancel_object_count; ///< Number of objects that can be canceled
 
@@ -440,8 +498,13 @@ public:
     };
 
     std::optional<JobInfo::JobResult> get_job_result(uint16_t job_id) {
-        auto guard = MarlinVarsLockGuard();
-        for (const auto &job : job_history) {
+        decltype(job_history) history;
+        MarlinVarsSnapshot snapshot;
+        do {
+            history = job_history;
+        } while (snapshot.retry());
+
+        for (const auto &job : history) {
             if (job.has_value() && job->job_id == job_id) {
                 return job->result;
             }
@@ -451,7 +514,7 @@ public:
     }
 
     void add_job_result(uint16_t job_id, JobInfo::JobResult result) {
-        auto guard = MarlinVarsLockGuard();
+        auto guard = MarlinVarsWriteGuard();
         if (job_history[0].has_value() && job_history[0]->job_id == job_id) {
             // We already have a result for this job, let's keep the first result
             return;
@@ -472,8 +535,12 @@ public:
      * @return last change for both FSM queues and the generation (which changes every time a value here changes).
      */
     fsm::States get_fsm_states() {
-        auto guard = MarlinVarsLockGuard();
-        return fsm_states; // copy is intended
+        fsm::States copy;
+        MarlinVarsSnapshot snapshot;
+        do {
+            copy = fsm_states;
+        } while (snapshot.retry());
+        return copy;
     }
 
     /**
@@ -485,17 +552,18 @@ public:
         if (osThreadGetId() != marlin_server::server_task) {
             bsod("set_fsm_states");
         }
-        auto guard = MarlinVarsLockGuard();
+        auto guard = MarlinVarsWriteGuard();
         fsm_states = states;
     }
 
-    void lock();
-    void unlock();
+    // Seqlock primitives, use MarlinVarsWriteGuard/MarlinVarsSnapshot instead of calling these directly
+    void write_begin();
+    void write_end();
+    uint32_t read_begin() const;
+    bool read_retry(uint32_t sequence) const;
 
 private:
-    osMutexDef(mutex); // Declare mutex
-    osMutexId mutex_id; // Mutex ID
-    std::atomic<osThreadId> current_mutex_owner; // current mutex owner -> to check for recursive locking
+    std::atomic<uint32_t> publish_sequence { 0 }; // odd while a write section is open, bumped twice per publication
     std::array<Hotend, HOTENDS> hotends; // array of hotends (use hotend()/active_hotend() getter)
     std::array<std::optional<JobInfo>, 2> job_history;
     fsm::States fsm_states;
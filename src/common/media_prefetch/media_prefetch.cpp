@@ -53,10 +53,10 @@ using namespace media_prefetch;
 
 LOG_COMPONENT_DEF(MediaPrefetch, logging::Severity::debug);
 
-// The code is not ready for two worker routines to be executed in parallel, which could happen in multi-worker executor.
-// So if this changes, we need to revise the code.
-// A good solution might be to adjust the AsyncJob::issue function so that it always uses the same worker throughout discarding
-static_assert(AsyncJobExecutor::worker_count() == 1);
+// The code is not ready for two worker routines to be executed in parallel.
+// All fetches are issued through the single \p worker_job instance and AsyncJob::issue pins a job
+// re-issued while the previous (discarded) callback is still running to the same worker,
+// so the executor guarantees the routines never overlap even with multiple workers.
 
 static constexpr const char *prefetch_bsod_title = "Prefetch error";
 
@@ -72,12 +72,37 @@ MediaPrefetchManager::~MediaPrefetchManager() {
 }
 
 MediaPrefetchManager::Status MediaPrefetchManager::read_command(ReadResult &result) {
+    size_t read_count;
+    return read_commands(std::span(&result, 1), read_count);
+}
+
+MediaPrefetchManager::Status MediaPrefetchManager::read_commands(std::span<ReadResult> results, size_t &read_count) {
     std::lock_guard mutex_guard(mutex);
 
+    // The previously returned gcodes might have been borrowed (pointing directly into the buffer).
+    // The client asking for more commands means it is done with the previous ones, so only now
+    // we can hand the space over to the worker for reuse.
+    // This is intentionally not done between the commands of a single batch - all of them
+    // have to remain valid until the client is done with the whole batch.
+    shared_state.read_head.buffer_pos = manager_state.read_head.buffer_pos;
+
+    read_count = 0;
+    while (read_count < results.size()) {
+        if (const Status status = read_command_nolock(results[read_count]); status != Status::ok) {
+            return status;
+        }
+
+        read_count++;
+    }
+
+    return Status::ok;
+}
+
+MediaPrefetchManager::Status MediaPrefetchManager::read_command_nolock(ReadResult &result) {
     auto &s = shared_state;
 
     // If we're at the buffer end, return the appropriate error
-    if (s.read_head.buffer_pos == s.read_tail.buffer_pos) {
+    if (manager_state.read_head.buffer_pos == s.read_tail.buffer_pos) {
         assert(s.read_tail.status != Status::ok);
         return s.read_tail.status;
     }
@@ -117,11 +142,25 @@ MediaPrefetchManager::Status MediaPrefetchManager::read_command(ReadResult &resu
             uint8_t gcode_len;
             read_entry(gcode_len);
 
-            assert(gcode_len < result.gcode.size());
-            read_entry_raw(result.gcode.data(), gcode_len);
+            assert(gcode_len < result.gcode_copy_buffer.size());
 
-            // The gcode in the buffer was not null-terminated, so add the null here
-            result.gcode[gcode_len] = '\0';
+            // The gcode is stored in the buffer including the null terminator,
+            // so unless it wraps around the buffer end, we can hand out a pointer
+            // directly into the buffer instead of copying it out
+            auto &read_pos = manager_state.read_head.buffer_pos;
+            if (read_pos + gcode_len + 1 <= buffer_size) {
+                if (!can_read_entry_raw(gcode_len + 1)) {
+                    bsod(prefetch_bsod_title);
+                }
+
+                result.gcode = reinterpret_cast<const char *>(&buffer[read_pos]);
+                assert(result.gcode[gcode_len] == '\0');
+                read_pos = (read_pos + gcode_len + 1) % buffer_size;
+
+            } else {
+                read_entry_raw(result.gcode_copy_buffer.data(), gcode_len + 1);
+                result.gcode = result.gcode_copy_buffer.data();
+            }
             break;
         }
 
@@ -133,7 +172,8 @@ MediaPrefetchManager::Status MediaPrefetchManager::read_command(ReadResult &resu
             assert(compressed_len < compressed_data.size());
             read_entry_raw(compressed_data.data(), compressed_len);
 
-            decompress_gcode(compressed_data.data(), compressed_len, result.gcode);
+            decompress_gcode(compressed_data.data(), compressed_len, result.gcode_copy_buffer);
+            result.gcode = result.gcode_copy_buffer.data();
             break;
         }
 
@@ -192,13 +232,13 @@ void MediaPrefetchManager::stop() {
 
 bool MediaPrefetchManager::check_buffer_empty() const {
     std::lock_guard mutex_guard(mutex);
-    return (shared_state.read_head.buffer_pos == shared_state.read_tail.buffer_pos) && (shared_state.read_tail.status == Status::end_of_buffer);
+    return (manager_state.read_head.buffer_pos == shared_state.read_tail.buffer_pos) && (shared_state.read_tail.status == Status::end_of_buffer);
 }
 
 MediaPrefetchManager::ReadyToStartPrintResult MediaPrefetchManager::check_ready_to_start_print() const {
     const auto metrics = get_metrics();
 
-    if (metrics.buffer_occupancy_percent > 90) {
+    if (metrics.buffer_occupancy_percent > ready_to_print_occupancy_percent) {
         return ReadyToStartPrintResult::ready;
     }
 
@@ -376,6 +416,11 @@ void MediaPrefetchManager::fetch_routine(AsyncJobExecutionControl &control) {
 
     // Keep fetching until we run out of space
     while (true) {
+        // First hand over any speculatively prepared records, so the reader can flip to them right away
+        if (!fetch_drain_spill(control)) {
+            return;
+        }
+
         // If the command buffer contains a full command, flush it
         // If we failed, it means that there is not enough space in the buffer and we need to continue flushing in the next fetch
         if (s.command_buffer.flush_pending && !fetch_flush_command(control)) {
@@ -396,12 +441,12 @@ bool MediaPrefetchManager::fetch_flush_command(AsyncJobExecutionControl &control
 
     // If the restore info changed, publish a relevant record
     if (const auto ri = s.gcode_reader->get_restore_info(); ri != s.write_tail.gcode_pos.restore_info) {
-        if (!can_write_entry<RecordHeader, GCodeReaderStreamRestoreInfo>()) {
+        if (!can_stage_entry<RecordHeader, GCodeReaderStreamRestoreInfo>()) {
             return false;
         }
 
-        write_entry<RecordHeader>({ .record_type = RecordType::restore_info_update });
-        write_entry(ri);
+        stage_entry<RecordHeader>({ .record_type = RecordType::restore_info_update });
+        stage_entry(ri);
 
         s.write_tail.gcode_pos.restore_info = ri;
     }
@@ -413,21 +458,21 @@ bool MediaPrefetchManager::fetch_flush_command(AsyncJobExecutionControl &control
 
         if (offset_diff < 256) {
             // Offset diff fits into one byte -> we can do incremental offset
-            if (!can_write_entry<RecordHeader, uint8_t>()) {
+            if (!can_stage_entry<RecordHeader, uint8_t>()) {
                 return false;
             }
 
-            write_entry<RecordHeader>({ .record_type = RecordType::incremental_offset_update });
-            write_entry<uint8_t>(offset_diff);
+            stage_entry<RecordHeader>({ .record_type = RecordType::incremental_offset_update });
+            stage_entry<uint8_t>(offset_diff);
 
         } else {
             // Otherwise, emit full 4 byte offsetđ
-            if (!can_write_entry<RecordHeader, decltype(offset)>()) {
+            if (!can_stage_entry<RecordHeader, decltype(offset)>()) {
                 return false;
             }
 
-            write_entry<RecordHeader>({ .record_type = RecordType::offset_update });
-            write_entry(offset);
+            stage_entry<RecordHeader>({ .record_type = RecordType::offset_update });
+            stage_entry(offset);
         }
 
         s.write_tail.gcode_pos.offset = offset;
@@ -435,11 +480,11 @@ bool MediaPrefetchManager::fetch_flush_command(AsyncJobExecutionControl &control
 
     /// If the cropped flag is set, send a message notifying that
     if (s.command_buffer.cropped) {
-        if (!can_write_entry<RecordHeader>()) {
+        if (!can_stage_entry<RecordHeader>()) {
             return false;
         }
 
-        write_entry<RecordHeader>({ .record_type = RecordType::cropped_flag });
+        stage_entry<RecordHeader>({ .record_type = RecordType::cropped_flag });
         s.command_buffer.cropped = false;
     }
 
@@ -453,27 +498,37 @@ bool MediaPrefetchManager::fetch_flush_command(AsyncJobExecutionControl &control
 
     if (compressed_len < command_len) {
         // If the gcode is compressable, store it compressed
-        if (!can_write_entry_raw(sizeof(RecordHeader) + sizeof(uint8_t) + compressed_len)) {
+        if (!can_stage_entry_raw(sizeof(RecordHeader) + sizeof(uint8_t) + compressed_len)) {
             return false;
         }
 
-        write_entry<RecordHeader>({ .record_type = RecordType::compressed_gcode });
-        write_entry<uint8_t>(compressed_len);
-        write_entry_raw(compressed_data.data(), compressed_len);
+        stage_entry<RecordHeader>({ .record_type = RecordType::compressed_gcode });
+        stage_entry<uint8_t>(compressed_len);
+        stage_entry_raw(compressed_data.data(), compressed_len);
 
     } else {
-        // Otherwise store it plain
-        if (!can_write_entry_raw(sizeof(RecordHeader) + sizeof(uint8_t) + command_len)) {
+        // Otherwise store it plain, including the null terminator.
+        // The terminator costs one byte per command, but allows read_command to hand out
+        // commands pointing directly into the buffer, without copying them out.
+        if (!can_stage_entry_raw(sizeof(RecordHeader) + sizeof(uint8_t) + command_len + 1)) {
             return false;
         }
 
-        write_entry<RecordHeader>({ .record_type = RecordType::plain_gcode });
-        write_entry<uint8_t>(command_len);
-        write_entry_raw(s.command_buffer_data.data(), command_len);
+        stage_entry<RecordHeader>({ .record_type = RecordType::plain_gcode });
+        stage_entry<uint8_t>(command_len);
+        assert(s.command_buffer_data[command_len] == '\0');
+        stage_entry_raw(s.command_buffer_data.data(), command_len + 1);
     }
 
-    // Update read_tail
-    {
+    if (s.spill.active) {
+        // The command (or its part) went into the spill buffer - just mark the handoff boundary,
+        // fetch_drain_spill publishes it once there is space in the shared buffer
+        s.spill.last_command_end = s.spill.size;
+        s.spill.commands++;
+        s.spill.gcode_pos = s.write_tail.gcode_pos;
+
+    } else {
+        // Update read_tail
         std::lock_guard mutex_guard(mutex);
 
         if (control.is_discarded()) {
@@ -500,6 +555,64 @@ bool MediaPrefetchManager::fetch_flush_command(AsyncJobExecutionControl &control
     return true;
 }
 
+bool MediaPrefetchManager::fetch_drain_spill(AsyncJobExecutionControl &control) {
+    auto &s = worker_state;
+    auto &spill = s.spill;
+
+    // Nothing handoverable in the spill buffer
+    if (spill.last_command_end == 0) {
+        return true;
+    }
+
+    // Refresh the read head first, the manager might have freed up some space in the meantime
+    {
+        std::lock_guard mutex_guard(mutex);
+
+        if (control.is_discarded()) {
+            return false;
+        }
+
+        s.read_head.buffer_pos = shared_state.read_head.buffer_pos;
+    }
+
+    // Only hand over complete commands, and only when they fit in the shared buffer in one go.
+    // We don't track the individual command boundaries, so we cannot publish a partial copy.
+    if (!can_write_entry_raw(spill.last_command_end)) {
+        return true;
+    }
+
+    write_entry_raw(spill.data.data(), spill.last_command_end);
+
+    {
+        std::lock_guard mutex_guard(mutex);
+
+        if (control.is_discarded()) {
+            return false;
+        }
+
+        shared_state.commands_in_buffer += spill.commands;
+
+        shared_state.read_tail = {
+            .gcode_pos = spill.gcode_pos,
+            .buffer_pos = s.write_tail.buffer_pos,
+            .status = Status::end_of_buffer,
+        };
+
+        s.read_head.buffer_pos = shared_state.read_head.buffer_pos;
+    }
+
+    // A partially staged command might remain in the spill buffer - keep it there,
+    // any further records have to stay behind it to preserve ordering
+    const auto remainder = spill.size - spill.last_command_end;
+    memmove(spill.data.data(), spill.data.data() + spill.last_command_end, remainder);
+    spill.size = remainder;
+    spill.last_command_end = 0;
+    spill.commands = 0;
+    spill.active = (remainder > 0);
+
+    return true;
+}
+
 bool MediaPrefetchManager::fetch_command(AsyncJobExecutionControl &control) {
     using SR = IGcodeReader::Result_t;
 
@@ -577,6 +690,16 @@ void MediaPrefetchManager::fetch_handle_error(AsyncJobExecutionControl &control,
     const auto status = status_map[error];
     const bool is_error = this->is_error(status);
 
+    // If we're still holding speculatively decoded commands that were not handed over yet,
+    // we must not publish a non-error status (esp. end_of_file) - the reader would act on it
+    // before seeing the spilled commands. Keep reporting end_of_buffer; the next fetch drains
+    // the spill and re-encounters the condition with the spill empty.
+    // Errors are safe to publish right away - they reset the worker (dropping the spill)
+    // and re-fetch everything from the published read_tail.
+    if (!is_error && worker_state.spill.size > 0) {
+        return;
+    }
+
     // Close the reader now, release the handle as soon as possible
     if (status != Status::end_of_buffer) {
         worker_state.gcode_reader = {};
@@ -600,7 +723,7 @@ void MediaPrefetchManager::fetch_handle_error(AsyncJobExecutionControl &control,
 bool MediaPrefetchManager::can_read_entry_raw(size_t bytes) const {
     assert(bytes < buffer_size);
 
-    const size_t read_pos = shared_state.read_head.buffer_pos;
+    const size_t read_pos = manager_state.read_head.buffer_pos;
     const size_t read_tail = shared_state.read_tail.buffer_pos;
     const size_t new_read_pos = (read_pos + bytes) % buffer_size;
 
@@ -622,7 +745,7 @@ void MediaPrefetchManager::read_entry_raw(void *target, size_t bytes) {
         bsod(prefetch_bsod_title);
     }
 
-    size_t &read_pos = shared_state.read_head.buffer_pos;
+    size_t &read_pos = manager_state.read_head.buffer_pos;
 
     // Possibly split into two memcpy calls, if the data wraps around the buffer end
     const auto nonwrapped_bytes = std::min(bytes, buffer_size - read_pos);
@@ -650,6 +773,38 @@ bool MediaPrefetchManager::can_write_entry_raw(size_t bytes) const {
     return (does_catch_up_read_head == does_wrap);
 }
 
+bool MediaPrefetchManager::can_stage_entry_raw(size_t bytes) const {
+    auto &spill = worker_state.spill;
+    assert(bytes < spill.data.size());
+
+    if (!spill.active && can_write_entry_raw(bytes)) {
+        return true;
+    }
+
+    // Shared buffer is full (or we're already spilling) -> check the spill buffer capacity
+    return (spill.size + bytes <= spill.data.size());
+}
+
+void MediaPrefetchManager::stage_entry_raw(const void *data, size_t bytes) {
+    auto &spill = worker_state.spill;
+
+    if (!spill.active && can_write_entry_raw(bytes)) {
+        write_entry_raw(data, bytes);
+        return;
+    }
+
+    // Shared buffer is full -> start (or keep) staging into the spill buffer.
+    // Once active, everything has to go through the spill to preserve record ordering.
+    spill.active = true;
+
+    if (spill.size + bytes > spill.data.size()) {
+        bsod(prefetch_bsod_title);
+    }
+
+    memcpy(spill.data.data() + spill.size, data, bytes);
+    spill.size += bytes;
+}
+
 void MediaPrefetchManager::write_entry_raw(const void *data, size_t bytes) {
     if (!can_write_entry_raw(bytes)) {
         bsod(prefetch_bsod_title);
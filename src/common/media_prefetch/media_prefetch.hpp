@@ -4,6 +4,7 @@
 #include <cstddef>
 #include <array>
 #include <mutex>
+#include <span>
 
 #include <gcode/gcode_reader_any.hpp>
 #include <async_job/async_job.hpp>
@@ -16,6 +17,20 @@ public:
     /// Size of the ring buffer
     static constexpr size_t buffer_size = 8192;
 
+    /// Size of the speculative look-ahead (spill) buffer.
+    /// When the shared ring buffer is full, the worker keeps decoding ahead into this buffer,
+    /// so that the records can be handed over with a plain memcpy once the manager frees up some space.
+    /// Must be small enough to fit in the free space the manager typically creates between two fetches,
+    /// otherwise the handoff would keep getting postponed.
+    static constexpr size_t spill_buffer_size = 2048;
+
+    /// Leading window required before a print is started, as buffer occupancy.
+    /// This is what gates the first motion of a print that is still being
+    /// downloaded - the preview keeps fetching until this much of the buffer
+    /// is filled (or the whole file fits in it), then lets the print begin
+    /// while the download continues in the background.
+    static constexpr uint8_t ready_to_print_occupancy_percent = 90;
+
     enum class Status {
         /// All is well, command was fetched
         ok,
@@ -47,8 +62,14 @@ public:
 
 public:
     struct ReadResult {
-        /// Fetched gcode
-        std::array<char, MAX_CMD_SIZE> gcode;
+        /// Fetched gcode, null-terminated.
+        /// Points either directly into the prefetch buffer (borrowed - only valid until the next call on the manager),
+        /// or into \p gcode_copy_buffer.
+        const char *gcode = nullptr;
+
+        /// Backing storage for commands that cannot be borrowed from the prefetch buffer
+        /// (compressed ones and those that wrap around the buffer end)
+        std::array<char, MAX_CMD_SIZE> gcode_copy_buffer;
 
         /// Position for the fetched gcode - to resume the stream by repeating the gcode
         GCodeReaderPosition replay_pos;
@@ -63,6 +84,12 @@ public:
     /// Attempts to read one gcode command from the buffer.
     Status read_command(ReadResult &result);
 
+    /// Attempts to read up to \p results.size() gcode commands from the buffer, under a single lock acquisition.
+    /// Stops at the first command that cannot be read.
+    /// \param read_count set to the number of commands filled in \p results
+    /// \returns \p Status::ok if the whole span was filled, otherwise the status that stopped the batch
+    Status read_commands(std::span<ReadResult> results, size_t &read_count);
+
     /// Restarts the manager & starts reading gcode from the specified position
     void start(const char *filepath, const GCodeReaderPosition &position);
 
@@ -116,6 +143,11 @@ public:
         return shared_state.filepath;
     }
 
+private:
+    /// Reads one gcode command from the buffer.
+    /// !!! Assumes the \p mutex to be locked
+    Status read_command_nolock(ReadResult &result);
+
 private:
     /// Routine that is executed on a worker thread
     void fetch_routine(AsyncJobExecutionControl &control);
@@ -128,6 +160,10 @@ private:
     /// \returns \p false if the execution of the fetch should stop
     bool fetch_command(AsyncJobExecutionControl &control);
 
+    /// Hands over complete commands prepared in the spill buffer into the shared \p buffer, if they fit.
+    /// \returns \p false if the execution of the fetch should stop
+    bool fetch_drain_spill(AsyncJobExecutionControl &control);
+
     void fetch_handle_error(AsyncJobExecutionControl &control, IGcodeReader::Result_t error);
 
 private:
@@ -167,6 +203,25 @@ private:
         write_entry_raw(&rec, sizeof(T));
     }
 
+    /// \returns whether \p bytes bytes can be staged - either in the shared buffer, or in the spill buffer
+    /// !!! Only to be done from the worker context
+    bool can_stage_entry_raw(size_t bytes) const;
+
+    template <typename... Record>
+    bool can_stage_entry() const {
+        return can_stage_entry_raw((sizeof(Record) + ...));
+    }
+
+    /// Writes the provided data to the shared buffer, or - once that one runs full - to the spill buffer
+    /// !!! Only to be done from the worker context
+    void stage_entry_raw(const void *data, size_t bytes);
+
+    template <typename T>
+    void stage_entry(const T &rec) {
+        static_assert(std::is_trivially_copyable_v<T>);
+        stage_entry_raw(&rec, sizeof(T));
+    }
+
 private:
     /// Circular buffer, accessed from both the manager and worker asynchronously.
     /// Data in this buffer is a sequence RecordHeader + data, depending on the record type
@@ -228,6 +283,12 @@ private:
             /// This is the position to resume from if we would discard the entire prefetch buffer
             GCodeReaderPosition gcode_pos;
 
+            /// Position in \p buffer just after the last record read by the manager.
+            /// This runs ahead of \p shared_state.read_head.buffer_pos - the shared one is only updated
+            /// on the next \p read_command call, because the last returned gcode may be borrowed
+            /// (pointing directly into \p buffer) and must not be overwritten by the worker until then.
+            size_t buffer_pos = 0;
+
         } read_head;
 
     } manager_state;
@@ -271,6 +332,30 @@ private:
 
         } read_head;
 
+        /// Speculative look-ahead buffer.
+        /// When the shared \p buffer is full, the worker keeps encoding records in here instead of stopping.
+        /// \p fetch_drain_spill then hands the prepared records over once the manager frees up space,
+        /// so the reader side never has to wait for the gcode reader itself.
+        struct {
+            std::array<uint8_t, spill_buffer_size> data;
+
+            /// Number of valid bytes in \p data
+            size_t size = 0;
+
+            /// End of the last complete command in \p data - only data up to this point can be handed over
+            size_t last_command_end = 0;
+
+            /// Number of complete commands in data[0..last_command_end]
+            size_t commands = 0;
+
+            /// \p write_tail.gcode_pos snapshot taken at \p last_command_end
+            GCodeReaderPosition gcode_pos;
+
+            /// If set, the worker is currently staging records into this buffer instead of the shared one
+            bool active = false;
+
+        } spill;
+
     } worker_state;
 
     /// Mutex that protects \p shared_state
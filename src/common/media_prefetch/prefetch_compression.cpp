@@ -29,6 +29,9 @@ namespace {
  *    - (word_value - primary_page_size) denotes index of the secondary page.
  *    - The following 4-bit word denotes index of the character in that page.
  *    - The formula is character_list[primary_page_size + (first_word - primary_page_size) * secondary_page_size + second_word]
+ *
+ * The secondary page codes that are not used by character_list encode entries of sequence_dictionary instead -
+ * common multi-character sequences that this way compress into a single byte.
  */
 
 constexpr uint8_t secondary_page_count = 1;
@@ -51,6 +54,21 @@ constexpr std::array character_list {
     'Z', 'X', 'F', 'J', 'P', 'R', 'S', 'M', 'G', ' '
 };
 
+/// Common character sequences, encoded in the secondary page codes left unused by character_list.
+/// Entries were picked by measuring typical PrusaSlicer output - they're mostly shapes of the decimal
+/// parts of coordinates, which repeat in vast amounts in any sliced file.
+constexpr std::array sequence_dictionary {
+    "E0.0",
+    "0.0",
+    "E.0",
+    ".00",
+    "X1",
+    "Y1",
+};
+
+// Must be sorted by length so that we hit the longest match first in the iteration
+static_assert(std::is_sorted(sequence_dictionary.begin(), sequence_dictionary.end(), [](auto a, auto b) { return strlen(a) > strlen(b); }));
+
 /// Common ways a gcode command can start. We can encode 16 possible options in a single 4-bit word
 constexpr std::array prefix_dictionary {
     "M486S", // Cancel object
@@ -80,6 +98,9 @@ static_assert(std::is_sorted(prefix_dictionary.begin(), prefix_dictionary.end(),
 static_assert(secondary_page_count < (1 << 4));
 static_assert(character_list.size() <= max_supported_compressed_characters);
 
+// Sequence dictionary entries occupy the secondary page codes right after character_list
+static_assert(character_list.size() + sequence_dictionary.size() <= max_supported_compressed_characters);
+
 // If we're not utilising a whole secondary page, we can reduce their count to make the algorithm more optimal
 static_assert(character_list.size() > max_supported_compressed_characters - secondary_page_size);
 
@@ -177,7 +198,40 @@ std::optional<size_t> media_prefetch::compress_gcode(const char *input, std::spa
         input += prefix_len;
     }
 
+    /// Emits the (possibly two-word) code for \p encoded_id
+    const auto write_encoded_id = [&](int encoded_id) {
+        if (encoded_id < primary_page_size) {
+            // Is in primary page -> just write one word
+            return write_word(encoded_id);
+
+        } else {
+            // Is in secondary page -> first word is the page number, second word is position on that page
+            const auto page_ix = (encoded_id - primary_page_size) / secondary_page_size;
+            return write_word(primary_page_size + page_ix) && write_word((encoded_id - primary_page_size) % secondary_page_size);
+        }
+    };
+
     while (true) {
+        // Check if the input continues with any of the dictionary sequences - those compress into a single byte
+        {
+            size_t sequence_len = 0;
+
+            const auto sequence_pred = [&](const char *sequence) {
+                sequence_len = starts_with(input, sequence);
+                return sequence_len != 0;
+            };
+            const auto sequence_it = std::find_if(sequence_dictionary.begin(), sequence_dictionary.end(), sequence_pred);
+
+            if (sequence_it != sequence_dictionary.end()) {
+                if (!write_encoded_id(character_list.size() + (sequence_it - sequence_dictionary.begin()))) {
+                    return std::nullopt;
+                }
+
+                input += sequence_len;
+                continue;
+            }
+        }
+
         char ch = *input++;
 
         // If we've hit end of string, we have a success
@@ -198,23 +252,8 @@ std::optional<size_t> media_prefetch::compress_gcode(const char *input, std::spa
             return std::nullopt;
         }
 
-        const int encoded_id = encoded_it - character_list.begin();
-
-        if (encoded_id < primary_page_size) {
-            // Is in primary page -> just write  one word
-            if (!write_word(encoded_id)) {
-                return std::nullopt;
-            }
-
-        } else {
-            // Is in secondary page -> first word is the page number, second word is position on that page
-            const auto page_ix = (encoded_id - primary_page_size) / secondary_page_size;
-            if ( //
-                !write_word(primary_page_size + page_ix) //
-                || !write_word((encoded_id - primary_page_size) % secondary_page_size) //
-            ) {
-                return std::nullopt;
-            }
+        if (!write_encoded_id(encoded_it - character_list.begin())) {
+            return std::nullopt;
         }
     }
 }
@@ -252,10 +291,9 @@ void media_prefetch::decompress_gcode(const uint8_t *input, int compressed_len,
 
     while (input_ptr < input_end) {
         const auto first_word = read_word();
-        char decoded_char;
 
         if (first_word < primary_page_size) {
-            decoded_char = character_list[first_word];
+            *output_ptr++ = character_list[first_word];
 
         } else if (input_ptr == input_end) {
             // If by reading the first word, we've got to the end of the buffer, just return.
@@ -265,10 +303,16 @@ void media_prefetch::decompress_gcode(const uint8_t *input, int compressed_len,
         } else {
             const auto page_ix = first_word - primary_page_size;
             const auto second_word = read_word();
-            decoded_char = character_list[primary_page_size + page_ix * secondary_page_size + second_word];
-        }
+            const size_t encoded_id = primary_page_size + page_ix * secondary_page_size + second_word;
 
-        *output_ptr++ = decoded_char;
+            if (encoded_id < character_list.size()) {
+                *output_ptr++ = character_list[encoded_id];
+
+            } else {
+                // Codes past character_list encode whole dictionary sequences
+                output_ptr += strlcpy(output_ptr, sequence_dictionary[encoded_id - character_list.size()], output.size() - (output_ptr - output.data()));
+            }
+        }
     }
 
     // Write terminating null
@@ -109,6 +109,13 @@ static metric_point_t *point_check_and_prepare(metric_t *metric, uint32_t timest
         return NULL; // don't try to enqueue if nobody is listening
     }
 
+    if (metric->keep_1_of > 1) {
+        if (++metric->_decimation_counter < metric->keep_1_of) {
+            return NULL;
+        }
+        metric->_decimation_counter = 0;
+    }
+
     metric_point_t *point = (metric_point_t *)osMailAlloc(metric_system_queue, 0);
     if (!point) {
         dropped_points_count.fetch_add(1, std::memory_order::relaxed);
@@ -69,14 +69,22 @@ typedef struct metric_s {
     /// of this metric are not going to be sent faster then
     /// at 20 Hz.
     /// When set to zero, no throttling is going to be performed.
-    const uint16_t min_interval_ms;
+    /// Adjustable at runtime (M335); the METRIC_DEF value is the default.
+    uint16_t min_interval_ms;
 
     /// The type of the values associated with this metric.
     const metric_value_type_t type : 3;
 
     bool enabled : 1;
 
-    const uint16_t _unused : 12;
+    /// Decimation: keep only one of every keep_1_of recorded points.
+    /// 1 keeps everything. Adjustable at runtime (M335) just like
+    /// min_interval_ms; unlike it, decimation thins out a stream evenly
+    /// regardless of how irregularly the values get recorded.
+    uint16_t keep_1_of : 6;
+
+    /// Internal. Number of points thrown away since the last kept one.
+    uint16_t _decimation_counter : 6;
 
 } metric_t;
 
@@ -89,7 +97,7 @@ typedef struct metric_s {
 #endif
 
 /// To be used for metric_t structure initialization.
-#define METRIC_DEF(var, name, type, min_interval_ms, enabled) static metric_t var _METRIC_DEF_ATTRS = { name, 0, min_interval_ms, type, enabled, 0 }
+#define METRIC_DEF(var, name, type, min_interval_ms, enabled) static metric_t var _METRIC_DEF_ATTRS = { name, 0, min_interval_ms, type, enabled, 1, 0 }
 
 /// Represents a single recorded value.
 ///
@@ -6,6 +6,7 @@
 #include "metric_handlers.h"
 #include "stm32f4xx_hal.h"
 #include "timing.h"
+#include "wall_clock.hpp"
 #include <syslog/syslog_transport.hpp>
 #include "otp.hpp"
 #include <config_store/store_instance.hpp>
@@ -15,6 +16,10 @@
 
 #define TEXTPROTOCOL_POINT_MAXLEN 63
 #define BUFFER_OLD_MS             1000 // after how many ms we flush the buffer
+// Fill the whole ethernet frame: 1500 (MTU of both the ESP and eth interface)
+// minus the IP and UDP headers. Fewer, bigger datagrams keep the ESP UART
+// traffic down compared to many small ones.
+#define BATCH_MAXLEN              (1500 - 20 - 8)
 
 static int textprotocol_append_escaped(char *buffer, int buffer_len, char *val) {
     int appended = 0;
@@ -103,6 +108,73 @@ void metrics_reconfigure() {
     }
 }
 
+//
+// Sampling overrides
+//
+// Persisted in config store as a space-separated list of
+// "name=keep_1_of/min_interval_ms" entries so a diagnostic session can crank
+// a metric up (and production can throttle it) without reflashing.
+
+static metric_t *find_metric(const char *name, size_t name_len) {
+    for (auto metric = metric_get_iterator_begin(), e = metric_get_iterator_end(); metric != e; metric++) {
+        if (strncmp(metric->name, name, name_len) == 0 && metric->name[name_len] == '\0') {
+            return metric;
+        }
+    }
+    return nullptr;
+}
+
+static void apply_sampling(metric_t *metric, unsigned keep_1_of, unsigned min_interval_ms) {
+    metric->keep_1_of = std::clamp<unsigned>(keep_1_of, 1, 63);
+    metric->min_interval_ms = std::min<unsigned>(min_interval_ms, UINT16_MAX);
+}
+
+void metrics_apply_sampling_overrides() {
+    auto overrides = config_store().metrics_sampling.get();
+    char *saveptr;
+    for (char *entry = strtok_r(overrides.data(), " ", &saveptr); entry; entry = strtok_r(nullptr, " ", &saveptr)) {
+        char *assignment = strchr(entry, '=');
+        unsigned keep_1_of, min_interval_ms;
+        if (!assignment || sscanf(assignment + 1, "%u/%u", &keep_1_of, &min_interval_ms) != 2) {
+            continue; // skip a malformed entry, do not lose the rest
+        }
+        if (metric_t *metric = find_metric(entry, assignment - entry)) {
+            apply_sampling(metric, keep_1_of, min_interval_ms);
+        }
+    }
+}
+
+bool metrics_set_sampling(const char *name, unsigned keep_1_of, int min_interval_ms) {
+    metric_t *metric = find_metric(name, strlen(name));
+    if (!metric) {
+        return false;
+    }
+    const unsigned interval = min_interval_ms < 0 ? metric->min_interval_ms : (unsigned)min_interval_ms;
+
+    // Rebuild the persisted list: our entry first, then everyone else's.
+    auto old_overrides = config_store().metrics_sampling.get();
+    decltype(old_overrides) new_overrides;
+    int used = snprintf(new_overrides.data(), new_overrides.size(), "%s=%u/%u", name, keep_1_of, interval);
+    if (used < 0 || (size_t)used >= new_overrides.size()) {
+        return false;
+    }
+    char *saveptr;
+    for (char *entry = strtok_r(old_overrides.data(), " ", &saveptr); entry; entry = strtok_r(nullptr, " ", &saveptr)) {
+        if (strncmp(entry, name, strlen(name)) == 0 && entry[strlen(name)] == '=') {
+            continue; // the old entry of this metric gets replaced
+        }
+        int appended = snprintf(new_overrides.data() + used, new_overrides.size() - used, " %s", entry);
+        if (appended < 0 || (size_t)(used + appended) >= new_overrides.size()) {
+            return false; // no space left for the overrides of the other metrics
+        }
+        used += appended;
+    }
+    config_store().metrics_sampling.set(new_overrides);
+
+    apply_sampling(metric, keep_1_of, interval);
+    return true;
+}
+
 static int syslog_message_init(char *buffer, int buffer_len, int64_t timestamp) {
     static int message_id = 0;
     const int facility = 1; // user level message
@@ -120,12 +192,20 @@ static int syslog_message_init(char *buffer, int buffer_len, int64_t timestamp)
 extern "C" void metric_handler(metric_point_t *point) {
     static uint32_t buffer_reference_timestamp = 0;
     static char buffer_has_header = false;
-    static char buffer[1024];
+    static char buffer[BATCH_MAXLEN];
     static unsigned int buffer_used = 0;
 
     auto init_header = [&]() {
-        int64_t absolute_timestamp_us = get_timestamp_us();
-        buffer_reference_timestamp = static_cast<uint32_t>(absolute_timestamp_us);
+        // Points keep their local tick timestamps, in-batch diffs are
+        // computed against this reference
+        buffer_reference_timestamp = ticks_us();
+        // The header carries the absolute time of the batch: the SNTP-synced
+        // wall clock when available, so events from different printers line
+        // up without manual clock reconciliation. Before the first sync this
+        // falls back to microseconds since boot; the receiver can tell the
+        // two apart by the magnitude.
+        const int64_t wall_us = wall_clock::now_us();
+        const int64_t absolute_timestamp_us = wall_us ? wall_us : get_timestamp_us();
         buffer_used = syslog_message_init(buffer, sizeof(buffer), absolute_timestamp_us);
         buffer_has_header = true;
     };
@@ -8,6 +8,15 @@ extern "C" {
 /// Set up the metrics handlers based on config store
 void metrics_reconfigure();
 
+/// Apply the sampling overrides persisted in config store to the metric definitions
+void metrics_apply_sampling_overrides();
+
+/// Set sampling of a metric (keep_1_of decimation and min interval) and persist
+/// the override in config store. A negative min_interval_ms keeps the metric's
+/// current interval. Returns false when the metric does not exist or the
+/// override does not fit the persisted list.
+bool metrics_set_sampling(const char *name, unsigned keep_1_of, int min_interval_ms);
+
 extern void metric_handler(metric_point_t *point);
 
 #ifdef __cplusplus
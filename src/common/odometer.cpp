@@ -1,12 +1,32 @@
 // odometer_s.cpp
 
+#include <bit>
 #include <cmath>
 #include "odometer.hpp"
 #include "cmath_ext.h"
+#include "PersistentStorage.h"
 #include <config_store/store_instance.hpp>
 
 static_assert(HOTENDS <= config_store_ns::max_tool_count, "Too many hotends");
 
+namespace {
+
+/// Ids of odometer counters in the PersistentStorage counter ring.
+/// The ids are stored in eeprom - never renumber them, only append.
+enum CounterId : uint8_t {
+    counter_axis_first = 0, // X, Y, Z
+    counter_time = 3,
+    counter_mmu_changes = 4,
+    counter_extruded_first = 5, // one id per tool
+    counter_toolpick_first = counter_extruded_first + config_store_ns::max_tool_count, // one id per tool
+    counter_id_count = counter_toolpick_first + config_store_ns::max_tool_count,
+};
+
+/// Every this many saves the journal checkpoint is refreshed as well
+constexpr uint8_t journal_checkpoint_period = 8;
+
+} // end anonymous namespace
+
 Odometer_s Odometer_s::instance_;
 
 bool Odometer_s::changed() {
@@ -38,34 +58,92 @@ bool Odometer_s::changed() {
     return false;
 }
 
+void Odometer_s::load_bases() {
+    if (bases_loaded) {
+        return;
+    }
+
+    std::optional<uint32_t> ring[counter_id_count];
+    PersistentStorage::load_counters(ring);
+
+    auto &store = config_store();
+    for (size_t i = 0; i < axis_count; ++i) {
+        const auto &value = ring[counter_axis_first + i];
+        base_xyz[i] = value ? std::bit_cast<float>(*value) : store.get_odometer_axis(i);
+    }
+    for (size_t i = 0; i < HOTENDS; ++i) {
+        const auto &value = ring[counter_extruded_first + i];
+        base_extruded[i] = value ? std::bit_cast<float>(*value) : store.get_odometer_extruded_length(i);
+    }
+    for (size_t i = 0; i < HOTENDS; ++i) {
+        base_toolpick[i] = ring[counter_toolpick_first + i].value_or(store.get_odometer_toolpicks(i));
+    }
+    base_time = ring[counter_time].value_or(store.odometer_time.get());
+    base_mmu_changes = ring[counter_mmu_changes].value_or(store.mmu_changes.get());
+
+    bases_loaded = true;
+}
+
 void Odometer_s::force_to_eeprom() {
     if (!changed()) {
         return;
     }
 
+    load_bases();
+
+    // Push the new absolute values to the wear-leveled counter ring; the
+    // journal only gets the occasional checkpoint below, so frequently
+    // bumped counters don't churn the same journal as rarely-changed settings
+    for (size_t i = 0; i < axis_count; ++i) {
+        if (trip_xyz[i] != 0) {
+            base_xyz[i] = base_xyz[i] + trip_xyz[i].exchange(0);
+            PersistentStorage::push_counter(counter_axis_first + i, std::bit_cast<uint32_t>(base_xyz[i].load()));
+        }
+    }
+
+    for (size_t i = 0; i < HOTENDS; ++i) {
+        if (extruded[i] != 0) {
+            base_extruded[i] = base_extruded[i] + MAX(0.0f, extruded[i].exchange(0));
+            PersistentStorage::push_counter(counter_extruded_first + i, std::bit_cast<uint32_t>(base_extruded[i].load()));
+        }
+        if (toolpick[i] != 0) {
+            base_toolpick[i] += toolpick[i].exchange(0);
+            PersistentStorage::push_counter(counter_toolpick_first + i, base_toolpick[i]);
+        }
+    }
+
+    if (duration_time != 0) {
+        base_time += duration_time.exchange(0);
+        PersistentStorage::push_counter(counter_time, base_time);
+    }
+
+    if (mmu_changes != 0) {
+        base_mmu_changes += mmu_changes.exchange(0);
+        PersistentStorage::push_counter(counter_mmu_changes, base_mmu_changes);
+    }
+
+    if (++saves_since_checkpoint < journal_checkpoint_period) {
+        return;
+    }
+    saves_since_checkpoint = 0;
+
     auto &store = config_store();
     auto transaction = store.get_backend().transaction_guard();
 
     for (size_t i = 0; i < axis_count; ++i) {
-        store.set_odometer_axis(i, get_axis(axis_t(i)));
-        trip_xyz[i] = 0;
+        store.set_odometer_axis(i, base_xyz[i]);
     }
 
     for (size_t i = 0; i < HOTENDS; ++i) {
-        store.set_odometer_extruded_length(i, get_extruded(i));
-        extruded[i] = 0;
+        store.set_odometer_extruded_length(i, base_extruded[i]);
     }
 
     for (size_t i = 0; i < HOTENDS; ++i) {
-        store.set_odometer_toolpicks(i, get_toolpick(i));
-        toolpick[i] = 0;
+        store.set_odometer_toolpicks(i, base_toolpick[i]);
     }
 
-    store.odometer_time.set(get_time());
-    duration_time = 0;
-
-    store.mmu_changes.set(get_mmu_changes());
-    mmu_changes = 0;
+    store.odometer_time.set(base_time);
+    store.mmu_changes.set(base_mmu_changes);
 }
 
 void Odometer_s::add_axis(axis_t axis, float value) {
@@ -82,7 +160,8 @@ void Odometer_s::add_axis(axis_t axis, float value) {
 
 float Odometer_s::get_axis(axis_t axis) {
     assert(axis <= axis_t::count_);
-    return config_store().get_odometer_axis(ftrstd::to_underlying(axis)) + trip_xyz[ftrstd::to_underlying(axis)].load();
+    load_bases();
+    return base_xyz[ftrstd::to_underlying(axis)].load() + trip_xyz[ftrstd::to_underlying(axis)].load();
 }
 
 void Odometer_s::add_extruded(uint8_t extruder, float value) {
@@ -92,7 +171,8 @@ void Odometer_s::add_extruded(uint8_t extruder, float value) {
 
 float Odometer_s::get_extruded(uint8_t extruder) {
     assert(extruder < HOTENDS);
-    return config_store().get_odometer_extruded_length(extruder) + MAX(0.0f, extruded[extruder].load());
+    load_bases();
+    return base_extruded[extruder].load() + MAX(0.0f, extruded[extruder].load());
 }
 
 float Odometer_s::get_extruded_all() {
@@ -110,7 +190,8 @@ void Odometer_s::add_toolpick(uint8_t extruder) {
 
 uint32_t Odometer_s::get_toolpick(uint8_t extruder) {
     assert(extruder < HOTENDS);
-    return config_store().get_odometer_toolpicks(extruder) + toolpick[extruder].load();
+    load_bases();
+    return base_toolpick[extruder].load() + toolpick[extruder].load();
 }
 
 uint32_t Odometer_s::get_toolpick_all() {
@@ -126,7 +207,8 @@ void Odometer_s::add_mmu_change() {
 }
 
 uint32_t Odometer_s::get_mmu_changes() {
-    return config_store().mmu_changes.get() + mmu_changes;
+    load_bases();
+    return base_mmu_changes.load() + mmu_changes;
 }
 
 void Odometer_s::add_time(uint32_t value) {
@@ -134,6 +216,6 @@ void Odometer_s::add_time(uint32_t value) {
 }
 
 uint32_t Odometer_s::get_time() {
-    uint32_t time = config_store().odometer_time.get() + MAX(0ul, duration_time.load());
-    return time;
+    load_bases();
+    return base_time.load() + MAX(0ul, duration_time.load());
 }
@@ -29,6 +29,20 @@ private:
     std::atomic<uint32_t> duration_time = 0;
     std::atomic<uint32_t> mmu_changes = 0;
 
+    /// persistent bases the trip counters add to, merged from the counter ring and the journal checkpoint on first use
+    std::atomic<float> base_xyz[axis_count] = {};
+    std::atomic<float> base_extruded[HOTENDS] = {};
+    std::atomic<uint32_t> base_toolpick[HOTENDS] = {};
+    std::atomic<uint32_t> base_time = 0;
+    std::atomic<uint32_t> base_mmu_changes = 0;
+    std::atomic<bool> bases_loaded = false;
+
+    /// saves since the journal checkpoint was last refreshed
+    uint8_t saves_since_checkpoint = 0;
+
+    /// Loads the persistent bases; counter ring values win over the (older or equal) journal checkpoint
+    void load_bases();
+
     Odometer_s() = default;
 
 public:
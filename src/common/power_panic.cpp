@@ -3,6 +3,7 @@
 
 #include <type_traits>
 #include <assert.h>
+#include <string.h>
 
 #include <option/has_puppies.h>
 #include <option/has_dwarf.h>
@@ -127,17 +128,20 @@ void ac_fault_task_main([[maybe_unused]] void const *argument) {
 static constexpr uint32_t FLASH_OFFSET = w25x_pp_start_address;
 static constexpr uint32_t FLASH_SIZE = w25x_pp_size;
 
+// how often to compare the live stable state against the last checkpoint
+// (prime to spread the work against other periodic tasks)
+static constexpr uint32_t CHECKPOINT_PERIOD_MS = 997;
+
 // WARNING: mind the alignment, the following structures are not automatically packed
 // as they're shared also for the on-memory copy. The on-memory copy can be avoided
 // if we decide to use two flash blocks (keeping one as a working set)
 #pragma GCC diagnostic push
 #pragma GCC diagnostic warning "-Wpadded"
 
-// planner state (TODO: a _lot_ of essential state is missing here and Crash_s also due to
+// planner state changing with every move; serialized only in the panic window
+// (TODO: a _lot_ of essential state is missing here and Crash_s also due to
 // the partial Motion_Parameters implementation)
 struct flash_planner_t {
-    user_planner_settings_t settings;
-
     float z_position;
 #if DISABLED(CLASSIC_JERK)
     float junction_deviation_mm;
@@ -146,7 +150,6 @@ struct flash_planner_t {
     int16_t target_nozzle[HOTENDS];
     int16_t flow_percentage[HOTENDS];
     int16_t target_bed;
-    int16_t extrude_min_temp;
 #if ENABLED(MODULAR_HEATBED)
     uint16_t enabled_bedlets_mask;
     uint8_t _padding_heat[2]; // padding to 2 or 4 bytes?
@@ -157,20 +160,6 @@ struct flash_planner_t {
     uint8_t was_crashed;
     uint8_t fan_speed;
     uint8_t axis_relative;
-    uint8_t allow_cold_extrude;
-
-    uint8_t gcode_compatibility_mode;
-    uint8_t fan_compatibility_mode;
-
-    uint8_t marlin_debug_flags;
-
-    uint8_t _padding_is[2];
-
-    // IS/PA
-    input_shaper::AxisConfig axis_config[3]; // XYZ
-    input_shaper::AxisConfig original_y;
-    input_shaper::WeightAdjustConfig axis_y_weight_adjust;
-    pressure_advance::Config axis_e_config;
 };
 
 // fully independent state that persist across panics until the end of the print
@@ -232,17 +221,18 @@ struct flash_data {
         static void save();
     } fixed;
 
-    // varying parameters
-    struct state_t {
-        flash_crash_t crash;
-        flash_planner_t planner;
-        flash_progress_t progress;
-        flash_print_t print;
-        flash_toolchanger_t toolchanger;
+    // rarely-changing state, checkpointed from the background while printing
+    // so the panic window only has to serialize the volatile state below
+    // (see update_checkpoint())
+    struct stable_t {
+        user_planner_settings_t settings;
+
+        // IS/PA
+        input_shaper::AxisConfig axis_config[3]; // XYZ
+        input_shaper::AxisConfig original_y;
+        input_shaper::WeightAdjustConfig axis_y_weight_adjust;
+        pressure_advance::Config axis_e_config;
 
-#if ENABLED(CANCEL_OBJECTS)
-        uint32_t canceled_objects;
-#endif
 #if ENABLED(PRUSA_TOOL_MAPPING)
         ToolMapper::serialized_state_t tool_mapping;
 #endif
@@ -253,6 +243,27 @@ struct flash_data {
         // The chamber API has it as optional, we map nullopt (disabled) to
         // chamber_temp_off (0xffff), as optional is not guaranteed to be POD.
         uint16_t chamber_target_temp;
+#endif
+        int16_t extrude_min_temp;
+        uint8_t allow_cold_extrude;
+        uint8_t gcode_compatibility_mode;
+        uint8_t fan_compatibility_mode;
+        uint8_t marlin_debug_flags;
+
+        static void load();
+        static void save();
+    } stable;
+
+    // varying parameters
+    struct state_t {
+        flash_crash_t crash;
+        flash_planner_t planner;
+        flash_progress_t progress;
+        flash_print_t print;
+        flash_toolchanger_t toolchanger;
+
+#if ENABLED(CANCEL_OBJECTS)
+        uint32_t canceled_objects;
 #endif
         GCodeReaderStreamRestoreInfo gcode_stream_restore_info;
         uint8_t invalid = true; // set to zero before writing, cleared on erase
@@ -290,6 +301,14 @@ static struct : public flash_data::state_t {
     uint32_t fault_stamp; // time since acFault trigger
 } state_buf;
 
+// Last checkpointed copy of the stable state, mirroring the flash content
+static flash_data::stable_t stable_buf;
+
+// Background checkpointing bookkeeping: whether the flash `stable` section
+// matches stable_buf and when we last compared against the live state
+static bool stable_saved = false;
+static uint32_t last_checkpoint_ms = 0;
+
 // Helper functions to read/write to the flash area with type checking
 #define FLASH_DATA_OFF(member) (FLASH_OFFSET + offsetof(flash_data, member))
 
@@ -348,6 +367,17 @@ void flash_data::fixed_t::load() {
     FLASH_LOAD(fixed.media_SFN_path, state_buf.media_SFN_path);
 }
 
+void flash_data::stable_t::save() {
+    FLASH_SAVE(stable, stable_buf);
+    if (w25x_fetch_error()) {
+        log_error(PowerPanic, "Failed to save stable data.");
+    }
+}
+
+void flash_data::stable_t::load() {
+    FLASH_LOAD(stable, stable_buf);
+}
+
 void flash_data::state_t::save() {
     state_buf.invalid = false;
     w25x_program(FLASH_DATA_OFF(state), reinterpret_cast<const uint8_t *>(&state_buf), sizeof(flash_data::state_t));
@@ -393,6 +423,88 @@ bool panic_is_active() {
     return power_panic_state >= PPState::Triggered;
 }
 
+/// Collect the current values of all background-checkpointed state
+static void capture_stable_state(flash_data::stable_t &buf) {
+    // zero also the padding so the buffer can be compared with memcmp()
+    memset(&buf, 0, sizeof(buf));
+
+    buf.settings = planner.user_settings;
+
+    // IS/PA
+    LOOP_XYZ(i) {
+        if (!input_shaper::current_config().axis[i]) {
+            buf.axis_config[i].frequency = 0.f;
+        } else {
+            buf.axis_config[i] = *input_shaper::current_config().axis[i];
+        }
+    }
+
+    if (!input_shaper::get_config_for_m74().axis[Y_AXIS]) {
+        buf.original_y.frequency = 0.f;
+    } else {
+        buf.original_y = *input_shaper::get_config_for_m74().axis[Y_AXIS];
+    }
+
+    if (!input_shaper::current_config().weight_adjust_y) {
+        buf.axis_y_weight_adjust.frequency_delta = 0.f;
+    } else {
+        buf.axis_y_weight_adjust = *input_shaper::current_config().weight_adjust_y;
+    }
+
+    buf.axis_e_config = pressure_advance::get_axis_e_config();
+
+#if ENABLED(PRUSA_TOOL_MAPPING)
+    tool_mapper.serialize(buf.tool_mapping);
+#endif
+#if ENABLED(PRUSA_SPOOL_JOIN)
+    spool_join.serialize(buf.spool_join);
+#endif
+#if HAS_CHAMBER_API()
+    buf.chamber_target_temp = buddy::chamber().target_temperature().value_or(chamber_temp_off);
+#endif
+#if ENABLED(PREVENT_COLD_EXTRUSION)
+    buf.extrude_min_temp = thermalManager.extrude_min_temp;
+    buf.allow_cold_extrude = thermalManager.allow_cold_extrude;
+#endif
+
+#if ENABLED(GCODE_COMPATIBILITY_MK3)
+    static_assert(
+        std::is_same_v<
+            decltype(buf.gcode_compatibility_mode),
+            std::underlying_type_t<GcodeSuite::GcodeCompatibilityMode>>
+        == true);
+    buf.gcode_compatibility_mode = static_cast<uint8_t>(GcodeSuite::gcode_compatibility_mode);
+#endif
+#if ENABLED(FAN_COMPATIBILITY_MK4_MK3)
+    static_assert(
+        std::is_same_v<
+            decltype(buf.fan_compatibility_mode),
+            std::underlying_type_t<GcodeSuite::FanCompatibilityMode>>
+        == true);
+    buf.fan_compatibility_mode = static_cast<uint8_t>(GcodeSuite::fan_compatibility_mode);
+#endif
+
+    static_assert(
+        std::is_same_v<
+            decltype(buf.marlin_debug_flags),
+            decltype(marlin_debug_flags)>
+        == true);
+    buf.marlin_debug_flags = marlin_debug_flags;
+}
+
+/// Mark the flash content as complete, unless a panic triggered while it was
+/// being written (in which case the save falls back to a full rebuild)
+static void finish_checkpoint() {
+    HAL_NVIC_DisableIRQ(buddy::hw::acFault.getIRQn());
+    if (power_panic_state <= PPState::Prepared) {
+        stable_saved = true;
+        power_panic_state = PPState::Prepared;
+        HAL_NVIC_EnableIRQ(buddy::hw::acFault.getIRQn());
+    }
+    // if a fault triggered meanwhile the IRQ was already disabled by the isr
+    // itself and has to stay that way
+}
+
 void prepare() {
     // do not erase/save unless we have a path we can use to resume later
     if (!state_buf.nested_fault) {
@@ -400,16 +512,72 @@ void prepare() {
         marlin_vars().media_SFN_path.copy_to(state_buf.media_SFN_path, sizeof(state_buf.media_SFN_path));
     }
 
-    // erase and save the MBL data
+    // erase and save the MBL data along with the first stable checkpoint
     flash_data::erase();
     flash_data::fixed_t::save();
+    capture_stable_state(stable_buf);
+    flash_data::stable_t::save();
     if (w25x_fetch_error()) {
         log_error(PowerPanic, "Failed to save fixed data.");
         return;
     }
 
     log_info(PowerPanic, "powerpanic prepared");
-    power_panic_state = PPState::Prepared;
+    finish_checkpoint();
+}
+
+void update_checkpoint() {
+    if (power_panic_state != PPState::Prepared) {
+        // nothing persisted for this print yet (or a panic is in progress)
+        return;
+    }
+
+    uint32_t now = ticks_ms();
+    if (now - last_checkpoint_ms < CHECKPOINT_PERIOD_MS) {
+        return;
+    }
+    last_checkpoint_ms = now;
+
+#if HAS_TOOLCHANGER()
+    if (prusa_toolchanger.is_conf_restore_pending()) {
+        // a toolchange temporarily replaced the planner config; comparing now
+        // would checkpoint the temporary values and rewrite again right after
+        return;
+    }
+#endif /*HAS_TOOLCHANGER()*/
+
+    flash_data::stable_t candidate;
+    capture_stable_state(candidate);
+    if (stable_saved && memcmp(&candidate, &stable_buf, sizeof(candidate)) == 0) {
+        // checkpoint is up to date
+        return;
+    }
+
+    // rewriting needs a sector erase which also wipes the fixed section: drop
+    // out of Prepared first so a panic hitting mid-rewrite falls back to a
+    // full save in the panic window instead of trusting half-written data;
+    // like in finish_checkpoint(), the transition must not race the AC-fault
+    // isr or it would overwrite Triggered and drop an in-flight panic
+    HAL_NVIC_DisableIRQ(buddy::hw::acFault.getIRQn());
+    if (power_panic_state != PPState::Prepared) {
+        // a fault triggered since the check above; the isr keeps its IRQ disabled
+        return;
+    }
+    power_panic_state = PPState::Inactive;
+    HAL_NVIC_EnableIRQ(buddy::hw::acFault.getIRQn());
+    stable_saved = false;
+    stable_buf = candidate;
+
+    flash_data::erase();
+    flash_data::fixed_t::save();
+    flash_data::stable_t::save();
+    if (w25x_fetch_error()) {
+        log_error(PowerPanic, "Failed to update checkpoint.");
+        return;
+    }
+
+    log_debug(PowerPanic, "checkpoint updated");
+    finish_checkpoint();
 }
 
 enum class ResumeState : uint8_t {
@@ -470,6 +638,7 @@ void resume_print() {
 
     // load the data
     flash_data::fixed_t::load();
+    flash_data::stable_t::load();
     flash_data::state_t::load();
     if (w25x_fetch_error()) {
         log_error(PowerPanic, "Setup load failed.");
@@ -560,21 +729,21 @@ void resume_loop() {
         // set bed temperatures
         thermalManager.setTargetBed(state_buf.planner.target_bed);
 #if ENABLED(PREVENT_COLD_EXTRUSION)
-        thermalManager.extrude_min_temp = state_buf.planner.extrude_min_temp;
-        thermalManager.allow_cold_extrude = state_buf.planner.allow_cold_extrude;
+        thermalManager.extrude_min_temp = stable_buf.extrude_min_temp;
+        thermalManager.allow_cold_extrude = stable_buf.allow_cold_extrude;
 #endif
 
 #if ENABLED(GCODE_COMPATIBILITY_MK3)
-        GcodeSuite::gcode_compatibility_mode = static_cast<GcodeSuite::GcodeCompatibilityMode>(state_buf.planner.gcode_compatibility_mode);
+        GcodeSuite::gcode_compatibility_mode = static_cast<GcodeSuite::GcodeCompatibilityMode>(stable_buf.gcode_compatibility_mode);
 #endif
 #if ENABLED(FAN_COMPATIBILITY_MK4_MK3)
-        GcodeSuite::fan_compatibility_mode = static_cast<GcodeSuite::FanCompatibilityMode>(state_buf.planner.fan_compatibility_mode);
+        GcodeSuite::fan_compatibility_mode = static_cast<GcodeSuite::FanCompatibilityMode>(stable_buf.fan_compatibility_mode);
 #endif
 
-        marlin_debug_flags = state_buf.planner.marlin_debug_flags;
+        marlin_debug_flags = stable_buf.marlin_debug_flags;
 
         // planner settings
-        planner.apply_settings(state_buf.planner.settings);
+        planner.apply_settings(stable_buf.settings);
         planner.refresh_acceleration_rates();
 #if !HAS_CLASSIC_JERK
         planner.max_e_jerk = state_buf.planner.max_jerk.e;
@@ -595,16 +764,16 @@ void resume_loop() {
         cancelable.canceled = state_buf.canceled_objects;
 #endif
 #if ENABLED(PRUSA_TOOL_MAPPING)
-        tool_mapper.deserialize(state_buf.tool_mapping);
+        tool_mapper.deserialize(stable_buf.tool_mapping);
 #endif
 #if ENABLED(PRUSA_SPOOL_JOIN)
-        spool_join.deserialize(state_buf.spool_join);
+        spool_join.deserialize(stable_buf.spool_join);
 #endif
 #if HAS_CHAMBER_API()
-        if (state_buf.chamber_target_temp == chamber_temp_off) {
+        if (stable_buf.chamber_target_temp == chamber_temp_off) {
             buddy::chamber().set_target_temperature(std::nullopt);
         } else {
-            buddy::chamber().set_target_temperature(state_buf.chamber_target_temp);
+            buddy::chamber().set_target_temperature(stable_buf.chamber_target_temp);
         }
 #endif
 
@@ -711,26 +880,26 @@ void resume_loop() {
 
         // IS/PA
         LOOP_XYZ(i) {
-            if (state_buf.planner.axis_config[i].frequency == 0.f) {
+            if (stable_buf.axis_config[i].frequency == 0.f) {
                 input_shaper::set_axis_config((AxisEnum)i, std::nullopt);
             } else {
-                input_shaper::set_axis_config((AxisEnum)i, state_buf.planner.axis_config[i]);
+                input_shaper::set_axis_config((AxisEnum)i, stable_buf.axis_config[i]);
             }
         }
 
-        if (state_buf.planner.original_y.frequency == 0.f) {
+        if (stable_buf.original_y.frequency == 0.f) {
             input_shaper::set_config_for_m74(Y_AXIS, std::nullopt);
         } else {
-            input_shaper::set_config_for_m74(Y_AXIS, state_buf.planner.original_y);
+            input_shaper::set_config_for_m74(Y_AXIS, stable_buf.original_y);
         }
 
-        if (state_buf.planner.axis_y_weight_adjust.frequency_delta != 0.f) {
+        if (stable_buf.axis_y_weight_adjust.frequency_delta != 0.f) {
             input_shaper::set_axis_y_weight_adjust(std::nullopt);
         } else {
-            input_shaper::set_axis_y_weight_adjust(state_buf.planner.axis_y_weight_adjust);
+            input_shaper::set_axis_y_weight_adjust(stable_buf.axis_y_weight_adjust);
         }
 
-        pressure_advance::set_axis_e_config(state_buf.planner.axis_e_config);
+        pressure_advance::set_axis_e_config(stable_buf.axis_e_config);
 
         // restore crash state
         {
@@ -949,15 +1118,6 @@ void panic_loop() {
 
 #if ENABLED(CANCEL_OBJECTS)
         state_buf.canceled_objects = cancelable.canceled;
-#endif
-#if ENABLED(PRUSA_TOOL_MAPPING)
-        tool_mapper.serialize(state_buf.tool_mapping);
-#endif
-#if ENABLED(PRUSA_SPOOL_JOIN)
-        spool_join.serialize(state_buf.spool_join);
-#endif
-#if HAS_CHAMBER_API()
-        state_buf.chamber_target_temp = buddy::chamber().target_temperature().value_or(chamber_temp_off);
 #endif
         state_buf.gcode_stream_restore_info = marlin_server::stream_restore_info();
 #if HAS_TOOLCHANGER()
@@ -969,9 +1129,12 @@ void panic_loop() {
 
         log_info(PowerPanic, "powerpanic saving");
         if (state_buf.orig_state != PPState::Prepared) {
-            // no prepare was performed for this print yet, prepare the flash now
+            // no complete prepare/checkpoint was performed for this print yet,
+            // rebuild the whole flash content now
             flash_data::erase();
             flash_data::fixed_t::save();
+            capture_stable_state(stable_buf);
+            flash_data::stable_t::save();
         }
         flash_data::state_t::save();
         flash_data::sync();
@@ -1179,10 +1342,6 @@ void ac_fault_isr() {
 #if ENABLED(MODULAR_HEATBED)
         state_buf.planner.enabled_bedlets_mask = thermalManager.getEnabledBedletMask();
 #endif
-#if ENABLED(PREVENT_COLD_EXTRUSION)
-        state_buf.planner.extrude_min_temp = thermalManager.extrude_min_temp;
-        state_buf.planner.allow_cold_extrude = thermalManager.allow_cold_extrude;
-#endif
 
         // remaining planner parameters
         HOTEND_LOOP() {
@@ -1190,36 +1349,11 @@ void ac_fault_isr() {
         }
         state_buf.planner.axis_relative = gcode.axis_relative;
 
-        // IS/PA
-        LOOP_XYZ(i) {
-            if (!input_shaper::current_config().axis[i]) {
-                state_buf.planner.axis_config[i].frequency = 0.f;
-            } else {
-                state_buf.planner.axis_config[i] = *input_shaper::current_config().axis[i];
-            }
-        }
-
-        if (!input_shaper::get_config_for_m74().axis[Y_AXIS]) {
-            state_buf.planner.original_y.frequency = 0.f;
-        } else {
-            state_buf.planner.original_y = *input_shaper::get_config_for_m74().axis[Y_AXIS];
-        }
-
-        if (!input_shaper::current_config().weight_adjust_y) {
-            state_buf.planner.axis_y_weight_adjust.frequency_delta = 0.f;
-        } else {
-            state_buf.planner.axis_y_weight_adjust = *input_shaper::current_config().weight_adjust_y;
-        }
-
-        state_buf.planner.axis_e_config = pressure_advance::get_axis_e_config();
-
 #if HAS_TOOLCHANGER()
         // Restore planner config if it was changed by toolchange
         prusa_toolchanger.try_restore();
 #endif /*HAS_TOOLCHANGER()*/
 
-        state_buf.planner.settings = planner.user_settings;
-
 #if !HAS_CLASSIC_JERK
         state_buf.planner.max_jerk.e = planner.max_e_jerk;
         state_buf.planner.junction_deviation_mm = planner.junction_deviation_mm;
@@ -1232,30 +1366,6 @@ void ac_fault_isr() {
         crash_s.set_state(Crash_s::TRIGGERED_AC_FAULT);
     }
 
-#if ENABLED(GCODE_COMPATIBILITY_MK3)
-    static_assert(
-        std::is_same_v<
-            decltype(state_buf.planner.gcode_compatibility_mode),
-            std::underlying_type_t<GcodeSuite::GcodeCompatibilityMode>>
-        == true);
-    state_buf.planner.gcode_compatibility_mode = static_cast<uint8_t>(GcodeSuite::gcode_compatibility_mode);
-#endif
-#if ENABLED(FAN_COMPATIBILITY_MK4_MK3)
-    static_assert(
-        std::is_same_v<
-            decltype(state_buf.planner.fan_compatibility_mode),
-            std::underlying_type_t<GcodeSuite::FanCompatibilityMode>>
-        == true);
-    state_buf.planner.fan_compatibility_mode = static_cast<uint8_t>(GcodeSuite::fan_compatibility_mode);
-#endif
-
-    static_assert(
-        std::is_same_v<
-            decltype(state_buf.planner.marlin_debug_flags),
-            decltype(marlin_debug_flags)>
-        == true);
-    state_buf.planner.marlin_debug_flags = marlin_debug_flags;
-
     // Disabling heaters & fans on dwarves wouldn't be even done before the dwarvers are disabled altogether soon
     // We're in the ISR and Dwarf functions lock mutexes, which we cannot do here - so the simplest thing is to just skip this step altogether.
     // BFW-6419
@@ -24,6 +24,11 @@ void reset();
 // Call once after MBL during the printing process (usually after a successful G29)
 void prepare();
 
+// Keep the background checkpoint of rarely-changing state up to date so the
+// panic window only has to serialize the volatile state.
+// Call periodically from the server loop while printing; cheap when unchanged
+void update_checkpoint();
+
 // Start resuming a stored print
 void resume_print();
 
@@ -228,16 +228,93 @@ std::tuple<ProbeAnalysisBase::Sample, ProbeAnalysisBase::Line, ProbeAnalysisBase
         return std::make_tuple(window.end(), Line::Invalid(), Line::Invalid());
     }
 
+    /// Running regression sums over one side of the split
+    ///
+    /// The split moves one sample at a time, so both sides can be maintained
+    /// in O(1) per candidate instead of recomputing the regression (and its
+    /// error) over the whole range every time.
+    struct RunningSums {
+        float n = 0;
+        float xSum = 0, ySum = 0, xySum = 0, x2Sum = 0, y2Sum = 0;
+
+        void Add(float x, float y) {
+            n += 1;
+            xSum += x;
+            ySum += y;
+            xySum += x * y;
+            x2Sum += x * x;
+            y2Sum += y * y;
+        }
+
+        void Remove(float x, float y) {
+            n -= 1;
+            xSum -= x;
+            ySum -= y;
+            xySum -= x * y;
+            x2Sum -= x * x;
+            y2Sum -= y * y;
+        }
+
+        /// Same solution as LinearRegression(), just from the accumulated sums
+        Line Regression() const {
+            float aNum = n * xySum - xSum * ySum;
+            float aDenom = n * x2Sum - (xSum * xSum);
+            float bNum = x2Sum * ySum - xSum * xySum;
+            if (aDenom == 0) {
+                return Line::Invalid();
+            }
+            return Line(aNum / aDenom, bNum / aDenom);
+        }
+
+        /// Residual sum of squares of the given line over the accumulated samples
+        float Error(Line line) const {
+            return y2Sum - 2 * line.a * xySum - 2 * line.b * ySum
+                + line.a * line.a * x2Sum + 2 * line.a * line.b * xSum
+                + n * line.b * line.b;
+        }
+    };
+
+    /// How often to recompute the shrinking side from scratch. Removing
+    /// samples from float sums accumulates rounding drift; renormalizing
+    /// every few steps keeps the drift bounded while staying O(1) amortized.
+    constexpr int renormalizationPeriod = 16;
+
+    auto xOf = [this](Sample s) { return static_cast<float>(TimeOfSample(s)); };
+
+    RunningSums left, right;
+    left.Add(xOf(samples.first), samples.first->load);
+    for (auto it = samples.first + 1; it <= samples.last; ++it) {
+        right.Add(xOf(it), it->load);
+    }
+
     float bestError = std::numeric_limits<float>::max();
     Sample bestSplit = window.end();
     Line leftLine, rightLine;
+    int stepsSinceRenormalization = 0;
 
     for (auto split = samples.first + 1; split < samples.last; ++split) {
-        auto result = CalculateErrorWhenLoadRepresentedAsLines(samples, split);
-        float error = std::get<0>(result);
-        if (!std::isnan(error) && error < bestError) {
-            bestSplit = split;
-            std::tie(bestError, leftLine, rightLine) = result;
+        // left covers [first, split), right covers [split, last]
+        Line leftCandidate = left.Regression();
+        Line rightCandidate = right.Regression();
+        if (leftCandidate.IsValid() && rightCandidate.IsValid()) {
+            float error = left.Error(leftCandidate) + right.Error(rightCandidate);
+            if (!std::isnan(error) && error < bestError) {
+                bestError = error;
+                bestSplit = split;
+                leftLine = leftCandidate;
+                rightLine = rightCandidate;
+            }
+        }
+
+        // move the split sample from the right side to the left one
+        left.Add(xOf(split), split->load);
+        right.Remove(xOf(split), split->load);
+        if (++stepsSinceRenormalization >= renormalizationPeriod) {
+            stepsSinceRenormalization = 0;
+            right = RunningSums();
+            for (auto it = split + 1; it <= samples.last; ++it) {
+                right.Add(xOf(it), it->load);
+            }
         }
     }
 
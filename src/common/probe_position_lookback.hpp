@@ -3,15 +3,14 @@
 #include <inplace_function.hpp>
 #include <stdint.h>
 #include <stddef.h>
-#include <atomic>
-#include <cmath>
-#include <functional>
+
+#include "time_series_ring.hpp"
 
 namespace buddy {
 
 class ProbePositionLookback {
 public:
-    ProbePositionLookback();
+    ProbePositionLookback() = default;
 
     float get_position_at(uint32_t time_us, stdext::inplace_function<float()> latest_z_position);
 
@@ -20,20 +19,10 @@ public:
     void add_sample(uint32_t time, float position);
 
 private:
-    struct PositionSample_t {
-        uint32_t time;
-        float position;
-
-        PositionSample_t()
-            : time(0)
-            , position(NAN) {}
-    };
-
     static constexpr size_t NUM_SAMPLES = 16;
     static constexpr size_t SAMPLES_REQUESTED_DIFF = 1900;
 
-    PositionSample_t samples[NUM_SAMPLES];
-    std::atomic<size_t> newest_sample_pos;
+    TimeSeriesRing<float, NUM_SAMPLES> samples;
 };
 
 extern ProbePositionLookback probePositionLookback;
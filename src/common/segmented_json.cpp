@@ -61,6 +61,18 @@ JsonResult JsonOutput::output_str_chunk(size_t resume_point, const char *str, si
 
 JsonResult JsonOutput::output_field_str(size_t resume_point, const char *name, const char *value) {
     JSONIFY_STR(value);
+    // Unlike the generic output(), we know the exact size of this field up
+    // front. When it can't fit, suspend right away instead of formatting it
+    // into the buffer and throwing the result away ‒ long strings (file
+    // paths, metadata) are exactly the fields that tend to straddle a buffer
+    // boundary and would pay for the extra formatting pass.
+    //
+    // 5 for the quotes and the colon; output() also insists on one spare byte
+    // for the \0 of vsnprintf, so "equal" still doesn't fit.
+    const size_t value_escaped_len = value_len > 0 ? value_len - 1 : strlen(value);
+    if (strlen(name) + value_escaped_len + 5 >= buffer_size) {
+        return suspend(resume_point);
+    }
     return output(resume_point, "\"%s\":\"%s\"", name, value_escaped);
 }
 
@@ -140,6 +152,9 @@ std::tuple<JsonResult, size_t> LowLevelJsonRenderer::render(uint8_t *buffer, siz
     JsonOutput output(buffer, buffer_size_rest, resume_point);
     const auto result = content(resume_point, output);
     assert(buffer_size_rest <= buffer_size);
+    if ((result == JsonResult::Incomplete || result == JsonResult::BufferTooSmall) && suspend_cnt < 255) {
+        suspend_cnt++;
+    }
     size_t written = (result == JsonResult::Abort) ? 0 : buffer_size - buffer_size_rest;
     return make_tuple(result, written);
 }
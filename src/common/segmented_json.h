@@ -212,8 +212,17 @@ public:
 class LowLevelJsonRenderer : public ChunkRenderer {
 private:
     size_t resume_point = 0;
+    uint8_t suspend_cnt = 0;
 
 public:
+    /// How many times the rendering suspended because the next field didn't
+    /// fit into the provided buffer.
+    ///
+    /// The field that didn't fit gets formatted again into the next buffer,
+    /// so this doubles as the number of retried fields ‒ useful as a metric
+    /// of how well the buffers are sized. Saturates instead of overflowing.
+    uint8_t suspends() const { return suspend_cnt; }
+
     /// The outer entry point.
     ///
     /// When called, this would produce the next part of the resulting JSON into the provided buffer and signal:
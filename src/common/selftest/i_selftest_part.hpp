@@ -9,6 +9,7 @@
 #include "selftest_loop_result.hpp"
 #include "client_response.hpp"
 #include <cstdint>
+#include <span>
 
 namespace selftest {
 
@@ -67,6 +68,39 @@ private:
     static PhasesSelftest fsm_phase_index;
 };
 
+/**
+ * @brief Group of independent selftest parts running concurrently.
+ *
+ * Independent means the parts do not compete for the physical printer - they
+ * can all do their thing at once (heaters of all tools, fans ...). Tests that
+ * need a picked tool or axis motion are not independent and must keep running
+ * one after another. All members of a group must also be created for phases
+ * of the same fsm dialog, so the GUI can display them together
+ * (see fsm_phase_index).
+ *
+ * The group does not own the parts; the caller deletes the finished ones
+ * (and may null their pointers - null entries are skipped).
+ */
+class PartGroup {
+public:
+    explicit PartGroup(std::span<IPartHandler *const> parts)
+        : parts(parts) {}
+
+    /// Loops every active part once.
+    /// @returns true while any part is still in progress
+    bool LoopOnce();
+
+    /// @returns true if the part at @p index finished within the last LoopOnce() call
+    bool JustFinished(size_t index) const { return just_finished & (1 << index); }
+
+    /// @returns true if any part finished within the last LoopOnce() call
+    bool AnyJustFinished() const { return just_finished != 0; }
+
+private:
+    std::span<IPartHandler *const> parts;
+    uint32_t just_finished = 0;
+};
+
 /**
  * @brief Helper class to return from selftest instead of bool.
  * Backwards compatible with bool.
@@ -155,29 +155,29 @@ void phaseHeaters_bed_ena(IPartHandler *&pBed, const HeaterConfig_t &config_bed)
 // data for both subtests must be sent together
 // we could loose some events, so we must be sending entire state of both parts
 bool phaseHeaters(std::array<IPartHandler *, HOTENDS> &pNozzles, IPartHandler **pBed) {
-    // true when nozzle just finished test
-    bool just_finished_noz[HOTENDS] {};
-    for (size_t i = 0; i < HOTENDS; i++) {
-        if (pNozzles[i]) {
-            just_finished_noz[i] = !pNozzles[i]->Loop();
-        }
-    }
+    // nozzles and bed are independent, run them as one concurrent group;
+    // the bed occupies the slot behind the nozzles
+    std::array<IPartHandler *, HOTENDS + 1> group_parts;
+    std::copy(pNozzles.begin(), pNozzles.end(), group_parts.begin());
+    group_parts[HOTENDS] = pBed ? *pBed : nullptr;
+
+    PartGroup group(group_parts);
+    group.LoopOnce();
 
-    // true when just finished nozzle test
-    const bool just_finished_bed = pBed && *pBed && !(*pBed)->Loop();
+    const bool just_finished_bed = group.JustFinished(HOTENDS);
 
     // change dialog state
     marlin_server::fsm_change_extended(IPartHandler::GetFsmPhase(), resultHeaters);
 
     // Continue below only if some of the tests just finished, if not, just run this again until some finishes
-    if (!just_finished_bed && !std::ranges::any_of(just_finished_noz, [](bool val) { return val; })) {
+    if (!group.AnyJustFinished()) {
         return true;
     }
 
     // just finished noz or bed, it is extremely unlikely they would finish both at same time
     SelftestResult eeres = config_store().selftest_result.get();
     HOTEND_LOOP() {
-        if (just_finished_noz[e]) {
+        if (group.JustFinished(e)) {
             eeres.tools[e].nozzle = pNozzles[e]->GetResult();
         }
     }
@@ -188,7 +188,7 @@ bool phaseHeaters(std::array<IPartHandler *, HOTENDS> &pNozzles, IPartHandler **
     config_store().selftest_result.set(eeres);
 
     for (size_t i = 0; i < HOTENDS; i++) {
-        if (just_finished_noz[i]) {
+        if (group.JustFinished(i)) {
 #if HAS_SELFTEST_POWER_CHECK_BOTH()
             PowerCheckBoth::Instance().UnBindNozzle();
 #endif
@@ -178,3 +178,19 @@ void IPartHandler::Abort() {
 bool IPartHandler::WaitSoLastStateIsVisible() const {
     return (SelftestInstance().GetTime() - current_state_enter_time) >= time_to_show_result;
 }
+
+bool PartGroup::LoopOnce() {
+    just_finished = 0;
+    bool in_progress = false;
+    for (size_t i = 0; i < parts.size(); ++i) {
+        if (parts[i] == nullptr) {
+            continue;
+        }
+        if (parts[i]->Loop()) {
+            in_progress = true;
+        } else {
+            just_finished |= 1 << i;
+        }
+    }
+    return in_progress;
+}
@@ -4,11 +4,14 @@
 #include <gui/file_list_defs.h>
 
 #include <array>
+#include <atomic>
 #include <optional>
 #include <cassert>
+#include <cstddef>
 #include <cstdint>
 #include <cstring>
 #include <memory>
+#include <new>
 
 template <size_t S>
 class Buffer {
@@ -82,6 +85,92 @@ constexpr size_t BORROW_BUF_SIZE = std::max(512, FILE_PATH_BUFFER_LEN + FILE_NAM
 using SharedBuffer = Buffer<BORROW_BUF_SIZE>;
 using SharedBorrow = std::shared_ptr<SharedBuffer::Borrow>;
 
+// A tiny static pool for the control blocks of SharedBorrow.
+//
+// Wrapping a borrow into a shared_ptr sits on the hot path of parsing every
+// Connect command (gcodes, paths, tokens all go through it) and we don't want
+// a malloc per command ‒ nor the theoretical possibility of it failing under
+// memory pressure. There are only a few shared buffers in the whole firmware
+// and each can be borrowed at most once at a time, so a handful of slots is
+// plenty; if they ever run out, we quietly fall back to the heap.
+namespace shared_borrow_pool {
+    // Enough for the shared_ptr control block together with the borrow, with
+    // some margin, both on the firmware and on the 64bit unit test builds.
+    constexpr size_t slot_size = 64;
+    constexpr size_t slot_count = 4;
+    static_assert(slot_count <= 8, "The taken bitmask is a single byte");
+
+    struct Slots {
+        struct alignas(std::max_align_t) Slot {
+            std::array<std::byte, slot_size> bytes;
+        };
+        std::array<Slot, slot_count> slots;
+        // Bitmask of taken slots. Atomic, because the last reference to a
+        // command may be dropped by a different task than the one that
+        // parsed it.
+        std::atomic<uint8_t> taken = 0;
+    };
+
+    inline Slots instance;
+
+    template <class T>
+    class Allocator {
+    public:
+        using value_type = T;
+
+        Allocator() = default;
+        template <class U>
+        Allocator(const Allocator<U> &) {}
+
+        T *allocate(size_t n) {
+            if (n == 1 && sizeof(T) <= slot_size) {
+                uint8_t old = instance.taken.load(std::memory_order_relaxed);
+                for (;;) {
+                    size_t i = 0;
+                    while (i < slot_count && (old & (1 << i))) {
+                        i++;
+                    }
+                    if (i == slot_count) {
+                        // All taken.
+                        break;
+                    }
+                    if (instance.taken.compare_exchange_weak(old, old | (1 << i), std::memory_order_acquire, std::memory_order_relaxed)) {
+                        return reinterpret_cast<T *>(instance.slots[i].bytes.data());
+                    }
+                    // Someone raced us for the slot, old got reloaded, retry.
+                }
+            }
+            return static_cast<T *>(::operator new(n * sizeof(T)));
+        }
+        void deallocate(T *ptr, size_t n) noexcept {
+            const auto *raw = reinterpret_cast<const std::byte *>(ptr);
+            const auto *first = instance.slots.front().bytes.data();
+            const auto *last = instance.slots.back().bytes.data();
+            if (raw >= first && raw <= last) {
+                const size_t i = (raw - first) / sizeof(Slots::Slot);
+                instance.taken.fetch_and(static_cast<uint8_t>(~(1 << i)), std::memory_order_release);
+            } else {
+                ::operator delete(ptr);
+            }
+        }
+    };
+
+    template <class A, class B>
+    bool operator==(const Allocator<A> &, const Allocator<B> &) {
+        return true;
+    }
+    template <class A, class B>
+    bool operator!=(const Allocator<A> &, const Allocator<B> &) {
+        return false;
+    }
+} // namespace shared_borrow_pool
+
+// Wrap the borrow into a shared pointer, without going to the general heap
+// for the control block (see shared_borrow_pool above).
+inline SharedBorrow make_shared_borrow(SharedBuffer::Borrow &&borrow) {
+    return std::allocate_shared<SharedBuffer::Borrow>(shared_borrow_pool::Allocator<SharedBuffer::Borrow>(), std::move(borrow));
+}
+
 class SharedPath {
 private:
     SharedBorrow borrow;
@@ -89,7 +178,7 @@ private:
 public:
     SharedPath() = default;
     SharedPath(SharedBuffer::Borrow borrow)
-        : borrow(std::make_shared<SharedBuffer::Borrow>(std::move(borrow))) {}
+        : borrow(make_shared_borrow(std::move(borrow))) {}
     // Pointing into that borrow.
     const char *path() const {
         return reinterpret_cast<const char *>(borrow->data());
@@ -0,0 +1,102 @@
+#pragma once
+
+#include <atomic>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+
+/// Fixed-size ring of (timestamp, value) samples with monotonically
+/// increasing microsecond timestamps, supporting interpolated lookups
+/// into the stored history.
+///
+/// A single producer (possibly an interrupt) appends with push(); readers
+/// use value_at() to linearly interpolate the value at a past timestamp.
+/// The bracketing pair of samples is located by binary search over the
+/// ring, so a lookup costs O(log N) timestamp comparisons instead of
+/// walking the whole history. Timestamps are compared through signed
+/// differences, so lookups stay correct across the 32bit timer overflow
+/// as long as the stored window spans less than 2^31 us.
+///
+/// The value type is expected to be float-like: unwritten slots hold NaN,
+/// which propagates into lookups that touch them.
+template <typename T, size_t N>
+class TimeSeriesRing {
+public:
+    struct Sample {
+        uint32_t time = 0;
+        T value = std::numeric_limits<T>::quiet_NaN();
+    };
+
+    void push(uint32_t time, T value) {
+        const size_t pos = (newest_pos + 1) % N;
+        data[pos].time = time;
+        data[pos].value = value;
+        newest_pos = pos;
+        if (count < N) {
+            count = count + 1;
+        }
+    }
+
+    [[nodiscard]] Sample newest() const {
+        return data[newest_pos];
+    }
+
+    /// Interpolate the value at time_us
+    ///
+    /// @param now upper bound of the history: a sample newer than (or as new
+    ///            as) everything stored in the ring, typically the current
+    ///            time and value
+    /// @return interpolated value, or NaN when time_us lies outside the
+    ///         stored window
+    [[nodiscard]] T value_at(uint32_t time_us, Sample now) const {
+        // store position of the newest sample before proceeding (a new sample
+        // might be pushed later from an interrupt)
+        const size_t newest = newest_pos;
+        // only search slots that have been written; unwritten ones hold
+        // arbitrary-looking timestamps that would break the search order
+        const size_t oldest = N - count;
+
+        // logical index: 0 = oldest ring slot, N - 1 = newest, N = `now`
+        auto sample_at = [&](size_t logical) -> const Sample & {
+            return logical == N ? now : data[(newest + 1 + logical) % N];
+        };
+
+        // find the oldest logical sample strictly newer than time_us
+        size_t low = oldest;
+        size_t high = N + 1;
+        while (low < high) {
+            const size_t mid = (low + high) / 2;
+            if (static_cast<int32_t>(sample_at(mid).time - time_us) > 0) {
+                high = mid;
+            } else {
+                low = mid + 1;
+            }
+        }
+
+        if (low == oldest) {
+            // older than the whole stored window
+            return std::numeric_limits<T>::quiet_NaN();
+        }
+        if (low == N + 1) {
+            // not bracketed from above; still accept an exact hit on `now`
+            return now.time == time_us ? now.value : std::numeric_limits<T>::quiet_NaN();
+        }
+
+        const Sample &s1 = sample_at(low - 1);
+        const Sample &s2 = sample_at(low);
+        const int32_t time_diff = static_cast<int32_t>(s2.time - s1.time);
+        // reject brackets spanning slots the producer has overwritten meanwhile
+        if (time_diff < 0 || static_cast<int32_t>(time_us - s1.time) < 0) {
+            return std::numeric_limits<T>::quiet_NaN();
+        }
+
+        const float time_coef = time_diff ? (time_us - s1.time) / static_cast<float>(time_diff) : 0.f;
+        return s1.value + ((s2.value - s1.value) * time_coef);
+    }
+
+private:
+    Sample data[N];
+    std::atomic<size_t> newest_pos { N - 1 };
+    std::atomic<size_t> count { 0 };
+};
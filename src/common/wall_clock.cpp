@@ -0,0 +1,119 @@
+#include "wall_clock.hpp"
+#include "timing.h"
+
+#include <algorithm>
+#include <cstdlib>
+#include <freertos/mutex.hpp>
+#include <mutex>
+
+namespace {
+
+constexpr int64_t million = 1'000'000;
+
+// NTP-like limits: errors below the step threshold are slewed in, at most
+// slew_rate_ppm of the elapsed time at once, so the clock never runs
+// backwards because of a sync. Anything larger is stepped.
+constexpr int64_t step_threshold_us = 1 * million;
+constexpr int32_t slew_rate_ppm = 500;
+
+// Crystal tolerance; also keeps the estimate sane against the network jitter
+// and the quantization of the roughly hourly samples
+constexpr int32_t max_drift_ppm = 200;
+
+// Don't estimate drift from windows shorter than this, the sample noise
+// would dominate
+constexpr int64_t min_drift_window_us = 600 * million;
+
+struct State {
+    int64_t base_wall_us = 0; ///< wall time at base_local_us
+    int64_t base_local_us = 0; ///< get_timestamp_us() of the last rebase
+    int64_t pending_slew_us = 0; ///< correction yet to be absorbed
+    int64_t last_sample_wall_us = 0; ///< raw previous SNTP sample, for drift estimation
+    int64_t last_sample_local_us = 0;
+    int32_t drift_ppm = 0; ///< local tick timer drift against SNTP
+    bool synced = false;
+};
+
+State state;
+freertos::Mutex state_mutex;
+
+/// Wall time the state extrapolates to at \p local_us, slew included
+int64_t extrapolate(const State &s, int64_t local_us) {
+    const int64_t elapsed = local_us - s.base_local_us;
+    int64_t wall = s.base_wall_us + elapsed + elapsed * s.drift_ppm / million;
+
+    // Absorb the pending correction at the bounded rate
+    const int64_t max_slew = elapsed * slew_rate_ppm / million;
+    wall += std::clamp(s.pending_slew_us, -max_slew, max_slew);
+    return wall;
+}
+
+} // namespace
+
+void wall_clock::sync_from_sntp(uint32_t utc_sec, uint32_t utc_us) {
+    const int64_t local = get_timestamp_us();
+    const int64_t wall = static_cast<int64_t>(utc_sec) * million + utc_us;
+
+    std::lock_guard lock(state_mutex);
+
+    if (!state.synced) {
+        state = State {
+            .base_wall_us = wall,
+            .base_local_us = local,
+            .last_sample_wall_us = wall,
+            .last_sample_local_us = local,
+            .synced = true,
+        };
+        return;
+    }
+
+    const int64_t predicted = extrapolate(state, local);
+    const int64_t error = wall - predicted;
+
+    if (std::abs(error) > step_threshold_us) {
+        // Grossly off - pretending continuity would take ages to fix, step.
+        // Drift estimation starts over, samples across the step are worthless.
+        state.base_wall_us = wall;
+        state.base_local_us = local;
+        state.pending_slew_us = 0;
+        state.last_sample_wall_us = wall;
+        state.last_sample_local_us = local;
+        return;
+    }
+
+    // Update the drift estimate from the raw sample pair
+    if (const int64_t window = local - state.last_sample_local_us; window >= min_drift_window_us) {
+        const int64_t observed_ppm = ((wall - state.last_sample_wall_us) - window) * million / window;
+        // Quarter-weight IIR, one outlier sample shall not bend the clock rate
+        state.drift_ppm += (static_cast<int32_t>(std::clamp<int64_t>(observed_ppm, -max_drift_ppm, max_drift_ppm)) - state.drift_ppm) / 4;
+        state.last_sample_wall_us = wall;
+        state.last_sample_local_us = local;
+    }
+
+    // Rebase at the currently extrapolated value, so the reported time stays
+    // continuous, and leave the measured error for the slew to absorb.
+    // The error subsumes whatever part of the previous correction was still
+    // pending.
+    state.base_wall_us = predicted;
+    state.base_local_us = local;
+    state.pending_slew_us = error;
+}
+
+bool wall_clock::is_synced() {
+    std::lock_guard lock(state_mutex);
+    return state.synced;
+}
+
+int64_t wall_clock::now_us() {
+    const int64_t local = get_timestamp_us();
+
+    std::lock_guard lock(state_mutex);
+    if (!state.synced) {
+        return 0;
+    }
+    return extrapolate(state, local);
+}
+
+time_t wall_clock::now_sec() {
+    return static_cast<time_t>(now_us() / million);
+}
@@ -0,0 +1,36 @@
+#pragma once
+
+#include <cstdint>
+#include <ctime>
+
+/// Smoothed wall clock fused from SNTP samples and the local tick timer.
+///
+/// SNTP on its own steps the RTC once per poll, which makes timestamps jump
+/// (sometimes backwards) and leaves them drifting in between polls. This
+/// service instead keeps a mapping from the microsecond tick timer to wall
+/// time: small corrections are slewed in at a bounded rate, so consecutive
+/// readings never run backwards because of a sync, and the observed drift of
+/// the local crystal is compensated between polls. Reading the clock is a few
+/// arithmetic operations, cheap enough to stamp individual metric batches
+/// or log lines with.
+///
+/// Only gross errors (the first fix after boot, or a clock that was off by
+/// more than a second) are stepped.
+namespace wall_clock {
+
+/// Feed a fresh SNTP sample; called from the lwIP SNTP callback.
+/// \param utc_sec seconds since the unix epoch
+/// \param utc_us microsecond part of the sample
+void sync_from_sntp(uint32_t utc_sec, uint32_t utc_us);
+
+/// \returns whether at least one SNTP sample has arrived since boot
+bool is_synced();
+
+/// \returns microseconds since the unix epoch, interpolated from the tick
+///     timer since the last SNTP sample; 0 before the first sample
+int64_t now_us();
+
+/// \returns now_us() in whole seconds
+time_t now_sec();
+
+} // namespace wall_clock
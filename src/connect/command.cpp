@@ -18,7 +18,6 @@ using json::Type;
 using std::array;
 using std::errc;
 using std::get_if;
-using std::make_shared;
 using std::min;
 using std::move;
 using std::nullopt;
@@ -99,7 +98,7 @@ Command Command::gcode_command(CommandId id, const string_view &body, SharedBuff
     return Command {
         id,
         Gcode {
-            make_shared<SharedBuffer::Borrow>(move(buff)),
+            make_shared_borrow(move(buff)),
             body.size(),
         },
     };
@@ -313,7 +312,7 @@ Command Command::parse_json_command(CommandId id, char *body, size_t body_size,
                 const size_t len = min(event.value->size() + 1, buff.size());
                 if (len - 1 <= Printer::Config::CONNECT_TOKEN_LEN) {
                     strlcpy(reinterpret_cast<char *>(buff.data()), event.value->data(), len);
-                    cmd->token = std::make_shared<SharedBuffer::Borrow>(move(buff));
+                    cmd->token = make_shared_borrow(move(buff));
                     seen_args |= ArgToken;
                     buffer_available = false;
                 } else {
@@ -336,7 +335,7 @@ Command Command::parse_json_command(CommandId id, char *body, size_t body_size,
                     seen_args |= ArgSetValue;
                     cmd->name = PropertyName::HostName;
                     strlcpy(reinterpret_cast<char *>(buff.data()), event.value->data(), len);
-                    cmd->value = std::make_shared<SharedBuffer::Borrow>(move(buff));
+                    cmd->value = make_shared_borrow(move(buff));
                     buffer_available = false;
                 } else {
                     data = BrokenCommand { "Hostname too long." };
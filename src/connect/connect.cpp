@@ -11,6 +11,8 @@
 #include <http/websocket.hpp>
 
 #include <logging/log.hpp>
+#include <common/loop_latency_monitor.hpp>
+#include <common/metric.h>
 
 #include <atomic>
 #include <cassert>
@@ -42,6 +44,11 @@ using std::visit;
 
 LOG_COMPONENT_DEF(connect, logging::Severity::debug);
 
+// How many times a message to the server had to suspend rendering and resume
+// into a fresh buffer (the overflowing field is formatted twice). Recorded per
+// message; for watching how well MAX_RESP_SIZE fits the real traffic.
+METRIC_DEF(metric_render_suspends, "conn_rendr", METRIC_VALUE_INTEGER, 0, METRIC_DISABLED);
+
 namespace connect_client {
 
 namespace {
@@ -49,6 +56,14 @@ namespace {
     // Send a ping if there's no activity from us during this time (15_000 ms = 15s)
     constexpr uint32_t ping_inactivity = 15000;
 
+#if WEBSOCKET()
+    // Parameters of the heatshrink compression of outgoing messages (the
+    // library defaults). The encoder costs ~1.5 kB of heap with these, paid
+    // only once and only when the server accepts the extension.
+    constexpr uint8_t compression_window_bits = 8;
+    constexpr uint8_t compression_lookahead_bits = 4;
+#endif
+
     // These two should actually be a atomic<tuple<.., ..>>. This won't compile on our platform.
     // But, considering the error is informative only and we set these only in
     // this thread, any temporary inconsistency in them is of no concern
@@ -148,6 +163,9 @@ namespace {
         virtual const HeaderOut *extra_headers() const override {
             return hdrs;
         }
+        uint8_t render_suspends() const {
+            return renderer_impl.suspends();
+        }
     };
 
     class UpgradeRequest final : public http::Request {
@@ -155,9 +173,9 @@ namespace {
         // 2 for auth
         // 2 for user agent parts
         // 1 for upgrade
-        // 3 for websocket negotiation
+        // 4 for websocket negotiation
         // 1 for sentinel
-        HeaderOut hdrs[9];
+        HeaderOut hdrs[10];
 
     public:
         UpgradeRequest(Printer &printer, const Printer::Config &config, const WebSocketKey &key)
@@ -172,6 +190,10 @@ namespace {
                 { "Sec-WebSocket-Key", key.req(), nullopt },
                 { "Sec-WebSocket-Version", "13", nullopt },
                 { "Sec-WebSocket-Protocol", "prusa-connect", nullopt },
+                // Offer compression of our messages (telemetry is repetitive
+                // JSON and shrinks a lot). The server accepts by echoing the
+                // extension back; otherwise we send uncompressed.
+                { "Sec-WebSocket-Extensions", "heatshrink", nullopt },
                 { nullptr, nullptr, nullopt }
             } {}
         virtual const char *url() const override {
@@ -616,6 +638,12 @@ CommResult Connect::prepare_connection(CachedFactory &conn_factory, const Printe
             } while (received > 0);
 
             websocket = WebSocket::from_response(resp);
+            ws_compressed = upgrade_hdrs.heatshrink_negotiated();
+            if (ws_compressed && ws_encoder == nullptr) {
+                ws_encoder.reset(heatshrink_encoder_alloc(compression_window_bits, compression_lookahead_bits));
+                // Out of memory ‒ fall back to uncompressed messages.
+                ws_compressed = ws_encoder != nullptr;
+            }
             // Initiating the connection is a "send" in some sense.
             last_send = now();
             break;
@@ -651,6 +679,31 @@ CommResult Connect::send_command(CachedFactory &conn_factory, const Printer::Con
     uint8_t buffer[MAX_RESP_SIZE];
     bool more = true;
     bool first = true;
+
+    const bool compress = ws_compressed && ws_encoder != nullptr;
+    if (compress) {
+        heatshrink_encoder_reset(ws_encoder.get());
+    }
+    // Compressed output accumulates here and goes out a full buffer at a
+    // time (the fragment boundaries no longer line up with the renderer
+    // chunks).
+    uint8_t compressed[MAX_RESP_SIZE];
+    size_t compressed_len = 0;
+
+    // One fragment out, tracking the Text/Continuation split. The compressed
+    // flag (RSV1) belongs only to the first fragment of the message.
+    auto send_fragment = [&](uint8_t *data, size_t size, bool last) -> optional<Error> {
+        auto error = websocket->send(first ? WebSocket::Text : WebSocket::Continuation, last, data, size, first && compress);
+        first = false;
+        if (error.has_value()) {
+            conn_factory.invalidate();
+            planner().action_done(ActionResult::Failed);
+        } else {
+            last_send = now();
+        }
+        return error;
+    };
+
     while (more) {
         const auto [result, written_json] = renderer.render(buffer, sizeof buffer);
         switch (result) {
@@ -666,19 +719,60 @@ CommResult Connect::send_command(CachedFactory &conn_factory, const Printer::Con
 
         log_debug(connect, "Send %.*s", written_json, buffer);
 
-        if (auto error = websocket->send(first ? WebSocket::Text : WebSocket::Continuation, !more, buffer, written_json); error.has_value()) {
-            conn_factory.invalidate();
-            planner().action_done(ActionResult::Failed);
-            return err_to_status(*error);
+        if (!compress) {
+            if (auto error = send_fragment(buffer, written_json, !more); error.has_value()) {
+                return err_to_status(*error);
+            }
+            continue;
         }
 
-        last_send = now();
+        // Push the chunk through the encoder, flushing the output buffer
+        // whenever it fills up.
+        size_t sunk = 0;
+        while (sunk < written_json) {
+            size_t used = 0;
+            heatshrink_encoder_sink(ws_encoder.get(), buffer + sunk, written_json - sunk, &used);
+            sunk += used;
 
-        first = false;
+            HSE_poll_res poll_result;
+            do {
+                size_t got = 0;
+                poll_result = heatshrink_encoder_poll(ws_encoder.get(), compressed + compressed_len, sizeof compressed - compressed_len, &got);
+                compressed_len += got;
+                if (compressed_len == sizeof compressed) {
+                    if (auto error = send_fragment(compressed, compressed_len, false); error.has_value()) {
+                        return err_to_status(*error);
+                    }
+                    compressed_len = 0;
+                }
+            } while (poll_result == HSER_POLL_MORE);
+        }
+    }
+
+    if (compress) {
+        // Terminate the stream and drain what's left in the encoder.
+        while (heatshrink_encoder_finish(ws_encoder.get()) == HSER_FINISH_MORE) {
+            size_t got = 0;
+            heatshrink_encoder_poll(ws_encoder.get(), compressed + compressed_len, sizeof compressed - compressed_len, &got);
+            compressed_len += got;
+            if (compressed_len == sizeof compressed) {
+                if (auto error = send_fragment(compressed, compressed_len, false); error.has_value()) {
+                    return err_to_status(*error);
+                }
+                compressed_len = 0;
+            }
+        }
+
+        // The (possibly empty) closing fragment.
+        if (auto error = send_fragment(compressed, compressed_len, true); error.has_value()) {
+            return err_to_status(*error);
+        }
     }
 
     log_debug(connect, "Sending done");
 
+    metric_record_integer(&metric_render_suspends, renderer.suspends());
+
     planner().action_done(ActionResult::Ok);
 
     return ConnectionStatus::Ok;
@@ -702,6 +796,9 @@ CommResult Connect::send_command(CachedFactory &conn_factory, const Printer::Con
     HttpClient http(conn_factory);
 
     const auto result = http.send(request, &cmd_id);
+
+    metric_record_integer(&metric_render_suspends, request.render_suspends());
+
     // Drop current job paths (if any) to make space for potentially parsing a command from the server.
     // In case we failed to send the JOB_INFO event that uses the paths, we
     // will acquire it and fill it in the next iteration anyway.
@@ -879,7 +976,11 @@ void Connect::run() {
 
     CachedFactory conn_factory;
 
+    buddy::LoopLatencyMonitor loop_latency_monitor("connect");
+
     while (true) {
+        loop_latency_monitor.tick();
+
         auto reg_wanted = registration.load();
         auto reg_running = holds_alternative<Registrator>(guts);
         if (reg_wanted && reg_running) {
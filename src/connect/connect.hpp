@@ -10,6 +10,12 @@
 #include <option/websocket.h>
 #if WEBSOCKET()
     #include <common/http/websocket.hpp>
+
+    #include <memory>
+
+extern "C" {
+    #include <heatshrink_encoder.h>
+}
 #endif
 
 namespace connect_client {
@@ -72,6 +78,20 @@ private:
     // Used to track when we should generate a ping.
     uint32_t last_send = 0;
 
+    struct EncoderDeleter {
+        void operator()(heatshrink_encoder *encoder) const {
+            heatshrink_encoder_free(encoder);
+        }
+    };
+
+    // Compression of outgoing messages, negotiated as a websocket extension
+    // on the upgrade. If the server doesn't accept it (or the allocation of
+    // the encoder fails), we keep sending uncompressed ‒ that's always
+    // allowed. The encoder is allocated at most once and then reused for all
+    // messages (reset before each one).
+    bool ws_compressed = false;
+    std::unique_ptr<heatshrink_encoder, EncoderDeleter> ws_encoder;
+
     CommResult receive_command(CachedFactory &conn_factory);
     CommResult send_ping(CachedFactory &conn_factory);
 #endif
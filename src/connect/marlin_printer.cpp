@@ -164,9 +164,11 @@ void MarlinPrinter::renew(std::optional<SharedBuffer::Borrow> new_borrow) {
         static_assert(SharedBuffer::SIZE >= FILE_NAME_BUFFER_LEN + FILE_PATH_BUFFER_LEN);
         borrow = BorrowPaths(move(*new_borrow));
         // update variables from marlin server, sample LFN+SFN atomically
-        auto lock = MarlinVarsLockGuard();
-        marlin_vars().media_SFN_path.copy_to(borrow->path(), FILE_PATH_BUFFER_LEN, lock);
-        marlin_vars().media_LFN.copy_to(borrow->name(), FILE_NAME_BUFFER_LEN, lock);
+        MarlinVarsSnapshot snapshot;
+        do {
+            marlin_vars().media_SFN_path.copy_to(borrow->path(), FILE_PATH_BUFFER_LEN, snapshot);
+            marlin_vars().media_LFN.copy_to(borrow->name(), FILE_NAME_BUFFER_LEN, snapshot);
+        } while (snapshot.retry());
     } else {
         borrow.reset();
     }
@@ -117,6 +117,21 @@ namespace {
         }
     }
 
+    // Events that are planned from a dirty-tracker and render the _current_
+    // state at send time. Such an event may be dropped and planned again
+    // later (after re-dirtying its tracker) without losing anything - unlike
+    // eg. command responses or transfer events, which are one-shot.
+    bool is_regenerable(EventType type) {
+        switch (type) {
+        case EventType::Info:
+        case EventType::StateChanged:
+        case EventType::CancelableChanged:
+            return true;
+        default:
+            return false;
+        }
+    }
+
     bool path_allowed(const char *path) {
         constexpr const char *const usb = "/usb/";
         // Note: allow even "bare" /usb
@@ -323,6 +338,7 @@ void Planner::reset() {
     cancellable_objects.mark_clean();
     last_telemetry = nullopt;
     telemetry_changes.mark_dirty();
+    telemetry_delivered.valid = false;
     cooldown = nullopt;
     perform_cooldown = false;
     failed_attempts = 0;
@@ -331,6 +347,8 @@ void Planner::reset() {
 void Planner::reset_telemetry() {
     last_telemetry = nullopt;
     telemetry_changes.mark_dirty();
+    // A new server node may not have the previous values, don't diff against them.
+    telemetry_delivered.valid = false;
 }
 
 Sleep Planner::sleep(Duration amount, http::Connection *wake_on_readable, bool cooldown) {
@@ -411,6 +429,15 @@ Action Planner::next_action(SharedBuffer &buffer, http::Connection *wake_on_read
     }
 
     if (planned_event.has_value()) {
+        if (command_waiting && is_regenerable(planned_event->type)) {
+            // A command is waiting behind an event that can be re-planned at
+            // any time. The command round-trip is what the user sees, so let
+            // the command through and send the event later - its tracker is
+            // dirty again, so it regenerates with the then-current state.
+            replan_event_later();
+            command_waiting = false;
+            return ReadCommand {};
+        }
         // We don't take it out yet. Only after it's successfuly sent.
         return *planned_event;
     }
@@ -529,7 +556,9 @@ Action Planner::next_action(SharedBuffer &buffer, http::Connection *wake_on_read
     const Duration since_full = since(last_full_telemetry).value_or(TELEMETRY_INTERVAL_FULL * 2);
 
     const bool send_telemetry = since_telemetry >= TELEMETRY_INTERVAL_MIN && (changes || since_telemetry >= telemetry_interval);
-    const bool want_full = changes || since_full >= TELEMETRY_INTERVAL_FULL;
+    // Without a delivered snapshot to diff against (start, reconnect), the
+    // changes have to go out as a full telemetry.
+    const bool want_full = since_full >= TELEMETRY_INTERVAL_FULL || !telemetry_delivered.valid;
 
     if (!send_telemetry && transfer.has_value() && transfer->download.has_value()) {
         // This call "consumes" the request, so we won't use it next time.
@@ -541,8 +570,12 @@ Action Planner::next_action(SharedBuffer &buffer, http::Connection *wake_on_read
     }
 
     if (send_telemetry) {
-        last_telemetry_mode = want_full ? SendTelemetry::Mode::Full : SendTelemetry::Mode::Reduced;
-        return SendTelemetry { last_telemetry_mode };
+        last_telemetry_mode = want_full ? SendTelemetry::Mode::Full : changes ? SendTelemetry::Mode::Differential
+                                                                              : SendTelemetry::Mode::Reduced;
+        if (last_telemetry_mode != SendTelemetry::Mode::Reduced) {
+            telemetry_in_flight = params.telemetry_cache();
+        }
+        return SendTelemetry { last_telemetry_mode, &telemetry_delivered };
     } else {
         // Don't sleep longer than until the next telemetry.
         // But also wake up often enough to check for interesting events.
@@ -557,7 +590,30 @@ bool Planner::wants_job_paths() const {
 }
 
 bool Planner::can_receive_command() const {
-    return !planned_event.has_value();
+    // A pending one-shot event (eg. a response to a previous command) must go
+    // out first. A regenerable one can be dropped and planned again, so it
+    // doesn't hold the command back.
+    return !planned_event.has_value() || is_regenerable(planned_event->type);
+}
+
+void Planner::replan_event_later() {
+    assert(planned_event.has_value() && is_regenerable(planned_event->type));
+    switch (planned_event->type) {
+    case EventType::Info:
+        // Might have been planned without dirtying the tracker (reconnect).
+        info_changes.mark_dirty();
+        break;
+    case EventType::StateChanged:
+        state_info.mark_dirty();
+        break;
+    case EventType::CancelableChanged:
+        cancellable_objects.mark_dirty();
+        break;
+    default:
+        // Not regenerable, never dropped (see is_regenerable).
+        break;
+    }
+    planned_event.reset();
 }
 
 void Planner::action_done(ActionResult result) {
@@ -602,9 +658,14 @@ void Planner::action_done(ActionResult result) {
         } else {
             const Timestamp n = now();
             last_telemetry = n;
-            if (last_telemetry_mode == SendTelemetry::Mode::Full) {
-                last_full_telemetry = n;
+            if (last_telemetry_mode != SendTelemetry::Mode::Reduced) {
                 telemetry_changes.mark_clean();
+                // The server has these values now, diff the next telemetry
+                // against them.
+                telemetry_delivered = telemetry_in_flight;
+                if (last_telemetry_mode == SendTelemetry::Mode::Full) {
+                    last_full_telemetry = n;
+                }
             }
         }
         planned_event.reset();
@@ -25,9 +25,16 @@ class Printer;
 struct SendTelemetry {
     enum class Mode {
         Reduced,
+        // Full-style telemetry, but fields whose value the server already has
+        // (according to the cache below) are left out.
+        Differential,
         Full,
     };
     Mode mode;
+    // Values of the last successfully delivered telemetry. Owned by the
+    // Planner (outlives the action), consulted by render.cpp in
+    // Mode::Differential.
+    const Printer::TelemetryCache *cache = nullptr;
 };
 
 struct ReadCommand {};
@@ -126,6 +133,12 @@ private:
     /// (0 can cause false negative at startup, but we also mark the telemetry tracker as dirty at startup).
     Timestamp last_full_telemetry = 0;
     SendTelemetry::Mode last_telemetry_mode = SendTelemetry::Mode::Reduced;
+    /// Values of the last successfully delivered non-reduced telemetry;
+    /// differential telemetry skips fields that still match it.
+    Printer::TelemetryCache telemetry_delivered;
+    /// Snapshot taken when planning a telemetry, promoted to
+    /// telemetry_delivered once the send is confirmed.
+    Printer::TelemetryCache telemetry_in_flight;
     /// Last time we've successfully talked to the server.
     std::optional<Timestamp> last_success;
     /// When doing comm retries, this is the cooldown time between them.
@@ -184,6 +197,11 @@ private:
 
     void handle_transfer_result(const Command &command, transfers::Transfer::BeginResult result);
 
+    /// Forgets the planned event while making sure its dirty-tracker plans it
+    /// again later. Valid only for regenerable events (the ones that render
+    /// the current state at send time, not one-shot responses).
+    void replan_event_later();
+
     // Tracking if we should resend the INFO message due to some changes.
     Tracked info_changes;
     // Tracking how much we want to send.
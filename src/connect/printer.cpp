@@ -91,6 +91,73 @@ uint32_t Printer::Params::telemetry_fingerprint(bool include_xy_axes) const {
         .done();
 }
 
+Printer::TelemetryCache Printer::Params::telemetry_cache() const {
+    // Note: keep the quantization in sync with telemetry_fingerprint and with
+    //   the rendering of telemetry in render.cpp.
+    TelemetryCache cache;
+
+    const auto &head = slots[preferred_head()];
+
+    cache.temp_nozzle = int(head.temp_nozzle);
+    cache.temp_bed = int(temp_bed);
+    cache.target_nozzle = int(target_nozzle);
+    cache.target_bed = int(target_bed);
+    cache.print_speed = print_speed;
+    cache.flow_factor = flow_factor;
+    cache.axis_x = int(pos[Printer::X_AXIS_POS]);
+    cache.axis_y = int(pos[Printer::Y_AXIS_POS]);
+    // Tenths of a millimeter - Z moves by less than a whole millimeter per layer.
+    cache.axis_z = int(pos[Printer::Z_AXIS_POS] * 10);
+    cache.fan_extruder = head.heatbreak_fan_rpm / 500;
+    cache.fan_print = head.print_fan_rpm / 500;
+    cache.filament = int(filament_used / 10);
+    cache.material = Crc().add_str(slots[preferred_slot()].material.data()).done();
+
+    // The whole slot object stands or falls together, so one hash for all of it.
+    Crc slot_crc;
+    for (size_t i = 0; i < slots.size(); i++) {
+        if (slot_mask & (1 << i)) {
+            slot_crc.add_str(slots[i].material.data())
+                .add(int(slots[i].temp_nozzle))
+                .add(slots[i].print_fan_rpm / 500)
+                .add(slots[i].heatbreak_fan_rpm / 500);
+        }
+    }
+    cache.slots = slot_crc
+                      .add(progress_code)
+                      .add(command_code)
+                      .add(active_slot)
+                      .done();
+
+#if PRINTER_IS_PRUSA_iX()
+    cache.temp_heatbreak = int(head.temp_heatbreak);
+    cache.temp_psu = int(temp_psu);
+    cache.temp_ambient = int(temp_ambient);
+    cache.extruder_fs_state = head.extruder_fs_state ? ftrstd::to_underlying(*head.extruder_fs_state) : -1;
+    cache.remote_fs_state = head.remote_fs_state ? ftrstd::to_underlying(*head.remote_fs_state) : -1;
+#endif
+#if XL_ENCLOSURE_SUPPORT()
+    cache.enclosure = Crc()
+                          .add(enclosure_info.temp)
+                          .add(enclosure_info.fan_rpm / 500)
+                          .add(enclosure_info.time_in_use)
+                          .done();
+#endif
+#if PRINTER_IS_PRUSA_COREONE()
+    cache.chamber = Crc()
+                        .add(int(chamber_info.current_temp))
+                        .add(chamber_info.target_temp)
+                        .add(chamber_info.fan_1_rpm / 500)
+                        .add(chamber_info.fan_2_rpm / 500)
+                        .add(chamber_info.fan_pwm_target)
+                        .add(chamber_info.led_intensity)
+                        .done();
+#endif
+
+    cache.valid = true;
+    return cache;
+}
+
 uint32_t Printer::Config::crc() const {
     return Crc()
         .add_str(host)
@@ -105,6 +105,46 @@ public:
     static constexpr size_t CANCEL_OBJECT_NAME_COUNT = 16;
 #endif
 
+    // Quantized snapshot of the values rendered in the full telemetry.
+    //
+    // The Planner remembers the snapshot of the last successfully delivered
+    // telemetry and render.cpp compares against it to leave out fields the
+    // server already has. The quantization follows the precision constants of
+    // telemetry_fingerprint - a value that differs by less than that is
+    // considered unchanged.
+    struct TelemetryCache {
+        // Set once the snapshot was taken; differential telemetry is
+        // rendered only against a valid cache.
+        bool valid = false;
+        int temp_nozzle;
+        int temp_bed;
+        int target_nozzle;
+        int target_bed;
+        uint16_t print_speed;
+        uint16_t flow_factor;
+        int axis_x;
+        int axis_y;
+        int axis_z;
+        int fan_extruder;
+        int fan_print;
+        int filament;
+        uint32_t material;
+        uint32_t slots;
+#if PRINTER_IS_PRUSA_iX()
+        int temp_heatbreak;
+        int temp_psu;
+        int temp_ambient;
+        int extruder_fs_state;
+        int remote_fs_state;
+#endif
+#if XL_ENCLOSURE_SUPPORT()
+        uint32_t enclosure;
+#endif
+#if PRINTER_IS_PRUSA_COREONE()
+        uint32_t chamber;
+#endif
+    };
+
     class Params {
     private:
         // Living in the Printer we come from
@@ -169,6 +209,7 @@ public:
 #endif
 
         uint32_t telemetry_fingerprint(bool include_xy_axes) const;
+        TelemetryCache telemetry_cache() const;
         uint32_t state_fingerprint() const;
         uint8_t enabled_tool_cnt() const {
             return std::popcount(slot_mask);
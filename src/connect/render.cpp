@@ -123,6 +123,17 @@ namespace {
         auto remote_fs_state = preferred_head.remote_fs_state;
 #endif
 
+        // In the differential mode, fields that still match the last
+        // delivered telemetry are left out - our cell-connected printers pay
+        // for every byte. A missing or invalid cache degrades to sending
+        // everything.
+        using TC = Printer::TelemetryCache;
+        const TC *cached = (telemetry.mode == SendTelemetry::Mode::Differential && telemetry.cache != nullptr && telemetry.cache->valid) ? telemetry.cache : nullptr;
+        const TC current = params.telemetry_cache();
+        const auto changed = [&](auto field) {
+            return cached == nullptr || cached->*field != current.*field;
+        };
+
         // Keep the indentation of the JSON in here!
         // clang-format off
         JSON_START;
@@ -165,29 +176,47 @@ namespace {
             // some way (eg. send the slots structure only), but for that we
             // need to coordinate with Connect, as these are probably
             // "essential" fields right now.
-            if (telemetry.mode == SendTelemetry::Mode::Full) {
-                JSON_FIELD_FFIXED("temp_nozzle", preferred_head.temp_nozzle, 1) JSON_COMMA;
-                JSON_FIELD_FFIXED("temp_bed", params.temp_bed, 1) JSON_COMMA;
+            if (telemetry.mode != SendTelemetry::Mode::Reduced) {
+                if (changed(&TC::temp_nozzle)) {
+                    JSON_FIELD_FFIXED("temp_nozzle", preferred_head.temp_nozzle, 1) JSON_COMMA;
+                }
+                if (changed(&TC::temp_bed)) {
+                    JSON_FIELD_FFIXED("temp_bed", params.temp_bed, 1) JSON_COMMA;
+                }
 #if PRINTER_IS_PRUSA_iX()
-                JSON_FIELD_FFIXED("temp_heatbreak", preferred_head.temp_heatbreak, 1) JSON_COMMA;
-                JSON_FIELD_FFIXED("temp_psu", params.temp_psu, 1) JSON_COMMA;
-                JSON_FIELD_FFIXED("temp_ambient", params.temp_ambient, 1) JSON_COMMA;
-                if (extruder_fs_state) {
+                if (changed(&TC::temp_heatbreak)) {
+                    JSON_FIELD_FFIXED("temp_heatbreak", preferred_head.temp_heatbreak, 1) JSON_COMMA;
+                }
+                if (changed(&TC::temp_psu)) {
+                    JSON_FIELD_FFIXED("temp_psu", params.temp_psu, 1) JSON_COMMA;
+                }
+                if (changed(&TC::temp_ambient)) {
+                    JSON_FIELD_FFIXED("temp_ambient", params.temp_ambient, 1) JSON_COMMA;
+                }
+                if (extruder_fs_state && changed(&TC::extruder_fs_state)) {
                     JSON_FIELD_STR_G(extruder_fs_state, "extruder_fs_state", to_str(*extruder_fs_state)) JSON_COMMA;
                 }
-                if (remote_fs_state) {
+                if (remote_fs_state && changed(&TC::remote_fs_state)) {
                     JSON_FIELD_STR_G(extruder_fs_state, "remote_fs_state", to_str(*remote_fs_state)) JSON_COMMA;
                 }
 #endif
-                JSON_FIELD_FFIXED("target_nozzle", params.target_nozzle, 1) JSON_COMMA;
-                JSON_FIELD_FFIXED("target_bed", params.target_bed, 1) JSON_COMMA;
-                JSON_FIELD_INT("speed", params.print_speed) JSON_COMMA;
-                JSON_FIELD_INT("flow", params.flow_factor) JSON_COMMA;
-                if (strlen(params.slots[params.preferred_slot()].material.data()) > 0) {
+                if (changed(&TC::target_nozzle)) {
+                    JSON_FIELD_FFIXED("target_nozzle", params.target_nozzle, 1) JSON_COMMA;
+                }
+                if (changed(&TC::target_bed)) {
+                    JSON_FIELD_FFIXED("target_bed", params.target_bed, 1) JSON_COMMA;
+                }
+                if (changed(&TC::print_speed)) {
+                    JSON_FIELD_INT("speed", params.print_speed) JSON_COMMA;
+                }
+                if (changed(&TC::flow_factor)) {
+                    JSON_FIELD_INT("flow", params.flow_factor) JSON_COMMA;
+                }
+                if (strlen(params.slots[params.preferred_slot()].material.data()) > 0 && changed(&TC::material)) {
                     JSON_FIELD_STR("material", params.slots[params.preferred_slot()].material.data()) JSON_COMMA;
                 }
 #if XL_ENCLOSURE_SUPPORT()
-                if (params.enclosure_info.present) {
+                if (params.enclosure_info.present && changed(&TC::enclosure)) {
                     JSON_FIELD_OBJ("enclosure");
                         JSON_FIELD_INT("temp", params.enclosure_info.temp) JSON_COMMA;
                         JSON_FIELD_INT("fan_rpm", params.enclosure_info.fan_rpm) JSON_COMMA;
@@ -196,6 +225,7 @@ namespace {
                 }
 #endif
 #if PRINTER_IS_PRUSA_COREONE()
+                if (changed(&TC::chamber)) {
                 JSON_FIELD_OBJ("chamber");
                     JSON_FIELD_FFIXED("temp", params.chamber_info.current_temp, 1) JSON_COMMA;
                     JSON_FIELD_INT("target_temp", params.chamber_info.target_temp) JSON_COMMA;
@@ -204,22 +234,35 @@ namespace {
                     JSON_FIELD_INT("fan_pwm_target", params.chamber_info.fan_pwm_target) JSON_COMMA;
                     JSON_FIELD_INT("led_intensity", params.chamber_info.led_intensity);
                 JSON_OBJ_END JSON_COMMA;
+                }
 #endif
                 if (!params.has_job) {
                     // To avoid spamming the DB, connect doesn't want positions during printing
-                    JSON_FIELD_FFIXED("axis_x", params.pos[Printer::X_AXIS_POS], 2) JSON_COMMA;
-                    JSON_FIELD_FFIXED("axis_y", params.pos[Printer::Y_AXIS_POS], 2) JSON_COMMA;
+                    if (changed(&TC::axis_x)) {
+                        JSON_FIELD_FFIXED("axis_x", params.pos[Printer::X_AXIS_POS], 2) JSON_COMMA;
+                    }
+                    if (changed(&TC::axis_y)) {
+                        JSON_FIELD_FFIXED("axis_y", params.pos[Printer::Y_AXIS_POS], 2) JSON_COMMA;
+                    }
+                }
+                if (changed(&TC::axis_z)) {
+                    JSON_FIELD_FFIXED("axis_z", params.pos[Printer::Z_AXIS_POS], 2) JSON_COMMA;
                 }
-                JSON_FIELD_FFIXED("axis_z", params.pos[Printer::Z_AXIS_POS], 2) JSON_COMMA;
                 if (params.has_job) {
-                    JSON_FIELD_INT("fan_extruder", preferred_head.heatbreak_fan_rpm) JSON_COMMA;
-                    JSON_FIELD_INT("fan_print", preferred_head.print_fan_rpm) JSON_COMMA;
-                    JSON_FIELD_FFIXED("filament", params.filament_used, 1) JSON_COMMA;
+                    if (changed(&TC::fan_extruder)) {
+                        JSON_FIELD_INT("fan_extruder", preferred_head.heatbreak_fan_rpm) JSON_COMMA;
+                    }
+                    if (changed(&TC::fan_print)) {
+                        JSON_FIELD_INT("fan_print", preferred_head.print_fan_rpm) JSON_COMMA;
+                    }
+                    if (changed(&TC::filament)) {
+                        JSON_FIELD_FFIXED("filament", params.filament_used, 1) JSON_COMMA;
+                    }
                 }
 
 #if HAS_MMU2() || HAS_TOOLCHANGER()
                 // Skip if we have single-tool XL or mk4 without MMU/with MMU disabled.
-                if (params.enabled_tool_cnt() > 1) {
+                if (params.enabled_tool_cnt() > 1 && changed(&TC::slots)) {
                     JSON_FIELD_OBJ("slot");
                         state.iter = 0;
                         while (state.iter < params.slots.size()) {
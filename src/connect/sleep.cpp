@@ -25,9 +25,18 @@ namespace {
     // Wait a bit between config retries, looking at incoming data, etc.
     const constexpr uint32_t IDLE_WAIT = 100;
 
+    // When all the remaining tasks only watch for some condition and there's
+    // no actual work to do, we can afford much sparser ticks. The condition
+    // that needs a fast reaction ‒ data on the socket ‒ interrupts the sleep
+    // by itself, see below.
+    const constexpr uint32_t WATCH_WAIT = 1000;
+
     enum class TaskResult {
         RerunSoon,
         RerunLater,
+        // Nothing to do, only watching if some condition happened. Unlike
+        // RerunLater, it's fine to check only once in a long while.
+        Watch,
         // Do not run this task again, but continue sleeping.
         TaskDone,
         // Wake up / terminate this sleep (after finishing all the tasks at least once).
@@ -72,6 +81,13 @@ namespace {
                         result = sub_result;
                     }
                     break;
+                case TaskResult::Watch:
+                    // The weakest one ‒ any actual work to rerun wins over
+                    // just watching.
+                    if (result == TaskResult::TaskDone) {
+                        result = sub_result;
+                    }
+                    break;
                 case TaskResult::TaskDone:
                     eradicate = true;
                     break;
@@ -111,7 +127,7 @@ namespace {
             if (get<1>(printer.config(false))) {
                 return TaskResult::Reschedule;
             } else {
-                return TaskResult::RerunLater;
+                return TaskResult::Watch;
             }
         }
     };
@@ -242,7 +258,7 @@ namespace {
                 planner.notify_command_waiting();
                 return TaskResult::WakeUp;
             } else {
-                return TaskResult::RerunLater;
+                return TaskResult::Watch;
             }
         }
     };
@@ -328,11 +344,16 @@ void Sleep::perform(Printer &printer, Planner &planner) {
         milliseconds -= min(milliseconds, took);
 
         bool do_sleep = false;
+        Duration max_wait = IDLE_WAIT;
 
         switch (result) {
         case TaskResult::RerunSoon:
             // Just let the next iteration run
             break;
+        case TaskResult::Watch: // Only watching for conditions, tick sparsely
+            max_wait = WATCH_WAIT;
+            do_sleep = true;
+            break;
         case TaskResult::RerunLater: // Sleep between two iterations
         case TaskResult::TaskDone: // Nothing to run, just sleep
             do_sleep = true;
@@ -343,14 +364,25 @@ void Sleep::perform(Printer &printer, Planner &planner) {
             return;
         }
 
-        if (took >= IDLE_WAIT) {
+        if (took >= max_wait) {
             // The iteration took longer than we are allowed, abort sleeping.
             do_sleep = false;
         }
 
         if (do_sleep) {
-            Duration left = min(milliseconds, IDLE_WAIT - took);
-            sleep_raw(left);
+            Duration left = min(milliseconds, max_wait - took);
+            if (wake_on_readable != nullptr) {
+                // Instead of a plain sleep, block on the socket ‒ a command
+                // from the server wakes us up right away, not at the next
+                // tick.
+                if (wake_on_readable->poll_readable(left)) {
+                    planner.notify_command_waiting();
+                    log_debug(connect, "Early wakeup");
+                    return;
+                }
+            } else {
+                sleep_raw(left);
+            }
 
             Timestamp after_sleep = now();
             took = after_sleep - after;
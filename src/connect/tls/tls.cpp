@@ -1,5 +1,6 @@
 #include "tls.hpp"
 #include "certificate.h"
+#include <connect/hostname.hpp>
 #include <string.h>
 #include <stdbool.h>
 #include <memory>
@@ -60,6 +61,65 @@ struct InitContexts {
     }
 };
 
+// Session from the last successful handshake, offered to the server for
+// resumption on the next connect. A resumed handshake skips the ECDHE math
+// (seconds of CPU on our hardware), so recovering from a Wi-Fi blip goes from
+// seconds to a fraction.
+//
+// A single slot is enough - we only ever talk to one Connect server. Not
+// persisted across reboots on purpose: the struct holds live keying material
+// we don't want sitting in the EEPROM, and the server-side session lifetime
+// is shorter than a typical power cycle anyway.
+//
+// No locking; all the tls instances are created and used by the connect task.
+class SessionCache {
+private:
+    mbedtls_ssl_session session;
+    char host[max_host_buf_len] = {};
+    uint16_t port = 0;
+    bool custom_cert = false;
+    bool valid = false;
+
+public:
+    SessionCache() {
+        mbedtls_ssl_session_init(&session);
+    }
+
+    /// Remember the session of a successful handshake (overwrites the previous one).
+    void store(mbedtls_ssl_context *ssl_context, const char *host_, uint16_t port_, bool custom_cert_) {
+        // Also resets the struct into the initialized state.
+        mbedtls_ssl_session_free(&session);
+        valid = false;
+        if (mbedtls_ssl_get_session(ssl_context, &session) != 0) {
+            // Out of memory or similar; simply don't resume next time.
+            return;
+        }
+        strlcpy(host, host_, sizeof host);
+        port = port_;
+        custom_cert = custom_cert_;
+        valid = true;
+    }
+
+    /// Offer the cached session for resumption, if it belongs to this server.
+    /// \return true if the session was offered (the handshake may still fall
+    ///   back to a full one if the server no longer accepts it).
+    bool restore(mbedtls_ssl_context *ssl_context, const char *host_, uint16_t port_, bool custom_cert_) {
+        if (!valid || port != port_ || custom_cert != custom_cert_ || strcmp(host, host_) != 0) {
+            return false;
+        }
+        return mbedtls_ssl_set_session(ssl_context, &session) == 0;
+    }
+
+    /// Throw the session away (eg. after a failed handshake - it might be the
+    /// stale session the server objects to).
+    void drop() {
+        mbedtls_ssl_session_free(&session);
+        valid = false;
+    }
+};
+
+SessionCache session_cache;
+
 } // namespace
 
 namespace connect_client {
@@ -181,12 +241,20 @@ std::optional<Error> tls::connection(const char *host, uint16_t port) {
     static const int tls_cipher_suites[2] = { MBEDTLS_TLS_ECDHE_ECDSA_WITH_AES_128_GCM_SHA256, 0 };
     mbedtls_ssl_conf_ciphersuites(&ssl_config, tls_cipher_suites);
 
+    // Ask the server for a session ticket so the next reconnect can resume
+    // instead of doing the full handshake.
+    mbedtls_ssl_conf_session_tickets(&ssl_config, MBEDTLS_SSL_SESSION_TICKETS_ENABLED);
+
     mbedtls_ssl_set_hostname(&ssl_context, host);
 
     if ((status = mbedtls_ssl_setup(&ssl_context, &ssl_config)) != 0) {
         return Error::InternalError;
     }
 
+    // Offer the session from the previous handshake for resumption; the
+    // server may still decline and negotiate a full handshake.
+    session_cache.restore(&ssl_context, host, port, custom_cert);
+
     mbedtls_ssl_set_bio(&ssl_context, &net_context, mbedtls_net_send, mbedtls_net_recv, NULL);
 
     constexpr size_t str_len = 6;
@@ -201,6 +269,9 @@ std::optional<Error> tls::connection(const char *host, uint16_t port) {
     while ((status = mbedtls_ssl_handshake(&ssl_context)) != 0) {
         if (status != MBEDTLS_ERR_SSL_WANT_READ && status != MBEDTLS_ERR_SSL_WANT_WRITE) {
             log_info(connect, "ssl handshake failed with: %d", status);
+            // The stale session might be what the server objects to; don't
+            // offer it again.
+            session_cache.drop();
             return Error::Tls;
         }
 
@@ -218,9 +289,13 @@ std::optional<Error> tls::connection(const char *host, uint16_t port) {
 
     if ((status = mbedtls_ssl_get_verify_result(&ssl_context)) != 0) {
         log_info(connect, "SSL error");
+        session_cache.drop();
         return Error::Tls;
     }
 
+    // Remember the (possibly refreshed) session for the next reconnect.
+    session_cache.store(&ssl_context, host, port, custom_cert);
+
     log_debug(connect, "SSL done");
 
     return std::nullopt;
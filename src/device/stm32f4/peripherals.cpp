@@ -294,9 +294,13 @@ void static config_adc(ADC_HandleTypeDef *hadc, ADC_TypeDef *ADC_NUM, uint32_t N
     }
 }
 
-static void config_adc_ch(ADC_HandleTypeDef *hadc, uint32_t Channel, uint32_t Rank) {
+// The default sampling time suits high-impedance sources (thermistor dividers,
+// internal temperature/reference). Low-impedance amplifier outputs such as the
+// current senses can charge the sampling capacitor much faster - give those a
+// shorter per-channel sampling time to tighten the whole scan.
+static void config_adc_ch(ADC_HandleTypeDef *hadc, uint32_t Channel, uint32_t Rank, uint32_t SampleTime = ADC_SAMPLETIME_480CYCLES) {
     Rank++; // Channel rank starts at 1, but for array indexing, we need to start from 0.
-    ADC_ChannelConfTypeDef sConfig = { Channel, Rank, ADC_SAMPLETIME_480CYCLES, 0 };
+    ADC_ChannelConfTypeDef sConfig = { Channel, Rank, SampleTime, 0 };
     if (HAL_ADC_ConfigChannel(hadc, &sConfig) != HAL_OK) {
         Error_Handler();
     }
@@ -331,7 +335,7 @@ void hw_adc1_init() {
     config_adc_ch(&hadc1, ADC_CHANNEL_VREFINT, AdcChannel::vref);
     config_adc_ch(&hadc1, ADC_CHANNEL_TEMPSENSOR, AdcChannel::mcu_temperature);
 #elif BOARD_IS_XLBUDDY()
-    config_adc_ch(&hadc1, ADC_CHANNEL_4, AdcChannel::dwarf_I);
+    config_adc_ch(&hadc1, ADC_CHANNEL_4, AdcChannel::dwarf_I, ADC_SAMPLETIME_144CYCLES);
     config_adc_ch(&hadc1, ADC_CHANNEL_5, AdcChannel::mux1_y);
     config_adc_ch(&hadc1, ADC_CHANNEL_8, AdcChannel::mux1_x);
     config_adc_ch(&hadc1, ADC_CHANNEL_VREFINT, AdcChannel::vref);
@@ -347,19 +351,23 @@ void hw_adc1_init() {
 #ifdef HAS_ADC3
 void hw_adc3_init() {
     // Configure the global features of the ADC (Clock, Resolution, Data Alignment and number of conversion)
-    config_adc(&hadc3, ADC3, AdcChannel::ADC3_CH_CNT);
+    config_adc(&hadc3, ADC3, AdcChannel::ADC3_SEQ_CNT);
 
     // Configure for the selected ADC regular channel its corresponding rank in the sequencer and its sample time.
     #if BOARD_IS_XBUDDY()
-    config_adc_ch(&hadc3, ADC_CHANNEL_4, AdcChannel::MMU_I);
+    config_adc_ch(&hadc3, ADC_CHANNEL_4, AdcChannel::MMU_I, ADC_SAMPLETIME_144CYCLES);
     config_adc_ch(&hadc3, ADC_CHANNEL_8, AdcChannel::board_T);
-    config_adc_ch(&hadc3, ADC_CHANNEL_9, AdcChannel::hotend_I);
-    config_adc_ch(&hadc3, ADC_CHANNEL_14, AdcChannel::board_I);
+    config_adc_ch(&hadc3, ADC_CHANNEL_9, AdcChannel::hotend_I, ADC_SAMPLETIME_144CYCLES);
+    config_adc_ch(&hadc3, ADC_CHANNEL_14, AdcChannel::board_I, ADC_SAMPLETIME_144CYCLES);
         #if PRINTER_IS_PRUSA_iX()
     config_adc_ch(&hadc3, ADC_CHANNEL_15, AdcChannel::case_T);
         #elif PRINTER_IS_PRUSA_COREONE()
     config_adc_ch(&hadc3, ADC_CHANNEL_15, AdcChannel::door_sensor);
         #endif
+    // Extra ranks: convert the current channels once more in the second half
+    // of the scan, doubling their rate. AdcGet averages both slots.
+    config_adc_ch(&hadc3, ADC_CHANNEL_4, AdcChannel::MMU_I_2, ADC_SAMPLETIME_144CYCLES);
+    config_adc_ch(&hadc3, ADC_CHANNEL_9, AdcChannel::hotend_I_2, ADC_SAMPLETIME_144CYCLES);
     #elif BOARD_IS_XLBUDDY()
     config_adc_ch(&hadc3, ADC_CHANNEL_8, AdcChannel::board_T);
     config_adc_ch(&hadc3, ADC_CHANNEL_4, AdcChannel::mux2_y);
@@ -1,4 +1,5 @@
 #include <freertos/binary_semaphore.hpp>
+#include <freertos/resource_registry.hpp>
 
 #include <cstdlib>
 
@@ -14,10 +15,12 @@ BinarySemaphore::BinarySemaphore() {
     static_assert(semaphore_storage_align == alignof(StaticSemaphore_t));
 
     handle = xSemaphoreCreateBinaryStatic(reinterpret_cast<StaticSemaphore_t *>(&semaphore_storage));
+    detail::resource_created(ResourceType::binary_semaphore);
 }
 
 BinarySemaphore::~BinarySemaphore() {
     vSemaphoreDelete(SemaphoreHandle_t(handle));
+    detail::resource_destroyed(ResourceType::binary_semaphore);
 }
 
 void BinarySemaphore::release() {
@@ -1,4 +1,5 @@
 #include <freertos/counting_semaphore.hpp>
+#include <freertos/resource_registry.hpp>
 
 #include <cstdlib>
 
@@ -14,10 +15,12 @@ CountingSemaphore::CountingSemaphore(size_t max_count, size_t initial_count) {
     static_assert(semaphore_storage_align == alignof(StaticSemaphore_t));
 
     handle = xSemaphoreCreateCountingStatic(max_count, initial_count, reinterpret_cast<StaticSemaphore_t *>(&semaphore_storage));
+    detail::resource_created(ResourceType::counting_semaphore);
 }
 
 CountingSemaphore::~CountingSemaphore() {
     vSemaphoreDelete(SemaphoreHandle_t(handle));
+    detail::resource_destroyed(ResourceType::counting_semaphore);
 }
 
 void CountingSemaphore::release() {
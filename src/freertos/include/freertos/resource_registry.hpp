@@ -0,0 +1,46 @@
+/// @file
+/// Live/high-water accounting of the C++-wrapped FreeRTOS primitives.
+///
+/// All the wrappers create their FreeRTOS objects statically, so this is not
+/// about heap usage - it tracks how many instances of each primitive exist at
+/// a time, so that metrics can catch modules that keep constructing and
+/// destroying primitives (or leak them) over long uptimes.
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+
+namespace freertos {
+
+enum class ResourceType : uint8_t {
+    mutex,
+    queue,
+    binary_semaphore,
+    counting_semaphore,
+    stream_buffer,
+    _count,
+};
+
+/// \returns short name of \p type, used as a metric tag
+const char *resource_type_name(ResourceType type);
+
+struct ResourceStats {
+    /// Instances existing right now
+    uint16_t live;
+
+    /// Most instances that ever existed at once since boot
+    uint16_t high_water;
+};
+
+/// \returns current statistics for \p type; safe to call from any task
+ResourceStats resource_stats(ResourceType type);
+
+namespace detail {
+    /// Called by the wrapper constructors; not meant for other use
+    void resource_created(ResourceType type);
+
+    /// Called by the wrapper destructors; not meant for other use
+    void resource_destroyed(ResourceType type);
+} // namespace detail
+
+} // namespace freertos
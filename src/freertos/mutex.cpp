@@ -1,4 +1,5 @@
 #include <freertos/mutex.hpp>
+#include <freertos/resource_registry.hpp>
 
 #include <cassert>
 #include <cstdlib>
@@ -17,6 +18,7 @@ Mutex::Mutex() {
     static_assert(mutex_storage_align == alignof(StaticSemaphore_t));
 
     handle = xSemaphoreCreateMutexStatic(reinterpret_cast<StaticSemaphore_t *>(&mutex_storage));
+    detail::resource_created(ResourceType::mutex);
 }
 
 Mutex::~Mutex() {
@@ -24,6 +26,7 @@ Mutex::~Mutex() {
     assert(xSemaphoreGetMutexHolder(SemaphoreHandle_t(handle)) == nullptr);
 #endif
     vSemaphoreDelete(SemaphoreHandle_t(handle));
+    detail::resource_destroyed(ResourceType::mutex);
 }
 
 void Mutex::unlock() {
@@ -1,4 +1,5 @@
 #include <freertos/queue.hpp>
+#include <freertos/resource_registry.hpp>
 
 #include <cstdlib>
 #include <type_traits>
@@ -20,10 +21,12 @@ QueueBase::QueueBase(size_t item_count, size_t item_size, uint8_t *item_storage)
 
     queue_handle = xQueueCreateStatic(item_count, item_size, item_storage, reinterpret_cast<StaticQueue_t *>(&queue_storage));
     configASSERT(queue_handle != nullptr);
+    detail::resource_created(ResourceType::queue);
 }
 
 QueueBase::~QueueBase() {
     vQueueDelete(queue_handle);
+    detail::resource_destroyed(ResourceType::queue);
 }
 
 void QueueBase::send(const void *payload) {
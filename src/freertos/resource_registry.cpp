@@ -0,0 +1,64 @@
+#include <freertos/resource_registry.hpp>
+
+#include <array>
+#include <cstddef>
+
+namespace freertos {
+
+namespace {
+    struct Counters {
+        std::atomic<uint16_t> live { 0 };
+        std::atomic<uint16_t> high_water { 0 };
+    };
+
+    // Zero-initialized, so usable from constructors of objects with static
+    // storage duration regardless of initialization order.
+    std::array<Counters, static_cast<size_t>(ResourceType::_count)> counters;
+} // namespace
+
+const char *resource_type_name(ResourceType type) {
+    switch (type) {
+
+    case ResourceType::mutex:
+        return "mutex";
+
+    case ResourceType::queue:
+        return "queue";
+
+    case ResourceType::binary_semaphore:
+        return "sem_bin";
+
+    case ResourceType::counting_semaphore:
+        return "sem_cnt";
+
+    case ResourceType::stream_buffer:
+        return "stream";
+
+    case ResourceType::_count:
+        break;
+    }
+    return "?";
+}
+
+ResourceStats resource_stats(ResourceType type) {
+    const auto &c = counters[static_cast<size_t>(type)];
+    return ResourceStats {
+        .live = c.live.load(std::memory_order_relaxed),
+        .high_water = c.high_water.load(std::memory_order_relaxed),
+    };
+}
+
+void detail::resource_created(ResourceType type) {
+    auto &c = counters[static_cast<size_t>(type)];
+    const uint16_t now = c.live.fetch_add(1, std::memory_order_relaxed) + 1;
+    uint16_t hw = c.high_water.load(std::memory_order_relaxed);
+    while (hw < now && !c.high_water.compare_exchange_weak(hw, now, std::memory_order_relaxed)) {
+    }
+}
+
+void detail::resource_destroyed(ResourceType type) {
+    auto &c = counters[static_cast<size_t>(type)];
+    c.live.fetch_sub(1, std::memory_order_relaxed);
+}
+
+} // namespace freertos
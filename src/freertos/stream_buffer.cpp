@@ -1,5 +1,6 @@
 /// @file
 #include <freertos/stream_buffer.hpp>
+#include <freertos/resource_registry.hpp>
 
 #include <cassert>
 #include <cstdlib>
@@ -20,10 +21,12 @@ StreamBufferBase::StreamBufferBase(std::span<std::byte> data_storage) {
         0,
         (uint8_t *)data_storage.data(),
         reinterpret_cast<StaticStreamBuffer_t *>(&stream_buffer_storage));
+    detail::resource_created(ResourceType::stream_buffer);
 }
 
 StreamBufferBase::~StreamBufferBase() {
     vStreamBufferDelete(StreamBufferHandle_t(handle));
+    detail::resource_destroyed(ResourceType::stream_buffer);
 }
 
 std::span<std::byte> StreamBufferBase::receive(std::span<std::byte> buffer) {
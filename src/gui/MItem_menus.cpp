@@ -9,6 +9,7 @@
 #include "screen_menu_temperature.hpp"
 #include "screen_menu_move.hpp"
 #include "screen_menu_sensor_info.hpp"
+#include "screen_menu_step_isr_info.hpp"
 #include "screen_menu_odometer.hpp"
 #include "screen_menu_version_info.hpp"
 #include "screen_menu_metrics.hpp"
@@ -85,6 +86,7 @@ template struct MI_SCREEN_CTOR<ScreenFilamentsReorder>;
 template struct MI_SCREEN_CTOR<ScreenFilamentsVisibility>;
 template struct MI_SCREEN_CTOR<ScreenMenuVersionInfo>;
 template struct MI_SCREEN_CTOR<ScreenMenuSensorInfo>;
+template struct MI_SCREEN_CTOR<ScreenMenuStepIsrInfo>;
 template struct MI_SCREEN_CTOR<ScreenMenuOdometer>;
 template struct MI_SCREEN_CTOR<screen_sysinfo_data_t>;
 template struct MI_SCREEN_CTOR<ScreenMenuFailStat>;
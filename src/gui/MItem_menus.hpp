@@ -60,6 +60,9 @@ using MI_VERSION_INFO
 using MI_SENSOR_INFO
     = MI_SCREEN<N_("Sensor Info"), class ScreenMenuSensorInfo>;
 
+using MI_STEP_ISR_INFO
+    = MI_SCREEN<N_("Step ISR Info"), class ScreenMenuStepIsrInfo, nullptr, is_hidden_t::dev>;
+
 using MI_ODOMETER
     = MI_SCREEN<N_("Statistics"), class ScreenMenuOdometer>;
 
@@ -412,7 +412,7 @@ MI_M600::MI_M600()
 }
 void MI_M600::click(IWindowMenu & /*window_menu*/) {
     if (!enqueued) {
-        marlin_client::inject("M600");
+        marlin_client::inject("M600", InjectPriority::user_action);
         enqueued = true;
     }
 }
@@ -1,10 +1,34 @@
 #include "ScreenHandler.hpp"
 #include "bsod.h"
+#include "img_resources.hpp"
 
 #include <gui.hpp>
 
+#ifdef _DEBUG
+    #include <heap.h>
+    #include <logging/log.hpp>
+
+LOG_COMPONENT_REF(GUI);
+#endif
+
 static const uint32_t MENU_TIMEOUT_MS = 30000;
 
+#ifdef _DEBUG
+/// heap_watch_alloc_count() snapshot taken when the current screen was created
+static uint32_t screen_alloc_mark = 0;
+
+/// Screens and their widgets live in ScreenFactory::storage; any heap
+/// allocation made by the GUI task during a screen's lifetime escapes that
+/// arena and fragments the heap. Report such escapes when the screen closes.
+static void log_escaped_allocations() {
+    const uint32_t count = heap_watch_alloc_count();
+    if (count != screen_alloc_mark) {
+        log_warning(GUI, "screen escaped its arena: %u heap allocations, last from 0x%08x",
+            (unsigned)(count - screen_alloc_mark), (unsigned)heap_watch_last_site());
+    }
+}
+#endif
+
 Screens *Screens::instance = nullptr;
 
 Screens::Screens(screen_node screen_creator)
@@ -15,6 +39,11 @@ Screens::Screens(screen_node screen_creator)
     , close_all(false)
     , close_printing(false)
     , timeout_tick(0) {
+#ifdef _DEBUG
+    // The constructor runs on the GUI task; watch it for allocations
+    // escaping the static screen storage
+    heap_watch_current_task();
+#endif
 }
 
 void Screens::Init(screen_node screen_creator) {
@@ -323,6 +352,9 @@ void Screens::InnerLoop() {
 
         /// without a reset screens does not behave correctly, because they occupy the same memory space as the new screen to be created
         if (current) {
+#ifdef _DEBUG
+            log_escaped_allocations();
+#endif
             current.reset();
         }
 
@@ -330,6 +362,12 @@ void Screens::InnerLoop() {
         /// screen ctor can change those pointers
         /// screen was destroyed by unique_ptr.release()
         window_t::ResetFocusedWindow();
+        /// window constructors of the new screen prefetch their icons,
+        /// drop whatever the previous screen had cached first
+        img::reset_icon_cache();
+#ifdef _DEBUG
+        screen_alloc_mark = heap_watch_alloc_count();
+#endif
         current = creator_node.creator();
         /// need to be reset also focused ptr
         if (!current->IsFocused() && !current->IsChildFocused()) {
@@ -82,7 +82,8 @@ struct FSMScreenDef {
         Screens::Access()->Close<Screen>();
     }
 
-    static void change(fsm::BaseData data) {
+    static void change(fsm::BaseData data, fsm::ChangeMask) {
+        // Screens diff phase against their stored state themselves
         if (auto s = Screens::Access()->get<Screen>()) {
             s->Change(data);
         }
@@ -101,9 +102,9 @@ struct FSMDialogDef {
         // Do nothing, is handled elsewhere
     }
 
-    static void change(fsm::BaseData data) {
+    static void change(fsm::BaseData data, fsm::ChangeMask changes) {
         if (auto &ptr = DialogHandler::Access().ptr) {
-            ptr->Change(data);
+            ptr->Change(data, changes);
         }
     }
 };
@@ -124,7 +125,7 @@ struct FSMWaitDef {
         // Do nothing, is handled elsewhere
     }
 
-    static void change(fsm::BaseData) {
+    static void change(fsm::BaseData, fsm::ChangeMask) {
         // No changes supported
     }
 };
@@ -156,7 +157,7 @@ struct FSMPrintDef {
         Screens::Access()->CloseAll();
     }
 
-    static void change([[maybe_unused]] fsm::BaseData data) {
+    static void change([[maybe_unused]] fsm::BaseData data, fsm::ChangeMask) {
         // Do nothing
     }
 };
@@ -167,7 +168,7 @@ struct FSMEndDef {
 
     static void open(fsm::BaseData) {}
     static void close() {}
-    static void change(fsm::BaseData) {}
+    static void change(fsm::BaseData, fsm::ChangeMask) {}
 };
 
 template <class... T>
@@ -254,11 +255,11 @@ void DialogHandler::close(ClientFSM fsm_type) {
     }
 }
 
-void DialogHandler::change(ClientFSM fsm_type, fsm::BaseData data) {
+void DialogHandler::change(ClientFSM fsm_type, fsm::BaseData data, fsm::ChangeMask changes) {
     last_fsm_change = std::make_pair(fsm_type, data);
 
     visit_display_config(fsm_type, [&]<typename Config>(Config) {
-        Config::change(data);
+        Config::change(data, changes);
     });
 }
 
@@ -284,7 +285,7 @@ void DialogHandler::Loop() {
     if (new_top && old_top) {
         if (new_top->fsm_type == old_top->fsm_type) {
             if (new_top->data != old_top->data) {
-                change(new_top->fsm_type, new_top->data);
+                change(new_top->fsm_type, new_top->data, fsm::changes(old_top->data, new_top->data));
             }
         } else {
             if (new_top->fsm_type == ClientFSM::Load_unload && (old_top->fsm_type == ClientFSM::PrintPreview
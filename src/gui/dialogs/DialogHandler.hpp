@@ -18,7 +18,7 @@ class DialogHandler {
     DialogHandler(DialogHandler &) = delete;
 
     void close(ClientFSM fsm_type);
-    void change(ClientFSM fsm_type, fsm::BaseData data);
+    void change(ClientFSM fsm_type, fsm::BaseData data, fsm::ChangeMask changes = fsm::all_changed);
     void open(ClientFSM fsm_type, fsm::BaseData data); // can be enforced (pre opened), unlike change/close
 
 public:
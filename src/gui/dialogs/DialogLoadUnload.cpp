@@ -381,6 +381,17 @@ static constexpr bool is_notice(PhasesLoadUnload phase) {
     return is_notice_mmu(phase) || is_notice_fstuck(phase);
 }
 
+bool DialogLoadUnload::Change(fsm::BaseData base_data, fsm::ChangeMask changes) {
+    // Only the progress byte ticked (see ProgressSerializerLoadUnload layout):
+    // just move the progress bar, skip the whole mode/phase re-layout.
+    // Notice phases carry a pointer in the data instead, those take the full path.
+    if (changes == fsm::data_changed_bit(1) && current_phase && !is_notice(*current_phase)) {
+        set_progress_percent(deserialize_progress(base_data.GetData()));
+        return true;
+    }
+    return Change(base_data);
+}
+
 bool DialogLoadUnload::Change(fsm::BaseData base_data) {
     PhasesLoadUnload phase = GetEnumFromPhaseIndex<PhasesLoadUnload>(base_data.GetPhase());
     fsm::PhaseData data = base_data.GetData();
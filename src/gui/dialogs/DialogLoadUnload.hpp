@@ -57,6 +57,7 @@ private:
 
 public:
     bool Change(fsm::BaseData data) override final;
+    bool Change(fsm::BaseData data, fsm::ChangeMask changes) override final;
 
     static constexpr uint8_t MaxErrorCodeDigits = 10;
 
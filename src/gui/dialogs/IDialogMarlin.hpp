@@ -13,4 +13,8 @@ public:
         : IDialog(rect) {}
 
     virtual bool Change(fsm::BaseData) { return true; }
+
+    /// Change with the mask of fields that differ from the previous state;
+    /// dialogs override this when they can skip work for partial updates.
+    virtual bool Change(fsm::BaseData data, fsm::ChangeMask) { return Change(data); }
 };
@@ -20,9 +20,8 @@ DialogQuickPause::DialogQuickPause(fsm::BaseData data)
     , radio(this, GuiDefaults::GetButtonRect_AvoidFooter(GuiDefaults::RectScreenBody), PhasesQuickPause::QuickPaused) {
 
     if (marlin_vars().print_state == marlin_server::State::Printing) {
-        auto lock = MarlinVarsLockGuard();
         static char buff[FILE_NAME_BUFFER_LEN] = { 0 };
-        marlin_vars().media_LFN.copy_to(buff, FILE_NAME_BUFFER_LEN, lock);
+        marlin_vars().media_LFN.copy_to(buff, FILE_NAME_BUFFER_LEN);
         gcode_name.SetText(string_view_utf8::MakeRAM(buff));
     }
 
@@ -19,7 +19,12 @@
     #endif
 #endif
 #if HAS_LARGE_DISPLAY()
-    #include "res/cc/font_regular_9x16_full.hpp" //Font::small
+    #if ENABLE_TRANSLATION_JA()
+        #include "res/cc/font_regular_9x16_full.hpp" //Font::small
+    #else
+        #include "res/cc/font_regular_9x16_standard.hpp" //Font::small (no katakana needed, save flash)
+    #endif
+    // No standard subset is generated for the bold fonts, they ship full either way.
     #include "res/cc/font_bold_11x19_full.hpp" //Font::normal
     #include "res/cc/font_bold_13x22_full.hpp" //Font::big
     #include "res/cc/font_bold_30x53_digits.hpp" //Font::large
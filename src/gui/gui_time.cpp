@@ -13,6 +13,15 @@ static uint32_t current_loop_counter = 0;
 static uint32_t loop_start_tick = 0;
 static uint32_t worst_duration = 0;
 
+static uint32_t draw_start_us = 0;
+static uint32_t worst_frame_duration_us = 0;
+static bool frame_over_budget = false;
+
+// One redraw period (25 fps); a frame that takes longer than this delays input
+// handling past the point where the encoder feels laggy, so the lowest
+// priority invalidations (rolling texts) are deferred after such a frame
+static constexpr uint32_t FRAME_BUDGET_US = 40'000;
+
 static constexpr uint32_t REPORT_DELAY = 100; // Record highest gui loop duration every 100ms
 static Sw_Timer report_timer(REPORT_DELAY);
 
@@ -28,6 +37,7 @@ void gui::StartLoop() {
 
 #ifndef UNITTESTS
 METRIC_DEF(gui_loop_duration, "gui_loop_dur", METRIC_VALUE_INTEGER, 100, METRIC_DISABLED);
+METRIC_DEF(gui_frame_duration, "gui_frame_dur", METRIC_VALUE_INTEGER, 100, METRIC_DISABLED);
 #endif
 
 void gui::EndLoop() {
@@ -35,11 +45,29 @@ void gui::EndLoop() {
     if (report_timer.RestartIfIsOver(ticks_ms())) {
 #ifndef UNITTESTS
         metric_record_integer(&gui_loop_duration, worst_duration);
+        metric_record_integer(&gui_frame_duration, worst_frame_duration_us);
 #endif
         worst_duration = 0;
+        worst_frame_duration_us = 0;
     }
 }
 
+void gui::StartDraw() {
+    draw_start_us = ticks_us();
+}
+
+void gui::EndDraw() {
+    const uint32_t duration = ticks_us() - draw_start_us;
+    worst_frame_duration_us = std::max(worst_frame_duration_us, duration);
+    frame_over_budget = duration > FRAME_BUDGET_US;
+}
+
+bool gui::ConsumeFrameOverBudget() {
+    const bool was_over_budget = frame_over_budget;
+    frame_over_budget = false;
+    return was_over_budget;
+}
+
 uint32_t gui::GetLoopCounter() {
     return current_loop_counter;
 }
@@ -43,6 +43,7 @@
 #endif
 
 #include "Jogwheel.hpp"
+#include <common/loop_latency_monitor.hpp>
 #include <wdt.hpp>
 #include <crash_dump/dump.hpp>
 #include "gui_leds.hpp"
@@ -235,7 +236,7 @@ void gui_run(void) {
     DialogHandler::Access(); // to create class NOW, not at first call of one of callback
     marlin_client::set_message_cb(MsgCircleBuffer_cb);
 
-    marlin_client::set_event_notify(marlin_server::EVENT_MSK_DEF);
+    marlin_client::set_event_notify(marlin_server::EVENT_MSK_GUI);
 
     // Close bootstrap screen, open home screen
     Screens::Access()->Close();
@@ -261,8 +262,11 @@ void gui_run(void) {
     // BFW-6193
     Screens::Access()->Loop();
 
+    static buddy::LoopLatencyMonitor loop_latency_monitor("gui");
+
     // TODO make some kind of registration
     while (1) {
+        loop_latency_monitor.tick();
         gui::StartLoop();
 
         led_animation_step();
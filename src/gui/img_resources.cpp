@@ -30,6 +30,76 @@ FILE *get_resource_file() {
     return file;
 }
 
+#if !PRINTER_IS_PRUSA_MINI()
+// MINI needs the RAM more than the faster screen transitions, the cache
+// exists only on the printers with the larger displays
+static constexpr size_t icon_cache_size = 8 * 1024;
+static constexpr size_t icon_cache_max_entries = 32;
+
+struct IconCacheEntry {
+    size_t offset; ///< Offset of the resource in the resource file, serves as the key
+    uint16_t size;
+    uint16_t arena_offset;
+};
+
+static IconCacheEntry icon_cache_entries[icon_cache_max_entries];
+static uint8_t icon_cache_arena[icon_cache_size];
+static size_t icon_cache_used_entries = 0;
+static size_t icon_cache_used_bytes = 0;
+
+static const IconCacheEntry *icon_cache_find(const Resource &res) {
+    for (size_t i = 0; i < icon_cache_used_entries; i++) {
+        if (icon_cache_entries[i].offset == res.offset) {
+            return &icon_cache_entries[i];
+        }
+    }
+    return nullptr;
+}
+#endif
+
+void prefetch_icon([[maybe_unused]] const Resource &res) {
+#if !PRINTER_IS_PRUSA_MINI()
+    if (res.file || !res.size) {
+        return; // only resources from the global resource file are cached
+    }
+    if (icon_cache_find(res)) {
+        return;
+    }
+    if (icon_cache_used_entries == icon_cache_max_entries || icon_cache_used_bytes + res.size > icon_cache_size) {
+        return; // cache full, the icon will be drawn from the file as before
+    }
+
+    FILE *f = get_resource_file();
+    if (!f) {
+        return; // before bootstrap, nothing to prefetch from
+    }
+    if (fseek(f, res.offset, SEEK_SET) != 0 || fread(icon_cache_arena + icon_cache_used_bytes, 1, res.size, f) != res.size) {
+        return;
+    }
+
+    icon_cache_entries[icon_cache_used_entries++] = IconCacheEntry { res.offset, uint16_t(res.size), uint16_t(icon_cache_used_bytes) };
+    icon_cache_used_bytes += res.size;
+#endif
+}
+
+FILE *open_cached_icon([[maybe_unused]] const Resource &res) {
+#if !PRINTER_IS_PRUSA_MINI()
+    if (!res.file) {
+        if (const IconCacheEntry *entry = icon_cache_find(res)) {
+            return fmemopen(icon_cache_arena + entry->arena_offset, entry->size, "rb");
+        }
+    }
+#endif
+    return nullptr;
+}
+
+void reset_icon_cache() {
+#if !PRINTER_IS_PRUSA_MINI()
+    icon_cache_used_entries = 0;
+    icon_cache_used_bytes = 0;
+#endif
+}
+
 img::ResourceSingleFile::ResourceSingleFile(const char *name)
     : Resource(0, 0, 0, 0) {
     file = open_file_and_disable_buff(name);
@@ -44,4 +44,24 @@ void enable_resource_file();
  */
 FILE *get_resource_file();
 
+/**
+ * @brief Read the resource data into the icon read-ahead cache.
+ * Called from window constructors, so the data is already in RAM by the time
+ * the new screen draws for the first time and icons do not pop in one by one.
+ * Best effort - when the cache is full the icon is simply drawn from the
+ * resource file as before.
+ */
+void prefetch_icon(const Resource &res);
+
+/**
+ * @brief Open a memory backed stream over previously prefetched resource data.
+ * @return FILE* the caller must fclose, or nullptr when the resource is not cached.
+ */
+FILE *open_cached_icon(const Resource &res);
+
+/**
+ * @brief Drop all prefetched icons, called when a screen transition starts.
+ */
+void reset_icon_cache();
+
 } // namespace img
@@ -49,6 +49,20 @@ void LazyDirViewBase::Clear() {
     }
 }
 
+void LazyDirViewBase::adopt(const LazyDirViewBase &other) {
+    assert(window_size == other.window_size);
+
+    totalFiles = other.totalFiles;
+    windowStartingFrom = other.windowStartingFrom;
+    sortPolicy = other.sortPolicy;
+    strlcpy(sfnPath, other.sfnPath, sizeof(sfnPath));
+
+    for (auto i = 0; i < window_size; i++) {
+        files_data[i] = other.files_data[i];
+        indices_data[i] = other.indices_data[i];
+    }
+}
+
 void LazyDirViewBase::ChangeDirectory(const char *p, SortPolicy sp, const char *firstDirEntry) {
     Clear();
 
@@ -48,6 +48,12 @@ public:
     ///                      A value of nullptr means put ".." first
     void ChangeDirectory(const char *p, SortPolicy sp = SortPolicy::BY_NAME, const char *firstDirEntry = nullptr);
 
+    /// Takes over the content of another view (entries, window position, path,
+    /// sort policy). Both views must have the same window size.
+    /// Used to move results of a background directory scan into the view the
+    /// GUI reads from.
+    void adopt(const LazyDirViewBase &other);
+
     /// Sets window offset to the specified position.
     /// \returns actual offset set
     int set_window_offset(int target);
@@ -1,6 +1,7 @@
 // print_time_module.cpp
 
 #include "format_print_will_end.hpp"
+#include <cstring>
 #include <ctime>
 #include "marlin_client.hpp"
 #include "print_time_module.hpp"
@@ -18,18 +19,26 @@ PT_t PrintTime::update_loop(PT_t screen_format, window_text_t *out_print_end, [[
     if (out_print_dur) {
         const time_t rawtime = (time_t)marlin_vars().print_duration; // print_duration holds SECONDS
         if (rawtime != last_print_duration) {
-            out_print_dur->SetTextColor(generate_duration(rawtime));
-            out_print_dur->SetText(string_view_utf8::MakeRAM((const uint8_t *)text_time_dur.data()));
-            out_print_dur->Invalidate();
+            const auto prev_text = text_time_dur;
+            const Color duration_color = generate_duration(rawtime);
+            // seconds only show below one hour, later the text changes once a minute
+            if (strcmp(text_time_dur.data(), prev_text.data()) != 0) {
+                out_print_dur->SetTextColor(duration_color);
+                out_print_dur->SetText(string_view_utf8::MakeRAM((const uint8_t *)text_time_dur.data()));
+                out_print_dur->Invalidate();
+            }
         }
         last_print_duration = rawtime;
     }
 #endif
 
-    if (screen_format != PT_t::init && time_to_end != marlin_server::TIME_TO_END_INVALID && time_to_end == last_time_to_end) {
+    // The display has minute granularity and this also covers the invalid value,
+    // which used to reformat "N/A" on every single call
+    if (screen_format != PT_t::init && time_to_end / 60 == last_time_to_end / 60) {
         return time_end_format;
     }
 
+    const auto prev_text = text_time_end;
     const Color print_end_text_color = [&] {
         // Invalid
         if (time_to_end == marlin_server::TIME_TO_END_INVALID || time_to_end > 60 * 60 * 24 * 365) {
@@ -57,9 +66,11 @@ PT_t PrintTime::update_loop(PT_t screen_format, window_text_t *out_print_end, [[
 
         return GuiDefaults::COLOR_VALUE_VALID;
     }();
-    out_print_end->SetTextColor(print_end_text_color);
-    out_print_end->SetText(string_view_utf8::MakeRAM((const uint8_t *)text_time_end.data()));
-    out_print_end->Invalidate();
+    if (strcmp(text_time_end.data(), prev_text.data()) != 0) {
+        out_print_end->SetTextColor(print_end_text_color);
+        out_print_end->SetText(string_view_utf8::MakeRAM((const uint8_t *)text_time_end.data()));
+        out_print_end->Invalidate();
+    }
     last_time_to_end = time_to_end;
 
     return time_end_format;
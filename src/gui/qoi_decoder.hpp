@@ -11,6 +11,8 @@ struct Pixel {
     uint8_t g;
     uint8_t b;
     uint8_t a;
+
+    bool operator==(const Pixel &) const = default;
 };
 
 class Decoder {
@@ -22,6 +22,7 @@
 #include "screen_move_z.hpp"
 #include "ScreenFactory.hpp"
 #include "gui_media_events.hpp"
+#include <common/gcode/gcode_info_scan.hpp>
 #include "DialogHandler.hpp"
 #include "img_resources.hpp"
 #include "tasks.hpp"
@@ -469,6 +470,10 @@ void screen_home_data_t::windowEvent(window_t *sender, GUI_event_t event, void *
 
                 std::array<char, FILE_PATH_BUFFER_LEN> filepath;
                 if (find_latest_gcode(filepath.data(), filepath.size())) {
+                    // Start reading the metadata right away, overlapping the print_start
+                    // round-trip; the preview FSM then picks up this scan instead of
+                    // issuing its own several loops later.
+                    gcode_info_scan::prescan_file(filepath.data());
                     print_begin(filepath.data());
                 }
             }
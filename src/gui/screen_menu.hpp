@@ -4,6 +4,7 @@
 #include <status_footer.hpp>
 #include <WinMenuContainer.hpp>
 #include <window_menu.hpp>
+#include <window_menu_virtual.hpp>
 #include <screen.hpp>
 
 /// Bits of ScreenMenuBase than can be made non-templated to save flash
@@ -87,3 +88,15 @@ public:
 
     // ShowDevOnly intentionally not supported, can be set only in ctor
 };
+
+/// ScreenMenu backed by WindowMenuStatic instead of a WinMenuContainer: only
+/// the items currently visible on the screen are instantiated, so long menus
+/// do not pay RAM for every item (see WindowMenuStatic for the restrictions
+/// this puts on the items). The items are transient, so there is no Item<>()
+/// access and no SwapVisibility().
+template <EFooter FOOTER, class... T>
+class ScreenMenuVirtual : public ScreenMenuBase<WindowMenuStatic<T...>> {
+public:
+    ScreenMenuVirtual(const string_view_utf8 &label, window_t *parent = nullptr)
+        : ScreenMenuBase<WindowMenuStatic<T...>>(parent, label, FOOTER) {}
+};
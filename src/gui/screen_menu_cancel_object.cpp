@@ -45,23 +45,21 @@ void MI_CO_OBJECT_N::UpdateState() {
 
 void MI_CO_OBJECT_N::UpdateName() {
     if (marlin_vars().cancel_object_count > ObjectId) {
-        bool empty; ///< True if object name from G-code is empty
-
-        { // Do all things in one lock
-            MarlinVarsLockGuard lock;
-
-            // Check if object name is empty
-            char first_char[2]; // Needs to be 2 to get 1 character and a valid null-terminator
-            marlin_vars().cancel_object_names[ObjectId].copy_to(first_char, 2, lock);
-            empty = (first_char[0] == '\0');
-
-            // Check if object name is known and (either was unknown before or changed)
-            if (!empty && (backup_label_used || (!marlin_vars().cancel_object_names[ObjectId].equals(label_buffer, lock)))) {
-                marlin_vars().cancel_object_names[ObjectId].copy_to(label_buffer, sizeof(label_buffer), lock);
-                backup_label_used = false;
-                Invalidate(); // The string memory is the same, so it needs to be invalidated manually
-            }
-        } // Unlock marlin_vars
+        // Sample the object name first, side effects belong after the snapshot loop
+        char name_buffer[sizeof(label_buffer)];
+        MarlinVarsSnapshot snapshot;
+        do {
+            marlin_vars().cancel_object_names[ObjectId].copy_to(name_buffer, sizeof(name_buffer), snapshot);
+        } while (snapshot.retry());
+
+        const bool empty = (name_buffer[0] == '\0'); ///< True if object name from G-code is empty
+
+        // Check if object name is known and (either was unknown before or changed)
+        if (!empty && (backup_label_used || strncmp(label_buffer, name_buffer, sizeof(label_buffer)) != 0)) {
+            strlcpy(label_buffer, name_buffer, sizeof(label_buffer));
+            backup_label_used = false;
+            Invalidate(); // The string memory is the same, so it needs to be invalidated manually
+        }
 
         // Switch from object name to backup_label
         if (empty && !backup_label_used) {
@@ -9,7 +9,9 @@
 #include "MItem_mmu.hpp"
 #include <option/has_mmu2.h>
 
-using ScreenMenuFailStat__ = ScreenMenu<EFooter::On, MI_RETURN
+// Virtual menu - the counters are read out in the item constructors, nothing
+// needs to stay alive while scrolled out of view
+using ScreenMenuFailStat__ = ScreenMenuVirtual<EFooter::On, MI_RETURN
 #if ENABLED(POWER_PANIC)
     ,
     MI_POWER_PANICS /*filament runout,*/
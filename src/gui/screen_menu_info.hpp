@@ -12,7 +12,7 @@ using ScreenMenuInfo__ = ScreenMenu<EFooter::On, MI_RETURN,
     MI_SYS_INFO,
 #endif //_DEBUG
     MI_NETWORK_STATUS,
-    MI_SENSOR_INFO, MI_VERSION_INFO, MI_PRINT_STATISTICS>;
+    MI_SENSOR_INFO, MI_STEP_ISR_INFO, MI_VERSION_INFO, MI_PRINT_STATISTICS>;
 
 class ScreenMenuInfo : public ScreenMenuInfo__ {
     virtual void windowEvent(window_t *sender, GUI_event_t event, void *param) override;
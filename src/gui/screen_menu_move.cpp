@@ -68,6 +68,7 @@ ScreenMenuMove::ScreenMenuMove()
     Item<MI_AXIS_E>().set_value(0);
 
     Item<screen_menu_move::MI_COOLDOWN>().callback = [] {
+        marlin_client::RequestBatch batch;
         HOTEND_LOOP() {
             marlin_client::set_target_nozzle(0, e);
         }
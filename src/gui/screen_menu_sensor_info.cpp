@@ -15,5 +15,5 @@ void ScreenMenuSensorInfo::windowEvent(window_t *sender, GUI_event_t event, void
         return;
     }
 
-    ScreenMenu::windowEvent(sender, event, param);
+    ScreenMenuVirtual::windowEvent(sender, event, param);
 }
@@ -48,7 +48,9 @@ struct ScreenMenuSensorInfo__;
 
 template <size_t... hotend>
 struct ScreenMenuSensorInfo__<std::index_sequence<hotend...>> {
-    using T = ScreenMenu<GuiDefaults::MenuFooter,
+    // Virtual menu - the list is long and the items only show live values,
+    // so there is no point keeping all of them in RAM at once
+    using T = ScreenMenuVirtual<GuiDefaults::MenuFooter,
         MI_RETURN,
 
 #if PRINTER_IS_PRUSA_MINI()
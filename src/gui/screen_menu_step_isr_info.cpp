@@ -0,0 +1,69 @@
+/**
+ * @file screen_menu_step_isr_info.cpp
+ */
+
+#include "screen_menu_step_isr_info.hpp"
+
+#include <device/cmsis.h>
+#include <i18n.h>
+
+#include <cinttypes>
+
+static const step_isr_cycle_stats_t &stats() {
+    return PreciseStepping::step_isr_cycle_stats;
+}
+
+static void print_us(uint32_t cycles, const std::span<char> &buffer) {
+    // all GUI boards run the core at SYSTEM_CORE_CLOCK, so cycles map to time directly
+    snprintf(buffer.data(), buffer.size(), "%.1f us", double(cycles) / (SYSTEM_CORE_CLOCK / 1000000));
+}
+
+MI_STEP_ISR_SAMPLES::MI_STEP_ISR_SAMPLES()
+    : MenuItemAutoUpdatingLabel(_("Samples"), "%" PRIu32,
+        [](auto) { return stats().count; } //
+    ) {}
+
+MI_STEP_ISR_MIN::MI_STEP_ISR_MIN()
+    : MenuItemAutoUpdatingLabel(
+        _("Min"),
+        [this](const std::span<char> &buffer) { print_us(value(), buffer); },
+        [](auto) { return stats().min_cycles; } //
+    ) {}
+
+MI_STEP_ISR_AVG::MI_STEP_ISR_AVG()
+    : MenuItemAutoUpdatingLabel(
+        _("Avg"),
+        [this](const std::span<char> &buffer) { print_us(value(), buffer); },
+        [](auto) { return stats().avg_cycles; } //
+    ) {}
+
+MI_STEP_ISR_MAX::MI_STEP_ISR_MAX()
+    : MenuItemAutoUpdatingLabel(
+        _("Max"),
+        [this](const std::span<char> &buffer) { print_us(value(), buffer); },
+        [](auto) { return stats().max_cycles; } //
+    ) {}
+
+// Bucket boundaries are fixed powers of two of CPU cycles, no point translating
+static constexpr const char *histogram_labels[step_isr_cycle_stats_t::HISTOGRAM_SIZE] = {
+    "< 64 cycles",
+    "64-127 cycles",
+    "128-255 cycles",
+    "256-511 cycles",
+    "512-1023 cycles",
+    "1024-2047 cycles",
+    "2048-4095 cycles",
+    ">= 4096 cycles",
+};
+
+MI_STEP_ISR_HISTOGRAM_BUCKET::MI_STEP_ISR_HISTOGRAM_BUCKET(size_t bucket)
+    : MenuItemAutoUpdatingLabel(string_view_utf8::MakeCPUFLASH(reinterpret_cast<const uint8_t *>(histogram_labels[bucket])), "%" PRIu32,
+        [](MenuItemAutoUpdatingLabel<uint32_t> *item) {
+            return stats().histogram[static_cast<MI_STEP_ISR_HISTOGRAM_BUCKET *>(item)->bucket];
+        })
+    , bucket(bucket) {}
+
+ScreenMenuStepIsrInfo::ScreenMenuStepIsrInfo()
+    : ScreenMenuStepIsrInfo_(_("STEP ISR INFO")) {
+    ClrMenuTimeoutClose();
+}
@@ -0,0 +1,58 @@
+/**
+ * @file screen_menu_step_isr_info.hpp
+ * @brief Debug overview of step ISR execution times
+ */
+#pragma once
+
+#include <Marlin/src/feature/precise_stepping/precise_stepping.hpp>
+
+#include <screen_menu.hpp>
+#include <WindowMenuItems.hpp>
+#include <WindowItemFormatableLabel.hpp>
+#include <meta_utils.hpp>
+
+/// Number of ISR runs aggregated in the last reporting window
+class MI_STEP_ISR_SAMPLES final : public MenuItemAutoUpdatingLabel<uint32_t> {
+public:
+    MI_STEP_ISR_SAMPLES();
+};
+
+class MI_STEP_ISR_MIN final : public MenuItemAutoUpdatingLabel<uint32_t> {
+public:
+    MI_STEP_ISR_MIN();
+};
+
+class MI_STEP_ISR_AVG final : public MenuItemAutoUpdatingLabel<uint32_t> {
+public:
+    MI_STEP_ISR_AVG();
+};
+
+class MI_STEP_ISR_MAX final : public MenuItemAutoUpdatingLabel<uint32_t> {
+public:
+    MI_STEP_ISR_MAX();
+};
+
+/// One log2 histogram bucket of ISR execution times (in CPU cycles)
+class MI_STEP_ISR_HISTOGRAM_BUCKET final : public MenuItemAutoUpdatingLabel<uint32_t> {
+public:
+    MI_STEP_ISR_HISTOGRAM_BUCKET(size_t bucket);
+
+    const size_t bucket;
+};
+
+template <typename>
+struct ScreenMenuStepIsrInfo__;
+
+template <size_t... bucket>
+struct ScreenMenuStepIsrInfo__<std::index_sequence<bucket...>> {
+    using T = ScreenMenu<EFooter::On, MI_RETURN,
+        MI_STEP_ISR_SAMPLES, MI_STEP_ISR_MIN, MI_STEP_ISR_AVG, MI_STEP_ISR_MAX,
+        WithConstructorArgs<MI_STEP_ISR_HISTOGRAM_BUCKET, bucket>...>;
+};
+
+using ScreenMenuStepIsrInfo_ = ScreenMenuStepIsrInfo__<std::make_index_sequence<step_isr_cycle_stats_t::HISTOGRAM_SIZE>>::T;
+
+class ScreenMenuStepIsrInfo : public ScreenMenuStepIsrInfo_ {
+public:
+    ScreenMenuStepIsrInfo();
+};
@@ -24,12 +24,15 @@ ScreenMenuTemperature::ScreenMenuTemperature()
 #endif // PRINTER_IS_PRUSA_MINI()
 
     Item<screen_menu_temperature::MI_COOLDOWN>().callback = [this] {
-        HOTEND_LOOP() {
-            marlin_client::set_target_nozzle(0, e);
-            marlin_client::set_display_nozzle(0, e);
+        {
+            marlin_client::RequestBatch batch;
+            HOTEND_LOOP() {
+                marlin_client::set_target_nozzle(0, e);
+                marlin_client::set_display_nozzle(0, e);
+            }
+            marlin_client::set_target_bed(0);
+            marlin_client::set_fan_speed(0);
         }
-        marlin_client::set_target_bed(0);
-        marlin_client::set_fan_speed(0);
         Item<MI_NOZZLE<0>>().SetVal(0);
 #if HAS_TOOLCHANGER()
         Item<MI_NOZZLE<1>>().SetVal(0);
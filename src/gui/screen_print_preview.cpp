@@ -187,6 +187,16 @@ void ScreenPrintPreview::windowEvent([[maybe_unused]] window_t *sender, [[maybe_
         break;
     }
 
+    case GUI_event_t::LOOP:
+        // While the loading dialog waits for the gcode info scan, decode the
+        // thumbnail into the cache, so the main dialog draws without touching the file.
+        // Not during download_wait - a partial file could cache a truncated stream.
+        if (!thumbnail_prefetched && phase == PhasesPrintPreview::loading) {
+            thumbnail_prefetched = true;
+            thumbnail.prefetch();
+        }
+        break;
+
         // Swipe left/right during preview phase -> go back
     case GUI_event_t::TOUCH_SWIPE_LEFT:
     case GUI_event_t::TOUCH_SWIPE_RIGHT: {
@@ -46,6 +46,8 @@ class ScreenPrintPreview : public ScreenPrintPreviewBase {
     // Set to invalid value by default so that the Change() always triggers on the first call.
     PhasesPrintPreview phase = static_cast<PhasesPrintPreview>(-1);
 
+    bool thumbnail_prefetched = false; // one-shot, decoded into the cache while the loading dialog waits
+
     using UniquePtrBox = static_unique_ptr<MsgBoxIconned>;
     UniquePtrBox pMsgbox;
 
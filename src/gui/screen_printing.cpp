@@ -280,8 +280,10 @@ void screen_printing_data_t::windowEvent(window_t *sender, GUI_event_t event, vo
 
     change_print_state();
 
-    /// -- Print time update loop
-    updateTimes();
+    /// -- Print time update loop, coalesced to once per GUI frame
+    if (event == GUI_event_t::LOOP) {
+        updateTimes();
+    }
 
     /// -- close screen when print is done / stopped and USB media is removed
     if (!marlin_vars().media_inserted && (p_state == printing_state_t::PRINTED || p_state == printing_state_t::STOPPED)) {
@@ -511,7 +513,8 @@ void screen_printing_data_t::updateTimes() {
         return;
     }
 
-    if (auto now = ticks_s(); now - last_update_time_s > rotation_time_s) {
+    const auto now = ticks_s();
+    if (now - last_update_time_s > rotation_time_s) {
         // do rotation
 
         currently_showing = static_cast<CurrentlyShowing>(
@@ -520,12 +523,22 @@ void screen_printing_data_t::updateTimes() {
         rotating_circles.set_index(ftrstd::to_underlying(currently_showing));
 
         last_update_time_s = now;
+    } else if (now == last_values_update_time_s) {
+        // The values have minute granularity, formatting them once per second
+        // is plenty - keep the rest of the GUI frames cheap during prints
+        return;
     }
+    last_values_update_time_s = now;
 
     bool value_available = true;
     auto time_to_end = marlin_vars().time_to_end.get();
     auto time_to_change = marlin_vars().time_to_pause.get();
 
+    // Format into a scratch buffer, the widget keeps referencing
+    // w_etime_value_buffer, so formatting in place would defeat the change
+    // detection below
+    EndResultBody::DateBufferT value_buffer {};
+
     if ((currently_showing == CurrentlyShowing::end_time
             || currently_showing == CurrentlyShowing::remaining_time)
         && (time_to_end == marlin_server::TIME_TO_END_INVALID || time_to_end > 60 * 60 * 24 * 365)) {
@@ -536,17 +549,17 @@ void screen_printing_data_t::updateTimes() {
 
     case CurrentlyShowing::end_time:
         w_etime_label.SetText(_(PrintTime::EN_STR_TIMESTAMP));
-        value_available &= PrintTime::print_end_time(time_to_end, w_etime_value_buffer);
+        value_available &= PrintTime::print_end_time(time_to_end, value_buffer);
         break;
 
     case CurrentlyShowing::remaining_time:
         w_etime_label.SetText(_(PrintTime::EN_STR_COUNTDOWN));
-        PrintTime::print_formatted_duration(time_to_end, w_etime_value_buffer);
+        PrintTime::print_formatted_duration(time_to_end, value_buffer);
         break;
 
     case CurrentlyShowing::time_since_start:
         w_etime_label.SetText(_(EndResultBody::txt_printing_time));
-        PrintTime::print_formatted_duration(marlin_vars().print_duration.get(), w_etime_value_buffer, true);
+        PrintTime::print_formatted_duration(marlin_vars().print_duration.get(), value_buffer, true);
         break;
 
     case CurrentlyShowing::time_to_change:
@@ -554,7 +567,7 @@ void screen_printing_data_t::updateTimes() {
         if (time_to_change == marlin_server::TIME_TO_END_INVALID) {
             value_available = false;
         } else {
-            PrintTime::print_formatted_duration(time_to_change, w_etime_value_buffer);
+            PrintTime::print_formatted_duration(time_to_change, value_buffer);
         }
         break;
     case CurrentlyShowing::_count:
@@ -565,9 +578,18 @@ void screen_printing_data_t::updateTimes() {
     // Add unknown marker
     // (time since start is always exact, not influenced by the print speed)
     if (marlin_vars().print_speed != 100 && currently_showing != CurrentlyShowing::time_since_start) {
-        strlcat(w_etime_value_buffer.data(), "?", w_etime_value_buffer.size());
+        strlcat(value_buffer.data(), "?", value_buffer.size());
     }
 
+    // Repaint only when the rendered text actually changed - the values tick
+    // once per minute, this function runs far more often
+    if (value_available == last_value_available && (!value_available || strcmp(value_buffer.data(), w_etime_value_buffer.data()) == 0)) {
+        return;
+    }
+
+    w_etime_value_buffer = value_buffer;
+    last_value_available = value_available;
+
     if (value_available) {
         w_etime_value.SetText(string_view_utf8::MakeRAM(w_etime_value_buffer.data()));
         w_etime_value.SetTextColor(GuiDefaults::COLOR_VALUE_VALID);
@@ -576,7 +598,7 @@ void screen_printing_data_t::updateTimes() {
         w_etime_value.SetTextColor(GuiDefaults::COLOR_VALUE_INVALID);
     }
 
-    w_etime_value.Invalidate(); // just to make sure
+    w_etime_value.Invalidate(); // SetText of the same buffer does not
 
 #endif
 }
@@ -100,7 +100,7 @@ class screen_printing_data_t : public ScreenPrintingModel {
     PrintTime print_time;
     PT_t time_end_format;
 #else
-    EndResultBody::DateBufferT w_etime_value_buffer;
+    EndResultBody::DateBufferT w_etime_value_buffer {};
     EndResultBody end_result_body;
 
     enum class CurrentlyShowing {
@@ -115,6 +115,8 @@ class screen_printing_data_t : public ScreenPrintingModel {
 
     CurrentlyShowing currently_showing { CurrentlyShowing::remaining_time }; // what item is currently shown
     uint32_t last_update_time_s { 0 }; // helper needed to properly rotate
+    uint32_t last_values_update_time_s { ~0u }; // second of the last value refresh, they need no finer granularity
+    bool last_value_available { true }; // whether the currently rendered w_etime_value_buffer is valid
 #endif
 
     window_text_t message_popup;
@@ -90,6 +90,15 @@ constexpr Rect16 get_right_phys_icon_rect(size_t idx) {
     return { col_1_text - alert_icon_size - middle_connector_margin, static_cast<int16_t>(get_icon_row(idx)), alert_icon_size, alert_icon_size };
 }
 
+// Redraw zones covering one row of a column - the text (with the colour box inside) plus the alert icon next to it
+constexpr Rect16 get_left_row_zone_rect(size_t idx) {
+    return { col_0_text, static_cast<int16_t>(row_first_item + idx * text_row_separation), text_col_width + middle_connector_margin + alert_icon_size, text_height };
+}
+
+constexpr Rect16 get_right_row_zone_rect(size_t idx) {
+    return { col_1_text - alert_icon_size - middle_connector_margin, static_cast<int16_t>(row_first_item + idx * text_row_separation), alert_icon_size + middle_connector_margin + text_col_width, text_height };
+}
+
 constexpr Rect16 bottom_guide_rect { text_side_margin, row_guide_text, GuiDefaults::ScreenWidth - 2 * text_side_margin, text_height };
 constexpr Rect16 bottom_icon_rect { 0, row_guide_text + (text_height - alert_icon_size) / 2, alert_icon_size, alert_icon_size }; // this rect will have 'left' modified by the current strlen of text in bottom_guide (needs to be 0)
 
@@ -574,7 +583,7 @@ void ToolsMappingBody::go_left() {
 #if PRINTER_IS_PRUSA_XL()
     update_dwarf_lights();
 #endif
-    Invalidate();
+    // no blanket Invalidate - every setter above invalidates its own zone when it changes something
 }
 
 void ToolsMappingBody::go_right() {
@@ -607,7 +616,7 @@ void ToolsMappingBody::go_right() {
 #if PRINTER_IS_PRUSA_XL()
     update_dwarf_lights();
 #endif
-    Invalidate();
+    // no blanket Invalidate - every setter above invalidates its own zone when it changes something
 }
 
 uint8_t ToolsMappingBody::get_cnt_current_items() {
@@ -870,9 +879,8 @@ void ToolsMappingBody::update_middle_connectors() {
         }
     }
 
+    // set_parents invalidates the connector zone only when the routing actually changed
     middle_connector.set_parents(parents);
-
-    middle_connector.Invalidate();
 }
 
 void ToolsMappingBody::adjust_index(int difference) {
@@ -898,6 +906,10 @@ void ToolsMappingBody::ensure_nicely_ordered() {
     // Ideal order on the left is: ordered by index, if possible, with possible blank items inbetween (or unassigend gcodes if not possible)
     // Ideal order on the right is: Mapped directly next to the left item, spool joins underneath in join order, unassigned at the end
 
+    // snapshot the current layout, so that only rows whose occupant changes get redrawn
+    const auto previous_left_pos_to_real = left_gcode_pos_to_real;
+    const auto previous_right_pos_to_real = right_phys_pos_to_real;
+
     const int max_left_blanks { std::ssize(left_gcode_pos_to_real) - gcode.UsedExtrudersCount() };
 
     // order it so that idx_to_real array is split into two (three) parts -> ordered assigned indices, ordered unassigned indices (+ blanks)
@@ -1033,20 +1045,28 @@ void ToolsMappingBody::ensure_nicely_ordered() {
     order_idx_arr_based_on_pos(right_phys_pos_to_real, right_phys_idx_to_real, get_num_of_enabled_tools());
     order_idx_arr_based_on_pos(left_gcode_pos_to_real, left_gcode_idx_to_real, gcode.UsedExtrudersCount());
 
-    // update rects
+    // update rects, but only for rows whose occupant changed - invalidating the
+    // row zone through the parent repaints the background and every window
+    // intersecting it, the rest of the screen stays valid
 
     for (size_t current_pos = 0; current_pos < std::size(left_gcode_pos_to_real); ++current_pos) {
+        if (left_gcode_pos_to_real[current_pos] == previous_left_pos_to_real[current_pos]) {
+            continue;
+        }
         left_gcode_texts[left_gcode_pos_to_real[current_pos]].SetRect(get_left_gcode_rect(current_pos));
         left_gcode_colors[left_gcode_pos_to_real[current_pos]].SetRect(get_left_gcode_color_rect(current_pos));
         left_gcode_icons[left_gcode_pos_to_real[current_pos]].SetRect(get_left_gcode_icon_rect(current_pos));
+        GetParent()->Invalidate(get_left_row_zone_rect(current_pos));
     }
 
     for (size_t current_pos = 0; current_pos < std::size(right_phys_pos_to_real); ++current_pos) {
+        if (right_phys_pos_to_real[current_pos] == previous_right_pos_to_real[current_pos]) {
+            continue;
+        }
         right_phys_texts[right_phys_pos_to_real[current_pos]].SetRect(get_right_phys_rect(current_pos));
         right_phys_icons[right_phys_pos_to_real[current_pos]].SetRect(get_right_phys_icon_rect(current_pos));
+        GetParent()->Invalidate(get_right_row_zone_rect(current_pos));
     }
-
-    Invalidate();
 }
 
 void ToolsMappingBody::handle_right_steal() {
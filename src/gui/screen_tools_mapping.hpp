@@ -57,7 +57,7 @@ private:
     void adjust_index(int difference);
     /// Updates current screen, meant to be called after adjust_index (or from)
     void update_shown_state_after_scroll(uint8_t previous_idx);
-    /// Redraws the whole screen to correspond to current state
+    /// Updates the screen to correspond to current state, redrawing only the zones that changed
     void update_shown_state();
     /// Redraws middle connectors based on current state
     void update_middle_connectors();
@@ -16,10 +16,92 @@
 #include "gui_invalidate.hpp"
 #include "img_resources.hpp"
 #include <config_store/store_instance.hpp>
+#include <gcode_info_prescan.hpp>
+#include <buddy/filesystem_fatfs.h>
+#include <printers.h>
 #if _DEBUG
     #include "bsod.h"
 #endif
 
+namespace dir_view_cache {
+
+/// Snapshots of recently displayed directory windows, so reopening the file
+/// browser (or going back up a directory) does not re-scan the whole
+/// directory - on a card with hundreds of files that takes seconds. A
+/// snapshot is served only while the fatfs path cache generation is
+/// unchanged; any write to the drive or a remount makes all snapshots stale.
+struct Slot {
+    char path[FILE_PATH_BUFFER_LEN];
+    FileSort::SortPolicy policy;
+    uint32_t generation; ///< filesystem_fatfs_cache_generation() at store time
+    uint32_t last_used;
+    bool valid;
+    window_file_list_t::LDV view;
+};
+
+#if PRINTER_IS_PRUSA_MINI()
+constexpr size_t slot_count = 1; // need to save RAM on MINI
+#else
+constexpr size_t slot_count = 2;
+#endif
+
+static Slot slots[slot_count];
+static uint32_t use_counter = 0;
+
+static Slot *find(const char *path, FileSort::SortPolicy policy) {
+    const uint32_t generation = filesystem_fatfs_cache_generation();
+    for (Slot &slot : slots) {
+        if (slot.valid && slot.generation == generation && slot.policy == policy && strcmp(slot.path, path) == 0) {
+            slot.last_used = ++use_counter;
+            return &slot;
+        }
+    }
+    return nullptr;
+}
+
+static void store(const char *path, FileSort::SortPolicy policy, const LazyDirViewBase &view) {
+    const uint32_t generation = filesystem_fatfs_cache_generation();
+
+    Slot *victim = nullptr;
+    for (Slot &slot : slots) {
+        if (slot.valid && slot.policy == policy && strcmp(slot.path, path) == 0) {
+            victim = &slot;
+            break;
+        }
+    }
+    if (victim == nullptr) {
+        for (Slot &slot : slots) {
+            if (!slot.valid || slot.generation != generation) {
+                victim = &slot;
+                break;
+            }
+        }
+    }
+    if (victim == nullptr) {
+        victim = &slots[0];
+        for (Slot &slot : slots) {
+            if (slot.last_used < victim->last_used) {
+                victim = &slot;
+            }
+        }
+    }
+
+    strlcpy(victim->path, path, sizeof(victim->path));
+    victim->policy = policy;
+    victim->generation = generation;
+    victim->last_used = ++use_counter;
+    victim->valid = true;
+    victim->view.adopt(view);
+}
+
+} // namespace dir_view_cache
+
+/// Directory scans run on the AsyncJob worker and fill this scratch view;
+/// the result is adopted into the window's own ldv on the GUI task. Static,
+/// so a scan can safely outlive the window that issued it. Only one file
+/// browser exists at a time and the single worker serializes the jobs.
+static window_file_list_t::LDV scan_scratch;
+
 GuiFileSort::GuiFileSort() {
     sort = static_cast<WF_Sort_t>(config_store().file_sort.get());
 }
@@ -47,12 +129,26 @@ void window_file_list_t::set_scroll_offset(int set) {
         return;
     }
 
+    // The worker owns ldv while the scan runs; there are no items to scroll anyway
+    if (scan_in_progress) {
+        WindowMenuVirtualBase::set_scroll_offset(set);
+        return;
+    }
+
     // -1 because ldv counts ".." as index -1 :/
     [[maybe_unused]] const auto new_window_offset = ldv.set_window_offset(set - 1);
     assert(new_window_offset == set - 1);
 
     // This must be called AFTER ldv.set_window_offset, as it updates the texts based on the newly shifted window
     WindowMenuVirtualBase::set_scroll_offset(set);
+
+    prescan_visible_files();
+
+    // Keep the snapshot cache pointing at what is currently displayed, so the
+    // next Load() of this directory can be served without a scan
+    if (view_loaded) {
+        dir_view_cache::store(sfn_path, scan_sort_policy, ldv);
+    }
 }
 
 bool window_file_list_t::IsPathRoot(const char *path) {
@@ -60,10 +156,78 @@ bool window_file_list_t::IsPathRoot(const char *path) {
 }
 
 void window_file_list_t::Load(WF_Sort_t sort, const char *sfnAtCursor, const char *topSFN) {
-    ldv.ChangeDirectory(
-        sfn_path,
-        (sort == WF_SORT_BY_NAME) ? LDV::SortPolicy::BY_NAME : LDV::SortPolicy::BY_CRMOD_DATETIME,
-        topSFN ?: sfnAtCursor);
+    scan_sort_policy = (sort == WF_SORT_BY_NAME) ? LDV::SortPolicy::BY_NAME : LDV::SortPolicy::BY_CRMOD_DATETIME;
+    scan_cursor_valid = (sfnAtCursor != nullptr);
+    scan_top_valid = (topSFN != nullptr);
+    strlcpy(scan_cursor_sfn, sfnAtCursor ?: "", sizeof(scan_cursor_sfn));
+    strlcpy(scan_top_sfn, topSFN ?: "", sizeof(scan_top_sfn));
+
+    // Serve the listing from the snapshot cache when it already shows the
+    // requested part of the directory - reopening the browser is then instant
+    if (const auto *slot = dir_view_cache::find(sfn_path, scan_sort_policy)) {
+        const char *first_entry = scan_top_valid ? scan_top_sfn : (scan_cursor_valid && scan_cursor_sfn[0] ? scan_cursor_sfn : nullptr);
+
+        bool usable = false;
+        if (first_entry == nullptr) {
+            usable = (slot->view.window_offset() == -1);
+        } else if (strcmp(slot->view.ShortFileNameAt(0).first, first_entry) == 0) {
+            usable = true;
+        } else if (!scan_top_valid && slot->view.window_offset() == -1) {
+            // Cursor-only request: the start window is fine as long as the cursor is in it
+            for (int i = 0, e = slot->view.WindowSize(); i < e; i++) {
+                if (strcmp(slot->view.ShortFileNameAt(i).first, first_entry) == 0) {
+                    usable = true;
+                    break;
+                }
+            }
+        }
+
+        if (usable) {
+            scan_job.discard(); // an older scan must not overwrite what we present
+            scan_in_progress = false;
+            ldv.adopt(slot->view);
+            apply_loaded_view();
+            return;
+        }
+    }
+
+    // Present an empty directory until the scan is done; the completion is
+    // picked up in the LOOP event, so the GUI task never waits for the drive.
+    scan_in_progress = true;
+    WindowMenuVirtual::setup_items();
+    Invalidate();
+
+    scan_job.issue([this](AsyncJobExecutionControl &control) {
+        // Runs on the worker task. The scan fills a static scratch view, not
+        // this->ldv - the window may be destroyed while the scan runs (its
+        // destructor discards the job, which makes with_synchronized fail, so
+        // this is not dereferenced in that case).
+        LDV::SortPolicy sort_policy;
+        char path[FILE_PATH_BUFFER_LEN];
+        char first_entry[FileSort::MAX_SFN];
+        bool has_first_entry;
+        if (!control.with_synchronized([&] {
+                sort_policy = scan_sort_policy;
+                has_first_entry = scan_top_valid || scan_cursor_valid;
+                strlcpy(path, sfn_path, sizeof(path));
+                strlcpy(first_entry, scan_top_valid ? scan_top_sfn : scan_cursor_sfn, sizeof(first_entry));
+            })) {
+            return;
+        }
+
+        scan_scratch.ChangeDirectory(path, sort_policy, has_first_entry ? first_entry : nullptr);
+    });
+}
+
+void window_file_list_t::finish_load() {
+    // The scan job is done, take its results over (on the GUI task, so nobody
+    // is reading the menu in the meantime)
+    ldv.adopt(scan_scratch);
+    apply_loaded_view();
+}
+
+void window_file_list_t::apply_loaded_view() {
+    view_loaded = true;
 
     // Now, ldv has adjusted its window offset and we need to synchronize scroll_offset with it properly.
     {
@@ -73,7 +237,7 @@ void window_file_list_t::Load(WF_Sort_t sort, const char *sfnAtCursor, const cha
         // If !topSFN -> we're trying to just focus sfnAtCursor.
         // In this case, it doesn't necessarily have to be on the top and we can be a bit smarter.
         // If the item is within the first visible window, we won't scroll on it, keep the scroll offset on 0
-        if (!topSFN && target_scroll_offset < max_items_on_screen_count()) {
+        if (!scan_top_valid && target_scroll_offset < max_items_on_screen_count()) {
             target_scroll_offset = 0;
         }
 
@@ -91,9 +255,9 @@ void window_file_list_t::Load(WF_Sort_t sort, const char *sfnAtCursor, const cha
         std::optional<int> target_focused_index;
 
         // If we've been given sfnAtCursor, try looking it up in the ldv window
-        if (sfnAtCursor && sfnAtCursor[0]) {
+        if (scan_cursor_valid && scan_cursor_sfn[0]) {
             for (int i = 0, e = ldv.WindowSize(); i < e; i++) {
-                if (!strcmp(sfnAtCursor, ldv.ShortFileNameAt(i).first)) {
+                if (!strcmp(scan_cursor_sfn, ldv.ShortFileNameAt(i).first)) {
                     target_focused_index = scroll_offset() + i;
                     break;
                 }
@@ -107,6 +271,42 @@ void window_file_list_t::Load(WF_Sort_t sort, const char *sfnAtCursor, const cha
 
         move_focus_to_index(target_focused_index);
     }
+
+    prescan_visible_files();
+    dir_view_cache::store(sfn_path, scan_sort_policy, ldv);
+    Invalidate();
+}
+
+void window_file_list_t::windowEvent(window_t *sender, GUI_event_t event, void *param) {
+    if (event == GUI_event_t::LOOP && scan_in_progress && !scan_job.is_active()) {
+        scan_in_progress = false;
+        finish_load();
+    }
+
+    WindowMenuVirtual::windowEvent(sender, event, param);
+}
+
+void window_file_list_t::prescan_visible_files() {
+    // Full SFN paths of the files in the current window.
+    // Capped so the buffers don't eat too much of the GUI task stack.
+    constexpr size_t max_prescan_files = 8;
+    std::array<std::array<char, FILE_PATH_BUFFER_LEN>, max_prescan_files> paths;
+    std::array<const char *, max_prescan_files> path_ptrs;
+    size_t path_count = 0;
+
+    for (int i = 0, e = ldv.WindowSize(); i < e && path_count < max_prescan_files; i++) {
+        const auto entry = ldv.ShortFileNameAt(i);
+        if (entry.second != LDV::EntryType::FILE || !entry.first || !entry.first[0]) {
+            continue;
+        }
+
+        auto &path = paths[path_count];
+        snprintf(path.data(), path.size(), "%s/%s", sfn_path, entry.first);
+        path_ptrs[path_count] = path.data();
+        path_count++;
+    }
+
+    gcode_info_prescan::request(std::span(path_ptrs.data(), path_count));
 }
 
 const char *window_file_list_t::CurrentLFN(bool *isFile) const {
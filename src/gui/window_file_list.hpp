@@ -10,7 +10,10 @@
 #include <stdbool.h>
 #include <bitset>
 
+#include <atomic>
+
 #include <buddy/filename_defs.h>
+#include <common/async_job/async_job.hpp>
 #include "window.hpp"
 #include "display_helper.h"
 #include "lazyfilelist.hpp"
@@ -53,7 +56,8 @@ public:
 
 public:
     inline int item_count() const final {
-        return ldv.TotalFilesCount();
+        // While the scan job owns ldv, present an empty directory
+        return scan_in_progress ? 0 : ldv.TotalFilesCount();
     }
 
     void set_scroll_offset(int set) final;
@@ -64,8 +68,15 @@ public:
 
 public:
     window_file_list_t(window_t *parent, Rect16 rc); // height is calculated from LazyDirViewSize
+
+    /// Starts scanning \p sfn_path on the AsyncJob worker. The window shows an
+    /// empty directory until the scan finishes (picked up in the LOOP event),
+    /// so a slow drive never blocks the jogwheel.
     void Load(WF_Sort_t sort, const char *sfnAtCursor, const char *topSFN);
 
+    /// \returns true while the directory scan job is still running
+    bool is_loading() const { return scan_in_progress; }
+
     const char *TopItemSFN();
     const char *CurrentLFN(bool *isFile = nullptr) const;
     const char *CurrentSFN(bool *isFile = nullptr) const;
@@ -74,8 +85,38 @@ public:
     static bool IsPathRoot(const char *path);
 
 protected:
+    void windowEvent(window_t *sender, GUI_event_t event, void *param) override;
+
     void setup_item(ItemVariant &variant, int index) final;
 
+    /// Asks the background metadata scanner to pre-scan the files in the current window
+    void prescan_visible_files();
+
+    /// Adjusts scroll offset and focus once the scan job has filled ldv.
+    /// Runs on the GUI task.
+    void finish_load();
+
+    /// Common tail of finish_load() and the snapshot-cache fast path:
+    /// synchronizes scroll offset and focus with the freshly adopted ldv.
+    void apply_loaded_view();
+
 protected:
     LDV ldv;
+
+private:
+    AsyncJob scan_job;
+
+    /// True from Load() until the LOOP event picks the finished job up.
+    /// While set, the GUI task must not touch ldv - the worker owns it.
+    std::atomic<bool> scan_in_progress = false;
+
+    /// True once the view has shown a real directory listing
+    bool view_loaded = false;
+
+    /// Parameters for the scan job; valid while the job is queued or running
+    LDV::SortPolicy scan_sort_policy = LDV::SortPolicy::BY_NAME;
+    char scan_cursor_sfn[FileSort::MAX_SFN];
+    char scan_top_sfn[FileSort::MAX_SFN];
+    bool scan_cursor_valid;
+    bool scan_top_valid;
 };
@@ -4,6 +4,7 @@
 
 #include "window_thumbnail.hpp"
 #include "gcode_thumb_decoder.h"
+#include "gcode_thumb_cache.hpp"
 #include "display.hpp"
 
 //-------------------------- Thumbnail --------------------------------------
@@ -18,19 +19,60 @@ WindowPreviewThumbnail::WindowPreviewThumbnail(window_t *parent, Rect16 rect)
     : WindowThumbnail(parent, rect) {
 }
 
+void WindowPreviewThumbnail::prefetch() {
+    const char *filepath = GCodeInfo::getInstance().GetGcodeFilepath();
+
+    // Already decoded, from a previous preview of the same file
+    if (FILE *cached = gcode_thumb_cache::open_cached(filepath, Width(), Height())) {
+        fclose(cached);
+        return;
+    }
+
+    AnyGcodeFormatReader reader { filepath };
+    if (!reader.is_open() || !reader->stream_thumbnail_start(Width(), Height(), IGcodeReader::ImgType::QOI)) {
+        return;
+    }
+
+    if (FILE *cached = gcode_thumb_cache::store(filepath, Width(), Height(), *reader)) {
+        fclose(cached);
+    }
+}
+
 void WindowPreviewThumbnail::unconditionalDraw() {
-    gcode_reader = AnyGcodeFormatReader { GCodeInfo::getInstance().GetGcodeFilepath() };
+    const char *filepath = GCodeInfo::getInstance().GetGcodeFilepath();
+
+    // Fast path - redraw from the cached stream, without touching the file at all
+    if (FILE *cached = gcode_thumb_cache::open_cached(filepath, Width(), Height())) {
+        img::Resource res(cached);
+        display::draw_img(point_ui16(Left(), Top()), res);
+        fclose(cached);
+        return;
+    }
+
+    gcode_reader = AnyGcodeFormatReader { filepath };
     if (!gcode_reader.is_open()) {
         return;
     }
 
-    FILE f {};
-    img::Resource res(&f);
+    if (!gcode_reader->stream_thumbnail_start(Width(), Height(), IGcodeReader::ImgType::QOI)) {
+        return;
+    }
+
+    if (FILE *cached = gcode_thumb_cache::store(filepath, Width(), Height(), *gcode_reader)) {
+        img::Resource res(cached);
+        display::draw_img(point_ui16(Left(), Top()), res);
+        fclose(cached);
+        return;
+    }
 
+    // The thumbnail did not fit in the cache - draw it directly from the reader
     if (!gcode_reader->stream_thumbnail_start(Width(), Height(), IGcodeReader::ImgType::QOI)) {
         return;
     }
 
+    FILE f {};
+    img::Resource res(&f);
+
     if (f_gcode_thumb_open(*gcode_reader, &f) != 0) {
         return;
     }
@@ -65,8 +107,25 @@ void WindowProgressThumbnail::unconditionalDraw() {
         return;
     }
 
-    FILE f {};
-    img::Resource res(&f);
+    const char *filepath = GCodeInfo::getInstance().GetGcodeFilepath();
+
+    // Fast path - redraw from the cached stream, without touching the file at all
+    if (FILE *cached = gcode_thumb_cache::open_cached(filepath, Width(), Height())) {
+        img::Resource res(cached);
+        display::draw_img(point_ui16(Left(), Top()), res);
+        fclose(cached);
+        redraw_whole = false;
+        return;
+    }
+    if (old_allowed_width < Width()) {
+        if (FILE *cached = gcode_thumb_cache::open_cached(filepath, old_allowed_width, Height())) {
+            img::Resource res(cached);
+            display::draw_img(point_ui16(get_old_left(), Top()), res);
+            fclose(cached);
+            redraw_whole = false;
+            return;
+        }
+    }
 
     bool have_old_alternative { false };
 
@@ -78,6 +137,24 @@ void WindowProgressThumbnail::unconditionalDraw() {
         }
     }
 
+    const uint16_t thumbnail_width = have_old_alternative ? old_allowed_width : Width();
+
+    if (FILE *cached = gcode_thumb_cache::store(filepath, thumbnail_width, Height(), *gcode_reader)) {
+        img::Resource res(cached);
+        display::draw_img(point_ui16(have_old_alternative ? get_old_left() : Left(), Top()), res);
+        fclose(cached);
+        redraw_whole = false;
+        return;
+    }
+
+    // The thumbnail did not fit in the cache - draw it directly from the reader
+    if (!gcode_reader->stream_thumbnail_start(thumbnail_width, Height(), IGcodeReader::ImgType::QOI)) {
+        return;
+    }
+
+    FILE f {};
+    img::Resource res(&f);
+
     if (f_gcode_thumb_open(*gcode_reader, &f) != 0) {
         return;
     }
@@ -50,6 +50,11 @@ class WindowPreviewThumbnail : public WindowThumbnail {
 public:
     WindowPreviewThumbnail(window_t *parent, Rect16 rect);
 
+    /// Decodes the thumbnail into the cache without drawing anything, so the
+    /// first draw is served straight from RAM. Meant to be called while the
+    /// preview still waits for the gcode info scan.
+    void prefetch();
+
 protected:
     void unconditionalDraw() override;
 };
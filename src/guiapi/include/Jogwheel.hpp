@@ -10,7 +10,7 @@
 
 #include <inttypes.h>
 #include "window_types.hpp" // BtnState_t
-#include <freertos/queue.hpp>
+#include <common/circular_buffer.hpp>
 
 // old encoder (with new encoder 2 steps per 1 count) - Type2
 // new encoder (1 steps per 1 count) - Type1
@@ -140,7 +140,10 @@ private:
     uint8_t encoder_gear; //!< multiple gears for jogwheel spinning
     bool type1; //!< jogwheel is type1 = true or type2 = false
     bool spin_accelerator; //!< turns up spin accelerator feature
-    freertos::Queue<BtnState_t, 32> queue;
+    // Lock-free handoff of button events from the 1ms interrupt to the gui
+    // thread. Encoder rotation does not go through here - consecutive detents
+    // coalesce in the threadsafe_enc snapshot and are consumed as one diff.
+    SpscCircularBuffer<BtnState_t, 32> queue;
 };
 
 extern Jogwheel jogwheel; // Jogwheel static instance
@@ -10,18 +10,28 @@
 #include <cstdint>
 
 /**
- * Takes screenshot and saves it to USB flash disk.
+ * Starts taking a screenshot to be saved to USB flash disk.
+ * The capture runs in the background: the display is read stripe by stripe
+ * from the gui loop and the file writes run on the AsyncJob worker, so the
+ * GUI does not freeze for the duration of the capture.
  *
- * @retval true  - all operations were completed successfully
- * @retval false - any of file's opening/writing/closing returned unexpected error
+ * @retval true  - the capture was started
+ * @retval false - opening the file failed or another capture is in progress
  */
 bool TakeAScreenshot();
 
 /**
- * @brief Takes screenshot and saves it to specified location
+ * @brief Starts taking a screenshot to be saved to specified location
  *
  * @param file_name - location + name + suffix == "/usb/screenshot.bmp"
- * @return true     - all operations were completed successfully
- * @return false    - any of file's opening/writing/closing returned unexpected error
+ * @return true     - the capture was started
+ * @return false    - opening the file failed or another capture is in progress
  */
 bool TakeAScreenshotAs(const char *file_name);
+
+/**
+ * @brief Advances the screenshot capture in progress (if any).
+ * Called from the gui loop; reads one display stripe per call, the display
+ * can only be accessed from the gui thread.
+ */
+void ScreenShotLoop();
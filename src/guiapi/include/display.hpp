@@ -20,6 +20,29 @@ void fill_rect(Rect16 rc, Color clr);
 void set_pixel(point_ui16_t pt, Color clr);
 uint8_t *get_block(point_ui16_t start, point_ui16_t end);
 
+/// Clip rect for the drawing functions above, empty rect = no clipping.
+///
+/// Only an optimization ‒ primitives that can do so cheaply skip or crop
+/// everything outside of the clip, the rest may still paint its full
+/// area. Therefore it may only be used where over-drawing is harmless,
+/// eg. when re-drawing content that did not change outside of the clip.
+void set_clip_rect(Rect16 rc);
+Rect16 get_clip_rect();
+
+/// Sets the clip rect for the scope of the guard, restores the previous one after.
+class ClipRectGuard {
+    Rect16 previous;
+
+public:
+    [[nodiscard]] ClipRectGuard(Rect16 rc)
+        : previous(get_clip_rect()) {
+        set_clip_rect(rc);
+    }
+    ~ClipRectGuard() {
+        set_clip_rect(previous);
+    }
+};
+
 void enable_safe_mode();
 void init();
 bool is_reset_required();
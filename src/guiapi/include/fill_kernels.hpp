@@ -0,0 +1,87 @@
+/**
+ * @file fill_kernels.hpp
+ * @brief word-sized pixel fill kernels for the display buffers
+ */
+#pragma once
+
+#include <cstdint>
+#include <cstddef>
+
+// The naive per-byte loops spend most of their time on load/store overhead;
+// these kernels emit 32bit stores instead (with small scalar head/tail parts
+// handling alignment), which matters for the clears and rect fills running
+// over whole stripe buffers.
+
+/// Fill @p count 2byte pixels starting at @p p with @p v, two pixels per store
+inline void fill_pixels_2b(uint16_t *p, uint16_t v, size_t count) {
+    if (count && (reinterpret_cast<uintptr_t>(p) & 3)) {
+        *p++ = v;
+        count--;
+    }
+    uint32_t *pw = reinterpret_cast<uint32_t *>(p);
+    const uint32_t vv = (uint32_t(v) << 16) | v;
+    for (; count >= 2; count -= 2) {
+        *pw++ = vv;
+    }
+    if (count) {
+        *reinterpret_cast<uint16_t *>(pw) = v;
+    }
+}
+
+/// Fill @p count 3byte pixels starting at @p p with the low 3 bytes of @p v,
+/// four pixels per three stores
+inline void fill_pixels_3b(uint8_t *p, uint32_t v, size_t count) {
+    const uint8_t b0 = v & 0xFF;
+    const uint8_t b1 = (v >> 8) & 0xFF;
+    const uint8_t b2 = (v >> 16) & 0xFF;
+
+    // scalar until a pixel starts at a word boundary (3 and 4 are coprime,
+    // so at most 3 pixels)
+    while (count && (reinterpret_cast<uintptr_t>(p) & 3)) {
+        p[0] = b0;
+        p[1] = b1;
+        p[2] = b2;
+        p += 3;
+        count--;
+    }
+
+    // 4 pixels == 12 bytes == 3 words (little endian)
+    uint32_t *pw = reinterpret_cast<uint32_t *>(p);
+    const uint32_t w0 = uint32_t(b0) | (uint32_t(b1) << 8) | (uint32_t(b2) << 16) | (uint32_t(b0) << 24);
+    const uint32_t w1 = uint32_t(b1) | (uint32_t(b2) << 8) | (uint32_t(b0) << 16) | (uint32_t(b1) << 24);
+    const uint32_t w2 = uint32_t(b2) | (uint32_t(b0) << 8) | (uint32_t(b1) << 16) | (uint32_t(b2) << 24);
+    for (; count >= 4; count -= 4) {
+        pw[0] = w0;
+        pw[1] = w1;
+        pw[2] = w2;
+        pw += 3;
+    }
+
+    p = reinterpret_cast<uint8_t *>(pw);
+    while (count--) {
+        p[0] = b0;
+        p[1] = b1;
+        p[2] = b2;
+        p += 3;
+    }
+}
+
+/// Fill @p count 4byte pixels starting at @p p with @p v
+inline void fill_pixels_4b(uint32_t *p, uint32_t v, size_t count) {
+    while (count--) {
+        *p++ = v;
+    }
+}
+
+/// Compile-time dispatch on the display's native pixel size
+template <size_t PIXEL_SIZE>
+inline void fill_pixels(uint8_t *p, uint32_t v, size_t count) {
+    if constexpr (PIXEL_SIZE == 2) {
+        fill_pixels_2b(reinterpret_cast<uint16_t *>(p), uint16_t(v), count);
+    } else if constexpr (PIXEL_SIZE == 3) {
+        fill_pixels_3b(p, v, count);
+    } else {
+        static_assert(PIXEL_SIZE == 4, "unsupported pixel size");
+        fill_pixels_4b(reinterpret_cast<uint32_t *>(p), v, count);
+    }
+}
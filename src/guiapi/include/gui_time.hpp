@@ -12,6 +12,9 @@ namespace gui {
 void TickLoop(); // call this function in loop
 void StartLoop(); // call this function in the beginning of the GUI loop
 void EndLoop(); // call this function in the beginning of the GUI loop
+void StartDraw(); // call this function right before redrawing the invalidated screen
+void EndDraw(); // call this function right after the redraw, keeps the frame duration metric
+bool ConsumeFrameOverBudget(); // did the last frame run over its budget? (clears the flag)
 uint32_t GetLoopCounter(); // current loop counter (is incremented with each loop by one)
 uint32_t GetTick(); // current loop tick value, every call in current loop returns same value
 uint32_t GetTick_ForceActualization(); // needed during gui start
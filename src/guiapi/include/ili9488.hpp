@@ -75,6 +75,11 @@ size_t ili9488_buffer_size();
 extern void ili9488_enable_safe_mode(void);
 extern void ili9488_draw_from_buffer(uint16_t x, uint16_t y, uint16_t w, uint16_t h);
 
+//! @brief true while a display write still occupies the SPI DMA
+//!
+//! Lets low-priority SPI clients (the LED writers) postpone their transfer
+//! instead of blocking the display task until the stripe is out.
+extern bool ili9488_dma_busy(void);
 extern void ili9488_spi_tx_complete(void);
 extern void ili9488_spi_rx_complete(void);
 extern bool ili9488_is_reset_required();
@@ -8,6 +8,10 @@
 class SideStripWriter {
 public:
     static void write(uint8_t *pb, uint16_t size);
+
+    /// To be called from HAL_SPI_TxCpltCallback when the strip has its own
+    /// SPI; wakes up the task sleeping in write().
+    static void spi_tx_complete();
 };
 
 /**
@@ -28,6 +28,10 @@ private:
         const color_scheme *pBackColorScheme;
     };
 
+    // union of the invalidated sub-rectangles; empty while flags.invalid
+    // is set means the whole window needs a redraw
+    Rect16 invalid_area;
+
 public:
     Rect16 GetRect() const;
     Rect16 GetRectWithoutTransformation() const;
@@ -73,6 +77,7 @@ public:
     bool IsHiddenBehindDialog() const;
 
     bool IsInvalid() const;
+    Rect16 GetInvalidationRect() const;
     bool HasValidBackground() const;
     bool IsFocused() const;
     bool IsCaptured() const;
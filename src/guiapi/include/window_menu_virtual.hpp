@@ -112,3 +112,66 @@ protected:
 private:
     std::array<ItemVariant, item_buffer_size> item_buffer_;
 };
+
+/// WindowMenuVirtual over a fixed, compile-time list of item types - a drop-in
+/// backend for menus that would otherwise keep a full WinMenuContainer in RAM.
+/// Only the items currently on the screen are instantiated (in the item
+/// buffer); the rest of the menu exists merely as a type list, so the menu
+/// costs a few visible items worth of RAM no matter how many items it has.
+/// Restrictions compared to the container-backed WindowMenu:
+/// * The items must be default constructible.
+/// * The items are destroyed whenever they scroll out of view, so they must
+///   not hold state that is supposed to outlive that.
+/// * Item visibility (hidden/dev items) is sampled once when the menu is
+///   created and cannot change while the menu is open.
+template <typename... Items>
+class WindowMenuStatic : public WindowMenuVirtual<Items...> {
+
+public:
+    using ItemVariant = typename WindowMenuVirtual<Items...>::ItemVariant;
+
+public:
+    WindowMenuStatic(window_t *parent, Rect16 rect)
+        : WindowMenuVirtual<Items...>(parent, rect, WindowMenuVirtualBase::CloseScreenReturnBehavior::yes) {
+        // Build the (menu index -> item type) map, skipping the items that
+        // report themselves hidden. The probe constructs each item once on
+        // the stack; the construction itself is cheap, it is keeping all the
+        // items alive at once that this class is avoiding.
+        constexpr auto is_hidden_f = []<typename T>(const T &item) -> bool {
+            if constexpr (std::is_same_v<T, std::monostate>) {
+                return true;
+            } else {
+                return static_cast<const IWindowMenuItem &>(item).IsHidden();
+            }
+        };
+
+        ItemVariant probe;
+        for (uint8_t type_index = 0; type_index < sizeof...(Items); type_index++) {
+            emplacers[type_index](probe);
+            if (!std::visit(is_hidden_f, probe)) {
+                visible_type_index_[visible_count_++] = type_index;
+            }
+        }
+        probe.template emplace<std::monostate>();
+
+        this->setup_items();
+    }
+
+    int item_count() const final {
+        return visible_count_;
+    }
+
+protected:
+    void setup_item(ItemVariant &variant, int index) final {
+        emplacers[visible_type_index_[index]](variant);
+    }
+
+private:
+    /// std::variant cannot be emplaced by a run-time index, go through a function table
+    static constexpr std::array<void (*)(ItemVariant &), sizeof...(Items)> emplacers {
+        +[](ItemVariant &variant) { variant.template emplace<Items>(); }...
+    };
+
+    std::array<uint8_t, sizeof...(Items)> visible_type_index_;
+    uint8_t visible_count_ = 0;
+};
@@ -4,6 +4,7 @@
 #include "hwio_pindef.h"
 #include <atomic>
 #include <cassert>
+#include <tuple>
 
 using buddy::hw::jogWheelEN1;
 using buddy::hw::jogWheelEN2;
@@ -67,7 +68,7 @@ uint8_t Jogwheel::ReadHwInputsFromISR() {
 }
 
 bool Jogwheel::ConsumeButtonEvent(BtnState_t &ev) {
-    return queue.try_receive(ev, 0);
+    return queue.try_get(ev);
 }
 
 int32_t Jogwheel::ConsumeEncoderDiff() {
@@ -153,7 +154,7 @@ bool Jogwheel::IsBtnPressed() {
 void Jogwheel::ChangeStateFromISR(BtnState_t new_state) {
     assert(initialized);
     btn_state = new_state;
-    std::ignore = queue.send_from_isr(btn_state);
+    std::ignore = queue.try_put(btn_state);
 }
 
 void Jogwheel::Update1msFromISR() {
@@ -1,11 +1,15 @@
 #include <fcntl.h>
 #include "ScreenShot.hpp"
 #include "display.hpp"
+#include <async_job/async_job.hpp>
 #include <unique_file_ptr.hpp>
 #include <scope_guard.hpp>
 #include <inttypes.h>
+#include <array>
 #include <dirent.h>
+#include <memory>
 #include <stdio.h>
+#include <string.h>
 #include <unistd.h>
 #include <guiconfig/GuiDefaults.hpp>
 #include <guiconfig/guiconfig.h>
@@ -180,8 +184,78 @@ constexpr const uint8_t bmp_header[BMP_HEADER_SIZE] {
     0,
 };
 
+constexpr int stripe_size = GuiDefaults::ScreenWidth * buffer_rows * bytes_per_pixel;
+
+/// Capture in progress, pumped stripe by stripe from ScreenShotLoop().
+/// The display can only be read from the gui thread, so the reads happen
+/// there, one per loop iteration; writing the stripe to the USB is what
+/// actually takes time and that runs on the AsyncJob worker.
+struct AsyncScreenshot {
+    unique_file_ptr file;
+    std::array<char, SCREENSHOT_FILE_NAME_BUFFER_LEN> file_name;
+    std::unique_ptr<uint8_t[]> stripe; ///< Copy of the stripe being written, owned here, written by the worker
+    int block; ///< Next display block to read; BMP stores rows bottom up, so it counts down
+    AsyncJobWithResult<bool> write_job;
+};
+
+std::unique_ptr<AsyncScreenshot> async_screenshot;
+
 } // namespace
 
+void ScreenShotLoop() {
+    if (!async_screenshot) {
+        return;
+    }
+    AsyncScreenshot &shot = *async_screenshot;
+
+    switch (shot.write_job.state()) {
+
+    case AsyncJobBase::State::queued:
+    case AsyncJobBase::State::running:
+        return; // previous stripe still on its way to the file
+
+    case AsyncJobBase::State::finished:
+        if (!shot.write_job.result()) {
+            unlink(shot.file_name.data());
+            async_screenshot.reset();
+            return;
+        }
+        break;
+
+    case AsyncJobBase::State::cancelled:
+        unlink(shot.file_name.data());
+        async_screenshot.reset();
+        return;
+
+    case AsyncJobBase::State::idle:
+        break;
+    }
+
+    if (shot.block < 0) {
+        async_screenshot.reset(); // done, closes the file
+        return;
+    }
+
+    const point_ui16_t start = point_ui16(0, shot.block * buffer_rows);
+    const point_ui16_t end = point_ui16(GuiDefaults::ScreenWidth - 1, (shot.block + 1) * buffer_rows - 1);
+    uint8_t *buffer = display::get_block(start, end); // this pointer is valid only until another display memory write is called
+    if (!buffer) {
+        unlink(shot.file_name.data());
+        async_screenshot.reset();
+        return;
+    }
+
+    transform_buffer(reinterpret_cast<Pixel *>(buffer + read_start_offset));
+    memcpy(shot.stripe.get(), buffer + read_start_offset, stripe_size);
+    shot.block--;
+
+    FILE *file = shot.file.get();
+    const uint8_t *data = shot.stripe.get();
+    shot.write_job.issue([file, data](AsyncJobExecutionControl &, bool &result) {
+        result = fwrite(data, 1, stripe_size, file) == stripe_size;
+    });
+}
+
 bool TakeAScreenshot() {
     char file_name[SCREENSHOT_FILE_NAME_BUFFER_LEN];
     uint32_t inc = 1;
@@ -195,35 +269,42 @@ bool TakeAScreenshot() {
 }
 
 bool TakeAScreenshotAs(const char *file_name) {
-    // Delete the file if the ssshot taking fails
+    if (async_screenshot) {
+        return false; // a capture is already in progress
+    }
+    if (strlen(file_name) >= SCREENSHOT_FILE_NAME_BUFFER_LEN) {
+        return false;
+    }
+
+    // Delete the file if starting the capture fails
     ScopeGuard delete_file_guard = [&] { unlink(file_name); };
 
-    const unique_file_ptr f(fopen(file_name, "w"));
-    if (!f) {
+    auto shot = std::unique_ptr<AsyncScreenshot>(new (std::nothrow) AsyncScreenshot());
+    if (!shot) {
         return false;
     }
-
-    const int header_size = BMP_FILE_HEADER_SIZE + BMP_INFO_HEADER_SIZE;
-    if (fwrite(&bmp_header, 1, header_size, f.get()) != header_size) {
+    shot->stripe.reset(new (std::nothrow) uint8_t[stripe_size]);
+    if (!shot->stripe) {
         return false;
     }
 
-    for (int block = GuiDefaults::ScreenHeight / buffer_rows - 1; block >= 0; block--) {
-        const point_ui16_t start = point_ui16(0, block * buffer_rows);
-        const point_ui16_t end = point_ui16(GuiDefaults::ScreenWidth - 1, (block + 1) * buffer_rows - 1);
-        uint8_t *buffer = display::get_block(start, end); // this pointer is valid only until another display memory write is called
-        if (!buffer) {
-            return false;
-        }
-
-        transform_buffer(reinterpret_cast<Pixel *>(buffer + read_start_offset));
+    shot->file.reset(fopen(file_name, "w"));
+    if (!shot->file) {
+        return false;
+    }
 
-        const int write_size = GuiDefaults::ScreenWidth * buffer_rows * bytes_per_pixel;
-        if (fwrite(buffer + read_start_offset, 1, write_size, f.get()) != write_size) {
-            return false;
-        }
+    const int header_size = BMP_FILE_HEADER_SIZE + BMP_INFO_HEADER_SIZE;
+    if (fwrite(&bmp_header, 1, header_size, shot->file.get()) != header_size) {
+        return false;
     }
 
+    strlcpy(shot->file_name.data(), file_name, shot->file_name.size());
+    shot->block = GuiDefaults::ScreenHeight / buffer_rows - 1;
+
+    // The stripes are read by ScreenShotLoop(), one per gui loop iteration,
+    // so the machine keeps responding while the capture runs. The price is
+    // that anything redrawn mid-capture may tear between stripes.
+    async_screenshot = std::move(shot);
     delete_file_guard.disarm();
     return true;
 }
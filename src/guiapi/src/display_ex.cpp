@@ -2,9 +2,11 @@
 #include "display.hpp"
 #include <functional>
 #include <cmath>
+#include <cstring>
 #include <guiconfig/guiconfig.h>
 #include <img_resources.hpp>
 #include "display_math_helper.h"
+#include "fill_kernels.hpp"
 #include <bsod.h>
 
 #if HAS_ST7789_DISPLAY()
@@ -157,6 +159,21 @@ static inline void fill_rect_colorFormatNative(uint16_t rect_x, uint16_t rect_y,
 
 static constexpr size_t BuffAlphaLen = (1 << FontMaxBitLen); // size of buffer for alpha channel 4bit font need 2^4 == 16 etc
 
+// see display::set_clip_rect(); empty == no clipping
+static Rect16 clip_rect = Rect16();
+
+namespace display {
+
+void set_clip_rect(Rect16 rc) {
+    clip_rect = rc;
+}
+
+Rect16 get_clip_rect() {
+    return clip_rect;
+}
+
+} // namespace display
+
 // do not use directly, use DispBuffer instead
 template <size_t LEN, class DATA_TYPE, class PTR_TYPE, uint32_t NATIVE_PIXEL_SIZE>
 class TDispBuffer {
@@ -196,16 +213,117 @@ public:
 };
 using DispBuffer = TDispBuffer<BuffAlphaLen, BuffDATA_TYPE, BuffPTR_TYPE, BuffNATIVE_PIXEL_SIZE>;
 
+/*****************************************************************************/
+// glyph cache
+//
+// Tiles of glyphs already expanded from the font bitmap into native pixel
+// bytes for a concrete background/foreground pair. Repeatedly drawn
+// characters ‒ digits in the footer temperatures, coordinates, timers ‒ are
+// then just copied row by row instead of being expanded bit by bit again on
+// every redraw.
+
+// ~10 tiles of the standard font; scaled by the pixel size so both display
+// types cache a similar number of glyphs
+static constexpr size_t GlyphCacheArenaSize = 2048 * BuffNATIVE_PIXEL_SIZE;
+static constexpr size_t GlyphCacheMaxEntries = 24;
+
+struct GlyphCacheEntry {
+    const font_t *font;
+    uint32_t chr; // position in the font, not a unicode codepoint
+    uint32_t clr_bg;
+    uint32_t clr_fg;
+    uint16_t offset; // of the tile in the arena
+};
+
+static GlyphCacheEntry glyph_cache_entries[GlyphCacheMaxEntries];
+static uint8_t glyph_cache_arena[GlyphCacheArenaSize];
+static size_t glyph_cache_used_entries = 0;
+static size_t glyph_cache_used_bytes = 0;
+
+/// Returns the tile of the glyph, rasterizing it into the cache first on a miss.
+///
+/// Returns null for glyphs that are not worth caching (huge fonts that
+/// would evict everything else).
+static const uint8_t *glyph_cache_get(uint32_t chr, const font_t *pf, Color clr_bg, Color clr_fg) {
+    const size_t tile_size = size_t(pf->w) * pf->h * BuffNATIVE_PIXEL_SIZE;
+    if (tile_size > GlyphCacheArenaSize / 4) {
+        return nullptr;
+    }
+
+    for (size_t i = 0; i < glyph_cache_used_entries; i++) {
+        const GlyphCacheEntry &e = glyph_cache_entries[i];
+        if (e.font == pf && e.chr == chr && e.clr_bg == clr_bg.raw && e.clr_fg == clr_fg.raw) {
+            return glyph_cache_arena + e.offset;
+        }
+    }
+
+    // Miss ‒ when out of space, simply start over. The screens cycle
+    // through a few glyph styles at a time, so anything smarter (LRU, ...)
+    // is not worth the code.
+    if (glyph_cache_used_entries == GlyphCacheMaxEntries || tile_size > GlyphCacheArenaSize - glyph_cache_used_bytes) {
+        glyph_cache_used_entries = 0;
+        glyph_cache_used_bytes = 0;
+    }
+
+    // the same expansion TDispBuffer does, just into the contiguous tile
+    const uint8_t bpp = 8 * pf->bpr / pf->w; // bits per pixel
+    const uint8_t ppb = 8 / bpp; // pixels per byte
+    const uint8_t pms = std::min(size_t((1 << bpp) - 1), BuffAlphaLen - 1); // pixel mask
+    BuffDATA_TYPE clr_native[BuffAlphaLen];
+    for (size_t i = 0; i <= pms; i++) {
+        clr_native[i] = color_to_native(Color::from_raw(color_alpha(clr_bg.raw, clr_fg.raw, 255 * i / pms)));
+    }
+
+    uint8_t *const tile = glyph_cache_arena + glyph_cache_used_bytes;
+    const uint8_t *pch = (const uint8_t *)(pf->pcs) + chr * pf->bpr * pf->h;
+    uint8_t *out = tile;
+    for (uint16_t j = 0; j < pf->h; j++) {
+        const uint8_t *pc = pch + j * pf->bpr;
+        uint8_t crd = 0; // current row byte data
+        for (uint16_t i = 0; i < pf->w; i++) {
+            if ((i % ppb) == 0) {
+                crd = *(pc++);
+            }
+            const BuffDATA_TYPE clr = clr_native[crd >> (8 - bpp)];
+            for (size_t NthByte = 0; NthByte < BuffNATIVE_PIXEL_SIZE; ++NthByte) {
+                *out++ = uint8_t(clr >> (8 * NthByte));
+            }
+            crd <<= bpp;
+        }
+    }
+
+    glyph_cache_entries[glyph_cache_used_entries++] = GlyphCacheEntry { pf, chr, clr_bg.raw, clr_fg.raw, uint16_t(glyph_cache_used_bytes) };
+    glyph_cache_used_bytes += tile_size;
+    return tile;
+}
+
+/// Sends the part of the stripe buffer that intersects the clip rect.
+/// The stripe is composed at full \p stripe width in the buffer; when the clip
+/// cuts into it, the surviving pixels are packed in place first, so the (much
+/// slower, especially on the ST7789V) SPI transfer stays proportional to the
+/// changed area instead of the whole window width.
+static void draw_stripe_clipped(uint8_t *buffer, Rect16 stripe) {
+    const Rect16 send = clip_rect.IsEmpty() ? stripe : stripe.Intersection(clip_rect);
+    if (send.IsEmpty()) {
+        return;
+    }
+    if (send != stripe) {
+        const size_t src_stride = size_t(stripe.Width()) * BuffNATIVE_PIXEL_SIZE;
+        const size_t row_bytes = size_t(send.Width()) * BuffNATIVE_PIXEL_SIZE;
+        const uint8_t *src = buffer + (send.Top() - stripe.Top()) * src_stride + (send.Left() - stripe.Left()) * BuffNATIVE_PIXEL_SIZE;
+        for (int row = 0; row < send.Height(); row++) {
+            // destination never runs ahead of the source, rows pack towards the buffer start
+            memmove(buffer + row * row_bytes, src + row * src_stride, row_bytes);
+        }
+    }
+    display::draw_from_buffer({ uint16_t(send.Left()), uint16_t(send.Top()) }, send.Width(), send.Height());
+}
+
 static inline void store_to_buffer(uint8_t *buffer, Rect16 rect, uint16_t artefact_width, Color color) {
     uint8_t *buff = buffer + (rect.Top() * artefact_width + rect.Left()) * BuffNATIVE_PIXEL_SIZE;
     uint32_t clr = color_to_native(color);
     for (int i = 0; i < rect.Height(); i++) {
-        int offset = i * artefact_width * BuffNATIVE_PIXEL_SIZE;
-        for (int j = 0; j < rect.Width(); j++) {
-            for (size_t NthByte = 0; NthByte < BuffNATIVE_PIXEL_SIZE; ++NthByte) {
-                buff[offset + (BuffNATIVE_PIXEL_SIZE * j) + NthByte] = (uint8_t)(clr >> (8 * NthByte));
-            }
-        }
+        fill_pixels<BuffNATIVE_PIXEL_SIZE>(buff + i * artefact_width * BuffNATIVE_PIXEL_SIZE, clr, rect.Width());
     }
     return;
 }
@@ -226,6 +344,21 @@ void store_char_in_buffer(uint16_t char_cnt, uint16_t curr_char_idx, unichar c,
 
     const uint16_t char_w = pf->w; // char width
     const uint16_t char_h = pf->h; // char height
+
+    // fast path ‒ blit an already expanded tile from the glyph cache
+    if (const uint8_t *tile = glyph_cache_get(chr, pf, clr_bg, clr_fg)) {
+        BorrowBuffer borrow_buffer;
+        // addressing matches TDispBuffer::OffsetInsert ‒ offsets are in
+        // BuffPTR_TYPE units, STORE_FN_PIXEL_SIZE of them per pixel
+        const size_t char_bytes = size_t(char_w) * STORE_FN_PIXEL_SIZE * sizeof(BuffPTR_TYPE);
+        const size_t dst_stride = char_cnt * char_bytes;
+        const size_t row_bytes = size_t(char_w) * BuffNATIVE_PIXEL_SIZE;
+        uint8_t *dst = borrow_buffer.buffer + curr_char_idx * char_bytes;
+        for (uint16_t j = 0; j < char_h; j++) {
+            memcpy(dst + j * dst_stride, tile + j * row_bytes, row_bytes);
+        }
+        return;
+    }
     const uint8_t bpr = pf->bpr; // bytes per row
     const uint16_t bpc = bpr * char_h; // bytes per char
     const uint8_t bpp = 8 * bpr / char_w; // bits per pixel
@@ -275,6 +408,9 @@ void draw_rect(Rect16 rc, Color clr) {
 
 void fill_rect(Rect16 rc, Color clr) {
     rc = rc.Intersection(DisplayClip());
+    if (!clip_rect.IsEmpty()) {
+        rc = rc.Intersection(clip_rect);
+    }
     if (rc.IsEmpty()) {
         return;
     }
@@ -343,6 +479,13 @@ static void draw_rounded_rect_rad1(Rect16 rect, Color back, Color front, uint8_t
     uint16_t h_left = rect.Height();
     for (uint8_t i = 0; i < loop; i++) { // If rectangle is higher than buffROWS (8 on ILI9488), it has to be separated
         uint8_t buff_rows_to_draw = (h_left < buffROWS ? h_left : buffROWS);
+
+        // skip stripes completely outside of the clip
+        const Rect16 stripe(rect.Left(), int16_t(rect.Top() + i * buffROWS), rect.Width(), buff_rows_to_draw);
+        if (!clip_rect.IsEmpty() && !clip_rect.HasIntersection(stripe)) {
+            h_left -= buff_rows_to_draw;
+            continue;
+        }
         // We paint whole rect with front color and then paint the round edge's complement in back color TO AVOID FLICKERING
         store_to_buffer(buffer, Rect16(0, 0, rect.Width(), buff_rows_to_draw), rect.Width(), front);
 
@@ -362,7 +505,7 @@ static void draw_rounded_rect_rad1(Rect16 rect, Color back, Color front, uint8_t
                 store_to_buffer(buffer, Rect16(rect.Width() - 1, buff_rows_to_draw - 1, 1, 1), rect.Width(), flag & MIC_ALT_CL_BOT_RIGHT ? secondary_color : back);
             }
         }
-        draw_from_buffer({ uint16_t(rect.Left()), uint16_t(rect.Top() + i * buffROWS) }, rect.Width(), buff_rows_to_draw);
+        draw_stripe_clipped(buffer, stripe);
         h_left -= buff_rows_to_draw;
     }
 }
@@ -402,6 +545,13 @@ void draw_rounded_rect(Rect16 rect, Color back, Color front, uint8_t cor_rad, ui
     for (int part = 0; part < (carry ? div + 1 : div); part++) { // seperated parts
         // clear buffer
         uint16_t buff_rows_to_draw = (h_left < buff_rows ? h_left : buff_rows);
+
+        // skip stripes completely outside of the clip
+        const Rect16 stripe(rect.Left(), int16_t(rect.Top() + part * buff_rows), rect.Width(), buff_rows_to_draw);
+        if (!clip_rect.IsEmpty() && !clip_rect.HasIntersection(stripe)) {
+            h_left -= buff_rows;
+            continue;
+        }
         store_to_buffer(buffer, Rect16(0, 0, rect.Width(), buff_rows_to_draw), rect.Width(), front); // We paint whole rect with front color and then paint the round edge's complement in back color TO AVOID FLICKERING
 
         // cycle trough buffer rows
@@ -449,7 +599,7 @@ void draw_rounded_rect(Rect16 rect, Color back, Color front, uint8_t cor_rad, ui
                 }
             }
         }
-        draw_from_buffer({ uint16_t(rect.Left()), uint16_t(rect.Top() + part * buff_rows) }, rect.Width(), buff_rows_to_draw);
+        draw_stripe_clipped(buffer, stripe);
         h_left -= buff_rows;
     }
 }
@@ -459,6 +609,9 @@ void set_pixel(point_ui16_t pt, Color clr) {
     if (!DisplayClip().Contain(pt)) {
         return;
     }
+    if (!clip_rect.IsEmpty() && !clip_rect.Contain(pt)) {
+        return;
+    }
     const uint32_t native_color = color_to_native(clr);
     set_pixel_colorFormatNative(pt.x, pt.y, native_color);
 }
@@ -486,6 +639,26 @@ void draw_img(point_ui16_t pt, const img::Resource &qoi, Color back_color, ropfn
          */
     }
 
+    // Crop to the clip ‒ the qoi decoder skips everything outside of the
+    // subrect on its own
+    if (!clip_rect.IsEmpty()) {
+        if (subrect.IsEmpty()) {
+            subrect = Rect16(pt.x, pt.y, qoi.w, qoi.h);
+        }
+        subrect = subrect.Intersection(clip_rect);
+        if (subrect.IsEmpty()) {
+            return;
+        }
+    }
+
+    // Icons prefetched into RAM during the screen open flow skip the
+    // littlefs read that makes them pop in during screen transitions
+    if (FILE *cached = img::open_cached_icon(qoi)) {
+        draw_qoi_ex_C(cached, pt.x, pt.y, back_color, rop, subrect);
+        fclose(cached);
+        return;
+    }
+
     // Seek to the beginning of the image and draw
     fseek(file, qoi.offset, SEEK_SET);
     draw_qoi_ex_C(file, pt.x, pt.y, back_color, rop, subrect);
@@ -9,6 +9,7 @@
 #include "window.hpp"
 #include "gui.hpp"
 #include "../lang/string_view_utf8.hpp"
+#include "../lang/translator.hpp"
 #include "../common/str_utils.hpp"
 #include "ScreenHandler.hpp"
 #include <math.h>
@@ -103,8 +104,8 @@ void fill_between_rectangles(const Rect16 *r_out, const Rect16 *r_in, Color colo
 /// \param clr_fg font/foreground color
 /// \returns size of drawn area
 /// Draws unused space of @rc with @clr_bg
-template <class T>
-size_ui16_t render_line(T &textWrapper, Rect16 rc, StringReaderUtf8 &reader, const font_t *pf, Color clr_bg, Color clr_fg) {
+template <class T, class S>
+size_ui16_t render_line(T &textWrapper, Rect16 rc, S &reader, const font_t *pf, Color clr_bg, Color clr_fg) {
     if (!pf || pf->w == 0 || pf->h == 0 || rc.Width() < pf->w || rc.Height() < pf->h) {
         return size_ui16_t { 0, 0 };
     }
@@ -119,22 +120,29 @@ size_ui16_t render_line(T &textWrapper, Rect16 rc, StringReaderUtf8 &reader, con
     uint16_t chars_cnt = 0; // character count of currently drawn loop iteration
     uint16_t chars_left = line_char_cnt; // characters left to draw
 
+    const Rect16 clip = display::get_clip_rect();
+
     for (uint16_t i = 0; i * buff_char_capacity < line_char_cnt; i++) {
         chars_cnt = chars_left > buff_char_capacity ? buff_char_capacity : chars_left;
+        // Batches completely outside of the clip are not rendered at all,
+        // but their characters still have to be consumed from the reader
+        const bool batch_visible = clip.IsEmpty() || clip.HasIntersection(Rect16(pt.x, pt.y, chars_cnt * fnt_w, fnt_h));
         // Storing text in the display buffer
         // It has to know how many chars will be stored to correctly compute display buffer offsets
         for (uint16_t j = 0; j < chars_cnt; j++) {
             unichar c = textWrapper.character(reader);
             if (c == '\n') {
                 j--; // j have to be unaffected by new line character
-            } else {
+            } else if (batch_visible) {
                 display::store_char_in_buffer(chars_cnt, j, c, pf, clr_bg, clr_fg);
             }
         }
         // Drawing from the buffer
         if (chars_cnt > 0) {
             chars_left -= chars_cnt;
-            display::draw_from_buffer(pt, chars_cnt * fnt_w, fnt_h);
+            if (batch_visible) {
+                display::draw_from_buffer(pt, chars_cnt * fnt_w, fnt_h);
+            }
             pt.x += chars_cnt * fnt_w;
         }
     }
@@ -153,6 +161,22 @@ size_ui16_t render_text_singleline(Rect16 rc, StringReaderUtf8 &reader, const fo
     return render_line(text_plain, rc, reader, pf, clr_bg, clr_fg);
 }
 
+namespace {
+/// Feeds render_line characters that were decoded in advance (rolling labels
+/// cache them between ticks), returns 0 when exhausted the same way a reader would
+struct predecoded_source {
+    const unichar *chars;
+    uint16_t left;
+    unichar getUtf8Char() { return left ? (left--, *chars++) : 0; }
+};
+} // namespace
+
+size_ui16_t render_text_singleline(Rect16 rc, const unichar *chars, uint16_t char_cnt, const font_t *pf, Color clr_bg, Color clr_fg) {
+    no_wrap text_plain;
+    predecoded_source source { chars, char_cnt };
+    return render_line(text_plain, rc, source, pf, clr_bg, clr_fg);
+}
+
 // count characters in lines
 static RectTextLayout multiline_loop(uint8_t MaxColsInRect, [[maybe_unused]] uint8_t MaxRowsInRect, const string_view_utf8 &str) {
     RectTextLayout layout;
@@ -368,7 +392,45 @@ std::optional<size_ui16_t> characters_meas_text(const string_view_utf8 &str, uin
     return size_ui16_t({ uint16_t(chars_longest_line), uint16_t(row_no + 1) });
 }
 
+namespace {
+
+// Measuring a string read from a file (= a translated one) pays a file read
+// per character and the labels on a screen get re-measured on every redraw.
+// The content behind a given handle + offset only changes with a language
+// switch, so the results can be memoized.
+//
+// Strings in memory are not cached ‒ walking them is cheap and a RAM buffer
+// can be overwritten with different content without changing its address.
+struct MeasCacheEntry {
+    // Identity of the measured string (the file handle + offset), never read.
+    string_view_utf8 str = string_view_utf8::MakeNULLSTR();
+    // The provider the string came from. A language switch changes it, which
+    // invalidates the entry without any explicit hook.
+    const ITranslationProvider *provider = nullptr;
+    Font font = {};
+    uint16_t chars = 0;
+    size_ui16_t size = {};
+};
+
+// Enough for the labels of one screen.
+constexpr size_t MEAS_CACHE_SIZE = 16;
+MeasCacheEntry meas_cache[MEAS_CACHE_SIZE];
+size_t meas_cache_next = 0;
+
+} // namespace
+
 size_ui16_t font_meas_text(Font font, const string_view_utf8 &str, uint16_t *numOfUTF8Chars) {
+    const bool cacheable = str.type() == string_view_utf8::Type::file_string;
+    const ITranslationProvider *provider = Translations::Instance().CurrentProvider();
+    if (cacheable) {
+        for (const auto &entry : meas_cache) {
+            if (entry.provider == provider && entry.font == font && entry.str.is_same_ref(str)) {
+                *numOfUTF8Chars = entry.chars;
+                return entry.size;
+            }
+        }
+    }
+
     int x = 0;
     int y = 0;
     int w = 0;
@@ -392,7 +454,15 @@ size_ui16_t font_meas_text(Font font, const string_view_utf8 &str, uint16_t *num
         }
         h = y + char_h;
     }
-    return { uint16_t(std::max(x, w)), uint16_t(h) };
+
+    const size_ui16_t size = { uint16_t(std::max(x, w)), uint16_t(h) };
+    if (cacheable) {
+        // Round-robin replacement; whole screens get redrawn at once, so
+        // recency is about as good a guess as any.
+        meas_cache[meas_cache_next] = MeasCacheEntry { str, provider, font, *numOfUTF8Chars, size };
+        meas_cache_next = (meas_cache_next + 1) % MEAS_CACHE_SIZE;
+    }
+    return size;
 }
 
 void render_rect(Rect16 rc, Color clr) {
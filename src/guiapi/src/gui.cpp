@@ -132,13 +132,20 @@ void gui_redraw(void) {
     }
 
     if (txtroll_t::HasInstance() && gui_roll_timer.RestartIfIsOver(now)) {
-        Screens::Access()->ScreenEvent(nullptr, GUI_event_t::TEXT_ROLL, nullptr);
+        // Rolling texts are the lowest priority invalidation source: when the
+        // previous frame ran over its budget, drop one tick so the loop gets
+        // back to the jogwheel instead of redrawing a scrolled label
+        if (!gui::ConsumeFrameOverBudget()) {
+            Screens::Access()->ScreenEvent(nullptr, GUI_event_t::TEXT_ROLL, nullptr);
+        }
     }
 
     bool should_sleep = true;
     if (gui_invalid) {
         if (gui_redraw_timer.RestartIfIsOver(now)) {
+            gui::StartDraw();
             Screens::Access()->Draw();
+            gui::EndDraw();
             gui_invalid = false;
             should_sleep = false;
         }
@@ -195,6 +202,7 @@ void gui_loop(void) {
     }
 
     gui_redraw();
+    ScreenShotLoop();
     marlin_client::loop();
     GuiMediaEventsHandler::Tick();
     if (marlin_client::event_clr(marlin_server::Event::RequestCalibrationsScreen)) {
@@ -54,6 +54,14 @@ void leds::ForceRefresh(size_t cnt) {
 }
 
 void leds::TickLoop() {
+    // While a display stripe is still going out over the DMA, the LED writers
+    // would block in the driver waiting for it. The LEDs keep their dirty
+    // marks, so postponing the refresh to the next loop is lossless and a LED
+    // animation never stretches the frame the display is just drawing.
+    if (ili9488_dma_busy()) {
+        return;
+    }
+
     getNeopixels().Tick();
 
 #if HAS_SIDE_LEDS()
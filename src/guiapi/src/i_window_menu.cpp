@@ -20,6 +20,10 @@ IWindowMenu::IWindowMenu(window_t *parent, Rect16 rect)
 
 void IWindowMenu::set_scroll_offset(int set) {
     assert(set >= 0 && set <= max_scroll_offset());
+    if (scroll_offset_ == set) {
+        // Nothing moved, do not repaint the whole menu
+        return;
+    }
     scroll_offset_ = set;
 
     // invalidate, but let invalid_background flag as it was
@@ -2,6 +2,7 @@
 
 #include <device/board.h>
 #include <device/hal.h>
+#include <optional>
 #include <span>
 #include <string.h>
 #include <stdlib.h>
@@ -15,6 +16,7 @@
 #include "hwio_pindef.h"
 #include "cmsis_os.h"
 #include "display_math_helper.h"
+#include "fill_kernels.hpp"
 
 #include "hw_configuration.hpp"
 
@@ -108,6 +110,13 @@ osThreadId ili9488_task_handle = 0;
 uint8_t ili9488_buff[ILI9488_COLS * 3 * ILI9488_BUFF_ROWS]; // 3 bytes for pixel color
 bool ili9488_buff_borrowed = false; ///< True if buffer is borrowed by someone else
 
+/// Staging buffer for background (DMA) writes.
+///
+/// The stripe to send is copied (or, in the qoi decoder, decoded directly)
+/// here, so ili9488_buff can already be filled with the next stripe while
+/// the previous one is still being transferred.
+static uint8_t ili9488_dma_buff[sizeof(ili9488_buff)];
+
 uint8_t *ili9488_borrow_buffer() {
     assert(!ili9488_buff_borrowed && "Already lent");
     assert(ili9488_task_handle == osThreadGetId() && "Must be called only from one task");
@@ -160,18 +169,11 @@ static void ili9488_clr_rst(void) {
 }
 
 static inline void ili9488_fill_ui16(uint16_t *p, uint16_t v, uint16_t c) {
-    while (c--) {
-        *(p++) = v;
-    }
+    fill_pixels_2b(p, v, c);
 }
 
 static void ili9488_fill_ui24(uint8_t *p, uint32_t v, int c) {
-    while (c--) {
-        p[0] = 0xFF & v;
-        p[1] = 0xFF & (v >> 8);
-        p[2] = 0xFF & (v >> 16);
-        p += 3;
-    }
+    fill_pixels_3b(p, v, c);
 }
 
 static inline int is_interrupt(void) {
@@ -191,11 +193,38 @@ void ili9488_delay_ms(uint32_t ms) {
     }
 }
 
+/// Data currently handed over to the SPI DMA by ili9488_wr_async(), null
+/// when the DMA is idle. Only the display task touches it (the ISR merely
+/// signals the completion), so no atomics are needed.
+static const uint8_t *ili9488_dma_pending = nullptr;
+
+static bool ili9488_dma_usable(const uint8_t *pb, uint16_t size) {
+    return (ili9488_flg & ILI9488_FLG_DMA) && !(ili9488_flg & ILI9488_FLG_SAFE) && (size > 4) && can_be_used_by_dma(pb);
+}
+
+/// Wait until a write started by ili9488_wr_async() is finished.
+///
+/// No-op if there's none. Every other SPI access (and everything that
+/// writes into the part of ili9488_buff being sent) must go through this
+/// first; the synchronous entry points below do so themselves.
+static void ili9488_dma_wait(void) {
+    if (ili9488_dma_pending) {
+        osSignalWait(ILI9488_SIG_SPI_TX, osWaitForever);
+        ili9488_dma_pending = nullptr;
+    }
+}
+
+bool ili9488_dma_busy(void) {
+    return ili9488_dma_pending && HAL_SPI_GetState(&SPI_HANDLE_FOR(lcd)) == HAL_SPI_STATE_BUSY_TX;
+}
+
 void ili9488_spi_wr_byte(uint8_t b) {
+    ili9488_dma_wait();
     HAL_SPI_Transmit(&SPI_HANDLE_FOR(lcd), &b, 1, HAL_MAX_DELAY);
 }
 
 void ili9488_spi_wr_bytes(const uint8_t *pb, uint16_t size) {
+    ili9488_dma_wait();
     if ((ili9488_flg & ILI9488_FLG_DMA) && !(ili9488_flg & ILI9488_FLG_SAFE) && (size > 4)) {
         osSignalSet(ili9488_task_handle, ILI9488_SIG_SPI_TX);
         osSignalWait(ILI9488_SIG_SPI_TX, osWaitForever);
@@ -208,6 +237,7 @@ void ili9488_spi_wr_bytes(const uint8_t *pb, uint16_t size) {
 }
 
 void ili9488_spi_rd_bytes(uint8_t *pb, uint16_t size) {
+    ili9488_dma_wait();
     // reading is more reliable at 20MHz
     SPIBaudRatePrescalerGuard guard { &SPI_HANDLE_FOR(lcd), SPI_BAUDRATEPRESCALER_4 };
 
@@ -215,6 +245,9 @@ void ili9488_spi_rd_bytes(uint8_t *pb, uint16_t size) {
 }
 
 void ili9488_cmd(uint8_t cmd, const uint8_t *pdata, uint16_t size) {
+    // The guard below reconfigures the SPI, that must not happen during a transfer
+    ili9488_dma_wait();
+
     // BFW-6328 Some displays possibly problematic with higher baudrate, reduce 40 -> 20 MHz
     SPIBaudRatePrescalerGuard _g(&SPI_HANDLE_FOR(lcd), SPI_BAUDRATEPRESCALER_4, reduce_display_baudrate);
 
@@ -242,6 +275,8 @@ void ili9488_cmd_1_data(uint8_t cmd, uint8_t data) {
 }
 
 void ili9488_cmd_rd(uint8_t cmd, uint8_t *pdata) {
+    ili9488_dma_wait();
+
     // reading is even more reliable at 10MHz
     SPIBaudRatePrescalerGuard guard { &SPI_HANDLE_FOR(lcd), SPI_BAUDRATEPRESCALER_8 };
 
@@ -259,6 +294,9 @@ void ili9488_wr(uint8_t *pdata, uint16_t size) {
         return; // null or empty data - return
     }
 
+    // The guard below reconfigures the SPI, that must not happen during a transfer
+    ili9488_dma_wait();
+
     // BFW-6328 Some displays possibly problematic with higher baudrate, reduce 40 -> 20 MHz
     SPIBaudRatePrescalerGuard _g(&SPI_HANDLE_FOR(lcd), SPI_BAUDRATEPRESCALER_4, reduce_display_baudrate);
 
@@ -268,6 +306,34 @@ void ili9488_wr(uint8_t *pdata, uint16_t size) {
     ili9488_set_cs(); // CS = H
 }
 
+/// Like ili9488_wr(), but when the DMA can take the transfer, it is only
+/// started and runs in the background while this returns.
+///
+/// The caller must not modify the data until the transfer is over; the next
+/// SPI access (or an explicit ili9488_dma_wait()) synchronizes with it
+/// first. With the BFW-6328 reduced-baudrate workaround active this falls
+/// back to the blocking write ‒ the prescaler is reconfigured around every
+/// transfer there and that can't be done with one still in flight.
+static void ili9488_wr_async(uint8_t *pdata, uint16_t size) {
+    if (!(pdata && size)) {
+        return; // null or empty data - return
+    }
+
+    if (reduce_display_baudrate || !ili9488_dma_usable(pdata, size)) {
+        ili9488_wr(pdata, size);
+        return;
+    }
+
+    ili9488_dma_wait();
+    ili9488_clr_cs(); // CS = L
+    ili9488_set_rs(); // RS = H
+    // flush any stale completion signal before a new transfer is started
+    osSignalSet(ili9488_task_handle, ILI9488_SIG_SPI_TX);
+    osSignalWait(ILI9488_SIG_SPI_TX, osWaitForever);
+    HAL_SPI_Transmit_DMA(&SPI_HANDLE_FOR(lcd), pdata, size);
+    ili9488_dma_pending = pdata;
+}
+
 void ili9488_rd(uint8_t *pdata, uint16_t size) {
     if (!(pdata && size)) {
         return; // null or empty data - return
@@ -508,16 +574,7 @@ void ili9488_clear(uint32_t clr666) {
     assert(!ili9488_buff_borrowed && "Buffer lent to someone");
 
     int i;
-    uint8_t *p_byte = (uint8_t *)ili9488_buff;
-
-    for (i = 0; i < ILI9488_COLS * ILI9488_BUFF_ROWS - 1; i++) {
-        *((uint32_t *)p_byte) = clr666;
-        p_byte += 3; // increase the address by 3 because the color has 3 bytes
-    }
-    uint8_t *clr_ptr = (uint8_t *)&clr666;
-    for (int j = 0; j < 3; j++) {
-        *(p_byte + j) = *(clr_ptr + j);
-    }
+    ili9488_fill_ui24(ili9488_buff, clr666, ILI9488_COLS * ILI9488_BUFF_ROWS);
 
     ili9488_clr_cs();
     ili9488_cmd_caset(0, ILI9488_COLS - 1);
@@ -559,6 +616,9 @@ uint32_t ili9488_get_pixel_colorFormat666(uint16_t point_x, uint16_t point_y) {
 }
 
 void ili9488_fill_rect_colorFormat666(uint16_t rect_x, uint16_t rect_y, uint16_t rect_w, uint16_t rect_h, uint32_t clr666) {
+    // The guard below reconfigures the SPI, that must not happen during a transfer
+    ili9488_dma_wait();
+
     // BFW-6328 Some displays possibly problematic with higher baudrate, reduce 40 -> 20 MHz
     SPIBaudRatePrescalerGuard _g(&SPI_HANDLE_FOR(lcd), SPI_BAUDRATEPRESCALER_4, reduce_display_baudrate);
 
@@ -590,10 +650,22 @@ void ili9488_draw_from_buffer(uint16_t x, uint16_t y, uint16_t w, uint16_t h) {
     /// @note This function is used when someone borrowed the buffer and filled it with data, don't check ili9488_buff_borrowed.
     /// @todo Cannot check that the buffer is borrowed because it is returned before calling this. Needs refactoring.
 
+    const uint16_t size = 3 * w * h;
+
+    // Stage the data into the DMA buffer and only start the transfer. The
+    // caller can render the next stripe into ili9488_buff right away,
+    // overlapping it with the transfer of this one; the copy costs a tiny
+    // fraction of the SPI transfer time.
+    ili9488_dma_wait();
+    memcpy(ili9488_dma_buff, ili9488_buff, size);
+
     ili9488_clr_cs();
     ili9488_cmd_caset(x, x + w - 1);
     ili9488_cmd_raset(y, y + h - 1);
-    ili9488_cmd_ramwr(ili9488_buff, 3 * w * h);
+    ili9488_cmd_ramwr(0, 0);
+    ili9488_wr_async(ili9488_dma_buff, size);
+    // CS is not wired out on any board with this display, so it's OK to
+    // "deassert" it while the transfer may still be running.
     ili9488_set_cs();
 }
 
@@ -601,6 +673,9 @@ void ili9488_draw_qoi_ex(FILE *pf, uint16_t point_x, uint16_t point_y, Color bac
     assert(!ili9488_buff_borrowed && "Buffer lent to someone");
     assert(pf);
 
+    // The guard below reconfigures the SPI, that must not happen during a transfer
+    ili9488_dma_wait();
+
     // BFW-6328 Some displays possibly problematic with higher baudrate, reduce 40 -> 20 MHz
     SPIBaudRatePrescalerGuard _g(&SPI_HANDLE_FOR(lcd), SPI_BAUDRATEPRESCALER_4, reduce_display_baudrate);
 
@@ -611,8 +686,15 @@ void ili9488_draw_qoi_ex(FILE *pf, uint16_t point_x, uint16_t point_y, Color bac
     std::span<uint8_t> i_buf(ili9488_buff, 512); ///< Input file buffer
     std::span<uint8_t> i_data; ///< Span of input data read from file
 
-    // Prepare output buffer
-    std::span<uint8_t> p_buf(ili9488_buff + i_buf.size(), std::size(ili9488_buff) - i_buf.size()); ///< Output pixel buffer
+    // Prepare output buffers ‒ the decoder alternates between the two, so
+    // the next stripe of pixels is decoded while the previous one is still
+    // being sent to the display by the DMA
+    const std::array<std::span<uint8_t>, 2> p_bufs = {
+        std::span<uint8_t>(ili9488_buff + i_buf.size(), std::size(ili9488_buff) - i_buf.size()),
+        std::span<uint8_t>(ili9488_dma_buff, std::size(ili9488_dma_buff)),
+    };
+    size_t p_buf_idx = 0;
+    std::span<uint8_t> p_buf = p_bufs[p_buf_idx]; ///< Output pixel buffer
     auto o_data = p_buf.begin(); ///< Pointer to output pixel data in buffer
 
 #if 0
@@ -647,6 +729,8 @@ void ili9488_draw_qoi_ex(FILE *pf, uint16_t point_x, uint16_t point_y, Color bac
     ili9488_cmd_ramwr(0, 0);
 
     qoi::Decoder qoi_decoder; ///< QOI decoding statemachine
+    std::optional<qoi::Pixel> last_pixel; ///< Last decoded pixel value
+    Color last_color = back_color; ///< Color computed for last_pixel
     while (1) {
         // Read more data from file
         if (size_t nread = fread(i_buf.data(), 1, i_buf.size(), pf); nread == 0) {
@@ -678,25 +762,35 @@ void ili9488_draw_qoi_ex(FILE *pf, uint16_t point_x, uint16_t point_y, Color bac
                     if (orig_pos.y > subrect.Bottom()) { // Picture ends
                         // Write remaining pixels to display and close SPI transaction
                         ili9488_wr(p_buf.data(), o_data - p_buf.begin());
+                        ili9488_dma_wait(); // the other buffer might still be in flight if the remainder was empty
                         ili9488_set_cs();
                         return;
                     }
                     continue;
                 }
 
-                // Transform pixel data
-                pixel = qoi::transform::apply_rop(pixel, rop);
-
-                const Color c = Color::mix(back_color, Color::from_rgb(pixel.r, pixel.g, pixel.b), pixel.a);
+                // Transform pixel data ‒ with a shortcut: images are full of
+                // single-color runs, so when the pixel repeats, reuse the
+                // color computed for the previous one instead of applying the
+                // rop and mixing with the background again
+                if (pixel != last_pixel) {
+                    last_pixel = pixel;
+                    pixel = qoi::transform::apply_rop(pixel, rop);
+                    last_color = Color::mix(back_color, Color::from_rgb(pixel.r, pixel.g, pixel.b), pixel.a);
+                }
+                const Color c = last_color;
 
                 // Store to output buffer
                 *o_data++ = c.b;
                 *o_data++ = c.g;
                 *o_data++ = c.r;
 
-                // Another 3 bytes wouldn't fit, write to display
+                // Another 3 bytes wouldn't fit, write to display and
+                // continue decoding into the other buffer meanwhile
                 if (p_buf.end() - o_data < 3) {
-                    ili9488_wr(p_buf.data(), o_data - p_buf.begin());
+                    ili9488_wr_async(p_buf.data(), o_data - p_buf.begin());
+                    p_buf_idx ^= 1;
+                    p_buf = p_bufs[p_buf_idx];
                     o_data = p_buf.begin();
                 }
             }
@@ -705,6 +799,7 @@ void ili9488_draw_qoi_ex(FILE *pf, uint16_t point_x, uint16_t point_y, Color bac
 
     // Write remaining pixels to display and close SPI transaction
     ili9488_wr(p_buf.data(), o_data - p_buf.begin());
+    ili9488_dma_wait(); // the other buffer might still be in flight if the remainder was empty
     ili9488_set_cs();
 }
 
@@ -51,6 +51,19 @@ void GuiLedsWriter::write(uint8_t *pb, uint16_t size) {
 }
 
 #if BOARD_IS_XLBUDDY() || PRINTER_IS_PRUSA_iX()
+// signal the completion callback wakes write() with; must not collide with
+// the ILI9488_SIG_* bits, both are delivered to the same (display) task
+static constexpr int32_t SIDE_STRIP_SIG_SPI_TX = 0x0010;
+
+/// Task currently sleeping in write() waiting for its transfer, null otherwise
+static osThreadId side_strip_waiting_task = nullptr;
+
+void SideStripWriter::spi_tx_complete() {
+    if (side_strip_waiting_task) {
+        osSignalSet(side_strip_waiting_task, SIDE_STRIP_SIG_SPI_TX);
+    }
+}
+
 void SideStripWriter::write(uint8_t *pb, uint16_t size) {
     SPI_HandleTypeDef *hspi = hw_get_spi_side_strip();
 
@@ -92,15 +105,21 @@ void SideStripWriter::write(uint8_t *pb, uint16_t size) {
     } else {
         HAL_SPI_Abort(hspi);
         assert(can_be_used_by_dma(pb));
+        side_strip_waiting_task = osThreadGetId();
+        // clear a stale completion signal possibly left by an aborted transfer
+        osSignalWait(SIDE_STRIP_SIG_SPI_TX, 0);
     #if HAS_BURST_STEPPING()
         HAL_SPI_Transmit_IT(hspi, pb, size);
     #else
         HAL_SPI_Transmit_DMA(hspi, pb, size);
     #endif
-        // wait for transmission complete
+        // sleep until the completion callback signals us; the state re-check
+        // (with a timeout on the wait) covers transfers ended by an error,
+        // those never deliver the signal
         while (HAL_SPI_GetState(hspi) == HAL_SPI_STATE_BUSY_TX) {
-            osDelay(1);
+            osSignalWait(SIDE_STRIP_SIG_SPI_TX, 10);
         }
+        side_strip_waiting_task = nullptr;
     }
 }
 #endif
@@ -3,11 +3,13 @@
 #include "cmath_ext.h"
 #include "cmsis_os.h"
 #include "disable_interrupts.h"
+#include "fill_kernels.hpp"
 #include "hwio_pindef.h"
 #include "qoi_decoder.hpp"
 #include "raster_opfn_c.h"
 #include <buddy/ccm_thread.hpp>
 #include <device/hal.h>
+#include <optional>
 #include <span>
 #include <stdbool.h>
 #include <stdlib.h>
@@ -181,9 +183,7 @@ void st7789v_reset(void) {
 }
 
 static inline void st7789v_fill_ui16(uint16_t *p, uint16_t v, uint16_t c) {
-    while (c--) {
-        *(p++) = v;
-    }
+    fill_pixels_2b(p, v, c);
 }
 
 static inline int is_interrupt(void) {
@@ -662,6 +662,8 @@ void st7789v_draw_qoi_ex(FILE *pf, uint16_t point_x, uint16_t point_y, Color bac
     st7789v_cmd_ramwr(0, 0);
 
     qoi::Decoder qoi_decoder; ///< QOI decoding statemachine
+    std::optional<qoi::Pixel> last_pixel; ///< Last decoded pixel value
+    uint16_t last_clr565 = 0; ///< Display-native color computed for last_pixel
     while (1) {
         // Read more data from file
         if (size_t nread = fread(i_buf.data(), 1, i_buf.size(), pf); nread == 0) {
@@ -699,14 +701,20 @@ void st7789v_draw_qoi_ex(FILE *pf, uint16_t point_x, uint16_t point_y, Color bac
                     continue;
                 }
 
-                // Transform pixel data
-                pixel = qoi::transform::apply_rop(pixel, rop);
+                // Transform pixel data ‒ with a shortcut: images are full of
+                // single-color runs, so when the pixel repeats, reuse the
+                // color computed for the previous one instead of applying the
+                // rop and mixing with the background again
+                if (pixel != last_pixel) {
+                    last_pixel = pixel;
+                    pixel = qoi::transform::apply_rop(pixel, rop);
+                    const Color c = Color::mix(back_color, Color::from_rgb(pixel.r, pixel.g, pixel.b), pixel.a);
+                    last_clr565 = color_to_565(c);
+                }
 
                 // Store to output buffer
-                const Color c = Color::mix(back_color, Color::from_rgb(pixel.r, pixel.g, pixel.b), pixel.a);
-                uint16_t clr565 = color_to_565(c);
-                *o_data++ = clr565;
-                *o_data++ = clr565 >> 8;
+                *o_data++ = last_clr565;
+                *o_data++ = last_clr565 >> 8;
 
                 // Another 3 bytes wouldn't fit, write to display
                 if (p_buf.end() - o_data < 3) {
@@ -1,5 +1,6 @@
 #include "text_roll.hpp"
 #include <algorithm>
+#include <array>
 
 #include "display_helper.h"
 #include "display.hpp"
@@ -12,6 +13,57 @@
 
 size_t txtroll_t::instance_counter = 0;
 
+namespace {
+
+// Decoded characters currently visible in the rolling label. The px phase of
+// the roll redraws the very same characters font_w times in a row, so decoding
+// the string on every tick (for file backed strings that means reading the
+// media) is wasted work; on a character step the window just shifts by one, so
+// everything still visible is reused too. One shared cache is enough, only one
+// label rolls at a time - should more of them roll, the cache keeps thrashing
+// and rendering merely decodes every tick as it used to.
+constexpr size_t roll_cache_capacity = 64;
+const txtroll_t *roll_cache_owner = nullptr;
+uint16_t roll_cache_progress = 0;
+uint16_t roll_cache_char_cnt = 0;
+std::array<unichar, roll_cache_capacity> roll_cache;
+
+const unichar *roll_cache_get(const txtroll_t *owner, const string_view_utf8 &text, uint16_t draw_progress, uint16_t char_cnt) {
+    if (char_cnt > roll_cache_capacity) {
+        return nullptr;
+    }
+
+    if (owner != roll_cache_owner || roll_cache_progress > draw_progress || draw_progress - roll_cache_progress > 1) {
+        // cold cache, decode the whole visible window
+        StringReaderUtf8 reader(text);
+        reader.skip(draw_progress);
+        for (uint16_t i = 0; i < char_cnt; i++) {
+            roll_cache[i] = reader.getUtf8Char();
+        }
+    } else {
+        if (roll_cache_progress != draw_progress) {
+            // character step, shift out the character that just rolled away
+            std::copy(roll_cache.begin() + 1, roll_cache.begin() + roll_cache_char_cnt, roll_cache.begin());
+            roll_cache_char_cnt--;
+        }
+        if (roll_cache_char_cnt < char_cnt) {
+            // decode only the newly exposed characters
+            StringReaderUtf8 reader(text);
+            reader.skip(draw_progress + roll_cache_char_cnt);
+            for (uint16_t i = roll_cache_char_cnt; i < char_cnt; i++) {
+                roll_cache[i] = reader.getUtf8Char();
+            }
+        }
+    }
+
+    roll_cache_owner = owner;
+    roll_cache_progress = draw_progress;
+    roll_cache_char_cnt = char_cnt;
+    return roll_cache.data();
+}
+
+} // namespace
+
 // invalidate at phase change
 invalidate_t txtroll_t::Tick() {
     if (buddy::conserve_cpu().is_requested()) {
@@ -83,6 +135,9 @@ void txtroll_t::Init(Rect16 rc, const string_view_utf8 &text, Font font,
     count_from_init = meas(rect, text, font);
     font_w = runtime_width(font);
     phase = phase_t::init_roll;
+    if (roll_cache_owner == this) {
+        roll_cache_owner = nullptr; // the text might have changed
+    }
 }
 
 void txtroll_t::render_text(Rect16 rc, const string_view_utf8 &text, Font font,
@@ -125,7 +180,13 @@ void txtroll_t::render_rolling_text_align(Rect16 rc, const string_view_utf8 &tex
     }
 
     if (!set_txt_rc.IsEmpty()) {
-        Rect16 text_drawn_at(set_txt_rc.TopLeft(), render_text_singleline(set_txt_rc, StringReaderUtf8(text).skip(draw_progress), resource_font(font), clr_back, clr_text));
+        const font_t *pf = resource_font(font);
+        const uint16_t char_cnt = set_txt_rc.Width() / pf->w;
+        const unichar *cached_chars = roll_cache_get(this, text, draw_progress, char_cnt);
+        Rect16 text_drawn_at(set_txt_rc.TopLeft(),
+            cached_chars
+                ? render_text_singleline(set_txt_rc, cached_chars, char_cnt, pf, clr_back, clr_text)
+                : render_text_singleline(set_txt_rc, StringReaderUtf8(text).skip(draw_progress), pf, clr_back, clr_text));
         if (fill_rect) {
             fill_between_rectangles(&rc, &text_drawn_at, clr_back);
         }
@@ -67,6 +67,7 @@ void window_t::Validate(Rect16 validation_rect) {
     if (validation_rect.IsEmpty() || rect.HasIntersection(validation_rect)) {
         flags.invalid = false;
         flags.invalid_background = false;
+        invalid_area = Rect16();
         validate(validation_rect);
     }
 }
@@ -82,7 +83,15 @@ void window_t::Invalidate(Rect16 invalidation_rect) {
 }
 
 // frame will invalidate children
-void window_t::invalidate([[maybe_unused]] Rect16 validation_rect) {
+void window_t::invalidate(Rect16 invalidation_rect) {
+    if (flags.invalid && invalid_area.IsEmpty()) {
+        return; // whole window is invalid already, nothing to add
+    }
+    if (invalidation_rect.IsEmpty()) {
+        invalid_area = Rect16(); // everything
+    } else {
+        invalid_area += invalidation_rect.Intersection(rect);
+    }
     flags.invalid = true;
     flags.invalid_background = true;
 }
@@ -91,6 +100,21 @@ void window_t::invalidate([[maybe_unused]] Rect16 validation_rect) {
 void window_t::validate([[maybe_unused]] Rect16 validation_rect) {
 }
 
+/**
+ * @brief Part of the window that needs a redraw.
+ * @return empty rect when the window is valid, the whole rect when fully
+ *         invalid, the union of the invalidated sub-rectangles otherwise
+ */
+Rect16 window_t::GetInvalidationRect() const {
+    if (!flags.invalid) {
+        return Rect16();
+    }
+    if (invalid_area.IsEmpty()) {
+        return GetRect();
+    }
+    return invalid_area.Intersection(GetRect());
+}
+
 void window_t::ValidateBackground() {
     flags.invalid_background = false;
 }
@@ -361,7 +385,15 @@ void window_t::Draw() {
 
 void window_t::draw() {
     if (IsInvalid() && IsVisible() && !rect.IsEmpty()) {
-        unconditionalDraw();
+        if (const Rect16 inv = GetInvalidationRect(); !inv.IsEmpty() && inv != GetRect()) {
+            // Only a part of the window was invalidated, clip the repaint
+            // to it. Primitives that cannot clip just repaint more of the
+            // (identical) content, which is harmless.
+            display::ClipRectGuard clip(inv);
+            unconditionalDraw();
+        } else {
+            unconditionalDraw();
+        }
     }
 }
 
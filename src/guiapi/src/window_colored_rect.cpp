@@ -12,8 +12,10 @@ void window_colored_rect::set_border_thickness(uint8_t new_thickness) {
 }
 
 void window_colored_rect::set_parent_color(Color new_parent_color) {
-    parent_color = new_parent_color;
-    Invalidate();
+    if (parent_color != new_parent_color) {
+        parent_color = new_parent_color;
+        Invalidate();
+    }
 }
 
 void window_colored_rect::unconditionalDraw() {
@@ -199,7 +199,8 @@ void window_frame_t::draw() {
         }
 
         if (invalid_area.HasIntersection(ptr->GetRect())) {
-            ptr->Invalidate();
+            // only the overlap needs a repaint, not the whole child
+            ptr->Invalidate(invalid_area);
         }
 
         ptr->Draw();
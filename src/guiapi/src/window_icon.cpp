@@ -15,6 +15,9 @@ window_icon_t::window_icon_t(window_t *parent, Rect16 rect, const img::Resource
     : window_aligned_t(parent, rect, win_type_t::normal, close)
     , pRes(res) {
     SetAlignment(Align_t::Center());
+    if (res) {
+        img::prefetch_icon(*res); // so the first draw does not wait for littlefs
+    }
 }
 
 // Icon rect is increased by padding, icon is centered inside it
@@ -137,6 +140,11 @@ WindowMultiIconButton::WindowMultiIconButton(window_t *parent, Rect16 rc, const
     , pRes(res)
     , callback(cb) {
     Enable();
+    if (res) {
+        img::prefetch_icon(res->normal);
+        img::prefetch_icon(res->focused);
+        img::prefetch_icon(res->disabled);
+    }
 }
 
 void WindowMultiIconButton::unconditionalDraw() {
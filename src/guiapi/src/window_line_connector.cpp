@@ -13,11 +13,17 @@ void window_line_connector::set_parent_side(ParentSide new_side) {
 }
 
 void window_line_connector::set_points(PointsT new_points) {
-    points = new_points;
+    if (points != new_points) {
+        points = new_points;
+        Invalidate();
+    }
 }
 
 void window_line_connector::set_parents(ParentsT new_parents) {
-    parents = new_parents;
+    if (parents != new_parents) {
+        parents = new_parents;
+        Invalidate();
+    }
 }
 
 void window_line_connector::set_line_thickness(uint16_t new_value) {
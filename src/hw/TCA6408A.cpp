@@ -81,12 +81,28 @@ bool TCA6408A::read_reg(Register reg, uint8_t &value) const {
     }
 
     i2c::Result res_transmit = i2c::Transmit(i2c, write_address, (uint8_t *)&reg, sizeof(uint8_t), timeout_ms);
-    HAL_Delay(5); // TODO: Check if delay can be shortened
+    HAL_Delay(read_settle_delay_ms);
     i2c::Result res_receive = i2c::Receive(i2c, read_address, &value, sizeof(uint8_t), timeout_ms);
 
     return res_transmit == i2c::Result::ok && res_receive == i2c::Result::ok;
 }
 
+bool TCA6408A::read_reg_async(Register reg, uint8_t &value, i2c::AsyncEngine::Callback callback, void *callback_context) {
+    if (!is_initialized_) {
+        SERIAL_ERROR_MSG(" IO Expander not initialized properly");
+        return false;
+    }
+
+    auto &engine = i2c::AsyncEngine::instance();
+    const uint8_t reg_address = static_cast<uint8_t>(reg);
+    if (!engine.Transmit(i2c, write_address, &reg_address, sizeof(reg_address), timeout_ms, nullptr, nullptr, read_settle_delay_ms)) {
+        return false;
+    }
+    // Should the queue fill up right between the two submissions, the device
+    // is left with the register selected and nothing read - harmless
+    return engine.Receive(i2c, read_address, &value, sizeof(value), timeout_ms, callback, callback_context);
+}
+
 bool TCA6408A::write_reg(Register reg, uint8_t value) {
     if (!is_initialized_) {
         SERIAL_ERROR_MSG(" IO Expander not initialized properly");
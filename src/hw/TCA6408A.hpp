@@ -1,6 +1,7 @@
 #pragma once
 
 #include "i2c.hpp"
+#include "i2c_async.hpp"
 #include <optional>
 
 namespace buddy::hw {
@@ -57,6 +58,15 @@ public:
      */
     bool read_reg(Register reg, uint8_t &value) const;
 
+    /** @brief Read from register through i2c::AsyncEngine, without blocking the caller.
+     *  Same bus sequence as read_reg, only spliced into the engine queue.
+     *  @param reg [in] register to read from
+     *  @param value [out] written by the engine worker, has to stay valid until the callback runs
+     *  @param callback [in] runs on the engine worker with the result of the read
+     *  @return if both phases of the read were queued (when false, no callback will run)
+     */
+    bool read_reg_async(Register reg, uint8_t &value, i2c::AsyncEngine::Callback callback, void *callback_context);
+
     /** @brief Write to register.
      *  Write a byte to a given register.
      *  @param reg [in] register to write to
@@ -86,6 +96,9 @@ private:
     // timeout for read/write operations
     static constexpr uint32_t timeout_ms = 5;
 
+    // gap between selecting a register and reading it
+    static constexpr uint8_t read_settle_delay_ms = 5; // TODO: Check if delay can be shortened
+
     static constexpr uint8_t write_operation = 0;
     static constexpr uint8_t read_operation = 1;
 
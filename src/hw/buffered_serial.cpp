@@ -55,57 +55,67 @@ void uartrxbuff_reset(BufferedSerial::uartrxbuff_t *prxbuff) {
     prxbuff->idle_at_NDTR = UINT32_MAX;
 }
 
-// an alternative approach to solving the first_half_full issue
-// as suggested by Alan - do not read the last character from the lower
-// half of the buffer unless the first_half_full flag is set
-// - i.e. return NO_DATA in such a case and the caller is obliged to
-// make another call to uartrxbuff_getchar to read the character.
-int uartrxbuff_getchar(BufferedSerial::uartrxbuff_t *prxbuff) {
-    int retval;
-
+// Copy up to maxlen already received bytes out of the DMA buffer in one go,
+// paying the event group round trip once instead of once per byte. During a
+// burst (e.g. a full fifo drain) this keeps the per-byte cost at a plain copy.
+//
+// Returns the number of bytes copied, or - when nothing was copied - one of
+// the UARTRXBUFF_ERR_* values:
+//  - UARTRXBUFF_ERR_IDLE when the read position reached the place idle line
+//    was detected at
+//  - UARTRXBUFF_ERR_NO_DATA when there is (possibly temporarily) nothing to
+//    consume; note we deliberately keep the last character of the first half
+//    in the buffer until the first_half_full flag is set (an approach
+//    suggested by Alan to avoid racing the half-complete ISR)
+int uartrxbuff_read(BufferedSerial::uartrxbuff_t *prxbuff, char *buf, size_t maxlen) {
     uint32_t ndtr = prxbuff->phdma->Instance->NDTR;
-    uint8_t cnt = prxbuff->buffer_size - ndtr;
+    int cnt = prxbuff->buffer_size - ndtr;
 
     EventBits_t events = xEventGroupGetBits(prxbuff->event_group);
     EventBits_t events_to_clear = UARTRXBUFF_EVT_IDLE;
     bool first_half_full = events & UARTRXBUFF_EVT_FIRST_HALF_FULL;
     bool second_half_full = events & UARTRXBUFF_EVT_SECOND_HALF_FULL;
 
+    int retval;
+    const int idle_pos = prxbuff->idle_at_NDTR != UINT32_MAX ? prxbuff->buffer_size - (int)prxbuff->idle_at_NDTR : -1;
+
     if (events & UARTRXBUFF_EVT_OVERFLOW_DETECTED) {
         retval = UARTRXBUFF_ERR_OVERFLOW;
-    } else if (prxbuff->idle_at_NDTR != UINT32_MAX && prxbuff->buffer_pos == (prxbuff->buffer_size - (int)prxbuff->idle_at_NDTR)) {
+    } else if (idle_pos == prxbuff->buffer_pos) {
         // idle occured at this position - return it
         retval = UARTRXBUFF_ERR_IDLE;
         prxbuff->idle_at_NDTR = UINT32_MAX;
-    } else if (prxbuff->buffer_pos < (prxbuff->buffer_size / 2)) {
-        // We are reading the first half of the buffer
-        if (first_half_full || (prxbuff->buffer_pos < cnt)) {
-            if ((!first_half_full) && (prxbuff->buffer_pos == (prxbuff->buffer_size / 2) - 1)) {
-                // special case - caught the bug - first_half_full is NOT set while we already have the
-                // lower part of the buffer full
-                retval = UARTRXBUFF_ERR_NO_DATA;
-            } else {
-                // normal operation
-                retval = prxbuff->buffer[prxbuff->buffer_pos++];
-                if (prxbuff->buffer_pos == (prxbuff->buffer_size / 2)) {
-                    // we just reached second half of the buffer, so let's mark the first half as "not pending"
-                    events_to_clear = UARTRXBUFF_EVT_FIRST_HALF_FULL;
-                }
-            }
+    } else {
+        // End of the run of bytes that are safe to consume
+        int end;
+        if (prxbuff->buffer_pos < (prxbuff->buffer_size / 2)) {
+            // We are reading the first half of the buffer; without the flag set,
+            // leave its last character in (see the note above)
+            end = first_half_full ? prxbuff->buffer_size / 2 : std::min(cnt, prxbuff->buffer_size / 2 - 1);
         } else {
-            retval = UARTRXBUFF_ERR_NO_DATA;
+            // We are reading the second half of the buffer
+            end = second_half_full ? prxbuff->buffer_size : cnt;
         }
-    } else {
-        // We are reading the second half of the buffer
-        if (second_half_full || (prxbuff->buffer_pos < cnt)) {
-            retval = prxbuff->buffer[prxbuff->buffer_pos++];
-            if (prxbuff->buffer_pos >= prxbuff->buffer_size) {
+        if (idle_pos > prxbuff->buffer_pos && idle_pos < end) {
+            // stop at the position idle occured at so the next call reports it
+            end = idle_pos;
+        }
+
+        const int available = end - prxbuff->buffer_pos;
+        if (available <= 0) {
+            retval = UARTRXBUFF_ERR_NO_DATA;
+        } else {
+            retval = std::min(available, (int)maxlen);
+            memcpy(buf, &prxbuff->buffer[prxbuff->buffer_pos], retval);
+            prxbuff->buffer_pos += retval;
+            if (prxbuff->buffer_pos == (prxbuff->buffer_size / 2)) {
+                // we just reached second half of the buffer, so let's mark the first half as "not pending"
+                events_to_clear = UARTRXBUFF_EVT_FIRST_HALF_FULL;
+            } else if (prxbuff->buffer_pos >= prxbuff->buffer_size) {
                 // we reached the end of the buffer, go back to the beginning and clear the "second half is full" flag
                 prxbuff->buffer_pos = 0;
                 events_to_clear = UARTRXBUFF_EVT_SECOND_HALF_FULL;
             }
-        } else {
-            retval = UARTRXBUFF_ERR_NO_DATA;
         }
     }
 
@@ -184,14 +194,14 @@ size_t BufferedSerial::Read(char *buf, size_t len, bool terminate_on_idle /* = f
     auto tickStart = ticks_ms();
 
     while (read != len) {
-        int ch = uartrxbuff_getchar(&rxBuf);
+        int ret = uartrxbuff_read(&rxBuf, buf + read, len - read);
 
-        if (ch >= 0) {
-            buf[read++] = (char)ch;
-        } else if (ch == UARTRXBUFF_ERR_OVERFLOW) {
+        if (ret > 0) {
+            read += ret;
+        } else if (ret == UARTRXBUFF_ERR_OVERFLOW) {
             log_error(BufferedSerial, "Overflow detected");
             break;
-        } else if (ch == UARTRXBUFF_ERR_IDLE) {
+        } else if (ret == UARTRXBUFF_ERR_IDLE) {
             if (terminate_on_idle && read > 0) {
                 break;
             }
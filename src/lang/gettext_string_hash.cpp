@@ -4,23 +4,57 @@
 
 #include "gettext_string_hash.hpp"
 #include <string.h>
+#include <stdlib.h>
+#include <algorithm>
 
-uint32_t gettext_hash_table::hash_string(const char *key) {
+namespace {
+
+// The RAM-resident index of one catalog, so the lookups in the GUI draw path
+// don't have to crawl the file record by record (see preloadIndex).
+//
+// There's only one ‒ initializing another table (= switching the language)
+// hands the index over to it and tables that don't own it read the file the
+// old way.
+struct PreloadedIndex {
+    const gettext_hash_table *owner = nullptr;
+    void *arena = nullptr;
+    // All of these point into the arena.
+    const uint32_t *hash_slots = nullptr; // [m_HashSize]
+    const uint32_t *trans_off = nullptr; // [m_NumOfString]
+    const uint32_t *orig_hash = nullptr; // [m_NumOfString]
+    const uint8_t *orig_len = nullptr; // [m_NumOfString]
+};
+
+PreloadedIndex preloaded;
+
+} // namespace
+
+gettext_hash_table::~gettext_hash_table() {
+    if (preloaded.owner == this) {
+        // Keep the arena for whoever claims it next, just don't let a new
+        // table at the same address inherit a foreign index.
+        preloaded.owner = nullptr;
+    }
+}
+
+uint32_t gettext_hash_table::hash_step(uint32_t hval, uint8_t c) {
     static constexpr uint32_t HASHWORDBITS = 32U;
 
-    uint32_t hval, g;
-    const char *str = key;
+    hval <<= 4U;
+    hval += c;
+    const uint32_t g = hval & ((uint32_t)0xf << (HASHWORDBITS - 4));
+    if (g != 0) {
+        hval ^= g >> (HASHWORDBITS - 8);
+        hval ^= g;
+    }
+    return hval;
+}
 
+uint32_t gettext_hash_table::hash_string(const char *key) {
     /* Compute the hash value for the given string.  */
-    hval = 0;
-    while (*str != '\0') {
-        hval <<= 4U;
-        hval += (uint8_t)*str++;
-        g = hval & ((uint32_t)0xf << (HASHWORDBITS - 4));
-        if (g != 0) {
-            hval ^= g >> (HASHWORDBITS - 8);
-            hval ^= g;
-        }
+    uint32_t hval = 0;
+    for (const char *str = key; *str != '\0'; str++) {
+        hval = hash_step(hval, (uint8_t)*str);
     }
     return hval;
 }
@@ -160,11 +194,129 @@ bool gettext_hash_table::Init(FILE *file) {
         return false;
     }
 
-    return fread(&hashTable, sizeof(hashTable), 1, m_File) == 1;
+    if (fread(&hashTable, sizeof(hashTable), 1, m_File) != 1) {
+        return false;
+    }
+
+    // We are the freshly selected language, take over the RAM index.
+    preloadIndex();
+
+    return true;
+}
+
+void gettext_hash_table::preloadIndex() const {
+    // Whatever happens below, don't leave a stale index of the previous
+    // owner around.
+    preloaded.owner = nullptr;
+    free(preloaded.arena);
+    preloaded.arena = nullptr;
+
+    const uint32_t strings = hashTable.m_NumOfString;
+    const uint32_t slots = hashTable.m_HashSize;
+
+    // One 4B slot of the hash table plus a (4 + 4 + 1)B record per string;
+    // the byte-sized lengths go last, so everything else stays aligned.
+    //
+    // For our catalogs this is about 20kB. The size cap is a sanity check
+    // against a corrupted file ‒ such file can't provide translations
+    // anyway, no point in holding RAM for it.
+    const size_t arena_size = size_t(4) * (slots + 2 * strings) + strings;
+    if (strings == 0 || slots < 3 || arena_size > 64 * 1024) {
+        return;
+    }
+
+    uint8_t *arena = static_cast<uint8_t *>(malloc(arena_size));
+    if (arena == nullptr) {
+        // Not enough RAM. The lookups will take the slower file path.
+        return;
+    }
+
+    uint32_t *hash_slots = reinterpret_cast<uint32_t *>(arena);
+    uint32_t *trans_off = hash_slots + slots;
+    uint32_t *orig_hash = trans_off + strings;
+    uint8_t *orig_len = reinterpret_cast<uint8_t *>(orig_hash + strings);
+
+    bool ok = fseek(m_File, hashTable.m_HashOffset, SEEK_SET) == 0 && fread(hash_slots, 4, slots, m_File) == slots;
+
+    for (uint32_t i = 0; ok && i < strings; i++) {
+        // Length and position of the original string.
+        uint32_t desc[2];
+        ok = fseek(m_File, hashTable.m_OrigOffset + 8 * i, SEEK_SET) == 0 && fread(desc, 4, 2, m_File) == 2 && fseek(m_File, desc[1], SEEK_SET) == 0;
+
+        // We won't have the original string in RAM to compare the key
+        // against, so store its hash (the full 32 bits, not just the
+        // position in the table) and its length instead.
+        uint32_t hval = 0;
+        for (uint32_t rest = desc[0]; ok && rest > 0;) {
+            char chunk[64];
+            const uint32_t chunk_len = std::min<uint32_t>(rest, sizeof chunk);
+            ok = fread(chunk, 1, chunk_len, m_File) == chunk_len;
+            for (uint32_t c = 0; c < chunk_len; c++) {
+                hval = hash_step(hval, (uint8_t)chunk[c]);
+            }
+            rest -= chunk_len;
+        }
+        orig_hash[i] = hval;
+        orig_len[i] = std::min<uint32_t>(desc[0], 0xff);
+
+        ok = ok && fseek(m_File, hashTable.m_TransOffset + 8 * i + 4, SEEK_SET) == 0 && fread(&trans_off[i], 4, 1, m_File) == 1;
+    }
+
+    if (!ok) {
+        free(arena);
+        return;
+    }
+
+    preloaded.arena = arena;
+    preloaded.hash_slots = hash_slots;
+    preloaded.trans_off = trans_off;
+    preloaded.orig_hash = orig_hash;
+    preloaded.orig_len = orig_len;
+    preloaded.owner = this;
+}
+
+int32_t gettext_hash_table::getOffsetPreloaded(const char *key) const {
+    // The same double-hashing walk as getIndexOfKey, just against the RAM
+    // index instead of the file.
+    const uint32_t hashVal = hash_string(key);
+    const uint32_t keyLen = strlen(key);
+    uint32_t posInHash = hashVal % hashTable.m_HashSize;
+    const uint32_t incr = 1 + (hashVal % (hashTable.m_HashSize - 2));
+
+    for (uint32_t index = preloaded.hash_slots[posInHash]; index > 0; index = preloaded.hash_slots[posInHash]) {
+
+        index--;
+
+        if (index > hashTable.m_NumOfString) {
+            index -= hashTable.m_NumOfString;
+        }
+
+        // A false match here needs a same-length string with a full 32bit
+        // hash collision sitting in the same probe chain ‒ that doesn't
+        // happen by accident.
+        //
+        // (Index 0 is the catalog header, never a real translation.)
+        if (index > 0 && index < hashTable.m_NumOfString && preloaded.orig_hash[index] == hashVal && preloaded.orig_len[index] == std::min<uint32_t>(keyLen, 0xff)) {
+            return preloaded.trans_off[index];
+        }
+
+        // if not rehash the string and check it again
+        if (posInHash >= hashTable.m_HashSize - incr) {
+            posInHash -= hashTable.m_HashSize - incr;
+        } else {
+            posInHash += incr;
+        }
+    }
+
+    return TranslationNotFound;
 }
 
 int32_t gettext_hash_table::GetOffset(const char *key) const {
 
+    if (preloaded.owner == this) {
+        return getOffsetPreloaded(key);
+    }
+
     int32_t index = getIndexOfKey(key);
     if (index <= 0) {
         return TranslationNotFound;
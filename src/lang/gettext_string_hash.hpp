@@ -9,6 +9,7 @@
 class gettext_hash_table {
 public:
     gettext_hash_table() = default;
+    ~gettext_hash_table();
 
     enum { TranslationNotFound = -1,
         FileErrorOccurred = -2 };
@@ -24,6 +25,14 @@ public:
     bool Init(FILE *file);
 
 private:
+    /// loads the hash table and per-string digests into a RAM arena, so the
+    /// lookups don't have to read the file; best effort, on failure the
+    /// lookups just take the slower file path
+    void preloadIndex() const;
+
+    /// the lookup against the RAM index, for the table that currently owns it
+    /// \return same as GetOffset, except it can't fail on file errors
+    int32_t getOffsetPreloaded(const char *key) const;
     /// finds index of key
     /// \param key which index to find
     /// \return positive number if key found, 0 if not, -1 if file error occurred
@@ -33,6 +42,9 @@ private:
     /// [see Aho/Sethi/Ullman, COMPILERS: Principles, Techniques and Tools, 1986, 1987 Bell Telephone Laboratories, Inc.]
     static uint32_t hash_string(const char *key);
 
+    /// one character worth of hash_string, for hashing strings streamed from the file
+    static uint32_t hash_step(uint32_t hval, uint8_t c);
+
     /// returns index from pos in hashtable
     ///  \param pos where to look for index
     ///  \return positive number or zero on success, -1 if file error occurred
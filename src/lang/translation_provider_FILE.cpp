@@ -1,5 +1,8 @@
 #include "translation_provider_FILE.hpp"
 
+#include <tuple>
+
+#include <buddy/filesystem_littlefs_internal.h>
 #include <option/has_translations.h>
 #include <option/enable_translation_cs.h>
 #include <option/enable_translation_de.h>
@@ -44,6 +47,9 @@ bool FILETranslationProvider::EnsureFile() const {
     if (m_File != nullptr) {
         return true;
     }
+    // translations are read in tiny random-access records; when the file fits
+    // the budget, pin it so the records come from RAM (best effort)
+    std::ignore = filesystem_littlefs_internal_pin(m_Path, 16384);
     m_File = fopen(m_Path, "rb"); // now we know that the FILE* is valid
     if (m_File == nullptr) {
         return false;
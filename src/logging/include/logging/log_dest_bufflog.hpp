@@ -9,11 +9,16 @@ namespace logging {
 ///
 /// The BuffLog destination does not guarantee delivery of all events.
 /// There is a limited buffer that can overflow. Messages might get logs on bus.
+/// Producers never take a lock; an event which does not fit is dropped whole
+/// and counted in a per-task drop counter.
 void bufflog_log_event(FormattedEvent *event);
 
 /// Pipukup data from buffer
 size_t bufflog_pickup(char *buffer, size_t buffer_size);
 
+/// Number of events dropped because the buffer was full, bucketed by task id
+uint32_t bufflog_dropped_count(TaskId task_id);
+
 /// Terminate event record with EOT
 #define BUFFLOG_TERMINATION_CHAR 4
 
@@ -14,4 +14,7 @@ void file_log_disable();
 
 bool file_log_is_enabled();
 
+/// How many records were lost to a full buffer or a failing file
+uint32_t file_log_dropped_count();
+
 } // namespace logging
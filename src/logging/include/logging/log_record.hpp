@@ -0,0 +1,52 @@
+#pragma once
+
+#include <cstdarg>
+#include <cstddef>
+#include <cstdint>
+
+namespace logging {
+
+/// Binary log record: format string pointer plus captured raw arguments.
+///
+/// Capturing is a cheap scan of the format string that copies each argument
+/// (strings are deep-copied, bounded by the buffer) into the record, so the
+/// record is self-contained and formatting can be deferred to whoever renders
+/// it - the caller doesn't have to wait for printf to run.
+///
+/// The format string itself is stored as a pointer; log format strings are
+/// string literals, so they stay valid forever.
+class Record {
+public:
+    /// Captures \p fmt and its arguments into the record.
+    ///
+    /// \returns false when the format string uses a feature the capturer does
+    /// not support (e.g. %n, long double) or the arguments don't fit the
+    /// buffer; the caller is expected to fall back to synchronous formatting.
+    /// \p args is consumed; va_copy before calling when it is needed again.
+    bool capture(const char *fmt, va_list args);
+
+    /// Renders the captured record into \p out (always NUL-terminated,
+    /// truncates when it doesn't fit).
+    void render(char *out, size_t out_size) const;
+
+private:
+    static constexpr size_t buffer_size = 48;
+
+    /// Type tag of one captured argument, stored in front of its payload
+    enum class ArgType : uint8_t {
+        signed_int, ///< intmax_t, sign-extended from the original size
+        unsigned_int, ///< uintmax_t, zero-extended from the original size
+        floating, ///< double
+        character, ///< int, as promoted for %c
+        string, ///< length byte followed by the characters and a NUL
+        pointer, ///< void *
+    };
+
+    bool append(ArgType type, const void *payload, size_t payload_size);
+
+    const char *fmt;
+    uint8_t used;
+    uint8_t buffer[buffer_size];
+};
+
+} // namespace logging
@@ -4,6 +4,7 @@
 #include <freertos/binary_semaphore.hpp>
 #include <freertos/queue.hpp>
 #include <logging/log.hpp>
+#include <logging/log_record.hpp>
 
 #include <FreeRTOS.h>
 #include <task.h>
@@ -13,8 +14,29 @@ namespace logging {
 class Task {
 private:
     struct QueueItem {
-        Event *event;
-        freertos::BinarySemaphore *semaphore;
+        enum class Type : uint8_t {
+            /// event points to the sender's stack; the sender blocks on the
+            /// semaphore until the logging task is done formatting
+            blocking,
+            /// deferred holds a self-contained binary record and the sender
+            /// did not block at all
+            deferred,
+        };
+
+        Type type;
+        union {
+            struct {
+                Event *event;
+                freertos::BinarySemaphore *semaphore;
+            } blocking;
+            struct {
+                Timestamp timestamp;
+                TaskId task_id;
+                const Component *component;
+                Severity severity;
+                Record record;
+            } deferred;
+        };
     };
     freertos::Queue<QueueItem, 4> queue;
     static constexpr size_t MESSAGE_MAX_SIZE = 128;
@@ -1,73 +1,146 @@
 #include <logging/log_dest_bufflog.hpp>
 
 #include <algorithm>
+#include <atomic>
 #include <cstring>
-#include <freertos/mutex.hpp>
 #include <logging/log_dest_shared.hpp>
 
-#define BUFFLOG_BUFFER_SIZE 256
-
-// Can't use std::unique_lock from <mutex> because it pulls in a bunch of other
-// std::crap which fails debug build.
-template <class Mutex>
-class UniqueLock {
-private:
-    Mutex &mutex;
-
-public:
-    explicit UniqueLock(Mutex &mutex)
-        : mutex { mutex } { mutex.lock(); }
-    ~UniqueLock() { mutex.unlock(); }
-};
-
 namespace logging {
 
-static freertos::Mutex mutex;
+// Lock-free multi-producer single-consumer ring of fixed-size cells
+// (a bounded Vyukov-style queue). A producer formats the whole event into a
+// stack buffer, claims a contiguous run of cells with a single
+// compare-exchange and copies the bytes in; it never takes a lock and never
+// waits for the consumer, so logging is safe even from timing-sensitive
+// tasks. When the ring is full the event is dropped and counted.
+
+namespace {
+
+    /// Number of cells in the ring; must be a power of two.
+    constexpr uint32_t cell_count = 8;
+
+    /// Payload bytes per cell. One event may span several cells, claimed as
+    /// one contiguous run, so interleaving between producers cannot happen.
+    constexpr size_t cell_payload = 28;
+
+    struct Cell {
+        /// Cell state encoded as a position: equal to a position p when the
+        /// cell is free to be claimed for p, p + 1 once data for p is
+        /// published. The consumer bumps it by cell_count when done.
+        std::atomic<uint32_t> sequence;
+        uint8_t used;
+        char data[cell_payload];
+    };
+
+    Cell cells[cell_count] = {
+        { { 0 }, 0, {} },
+        { { 1 }, 0, {} },
+        { { 2 }, 0, {} },
+        { { 3 }, 0, {} },
+        { { 4 }, 0, {} },
+        { { 5 }, 0, {} },
+        { { 6 }, 0, {} },
+        { { 7 }, 0, {} },
+    };
+
+    std::atomic<uint32_t> enqueue_pos { 0 };
+
+    /// Consumer-side state; bufflog_pickup is the only one touching these.
+    uint32_t dequeue_pos = 0;
+    size_t dequeue_offset = 0;
+
+    constexpr uint32_t drop_counter_count = 8;
+    std::atomic<uint32_t> drop_counters[drop_counter_count];
+
+    /// Claim needed_cells consecutive positions starting at pos.
+    /// Returns false without blocking when the ring does not have room.
+    bool claim(uint32_t needed_cells, uint32_t &pos) {
+        pos = enqueue_pos.load(std::memory_order_relaxed);
+        for (;;) {
+            // The consumer releases cells in position order, so if the last
+            // cell of the run is free, all the preceding ones are as well.
+            const uint32_t last = pos + needed_cells - 1;
+            const uint32_t sequence = cells[last % cell_count].sequence.load(std::memory_order_acquire);
+            const int32_t diff = static_cast<int32_t>(sequence - last);
+            if (diff < 0) {
+                return false; // ring is full
+            }
+            if (diff > 0) {
+                // Another producer has already claimed past this position.
+                pos = enqueue_pos.load(std::memory_order_relaxed);
+                continue;
+            }
+            if (enqueue_pos.compare_exchange_weak(pos, pos + needed_cells, std::memory_order_relaxed)) {
+                return true;
+            }
+        }
+    }
 
-typedef struct {
-    char *data;
-    size_t read;
-    size_t write;
-} buffer_output_state_t;
+    struct FormatState {
+        char buffer[cell_count * cell_payload];
+        size_t len;
+    };
 
-static void buffer_output(char character, void *arg) {
-    buffer_output_state_t *state = (buffer_output_state_t *)arg;
-    const size_t next = (state->write + 1) % BUFFLOG_BUFFER_SIZE;
-    if (next != state->read) {
-        state->write = next;
-        state->data[state->write] = character;
+    void buffer_output(char character, void *arg) {
+        FormatState *state = static_cast<FormatState *>(arg);
+        if (state->len < sizeof(state->buffer)) {
+            state->buffer[state->len++] = character;
+        }
     }
-}
 
-static char buffer[BUFFLOG_BUFFER_SIZE];
-static buffer_output_state_t buffer_state = {
-    .data = buffer,
-    .read = 0,
-    .write = 0,
-};
+} // namespace
 
 void bufflog_log_event(FormattedEvent *event) {
-    UniqueLock lock { mutex };
+    FormatState state { .buffer = {}, .len = 0 };
+    log_format_simple(event, buffer_output, &state);
+    buffer_output(BUFFLOG_TERMINATION_CHAR, &state);
+    // A truncated event still has to terminate its record.
+    state.buffer[state.len - 1] = BUFFLOG_TERMINATION_CHAR;
+
+    const uint32_t needed_cells = (state.len + cell_payload - 1) / cell_payload;
+    uint32_t pos;
+    if (!claim(needed_cells, pos)) {
+        const uint32_t bucket = static_cast<uint32_t>(event->task_id) % drop_counter_count;
+        drop_counters[bucket].fetch_add(1, std::memory_order_relaxed);
+        return;
+    }
 
-    log_format_simple(event, buffer_output, &buffer_state);
-    buffer_output(BUFFLOG_TERMINATION_CHAR, &buffer_state);
+    const char *src = state.buffer;
+    size_t remaining = state.len;
+    for (uint32_t i = 0; i < needed_cells; ++i) {
+        Cell &cell = cells[(pos + i) % cell_count];
+        const size_t chunk = std::min(remaining, cell_payload);
+        cell.used = chunk;
+        memcpy(cell.data, src, chunk);
+        src += chunk;
+        remaining -= chunk;
+        cell.sequence.store(pos + i + 1, std::memory_order_release);
+    }
 }
 
 size_t bufflog_pickup(char *dest, size_t buffer_size) {
-    UniqueLock lock { mutex };
-
-    const size_t available = (buffer_state.write - buffer_state.read) % BUFFLOG_BUFFER_SIZE;
-    const size_t to_copy = std::min(buffer_size, available);
-
-    // Copy data to buffer - read pos to end
-    const size_t first_part_size = std::min(to_copy, BUFFLOG_BUFFER_SIZE - buffer_state.read);
-    memcpy(dest, buffer + buffer_state.read, first_part_size);
-    // Copy data to buffer - begin to write pos
-    memcpy(dest + first_part_size, buffer, to_copy - first_part_size);
-
-    buffer_state.read = (buffer_state.read + to_copy) % BUFFLOG_BUFFER_SIZE;
+    size_t copied = 0;
+    while (copied < buffer_size) {
+        Cell &cell = cells[dequeue_pos % cell_count];
+        if (cell.sequence.load(std::memory_order_acquire) != dequeue_pos + 1) {
+            break; // next cell not published yet
+        }
+        const size_t chunk = std::min(cell.used - dequeue_offset, buffer_size - copied);
+        memcpy(dest + copied, cell.data + dequeue_offset, chunk);
+        copied += chunk;
+        dequeue_offset += chunk;
+        if (dequeue_offset == cell.used) {
+            // Cell fully drained, hand it back to the producers.
+            cell.sequence.store(dequeue_pos + cell_count, std::memory_order_release);
+            ++dequeue_pos;
+            dequeue_offset = 0;
+        }
+    }
+    return copied;
+}
 
-    return to_copy;
+uint32_t bufflog_dropped_count(TaskId task_id) {
+    return drop_counters[static_cast<uint32_t>(task_id) % drop_counter_count].load(std::memory_order_relaxed);
 }
 
 } // namespace logging
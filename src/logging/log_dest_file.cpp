@@ -3,12 +3,15 @@
 #include <mutex>
 #include <shared_mutex>
 #include <cstring>
+#include <cstdio>
+#include <inttypes.h>
 
 #include <common/freertos_shared_mutex.hpp>
 #include <logging/log_dest_shared.hpp>
 #include <libs/circularqueue.h>
 #include <unique_file_ptr.hpp>
 #include <async_job/async_job.hpp>
+#include <file_list_defs.h>
 
 LOG_COMPONENT_REF(FileSystem);
 
@@ -22,10 +25,21 @@ namespace file {
     };
     static_assert(sizeof(BufferChunk) == 32);
 
+    /// Rotate the log file once it grows past this size; one previous file
+    /// (filepath with ".1" appended) is kept, so the flight recorder never
+    /// eats more than twice this from the flash drive.
+    constexpr long rotation_size = 1024 * 1024;
+
+    /// Stream buffer for the file, so FatFS sees multi-KB writes instead of
+    /// one write per chunk.
+    constexpr size_t file_buffer_size = 4096;
+
     struct Data {
-        AtomicCircularQueue<BufferChunk, uint8_t, 16> buffer;
+        AtomicCircularQueue<BufferChunk, uint8_t, 64> buffer;
         AsyncJob write_job;
         unique_file_ptr file;
+        std::array<char, FILE_PATH_BUFFER_LEN> filepath;
+        long bytes_written = 0;
 
         BufferChunk wip_chunk;
     };
@@ -37,10 +51,40 @@ namespace file {
 
     freertos::SharedMutex mutex(2);
 
+    /// Records lost to a full buffer or a failed/missing file, for the curious.
+    std::atomic<uint32_t> dropped_chunks = 0;
+
 } // namespace file
 
 using namespace file;
 
+static unique_file_ptr open_log_file(const char *filepath, const char *mode, long &bytes_written) {
+    unique_file_ptr file(fopen(filepath, mode));
+    bytes_written = 0;
+    if (file) {
+        setvbuf(file.get(), nullptr, _IOFBF, file_buffer_size);
+        // When appending, the already-present content counts towards rotation.
+        if (fseek(file.get(), 0, SEEK_END) == 0) {
+            bytes_written = ftell(file.get());
+        }
+    }
+    return file;
+}
+
+static void rotate_if_needed() {
+    if (data->bytes_written < rotation_size) {
+        return;
+    }
+
+    // Keep exactly one previous file: <filepath> becomes <filepath>.1
+    std::array<char, FILE_PATH_BUFFER_LEN + 2> rotated;
+    snprintf(rotated.data(), rotated.size(), "%s.1", data->filepath.data());
+    data->file.reset();
+    remove(rotated.data());
+    rename(data->filepath.data(), rotated.data());
+    data->file = open_log_file(data->filepath.data(), "w", data->bytes_written);
+}
+
 static void file_log_write(AsyncJobExecutionControl &) {
     std::shared_lock _gd(mutex);
 
@@ -48,30 +92,49 @@ static void file_log_write(AsyncJobExecutionControl &) {
         return;
     }
 
+    if (!data->file) {
+        // An earlier write failure closed the file. Try to get it back (this
+        // recovers for example a re-inserted flash drive), drop otherwise.
+        data->file = open_log_file(data->filepath.data(), "a", data->bytes_written);
+        if (!data->file) {
+            while (!data->buffer.isEmpty()) {
+                data->buffer.dequeue();
+                dropped_chunks.fetch_add(1, std::memory_order_relaxed);
+            }
+            return;
+        }
+    }
+
     const bool was_overflow = data->buffer.isFull();
 
     while (!data->buffer.isEmpty()) {
         BufferChunk chunk = data->buffer.dequeue();
         fwrite(chunk.data.data(), 1, chunk.size, data->file.get());
+        data->bytes_written += chunk.size;
     }
 
-    // If we fail writing, disable the logger
+    // If we fail writing, degrade to dropping instead of stalling anyone or
+    // turning the logger off; the next flush retries the file.
     if (ferror(data->file.get())) {
-        _gd.unlock();
-        file_log_disable();
+        dropped_chunks.fetch_add(1, std::memory_order_relaxed);
+        data->file.reset();
         return;
     }
 
+    rotate_if_needed();
+
     // Log AFTER draining the buffer - we want this record to be stored in the file as well
     if (was_overflow) {
-        log_warning(FileSystem, "Logging to file: buffer overflow");
+        log_warning(FileSystem, "Logging to file: buffer overflow, %" PRIu32 " chunks dropped so far", dropped_chunks.load(std::memory_order_relaxed));
     }
 }
 
 static void flush_chunk() {
     assert(data->wip_chunk.size <= data->wip_chunk.data.size());
 
-    data->buffer.enqueue(data->wip_chunk);
+    if (!data->buffer.enqueue(data->wip_chunk)) {
+        dropped_chunks.fetch_add(1, std::memory_order_relaxed);
+    }
     data->wip_chunk.size = 0;
 }
 
@@ -116,7 +179,12 @@ bool file_log_enable(const char *filepath) {
         return false;
     }
 
-    d->file.reset(fopen(filepath, "a"));
+    if (strlen(filepath) >= d->filepath.size()) {
+        return false;
+    }
+    strlcpy(d->filepath.data(), filepath, d->filepath.size());
+
+    d->file = open_log_file(filepath, "a", d->bytes_written);
     if (!d->file) {
         return false;
     }
@@ -144,4 +212,8 @@ bool file_log_is_enabled() {
     return is_enabled.load();
 }
 
+uint32_t file_log_dropped_count() {
+    return dropped_chunks.load(std::memory_order_relaxed);
+}
+
 } // namespace logging
@@ -6,7 +6,10 @@
 #include <common/otp.hpp>
 #include <config_store/store_instance.hpp>
 
+#include <algorithm>
 #include <atomic>
+#include <inttypes.h>
+#include <metric.h>
 
 namespace logging {
 
@@ -63,6 +66,39 @@ void syslog_format_event(FormattedEvent *event, void (*out_fn)(char character, v
     fctprintf(out_fn, arg, "<%i>1 - %s %s %s - - %s", priority, hostname.data(), appname, event->component->name, event->message);
 }
 
+// Occupancy of the transport pool (4 messages) at which records of the given
+// severity stop being sent. The important stuff keeps flowing while a slow
+// link sheds the chatter first.
+static uint8_t severity_occupancy_limit(Severity severity) {
+    switch (severity) {
+    case Severity::debug:
+        return 1;
+    case Severity::info:
+        return 2;
+    case Severity::warning:
+        return 3;
+    default:
+        return UINT8_MAX; // error & critical are only ever dropped by the transport itself
+    }
+}
+
+// Records shed by the policy above, indexed by (severity - debug);
+// error and critical records are never shed by it.
+static std::atomic<uint32_t> policy_dropped[3];
+
+METRIC_DEF(metric_syslog_drop, "syslog_drop", METRIC_VALUE_CUSTOM, 1000, METRIC_ENABLED);
+
+/// Publish the occupancy and drop counters, so a fleet dashboard can tell a
+/// quiet printer from a drowning transport.
+static void report_drop_counters(uint8_t occupancy) {
+    metric_record_custom(&metric_syslog_drop, " q=%" PRIu8 "i,d=%" PRIu32 "i,i=%" PRIu32 "i,w=%" PRIu32 "i,t=%" PRIu32 "i",
+        occupancy,
+        policy_dropped[0].load(std::memory_order_relaxed),
+        policy_dropped[1].load(std::memory_order_relaxed),
+        policy_dropped[2].load(std::memory_order_relaxed),
+        SyslogTransport::dropped_count());
+}
+
 void syslog_log_event(FormattedEvent *event) {
     // check that we are not logging from within the LwIP stack
     // as calling LwIP again "from the outside" would cause a deadlock
@@ -70,6 +106,14 @@ void syslog_log_event(FormattedEvent *event) {
         return;
     }
 
+    const uint8_t occupancy = SyslogTransport::queue_occupancy();
+    report_drop_counters(occupancy);
+    if (occupancy >= severity_occupancy_limit(event->severity)) {
+        const size_t bucket = std::min<size_t>(static_cast<size_t>(event->severity) - static_cast<size_t>(Severity::debug), 2);
+        policy_dropped[bucket].fetch_add(1, std::memory_order_relaxed);
+        return;
+    }
+
     // prepare the message
     static char buffer[128];
     buffer_output_state_t buffer_state = {
@@ -0,0 +1,399 @@
+#include <logging/log_record.hpp>
+
+#include <cinttypes>
+#include <cstdio>
+#include <cstring>
+#include <type_traits>
+
+namespace logging {
+
+/// Length byte marking a captured NULL string argument
+static constexpr uint8_t null_string = 0xFF;
+
+bool Record::append(ArgType type, const void *payload, size_t payload_size) {
+    if (used + 1 + payload_size > buffer_size) {
+        return false;
+    }
+    buffer[used++] = static_cast<uint8_t>(type);
+    memcpy(buffer + used, payload, payload_size);
+    used += payload_size;
+    return true;
+}
+
+bool Record::capture(const char *fmt_, va_list args) {
+    fmt = fmt_;
+    used = 0;
+
+    const auto append_signed = [&](intmax_t value) {
+        return append(ArgType::signed_int, &value, sizeof(value));
+    };
+    const auto append_unsigned = [&](uintmax_t value) {
+        return append(ArgType::unsigned_int, &value, sizeof(value));
+    };
+
+    const char *p = fmt_;
+    while (*p) {
+        if (*p++ != '%') {
+            continue;
+        }
+        if (*p == '%') {
+            ++p;
+            continue;
+        }
+
+        // flags
+        while (*p == '-' || *p == '+' || *p == ' ' || *p == '#' || *p == '0') {
+            ++p;
+        }
+        // width
+        if (*p == '*') {
+            if (!append_signed(va_arg(args, int))) {
+                return false;
+            }
+            ++p;
+        } else {
+            while (*p >= '0' && *p <= '9') {
+                ++p;
+            }
+        }
+        // precision
+        if (*p == '.') {
+            ++p;
+            if (*p == '*') {
+                if (!append_signed(va_arg(args, int))) {
+                    return false;
+                }
+                ++p;
+            } else {
+                while (*p >= '0' && *p <= '9') {
+                    ++p;
+                }
+            }
+        }
+        // length modifier
+        enum class Length : uint8_t { none,
+            hh,
+            h,
+            l,
+            ll,
+            z,
+            j,
+            t };
+        Length length = Length::none;
+        switch (*p) {
+        case 'h':
+            ++p;
+            length = (*p == 'h') ? (++p, Length::hh) : Length::h;
+            break;
+        case 'l':
+            ++p;
+            length = (*p == 'l') ? (++p, Length::ll) : Length::l;
+            break;
+        case 'z':
+            ++p;
+            length = Length::z;
+            break;
+        case 'j':
+            ++p;
+            length = Length::j;
+            break;
+        case 't':
+            ++p;
+            length = Length::t;
+            break;
+        case 'L':
+            return false; // long double not supported
+        default:
+            break;
+        }
+
+        const char conversion = *p++;
+        switch (conversion) {
+
+        case 'd':
+        case 'i': {
+            intmax_t value;
+            switch (length) {
+            case Length::l:
+                value = va_arg(args, long);
+                break;
+            case Length::ll:
+                value = va_arg(args, long long);
+                break;
+            case Length::z:
+                value = va_arg(args, std::make_signed_t<size_t>);
+                break;
+            case Length::j:
+                value = va_arg(args, intmax_t);
+                break;
+            case Length::t:
+                value = va_arg(args, ptrdiff_t);
+                break;
+            default: // hh, h and none all promote to int
+                value = va_arg(args, int);
+                break;
+            }
+            if (!append_signed(value)) {
+                return false;
+            }
+            break;
+        }
+
+        case 'u':
+        case 'o':
+        case 'x':
+        case 'X': {
+            uintmax_t value;
+            switch (length) {
+            case Length::l:
+                value = va_arg(args, unsigned long);
+                break;
+            case Length::ll:
+                value = va_arg(args, unsigned long long);
+                break;
+            case Length::z:
+                value = va_arg(args, size_t);
+                break;
+            case Length::j:
+                value = va_arg(args, uintmax_t);
+                break;
+            case Length::t:
+                value = va_arg(args, std::make_unsigned_t<ptrdiff_t>);
+                break;
+            default:
+                value = va_arg(args, unsigned int);
+                break;
+            }
+            if (!append_unsigned(value)) {
+                return false;
+            }
+            break;
+        }
+
+        case 'f':
+        case 'F':
+        case 'e':
+        case 'E':
+        case 'g':
+        case 'G':
+        case 'a':
+        case 'A': {
+            const double value = va_arg(args, double);
+            if (!append(ArgType::floating, &value, sizeof(value))) {
+                return false;
+            }
+            break;
+        }
+
+        case 'c': {
+            if (length != Length::none) {
+                return false; // %lc not supported
+            }
+            const int value = va_arg(args, int);
+            if (!append(ArgType::character, &value, sizeof(value))) {
+                return false;
+            }
+            break;
+        }
+
+        case 's': {
+            if (length != Length::none) {
+                return false; // %ls not supported
+            }
+            const char *value = va_arg(args, const char *);
+            if (value == nullptr) {
+                const uint8_t len = null_string;
+                if (!append(ArgType::string, &len, sizeof(len))) {
+                    return false;
+                }
+                break;
+            }
+            const size_t len = strlen(value);
+            if (len >= null_string || used + 2 + len + 1 > buffer_size) {
+                return false;
+            }
+            buffer[used++] = static_cast<uint8_t>(ArgType::string);
+            buffer[used++] = static_cast<uint8_t>(len);
+            memcpy(buffer + used, value, len + 1);
+            used += len + 1;
+            break;
+        }
+
+        case 'p': {
+            void *value = va_arg(args, void *);
+            if (!append(ArgType::pointer, &value, sizeof(value))) {
+                return false;
+            }
+            break;
+        }
+
+        default:
+            // %n, wide characters, malformed or unknown conversions
+            return false;
+        }
+    }
+    return true;
+}
+
+void Record::render(char *out, size_t out_size) const {
+    if (out_size == 0) {
+        return;
+    }
+
+    size_t out_pos = 0;
+    size_t read_pos = 0;
+    const char *p = fmt;
+
+    const auto read_value = [&](auto &value) {
+        memcpy(&value, buffer + read_pos, sizeof(value));
+        read_pos += sizeof(value);
+    };
+
+    while (*p && out_pos + 1 < out_size) {
+        if (*p != '%') {
+            out[out_pos++] = *p++;
+            continue;
+        }
+        ++p;
+        if (*p == '%') {
+            out[out_pos++] = '%';
+            ++p;
+            continue;
+        }
+
+        // Rebuild the conversion spec; the length modifier is replaced with
+        // 'j' for integer conversions, as values were widened on capture.
+        char spec[24];
+        size_t spec_len = 0;
+        spec[spec_len++] = '%';
+        int star_count = 0;
+        int star_values[2] = { 0, 0 };
+
+        const auto read_star = [&]() {
+            ++read_pos; // type byte, always ArgType::signed_int
+            intmax_t value;
+            read_value(value);
+            star_values[star_count++] = static_cast<int>(value);
+        };
+        // room for 'j', the conversion character and the terminating NUL
+        const auto push_spec = [&](char c) {
+            if (spec_len < sizeof(spec) - 3) {
+                spec[spec_len++] = c;
+            }
+        };
+
+        while (*p == '-' || *p == '+' || *p == ' ' || *p == '#' || *p == '0') {
+            push_spec(*p++);
+        }
+        if (*p == '*') {
+            push_spec(*p++);
+            read_star();
+        } else {
+            while (*p >= '0' && *p <= '9') {
+                push_spec(*p++);
+            }
+        }
+        if (*p == '.') {
+            push_spec(*p++);
+            if (*p == '*') {
+                push_spec(*p++);
+                read_star();
+            } else {
+                while (*p >= '0' && *p <= '9') {
+                    push_spec(*p++);
+                }
+            }
+        }
+        while (*p == 'h' || *p == 'l' || *p == 'z' || *p == 'j' || *p == 't') {
+            ++p; // captured values are already widened
+        }
+
+        const char conversion = *p++;
+        switch (conversion) {
+        case 'd':
+        case 'i':
+        case 'u':
+        case 'o':
+        case 'x':
+        case 'X':
+            spec[spec_len++] = 'j';
+            break;
+        default:
+            break;
+        }
+        spec[spec_len++] = conversion;
+        spec[spec_len] = '\0';
+
+        char *dst = out + out_pos;
+        const size_t remaining = out_size - out_pos;
+        const auto emit = [&](auto value) -> int {
+            switch (star_count) {
+            case 1:
+                return snprintf(dst, remaining, spec, star_values[0], value);
+            case 2:
+                return snprintf(dst, remaining, spec, star_values[0], star_values[1], value);
+            default:
+                return snprintf(dst, remaining, spec, value);
+            }
+        };
+
+        const ArgType type = static_cast<ArgType>(buffer[read_pos++]);
+        int written = 0;
+        switch (type) {
+        case ArgType::signed_int: {
+            intmax_t value;
+            read_value(value);
+            written = emit(value);
+            break;
+        }
+        case ArgType::unsigned_int: {
+            uintmax_t value;
+            read_value(value);
+            written = emit(value);
+            break;
+        }
+        case ArgType::floating: {
+            double value;
+            read_value(value);
+            written = emit(value);
+            break;
+        }
+        case ArgType::character: {
+            int value;
+            read_value(value);
+            written = emit(value);
+            break;
+        }
+        case ArgType::string: {
+            const uint8_t len = buffer[read_pos++];
+            const char *value;
+            if (len == null_string) {
+                value = "(null)";
+            } else {
+                value = reinterpret_cast<const char *>(buffer + read_pos);
+                read_pos += len + 1;
+            }
+            written = emit(value);
+            break;
+        }
+        case ArgType::pointer: {
+            void *value;
+            read_value(value);
+            written = emit(value);
+            break;
+        }
+        }
+
+        if (written < 0) {
+            break;
+        }
+        if (static_cast<size_t>(written) >= remaining) {
+            out_pos = out_size - 1;
+            break;
+        }
+        out_pos += written;
+    }
+    out[out_pos] = '\0';
+}
+
+} // namespace logging
@@ -5,6 +5,7 @@
 #include <cmsis_os.h>
 #include <cstdio>
 #include <cstdlib>
+#include <tuple>
 
 namespace logging {
 
@@ -32,11 +33,26 @@ void Task::run() {
         QueueItem item;
         queue.receive(item);
 
+        std::array<char, MESSAGE_MAX_SIZE> message;
+
+        if (item.type == QueueItem::Type::deferred) {
+            // Self-contained binary record, the sender is long gone.
+            item.deferred.record.render(message.data(), message.size());
+            FormattedEvent formatted_event {
+                .timestamp = item.deferred.timestamp,
+                .task_id = item.deferred.task_id,
+                .component = item.deferred.component,
+                .severity = item.deferred.severity,
+                .message = message.data(),
+            };
+            log_task_process_event(&formatted_event);
+            continue;
+        }
+
         // Format message as soon as possible to unblock semaphore holder.
         // Also, formats the string only once.
         // Also, saves stack by not requiring every task to have a buffer.
-        Event *event = item.event;
-        std::array<char, MESSAGE_MAX_SIZE> message;
+        Event *event = item.blocking.event;
         vsnprintf(message.data(), message.size(), event->fmt, *event->args);
         FormattedEvent formatted_event {
             .timestamp = event->timestamp, // OK to copy value
@@ -45,7 +61,7 @@ void Task::run() {
             .severity = event->severity, // OK to copy value
             .message = message.data(), // OK to copy const* to local variable of this task, we will be blocking before it goes out of scope
         };
-        item.semaphore->release(); // unblock, we no longer need anything from the event
+        item.blocking.semaphore->release(); // unblock, we no longer need anything from the event
 
         // Proceed with (potentially blocking) event processing.
         log_task_process_event(&formatted_event);
@@ -67,11 +83,36 @@ void Task::send(Event *event) {
         // FIXME: But perhaps we can at least log via RTT in such case.
         return;
     }
+    {
+        // Preferred path: capture the format string pointer and raw arguments
+        // into a self-contained binary record and return without waiting for
+        // the formatting at all. Works even from the logging task itself.
+        QueueItem item;
+        item.type = QueueItem::Type::deferred;
+        va_list args_copy;
+        va_copy(args_copy, *event->args);
+        const bool captured = item.deferred.record.capture(event->fmt, args_copy);
+        va_end(args_copy);
+        if (captured) {
+            item.deferred.timestamp = event->timestamp;
+            item.deferred.task_id = event->task_id;
+            item.deferred.component = event->component;
+            item.deferred.severity = event->severity;
+            // We can't afford to block here, it might lead to deadlock.
+            // Try waiting a bit and then just discard the message; never wait
+            // when called from the logging task itself - it is the consumer.
+            const bool from_log_task = xTaskGetCurrentTaskHandle() == task_handle;
+            std::ignore = queue.try_send(item, from_log_task ? 0 : 10);
+            return;
+        }
+    }
+
+    // Fallback for format strings the record capturer does not support:
+    // pass pointers into our stack and block until the logging task is done
+    // formatting.
     if (xTaskGetCurrentTaskHandle() == task_handle) {
-        // FIXME: For now, we do not support logging from the logging thread.
-        //        In order to support that, we would have to support non-blocking
-        //        insertion to the queue, which would in turn require solving the
-        //        lifetime issues. We would also need to disable the semaphore.
+        // FIXME: For now, we do not support blocking logging from the logging
+        //        thread; it would deadlock waiting for itself.
         return;
     }
     if (task_handle == nullptr) {
@@ -82,10 +123,10 @@ void Task::send(Event *event) {
     }
 
     freertos::BinarySemaphore semaphore;
-    QueueItem item {
-        .event = event,
-        .semaphore = &semaphore,
-    };
+    QueueItem item;
+    item.type = QueueItem::Type::blocking;
+    item.blocking.event = event;
+    item.blocking.semaphore = &semaphore;
     // We can't afford to block here, it might lead to deadlock. Try waiting
     // a bit and then just discard the message.
     if (queue.try_send(item, 10)) {
@@ -266,6 +266,8 @@ private:
 #endif // PRINTER_IS_PRUSA_MK3_5() && HAS_SWITCHED_FAN_TEST()
 
     void reset_fan_result() {
+        // batch the result resets into one journal transaction
+        auto transaction = config_store().get_backend().transaction_guard();
         SelftestResult result = config_store().selftest_result.get();
         for (auto &tool : result.tools) {
             tool.printFan = TestResult_Unknown;
@@ -303,6 +305,8 @@ private:
 
     bool save_selftest_results() {
         bool failed = false;
+        // batch the per-fan results into one journal transaction
+        auto transaction = config_store().get_backend().transaction_guard();
         SelftestResult result = config_store().selftest_result.get();
         for (auto *fan : fans) {
             switch (fan->get_type()) {
@@ -93,6 +93,41 @@ void PrusaGcodeSuite::M333() {
     }
 }
 
+/**
+ *### M335: Set metric sampling
+ *
+ *#### Usage
+ *
+ *    M335 [ <metric> <keep_1_of> [<min_interval_ms>] ]
+ *
+ *#### Parameters
+ *
+ * - `<metric>` - Metric to configure
+ * - `<keep_1_of>` - Decimation; keep only one of every `keep_1_of` recorded points (1 keeps all)
+ * - `<min_interval_ms>` - Minimal interval between sent points in ms (omit to keep the current one)
+ *
+ * The setting is persisted and survives reboots.
+ */
+
+void PrusaGcodeSuite::M335() {
+    char name[32] = "";
+    unsigned keep_1_of = 1;
+    int min_interval_ms = -1;
+    const int scanned_fields = sscanf(parser.string_arg, "%31s %u %i", name, &keep_1_of, &min_interval_ms);
+    if (scanned_fields < 2) {
+        SERIAL_ERROR_MSG("Usage: M335 <metric> <keep_1_of> [<min_interval_ms>]");
+        return;
+    }
+
+    if (metrics_set_sampling(name, keep_1_of, min_interval_ms)) {
+        SERIAL_ECHO_START();
+        SERIAL_ECHOLNPAIR_F("Metric sampling set: ", name);
+    } else {
+        SERIAL_ERROR_START();
+        SERIAL_ECHOLNPAIR("Metric not found (or overrides full): ", name);
+    }
+}
+
 /**
  *### M334: Metrics & syslog configuration <a href="https://reprap.org/wiki/G-code#M334:_Metrics_.26_syslog_configuration">M334: Metrics & syslog configuration</a>
  *
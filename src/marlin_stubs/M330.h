@@ -11,6 +11,7 @@ void M331(); //< enable metric
 void M332(); //< disable metric
 void M333(); //< print metrics and their settings
 void M334(); //< configure metrics & syslog
+void M335(); //< set metric sampling (decimation & min interval)
 /// @}
 
 /// Prompts the user about metrics configuration change.
@@ -0,0 +1,26 @@
+#include "PrusaGcodeSuite.hpp"
+
+#include <marlin_server.hpp>
+
+/** \addtogroup G-Codes
+ * @{
+ */
+
+/**
+ *### M9160: Dump marlin_server cycle time accounting
+ *
+ * Internal GCode
+ *
+ *#### Usage
+ *
+ *    M9160
+ *
+ * Prints how much time the server loop has spent in each of its sections
+ * since boot. Useful to find out which section eats the loop when a
+ * machine stutters.
+ */
+void PrusaGcodeSuite::M9160() {
+    marlin_server::dump_cycle_time_accounting();
+}
+
+/** @}*/
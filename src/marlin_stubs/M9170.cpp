@@ -0,0 +1,32 @@
+#include "PrusaGcodeSuite.hpp"
+
+#include <gcode/gcode.h>
+#include <HAL/HAL_STM32_F4_F7/timers.h>
+
+/** \addtogroup G-Codes
+ * @{
+ */
+
+/**
+ *### M9170: Toggle SystemView tracing of the motion timer ISRs
+ *
+ * Internal GCode
+ *
+ *#### Usage
+ *
+ *    M9170 [ S ]
+ *
+ *#### Parameters
+ *
+ * - `S` - 1 to emit SystemView tracepoints from the step/move/temp timer
+ *         ISRs, 0 (default) to keep them silent
+ *
+ * The rest of the interrupts and the FreeRTOS scheduler are traced whenever
+ * a SystemView capture runs; these three fire too often for that, so they
+ * have to be opted in for the capture session.
+ */
+void PrusaGcodeSuite::M9170() {
+    hal_timer_sysview_trace = parser.byteval('S', 0) != 0;
+}
+
+/** @}*/
@@ -137,6 +137,10 @@ void M1978(); //< Fan Selftest
 void M9140(); //< Set normal (non-stealth) mode
 void M9150(); //< Set stealth mode
 
+void M9160(); //< Dump marlin_server cycle time accounting
+
+void M9170(); //< Toggle SystemView tracing of the motion timer ISRs
+
 void M9200(); //< Re-load IS settings from config store
 void M9201(); //< Reset to default motion parameters (accelerations, feedrates, ...)
 
@@ -33,6 +33,10 @@
 
 #include <logging/log.hpp>
 
+#include <algorithm>
+#include <limits>
+#include <utility>
+
 LOG_COMPONENT_DEF(PRUSA_GCODE, logging::Severity::info);
 
 static void record_pre_gcode_metrics();
@@ -41,290 +45,166 @@ int8_t PrusaGcodeSuite::get_target_extruder_from_command(const GCodeParser2 &p)
     return GcodeSuite::get_target_extruder_from_option_value(p.option<uint8_t>('T'));
 }
 
-bool GcodeSuite::process_parsed_command_custom(bool no_ok) {
-    record_pre_gcode_metrics();
-    bool processed = true;
+namespace {
 
-    switch (parser.command_letter) {
-    case 'M':
-        switch (parser.codenum) {
-        case 0:
-            PrusaGcodeSuite::M0();
-            break;
+/// Returns whether the command was processed; unprocessed commands fall
+/// through to the standard Marlin handlers
+using GcodeHandler = bool (*)();
 
-        case 104:
-            switch (parser.subcode) {
+/// Adapts the common case - a handler that always consumes the command
+template <void (*handler)()>
+bool run() {
+    handler();
+    return true;
+}
 
-            case 1:
-                PrusaGcodeSuite::M104_1();
-                break;
+/// Entries with this subcode match the command regardless of its subcode
+constexpr int16_t any_subcode = -1;
 
-            default:
-                processed = false;
-                break;
-            }
-            break;
+struct GcodeDispatchEntry {
+    char letter; ///< G/M/P
+    uint16_t codenum;
+    int16_t subcode; ///< specific subcode or any_subcode
+    GcodeHandler handler;
 
-        case 123:
-            PrusaGcodeSuite::M123();
-            break;
+    constexpr uint32_t key() const {
+        return (static_cast<uint32_t>(letter) << 16) | codenum;
+    }
+};
 
-#if HAS_CHAMBER_API()
-        case 141:
-            PrusaGcodeSuite::M141();
-            break;
+/// Dispatch table for the Prusa-specific part of the g-code suite,
+/// sorted by (letter, codenum, subcode) and binary-searched on lookup.
+/// The static_assert below catches entries added out of order.
+constexpr GcodeDispatchEntry prusa_dispatch_table[] = {
+#if HAS_NOZZLE_CLEANER()
+    { 'G', 12, any_subcode, run<PrusaGcodeSuite::G12> },
 #endif
+    { 'G', 26, any_subcode, run<PrusaGcodeSuite::G26> },
+    { 'G', 64, any_subcode, run<PrusaGcodeSuite::G64> },
+    { 'G', 123, any_subcode, run<PrusaGcodeSuite::G123> },
+    { 'G', 162, any_subcode, run<PrusaGcodeSuite::G162> },
+    { 'G', 163, any_subcode, run<PrusaGcodeSuite::G163> },
 
+    { 'M', 0, any_subcode, run<PrusaGcodeSuite::M0> },
+    { 'M', 104, 1, run<PrusaGcodeSuite::M104_1> },
+    { 'M', 123, any_subcode, run<PrusaGcodeSuite::M123> },
+#if HAS_CHAMBER_API()
+    { 'M', 141, any_subcode, run<PrusaGcodeSuite::M141> },
+#endif
 #if HAS_LEDS()
-        case 150:
-            PrusaGcodeSuite::M150();
-            break;
+    { 'M', 150, any_subcode, run<PrusaGcodeSuite::M150> },
 #endif
 #if HAS_SIDE_LEDS()
-        case 151:
-            PrusaGcodeSuite::M151();
-            break;
+    { 'M', 151, any_subcode, run<PrusaGcodeSuite::M151> },
 #endif
-
 #if HAS_CHAMBER_API()
-        case 191:
-            PrusaGcodeSuite::M191();
-            break;
+    { 'M', 191, any_subcode, run<PrusaGcodeSuite::M191> },
 #endif
-
 #if HAS_I2C_EXPANDER()
-        case 262:
-            PrusaGcodeSuite::M262();
-            break;
-        case 263:
-            PrusaGcodeSuite::M263();
-            break;
-        case 264:
-            PrusaGcodeSuite::M264();
-            break;
-        case 265:
-            PrusaGcodeSuite::M265();
-            break;
-        case 267:
-            PrusaGcodeSuite::M267();
-            break;
-        case 268:
-            PrusaGcodeSuite::M268();
-            break;
+    { 'M', 262, any_subcode, run<PrusaGcodeSuite::M262> },
+    { 'M', 263, any_subcode, run<PrusaGcodeSuite::M263> },
+    { 'M', 264, any_subcode, run<PrusaGcodeSuite::M264> },
+    { 'M', 265, any_subcode, run<PrusaGcodeSuite::M265> },
+    { 'M', 267, any_subcode, run<PrusaGcodeSuite::M267> },
+    { 'M', 268, any_subcode, run<PrusaGcodeSuite::M268> },
 #endif // HAS_I2C_EXPANDER()
-        case 300:
-            PrusaGcodeSuite::M300();
-            break;
-        case 330:
-            // Metrics handler selection deprecated. We only really have one handler. Let's not pretend otherwise.
-            // BFW-5464
-            break;
-        case 331:
-            PrusaGcodeSuite::M331();
-            break;
-        case 332:
-            PrusaGcodeSuite::M332();
-            break;
-        case 333:
-            PrusaGcodeSuite::M333();
-            break;
-        case 334:
-            PrusaGcodeSuite::M334();
-            break;
-        case 340:
-            PrusaGcodeSuite::M340();
-            break;
-        // case 505: // deprecated
-        //     PrusaGcodeSuite::M505();
-        //     break;
-        case 591:
-            PrusaGcodeSuite::M591();
-            break;
-        case 704:
-            PrusaGcodeSuite::M704();
-            break;
-        case 1704:
-            PrusaGcodeSuite::M1704();
-            break;
-        case 705:
-            PrusaGcodeSuite::M705();
-            break;
-        case 706:
-            PrusaGcodeSuite::M706();
-            break;
-        case 707:
-            PrusaGcodeSuite::M707();
-            break;
-        case 708:
-            PrusaGcodeSuite::M708();
-            break;
-        case 709:
-            PrusaGcodeSuite::M709();
-            break;
+    { 'M', 300, any_subcode, run<PrusaGcodeSuite::M300> },
+    // Metrics handler selection deprecated. We only really have one handler. Let's not pretend otherwise.
+    // BFW-5464
+    { 'M', 330, any_subcode, +[] { return true; } },
+    { 'M', 331, any_subcode, run<PrusaGcodeSuite::M331> },
+    { 'M', 332, any_subcode, run<PrusaGcodeSuite::M332> },
+    { 'M', 333, any_subcode, run<PrusaGcodeSuite::M333> },
+    { 'M', 334, any_subcode, run<PrusaGcodeSuite::M334> },
+    { 'M', 335, any_subcode, run<PrusaGcodeSuite::M335> },
+    { 'M', 340, any_subcode, run<PrusaGcodeSuite::M340> },
+    // M505 deprecated
+    { 'M', 591, any_subcode, run<PrusaGcodeSuite::M591> },
+    { 'M', 704, any_subcode, run<PrusaGcodeSuite::M704> },
+    { 'M', 705, any_subcode, run<PrusaGcodeSuite::M705> },
+    { 'M', 706, any_subcode, run<PrusaGcodeSuite::M706> },
+    { 'M', 707, any_subcode, run<PrusaGcodeSuite::M707> },
+    { 'M', 708, any_subcode, run<PrusaGcodeSuite::M708> },
+    { 'M', 709, any_subcode, run<PrusaGcodeSuite::M709> },
 #ifdef PRINT_CHECKING_Q_CMDS
-        case 862:
-            switch (parser.subcode) {
-            case 1:
-                PrusaGcodeSuite::M862_1();
-                break;
-            case 2:
-                PrusaGcodeSuite::M862_2();
-                break;
-            case 3:
-                PrusaGcodeSuite::M862_3();
-                break;
-            case 4:
-                PrusaGcodeSuite::M862_4();
-                break;
-            case 5:
-                PrusaGcodeSuite::M862_5();
-                break;
-            case 6:
-                PrusaGcodeSuite::M862_6();
-                break;
-            default:
-                processed = false;
-            }
-            break;
+    { 'M', 862, 1, run<PrusaGcodeSuite::M862_1> },
+    { 'M', 862, 2, run<PrusaGcodeSuite::M862_2> },
+    { 'M', 862, 3, run<PrusaGcodeSuite::M862_3> },
+    { 'M', 862, 4, run<PrusaGcodeSuite::M862_4> },
+    { 'M', 862, 5, run<PrusaGcodeSuite::M862_5> },
+    { 'M', 862, 6, run<PrusaGcodeSuite::M862_6> },
 #endif
-
 #if ENABLED(PRUSA_TOOL_MAPPING)
-        case 863:
-            PrusaGcodeSuite::M863();
-            break;
+    { 'M', 863, any_subcode, run<PrusaGcodeSuite::M863> },
 #endif
 #if ENABLED(PRUSA_SPOOL_JOIN)
-        case 864:
-            PrusaGcodeSuite::M864();
-            break;
+    { 'M', 864, any_subcode, run<PrusaGcodeSuite::M864> },
 #endif
-        case 865:
-            PrusaGcodeSuite::M865();
-            break;
-
-        case 919:
-            PrusaGcodeSuite::M919();
-            break;
-        case 920:
-            PrusaGcodeSuite::M920();
-            break;
+    { 'M', 865, any_subcode, run<PrusaGcodeSuite::M865> },
+    { 'M', 919, any_subcode, run<PrusaGcodeSuite::M919> },
+    { 'M', 920, any_subcode, run<PrusaGcodeSuite::M920> },
 #if HAS_BELT_TUNING()
-        case 960:
-            PrusaGcodeSuite::M960();
-            break;
-#endif
-        case 997:
-            PrusaGcodeSuite::M997();
-            break;
-        case 999:
-            if (parser.seen('R')) {
-                PrusaGcodeSuite::M999();
-                break;
-            } else {
-                processed = false;
-                break;
-            }
+    { 'M', 960, any_subcode, run<PrusaGcodeSuite::M960> },
+#endif
+    { 'M', 997, any_subcode, run<PrusaGcodeSuite::M997> },
+    { 'M', 999, any_subcode, +[] {
+         if (!parser.seen('R')) {
+             return false;
+         }
+         PrusaGcodeSuite::M999();
+         return true;
+     } },
 #if BUDDY_ENABLE_CONNECT()
-        case 1200:
-            PrusaGcodeSuite::M1200();
-            break;
+    { 'M', 1200, any_subcode, run<PrusaGcodeSuite::M1200> },
 #endif // BUDDY_ENABLE_CONNECT()
-        case 1600:
-            PrusaGcodeSuite::M1600();
-            break;
-        case 1601:
-            PrusaGcodeSuite::M1601();
-            break;
-
-        case 1700:
-            PrusaGcodeSuite::M1700();
-            break;
-        case 1701:
-            PrusaGcodeSuite::M1701();
-            break;
-        case 1702:
-            PrusaGcodeSuite::M1702();
-            break;
-        case 1703:
-            PrusaGcodeSuite::M1703();
-            break;
-
+    { 'M', 1600, any_subcode, run<PrusaGcodeSuite::M1600> },
+    { 'M', 1601, any_subcode, run<PrusaGcodeSuite::M1601> },
+    { 'M', 1700, any_subcode, run<PrusaGcodeSuite::M1700> },
+    { 'M', 1701, any_subcode, run<PrusaGcodeSuite::M1701> },
+    { 'M', 1702, any_subcode, run<PrusaGcodeSuite::M1702> },
+    { 'M', 1703, any_subcode, run<PrusaGcodeSuite::M1703> },
+    { 'M', 1704, any_subcode, run<PrusaGcodeSuite::M1704> },
 #if HAS_INPUT_SHAPER_CALIBRATION()
-        case 1959:
-            PrusaGcodeSuite::M1959();
-            break;
+    { 'M', 1959, any_subcode, run<PrusaGcodeSuite::M1959> },
 #endif
-
 #if HAS_PHASE_STEPPING()
-        case 1977:
-            PrusaGcodeSuite::M1977();
-            break;
+    { 'M', 1977, any_subcode, run<PrusaGcodeSuite::M1977> },
 #endif
-        case 1978:
-            PrusaGcodeSuite::M1978();
-            break;
-        case 9140:
-            PrusaGcodeSuite::M9140();
-            break;
-        case 9150:
-            PrusaGcodeSuite::M9150();
-            break;
+    { 'M', 1978, any_subcode, run<PrusaGcodeSuite::M1978> },
+    { 'M', 9140, any_subcode, run<PrusaGcodeSuite::M9140> },
+    { 'M', 9150, any_subcode, run<PrusaGcodeSuite::M9150> },
+    { 'M', 9160, any_subcode, run<PrusaGcodeSuite::M9160> },
+    { 'M', 9170, any_subcode, run<PrusaGcodeSuite::M9170> },
+    { 'M', 9200, any_subcode, run<PrusaGcodeSuite::M9200> },
+    { 'M', 9201, any_subcode, run<PrusaGcodeSuite::M9201> },
 
-        case 9200:
-            PrusaGcodeSuite::M9200();
-            break;
+#if HAS_TOOLCHANGER()
+    { 'P', 0, any_subcode, run<PrusaGcodeSuite::P0> },
+#endif
+};
 
-        case 9201:
-            PrusaGcodeSuite::M9201();
-            break;
+static_assert(std::ranges::is_sorted(prusa_dispatch_table, {}, [](const GcodeDispatchEntry &e) { return std::make_pair(e.key(), e.subcode); }),
+    "binary search needs the table sorted by letter/codenum/subcode");
 
-        default:
-            processed = false;
-            break;
-        }
-        break;
-    case 'G':
-        switch (parser.codenum) {
-#if HAS_NOZZLE_CLEANER()
-        case 12:
-            PrusaGcodeSuite::G12();
-            break;
-#endif
-        case 26:
-            PrusaGcodeSuite::G26();
-            break;
-        case 123:
-            PrusaGcodeSuite::G123();
-            break;
-        case 64:
-            PrusaGcodeSuite::G64();
-            break;
-        case 162:
-            PrusaGcodeSuite::G162();
-            break;
-        case 163:
-            PrusaGcodeSuite::G163();
-            break;
-        default:
-            processed = false;
-            break;
-        }
-        break;
-#if HAS_TOOLCHANGER()
-    case 'P':
-        switch (parser.codenum) {
-        case 0:
-            PrusaGcodeSuite::P0();
-            break;
-        default:
-            processed = false;
-            break;
+} // namespace
+
+bool GcodeSuite::process_parsed_command_custom(bool no_ok) {
+    record_pre_gcode_metrics();
+
+    bool processed = false;
+
+    if (parser.codenum >= 0 && parser.codenum <= std::numeric_limits<uint16_t>::max()) {
+        const uint32_t key = (static_cast<uint32_t>(parser.command_letter) << 16) | static_cast<uint32_t>(parser.codenum);
+
+        // commands with handled subcodes have one entry per subcode, so the
+        // equal range is scanned for a match; for everything else it has at
+        // most one element
+        for (const GcodeDispatchEntry &entry : std::ranges::equal_range(prusa_dispatch_table, key, {}, &GcodeDispatchEntry::key)) {
+            if (entry.subcode == any_subcode || entry.subcode == parser.subcode) {
+                processed = entry.handler();
+                break;
+            }
         }
-        break;
-#endif
-    default:
-        processed = false;
-        break;
     }
 
     if (processed && !no_ok) {
@@ -6,6 +6,7 @@
 #include "config_features.h"
 #include "../PrusaGcodeSuite.hpp"
 #include "../../../lib/Marlin/Marlin/src/gcode/gcode.h"
+#include "../../../lib/Marlin/Marlin/src/module/motion.h"
 #include "M70X.hpp"
 
 /** \addtogroup G-Codes
@@ -129,3 +130,7 @@ void PrusaGcodeSuite::M1600() {
 }
 
 /** @}*/
+
+void filament_gcodes::M1701_autoload() {
+    M1701_no_parser(std::abs(FILAMENT_CHANGE_FAST_LOAD_LENGTH), Z_AXIS_LOAD_POS, active_extruder);
+}
@@ -5,8 +5,8 @@
 
 #include "../../lib/Marlin/Marlin/src/feature/prusa/MMU2/mmu2_serial.h"
 #include "../../lib/Marlin/Marlin/src/feature/prusa/MMU2/mmu2_bootloader_result.h"
-#include "mmu2_bootloader_coroutine.hpp"
-#include "mmu2_bootloader_memory_resource.hpp"
+#include <common/coro/task.hpp>
+#include <common/coro/stack_memory_resource.hpp>
 
 namespace MMU2 {
 
@@ -14,7 +14,7 @@ namespace MMU2 {
 /// Checks for firmware version, does firmware updates, and such.
 class MMU2BootloaderManager final {
     template <typename T>
-    using Task = bootloader::Task<T>;
+    using Task = coro::Task<T>;
 
 public:
     MMU2BootloaderManager(MMU2Serial &serial);
@@ -53,7 +53,7 @@ public:
 public:
     /// Memory resource (allocator/deallocator) for coroutine frames
     /// This is to prevent coroutines dynamic allocation
-    bootloader::StaticStackMemoryResource<320> co_memory_resource;
+    coro::StaticStackMemoryResource<320> co_memory_resource;
 
 private:
     /// Handle of the coroutine handling the comm
@@ -1 +0,0 @@
-#include "mmu2_bootloader_coroutine.hpp"
@@ -203,6 +203,12 @@ void Backend::load_version_migrated_data(const UpdateFunction &update_function)
 }
 
 void Backend::load_all(const UpdateFunction &update_function, std::span<const MigrationFunction> migration_functions) {
+    const uint32_t start_us = ticks_us();
+    do_load_all(update_function, migration_functions);
+    load_duration_us = ticks_us() - start_us;
+}
+
+void Backend::do_load_all(const UpdateFunction &update_function, std::span<const MigrationFunction> migration_functions) {
     auto l = lock();
 
     const auto [primary_bank, primary_address, secondary_header, secondary_address] = [this]() {
@@ -280,9 +286,27 @@ void Backend::load_all(const UpdateFunction &update_function, std::span<const Mi
     }
     // load extra transactions that were a result of migration functions from the next bank
 
-    if (migrated || num_of_transactions > 1) {
+    if (migrated) {
         migrate_bank();
+    } else if (num_of_transactions > 1) {
+        // The bank is only fragmented, not broken - leave the compaction to
+        // compact_if_needed() so a config-churned journal does not slow boot
+        compaction_pending = true;
+    }
+}
+
+void Backend::compact_if_needed() {
+    auto l = lock();
+
+    // Proactively migrate when the bank is nearly full as well - better here,
+    // on a background task, than in whichever save() would overflow the bank
+    const bool nearly_full = transactions_since_migration > 0 && get_free_space_in_current_bank() < bank_size / 4;
+
+    if (!compaction_pending && !nearly_full) {
+        return;
     }
+
+    migrate_bank();
 }
 std::optional<Backend::BanksState> Backend::choose_bank() const {
     std::array<uint8_t, BANK_HEADER_SIZE_WITH_CRC> bank_header_buffer {};
@@ -388,6 +412,10 @@ void Backend::init_bank(const Backend::BankSelector selector, Backend::BankSeque
     }
 }
 
+uint32_t Backend::get_load_duration_us() const {
+    return load_duration_us;
+}
+
 auto Backend::get_journal_state() const -> JournalState {
     return journal_state;
 }
@@ -433,6 +461,7 @@ void Backend::store_single_item(uint16_t id, const std::span<const uint8_t> &dat
 
     current_address += write_item(current_address, header, data, crc);
     write_end_item(current_address);
+    transactions_since_migration++;
 }
 Backend::Address Backend::get_next_bank_start_address() const {
     if (current_address > start_address && current_address < start_address + bank_size) {
@@ -449,10 +478,20 @@ void Backend::migrate_bank() {
         auto guard = bank_migration_guard();
         dump_callback();
     }
+
+    compaction_pending = false;
+    transactions_since_migration = 0;
 }
 void Backend::transaction_start() {
     if (transaction.has_value()) {
-        bsod("Starting transaction while transaction is running");
+        if (transaction->type != Transaction::Type::transaction) {
+            bsod("Starting transaction while transaction is running");
+        }
+        // A transaction is already open - join it. This lets helper functions
+        // guard their own write bursts while a broader flow (wizard, settings
+        // sync) batches everything into a single journal record.
+        ++transaction_nesting;
+        return;
     }
     transaction.emplace(Transaction::Type::transaction, *this);
 }
@@ -461,6 +500,11 @@ void Backend::transaction_end() {
     if (!transaction.has_value()) {
         bsod("Transaction is not in progress");
     }
+    if (transaction_nesting > 0) {
+        // an outer guard still owns the transaction, it will commit it
+        --transaction_nesting;
+        return;
+    }
     transaction.reset();
 }
 
@@ -483,6 +527,19 @@ auto Backend::version_migration_guard() -> VersionMigratingTransactionGuard {
     return VersionMigratingTransactionGuard(*this);
 }
 
+void Backend::ram_mirror_write_start() {
+    ram_mirror_seq.fetch_add(1, std::memory_order_relaxed); // sequence is odd from now on
+    std::atomic_thread_fence(std::memory_order_release);
+}
+
+void Backend::ram_mirror_write_end() {
+    ram_mirror_seq.fetch_add(1, std::memory_order_release);
+}
+
+auto Backend::ram_mirror_write_guard() -> RamMirrorWriteGuard {
+    return RamMirrorWriteGuard(*this);
+}
+
 void Backend::erase_storage_area() {
     storage.erase_area(start_address, start_address + bank_size * 2);
 }
@@ -587,6 +644,10 @@ Backend::Transaction::~Transaction() {
     current_address += CRC_SIZE;
 
     backend.write_end_item(current_address);
+
+    if (type == Type::transaction) {
+        backend.transactions_since_migration++;
+    }
 }
 
 void Backend::Transaction::calculate_crc(Backend::Id id, const std::span<const uint8_t> &data) {
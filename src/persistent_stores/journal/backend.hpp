@@ -16,6 +16,7 @@
 #include <memory>
 #include <storage_drivers/storage.hpp>
 #include <assert.h>
+#include <atomic>
 #include <type_traits>
 
 namespace journal {
@@ -246,8 +247,15 @@ public:
     using VersionMigratingTransactionGuard = TransactionRAII<&Backend::version_migration_start, &Backend::version_migration_end>;
     VersionMigratingTransactionGuard version_migration_guard();
 
+    void ram_mirror_write_start();
+    void ram_mirror_write_end();
+
     std::optional<Transaction> transaction = std::nullopt;
     std::optional<Transaction> bank_migration = std::nullopt;
+    uint8_t transaction_nesting = 0; ///< Number of transaction guards nested inside the outermost one
+    std::atomic<uint32_t> ram_mirror_seq { 0 }; ///< Seqlock generation of the item RAM mirror; odd while a write is in flight
+    bool compaction_pending = false; ///< load_all() found a fragmented bank and left the compaction for later
+    uint16_t transactions_since_migration = 0; ///< Transactions committed to the current bank since it was last rewritten
     const Address start_address;
     Offset bank_size;
 
@@ -337,6 +345,10 @@ public:
     uint16_t write_end_item(Address address);
     void store_single_item(Id id, const std::span<const uint8_t> &data);
 
+    void do_load_all(const UpdateFunction &update_function, std::span<const MigrationFunction> migration_functions);
+
+    uint32_t load_duration_us = 0; ///< How long do_load_all() took, for the boot time metric
+
 public:
     void load_all(const UpdateFunction &update_function, std::span<const MigrationFunction> migration_functions);
 
@@ -346,6 +358,9 @@ public:
     std::unique_lock<freertos::Mutex> lock();
     JournalState get_journal_state() const;
 
+    /// @returns how long load_all() took, so the boot cost of the journal can be reported once metrics are up
+    uint32_t get_load_duration_us() const;
+
     /**
      * @brief Invalidates the values stored in eeprom in both banks
      *
@@ -354,12 +369,45 @@ public:
      */
     void reset();
 
+    /**
+     * @brief Compacts the journal by migrating the bank if it is fragmented or nearly full.
+     *
+     * load_all() only marks a fragmented bank for compaction instead of migrating
+     * it right away; call this periodically once the printer is up, so neither
+     * boot nor some unlucky save() pays for the bank rewrite.
+     */
+    void compact_if_needed();
+
     /**
      * @brief In case there's gonna be multiple writes in succession,  all the writes can be put into one transaction by starting a transaction via this guard and releasing the guard once the transaction is done
      *
+     * The guards nest: a guard taken while another one is active joins the
+     * running transaction and the outermost guard commits it, so helper
+     * functions can guard their own write bursts regardless of the caller.
      */
     TransactionGuard transaction_guard();
 
+    /**
+     * @brief Seqlock over the item RAM mirror so that hot paths can read items without the backend mutex.
+     *
+     * Readers snapshot the sequence with ram_mirror_read_begin(), copy the item data and discard the copy
+     * if ram_mirror_read_retry() reports a concurrent write - so a read never waits for a writer that is
+     * busy journalling to eeprom. Writers hold the backend lock and additionally take
+     * ram_mirror_write_guard() around the RAM modification itself.
+     */
+    uint32_t ram_mirror_read_begin() const {
+        return ram_mirror_seq.load(std::memory_order_acquire);
+    }
+
+    /// @returns true if a write raced with the read and the data copied since ram_mirror_read_begin() must be discarded
+    bool ram_mirror_read_retry(uint32_t seq) const {
+        std::atomic_thread_fence(std::memory_order_acquire);
+        return (seq & 1) || ram_mirror_seq.load(std::memory_order_relaxed) != seq;
+    }
+
+    using RamMirrorWriteGuard = TransactionRAII<&Backend::ram_mirror_write_start, &Backend::ram_mirror_write_end>;
+    RamMirrorWriteGuard ram_mirror_write_guard();
+
     Backend(uint16_t offset, uint16_t size, configuration_store::Storage &storage);
     Backend(const Backend &other) = delete;
     Backend(Backend &&other) = delete;
@@ -13,6 +13,7 @@
 #include "backend.hpp"
 #include <persistent_stores/journal/gen_journal_hashes.hpp>
 #include <common/visit_all_struct_fields.hpp>
+#include <common/tie_struct_fields.hpp>
 
 namespace journal {
 
@@ -59,6 +60,48 @@ bool consteval has_unique_items() {
     return true;
 };
 
+namespace detail {
+
+/// One row of the compile-time item index: the id range an item covers and a thunk restoring it from journal data
+template <class Config>
+struct StoreItemRecord {
+    uint16_t first_id;
+    uint16_t last_id; ///< Same as first_id except for item arrays
+    void (*init)(Config &config, uint16_t id, std::span<uint8_t> data);
+};
+
+/**
+ * @brief Builds an index of all store items sorted by hashed id.
+ *
+ * Journal replay on boot looks items up by id for every journal entry; a sorted index makes that
+ * a binary search instead of a linear walk over the whole (and ever growing) config structure.
+ */
+template <class Config>
+consteval auto make_store_item_index() {
+    using Tuple = decltype(tie_struct_fields(std::declval<Config &>()));
+
+    std::array<StoreItemRecord<Config>, std::tuple_size_v<Tuple>> index;
+    [&]<size_t... i>(std::index_sequence<i...>) {
+        (([&] {
+            using Item = std::remove_reference_t<std::tuple_element_t<i, Tuple>>;
+            if constexpr (is_item_array_v<Item>) {
+                index[i] = { Item::hashed_id_first, Item::hashed_id_last, +[](Config &config, uint16_t id, std::span<uint8_t> data) {
+                                std::get<i>(tie_struct_fields(config)).init(id - Item::hashed_id_first, data);
+                            } };
+            } else {
+                index[i] = { Item::hashed_id, Item::hashed_id, +[](Config &config, [[maybe_unused]] uint16_t id, std::span<uint8_t> data) {
+                                std::get<i>(tie_struct_fields(config)).init(data);
+                            } };
+            }
+        }()),
+            ...);
+    }(std::make_index_sequence<std::tuple_size_v<Tuple>>());
+    std::ranges::sort(index, {}, &StoreItemRecord<Config>::first_id);
+    return index;
+}
+
+} // namespace detail
+
 /**
  * This class takes Config class as template parameter and it defines the items in ConfigStore, DeprecatedItems class has definition for deprecated items.
  */
@@ -80,17 +123,18 @@ public:
      * @param data Holds data in binary form to be loaded into current item
      */
     void load_item(uint16_t id, std::span<uint8_t> data) {
-        visit_all_struct_fields(static_cast<Config &>(*this), [&]<typename Item>(Item &item) {
-            if constexpr (is_item_array_v<Item>) {
-                if (Item::hashed_id_first <= id && id <= Item::hashed_id_last) {
-                    item.init(id - Item::hashed_id_first, data);
-                }
-            } else {
-                if (Item::hashed_id == id) {
-                    item.init(data);
-                }
-            }
-        });
+        static constexpr auto item_index = detail::make_store_item_index<Config>();
+
+        // find the last item whose id range can still contain the id
+        const auto it = std::ranges::upper_bound(item_index, id, {}, &detail::StoreItemRecord<Config>::first_id);
+        if (it == item_index.begin()) {
+            return;
+        }
+
+        const auto &record = *std::prev(it);
+        if (id <= record.last_id) {
+            record.init(static_cast<Config &>(*this), id, data);
+        }
     }
 
     void save_all() {
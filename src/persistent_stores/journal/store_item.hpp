@@ -40,6 +40,16 @@ public:
             return data;
         }
 
+        // Seqlock read - copy the data without taking the backend mutex, so hot paths never wait for a writer that is busy journalling to eeprom
+        for (int retry = 0; retry < 3; retry++) {
+            const uint32_t seq = backend().ram_mirror_read_begin();
+            const DataT copy = data;
+            if (!backend().ram_mirror_read_retry(seq)) {
+                return copy;
+            }
+        }
+
+        // Writes keep racing with us - wait for them instead of spinning
         auto l = backend().lock();
         return data;
     }
@@ -79,7 +89,10 @@ protected:
             return;
         }
         auto l = backend().lock();
-        data = in;
+        {
+            auto write_guard = backend().ram_mirror_write_guard();
+            data = in;
+        }
         do_save(hashed_id);
     }
 
@@ -138,7 +151,10 @@ public:
         const auto old_value = this->data;
         const auto new_value = f(old_value);
         if (new_value != old_value) {
-            this->data = new_value;
+            {
+                auto write_guard = backend().ram_mirror_write_guard();
+                this->data = new_value;
+            }
             this->do_save(hashed_id);
         }
     }
@@ -152,7 +168,10 @@ public:
         DataT new_value = old_value;
         f(new_value);
         if (new_value != old_value) {
-            this->data = new_value;
+            {
+                auto write_guard = backend().ram_mirror_write_guard();
+                this->data = new_value;
+            }
             this->do_save(hashed_id);
         }
     }
@@ -235,12 +254,16 @@ public:
         }
         auto l = backend().lock();
 
-        data_array[index] = in;
+        {
+            auto write_guard = backend().ram_mirror_write_guard();
+            data_array[index] = in;
+        }
         do_save(index);
     }
 
     void set_all(DataArg in) {
         auto l = backend().lock();
+        auto write_guard = backend().ram_mirror_write_guard();
         for (size_t i = 0; i < item_count; i++) {
             if (data_array[i] == in) {
                 continue;
@@ -252,6 +275,7 @@ public:
 
     void set_all(ItemArray &in) {
         auto l = backend().lock();
+        auto write_guard = backend().ram_mirror_write_guard();
         for (size_t i = 0; i < item_count; i++) {
             if (data_array[i] == in[i]) {
                 continue;
@@ -270,7 +294,10 @@ public:
         const auto old_value = this->data_array[index];
         const auto new_value = f(old_value);
         if (new_value != old_value) {
-            this->data_array = new_value;
+            {
+                auto write_guard = backend().ram_mirror_write_guard();
+                this->data_array = new_value;
+            }
             this->do_save(index);
         }
     }
@@ -279,6 +306,7 @@ public:
     /// This is done under the lock, so the operation is atomic
     inline void transform_all(std::invocable<DataArg> auto f) {
         auto l = backend().lock();
+        auto write_guard = backend().ram_mirror_write_guard();
         for (uint8_t i = 0; i < item_count; i++) {
             const auto old_value = this->data_array[i];
             const auto new_value = f(old_value);
@@ -310,6 +338,15 @@ public:
             return data_array[index];
         }
 
+        // Seqlock read, see JournalItemBase::get()
+        for (int retry = 0; retry < 3; retry++) {
+            const uint32_t seq = backend().ram_mirror_read_begin();
+            const DataT copy = data_array[index];
+            if (!backend().ram_mirror_read_retry(seq)) {
+                return copy;
+            }
+        }
+
         auto l = backend().lock();
         return data_array[index];
     }
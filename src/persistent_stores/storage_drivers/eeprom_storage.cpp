@@ -1,5 +1,13 @@
 #include "eeprom_storage.hpp"
 
+#include <algorithm>
+#include <array>
+#include <cstring>
+
+#ifndef UNITTESTS
+    #include <wdt.hpp>
+#endif
+
 uint8_t EEPROMStorage::read_byte(uint16_t address) {
     return st25dv64k_user_read(address);
 };
@@ -14,8 +22,27 @@ void EEPROMStorage::write_bytes(uint16_t address, std::span<const uint8_t> data)
 };
 
 void EEPROMStorage::erase_area(uint16_t start_address, uint16_t end_address) {
-    static constexpr std::array<uint8_t, 4> data { 0xff, 0xff, 0xff, 0xff };
-    for (; start_address < end_address; start_address += data.size()) {
-        write_bytes(start_address, data);
+    // Each programmed chunk costs a fixed EEPROM write delay, so a full-area
+    // erase blocks for seconds. Work chunk by chunk: read first and skip chunks
+    // that already hold 0xff - a fresh area erases in one cheap read pass and an
+    // interrupted erase resumes right where it stopped, since the erased prefix
+    // is skipped on the next attempt. The watchdog is fed between chunks so even
+    // the worst case (whole area dirty) cannot trip it.
+    static constexpr std::array<uint8_t, 32> erased = [] {
+        std::array<uint8_t, 32> a;
+        a.fill(0xff);
+        return a;
+    }();
+    std::array<uint8_t, erased.size()> chunk;
+
+    for (; start_address < end_address; start_address += erased.size()) {
+        const uint16_t chunk_size = std::min<uint16_t>(erased.size(), end_address - start_address);
+        read_bytes(start_address, { chunk.data(), chunk_size });
+        if (memcmp(chunk.data(), erased.data(), chunk_size) != 0) {
+            write_bytes(start_address, { erased.data(), chunk_size });
+        }
+#ifndef UNITTESTS
+        wdt_iwdg_refresh();
+#endif
     }
 }
@@ -25,5 +25,6 @@ inline constexpr size_t wifi_max_ssid_len { old_eeprom::WIFI_MAX_SSID_LEN };
 inline constexpr size_t wifi_max_passwd_len { old_eeprom::WIFI_MAX_PASSWD_LEN };
 
 inline constexpr size_t metrics_host_size { connect_host_size }; ///< Size of metrics host string
+inline constexpr size_t metrics_sampling_size { 64 }; ///< Size of per-metric sampling overrides string
 inline constexpr int16_t stallguard_sensitivity_unset { std::numeric_limits<int16_t>::max() };
 } // namespace config_store_ns
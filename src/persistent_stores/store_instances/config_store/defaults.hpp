@@ -138,6 +138,8 @@ namespace defaults {
     inline constexpr bool enable_metrics { false };
 #endif /*DEVELOPMENT_ITEMS()*/
 
+    inline constexpr std::array<char, metrics_sampling_size + 1> metrics_sampling { "" };
+
     inline constexpr bool crash_enabled {
 #if (PRINTER_IS_PRUSA_MK4() || PRINTER_IS_PRUSA_MK3_5() || PRINTER_IS_PRUSA_iX() || PRINTER_IS_PRUSA_XL() || PRINTER_IS_PRUSA_COREONE())
         false
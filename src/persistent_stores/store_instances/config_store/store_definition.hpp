@@ -170,6 +170,7 @@ struct CurrentStore
     StoreItem<std::array<char, metrics_host_size + 1>, defaults::metrics_host, journal::hash("Metrics Host")> metrics_host;
     StoreItem<uint16_t, 8514, journal::hash("Metrics Port")> metrics_port; ///< Port used to allow and init metrics
     StoreItem<uint16_t, 13514, journal::hash("Log Port")> syslog_port; ///< Port used to allow and init log (uses metrics_host)
+    StoreItem<std::array<char, metrics_sampling_size + 1>, defaults::metrics_sampling, journal::hash("Metrics Sampling")> metrics_sampling; ///< Per-metric sampling overrides, "name=keep_1_of/min_interval_ms" separated by spaces
 
     StoreItem<uint16_t, 0, journal::hash("Job ID")> job_id; // print job id incremented at every print start
 
@@ -569,6 +570,11 @@ struct CurrentStore
 #if ENABLED(PRECISE_HOMING_COREXY) && HAS_TRINAMIC && defined(XY_HOMING_MEASURE_SENS_MIN)
     StoreItem<CoreXYHomeTMCSens, COREXY_NO_HOME_TMC_SENS, journal::hash("CoreXY home TMC calibration")> corexy_home_tmc_sens;
 #endif
+
+    // Resume cursor of the background crash dump upload. The size records
+    // which dump the cursor belongs to - a mismatch restarts the upload.
+    StoreItem<uint32_t, 0, journal::hash("Crash Dump Upload Offset")> crash_dump_upload_offset;
+    StoreItem<uint32_t, 0, journal::hash("Crash Dump Upload Size")> crash_dump_upload_size;
 };
 
 /**
@@ -1,9 +1,9 @@
 #include "puppies/BootloaderProtocol.hpp"
 #include <algorithm>
-#include "Crc.h"
 #include <cstring>
 #include "buffered_serial.hpp"
 #include "puppies/PuppyBus.hpp"
+#include "puppies/modbus.h"
 #include <assert.h>
 
 namespace buddy::puppies {
@@ -19,7 +19,7 @@ BootloaderProtocol::status_t BootloaderProtocol::write_command(commands_t cmd, u
     write_buffer[1] = (uint8_t)cmd;
     // buffer[2] and onwards was prefilled with command data
 
-    uint16_t crc = Crc16Ibm().update(write_buffer, len + 2).get();
+    uint16_t crc = common::puppies::crc::compute(crc_tables, write_buffer, len + 2);
     write_buffer[len + 2] = (crc & 0xff);
     write_buffer[len + 3] = (crc >> 8);
 
@@ -69,7 +69,7 @@ BootloaderProtocol::status_t BootloaderProtocol::read_status(uint8_t *datain, si
         return status_t::INCOMPLETE_RESPONSE;
     }
 
-    uint16_t expectedCrc = Crc16Ibm().update(buffer, 3).update(datain, len).get();
+    uint16_t expectedCrc = common::puppies::crc::compute(crc_tables, datain, len, common::puppies::crc::compute(crc_tables, buffer, 3));
     if (((crc[1] << 8) | crc[0]) != expectedCrc) {
         return status_t::INVALID_CRC;
     }
@@ -13,6 +13,7 @@
 #include <assert.h>
 #include "metric.h"
 #include <puppies/PuppyBootstrap.hpp>
+#include <puppies/PuppyBus.hpp>
 #include <i18n.h>
 #include "Marlin/src/inc/MarlinConfig.h"
 #include "utility_extensions.hpp"
@@ -40,6 +41,7 @@ LOG_COMPONENT_DEF(Dwarf_6, logging::Severity::info);
 #define DWARF_LOG(severity, fmt, ...) _log_event(severity, &this->log_component, fmt, ##__VA_ARGS__);
 
 METRIC_DEF(metric_fast_refresh_delay, "dwarf_fast_refresh_delay", METRIC_VALUE_INTEGER, 0, METRIC_DISABLED);
+METRIC_DEF(metric_dwarf_fifo_drops, "dwarf_fifo_drops", METRIC_VALUE_CUSTOM, 0, METRIC_DISABLED);
 
 METRIC_DEF(metric_dwarf_picked_raw, "dwarf_picked_raw", METRIC_VALUE_CUSTOM, 100, METRIC_DISABLED);
 METRIC_DEF(metric_dwarf_parked_raw, "dwarf_parked_raw", METRIC_VALUE_CUSTOM, 100, METRIC_DISABLED);
@@ -76,11 +78,10 @@ CommunicationStatus Dwarf::refresh() {
     Lock guard(*mutex);
     typedef CommunicationStatus (Dwarf::*MethodType)();
     static constexpr MethodType funcs[] = {
-        &Dwarf::read_general_status,
+        &Dwarf::read_general_status, // also covers time sync when a round is due, the registers are adjacent and read in one request
         &Dwarf::read_discrete_general_status,
         &Dwarf::write_general,
         &Dwarf::write_tmc_enable,
-        &Dwarf::run_time_sync,
     };
     if (++refresh_nr >= std::size(funcs)) {
         refresh_nr = 0;
@@ -88,6 +89,14 @@ CommunicationStatus Dwarf::refresh() {
     return (this->*funcs[refresh_nr])();
 }
 
+CommunicationStatus Dwarf::refresh_requested_status() {
+    if (!status_read_request.exchange(false, std::memory_order_relaxed)) {
+        return CommunicationStatus::SKIPPED;
+    }
+    Lock guard(*mutex);
+    return read_discrete_general_status();
+}
+
 CommunicationStatus Dwarf::read_discrete_general_status() {
     // read general status discrete inputs
     CommunicationStatus status = bus.read(unit, DiscreteGeneralStatus, 250);
@@ -99,8 +108,17 @@ CommunicationStatus Dwarf::read_discrete_general_status() {
 }
 
 CommunicationStatus Dwarf::read_general_status() {
-    // read general status registers
-    CommunicationStatus status = bus.read(unit, RegisterGeneralStatus, 250);
+    CommunicationStatus status;
+    if (time_sync.sync_due()) {
+        // extend the status read to cover the directly following time sync registers - a sync round for free
+        RequestTiming timing;
+        status = bus.read(unit, RegisterGeneralStatus, TimeSync, 250, &timing);
+        if (status == CommunicationStatus::OK) {
+            time_sync.sync(TimeSync.value.dwarf_time_us, timing);
+        }
+    } else {
+        status = bus.read(unit, RegisterGeneralStatus, 250);
+    }
     if (status == CommunicationStatus::OK) {
         if (RegisterGeneralStatus.value.FaultStatus != dwarf_shared::errors::FaultStatusMask::NO_FAULT) {
             handle_dwarf_fault();
@@ -152,6 +170,7 @@ CommunicationStatus Dwarf::initial_scan() {
     status = read_discrete_general_status();
 
     GeneralWrite.dirty = true;
+    GeneralWrite.shadow_valid = false; // the dwarf may have rebooted, the shadow image no longer matches
     TmcEnable.dirty = true;
     IsSelectedCoil.dirty = true;
     LoadcellEnableCoil.dirty = true;
@@ -296,6 +315,9 @@ CommunicationStatus Dwarf::write_tmc_enable() {
 }
 
 uint32_t Dwarf::tmc_read(uint8_t addressByte) {
+    // Stepper register access comes from the motion thread - make the puppy
+    // task back off its background polling while we wait for the bus
+    PuppyBus::PriorityLane lane;
     Lock guard(*mutex);
 
     TmcReadRequest.value.address = addressByte;
@@ -316,6 +338,7 @@ uint32_t Dwarf::tmc_read(uint8_t addressByte) {
 }
 
 void Dwarf::tmc_write(uint8_t addressByte, uint32_t config) {
+    PuppyBus::PriorityLane lane;
     Lock guard(*mutex);
 
     TmcWriteRequest.value.address = addressByte;
@@ -714,6 +737,14 @@ void Dwarf::decode_accelerometer_freq(const AccelerometerSamplingRate &data) {
     PrusaAccelerometer::set_rate(data.frequency);
 }
 
+void Dwarf::decode_fifo_stream_status(const FifoStreamStatus &data) {
+    // Surface samples dropped on the dwarf, only when the counter moves
+    if (data.dropped_samples != last_reported_fifo_drops) {
+        last_reported_fifo_drops = data.dropped_samples;
+        metric_record_custom(&metric_dwarf_fifo_drops, ",n=%u v=%ui", dwarf_nr, unsigned(data.dropped_samples));
+    }
+}
+
 uint16_t Dwarf::get_fan_pwm(uint8_t fan_nr) const {
     // Lock guard(*mutex);
     // FIXME:
@@ -196,6 +196,8 @@ PuppyBootstrap::BootstrapResult PuppyBootstrap::run(
     }
 
     // Check fingerprints and flash firmware
+    BootstrapResult flashed_docks {};
+    std::array<uint32_t, DOCKS.size()> flash_wait_starts {};
     for (const auto dock : DOCKS) {
         if (!result.is_dock_occupied(dock)) {
             // puppy not detected here, nothing to bootstrap
@@ -218,10 +220,16 @@ PuppyBootstrap::BootstrapResult PuppyBootstrap::run(
             offset = size * (static_cast<uint8_t>(dock) - 1);
         }
         #endif
-        flash_firmware(dock, fingerprints, offset, size, percent_base, percent_per_puppy);
+        if (flash_firmware(dock, fingerprints, offset, size, percent_base, percent_per_puppy)) {
+            // flashed puppy is now computing its new fingerprint, verify once the remaining docks are done
+            flashed_docks.set_dock_occupied(dock);
+            flash_wait_starts[stdext::index_of(DOCKS, dock)] = ticks_ms();
+        }
     #endif
         percent_base += percent_per_puppy;
     }
+
+    verify_flashed_puppies(flashed_docks, fingerprints, flash_wait_starts);
     #if HAS_DWARF()
     progressHook({ 100, FlashingStage::DONE, PuppyType::DWARF });
     #elif HAS_MODULARBED()
@@ -466,7 +474,7 @@ off_t PuppyBootstrap::get_firmware_size(PuppyType type) {
     return fs.st_size;
 }
 
-void PuppyBootstrap::flash_firmware(Dock dock, fingerprints_t &fw_fingerprints, uint8_t chunk_offset, uint8_t chunk_size, int percent_offset, int percent_span) {
+bool PuppyBootstrap::flash_firmware(Dock dock, fingerprints_t &fw_fingerprints, uint8_t chunk_offset, uint8_t chunk_size, int percent_offset, int percent_span) {
     auto puppy_type = to_puppy_type(dock);
     unique_file_ptr fw_file = get_firmware(puppy_type);
     off_t fw_size = get_firmware_size(puppy_type);
@@ -526,13 +534,28 @@ void PuppyBootstrap::flash_firmware(Dock dock, fingerprints_t &fw_fingerprints,
         // Calculate new fingerprint, salt needs to be changed so the flashing cannot be faked
         fw_fingerprints.get_salt(dock) = rand_u();
         start_fingerprint_computation(get_boot_address_for_dock(dock), fw_fingerprints.get_salt(dock));
+        return true;
+    }
+    return false;
+}
+
+void PuppyBootstrap::verify_flashed_puppies(BootstrapResult flashed, fingerprints_t &fw_fingerprints, const std::array<uint32_t, DOCKS.size()> &wait_starts) {
+    for (const auto dock : DOCKS) {
+        if (!flashed.is_dock_occupied(dock)) {
+            // nothing was flashed here, the initial fingerprint check was enough
+            continue;
+        }
 
-        auto fingerprint_wait_start = ticks_ms();
+        const auto puppy_type = to_puppy_type(dock);
 
+        // Calculate the expected fingerprint while the puppy is computing its own
+        unique_file_ptr fw_file = get_firmware(puppy_type);
+        const off_t fw_size = get_firmware_size(puppy_type);
         calculate_fingerprint(fw_file, fw_size, fw_fingerprints.get_fingerprint(dock), fw_fingerprints.get_salt(dock));
 
         // Check puppy if it finished fingerprint calculation
-        wait_for_fingerprint(fingerprint_wait_start);
+        flasher.set_address(get_boot_address_for_dock(dock));
+        wait_for_fingerprint(wait_starts[stdext::index_of(DOCKS, dock)]);
 
         // check fingerprint after flashing, to make sure it went well
         if (!fingerprint_match(fw_fingerprints.get_fingerprint(dock))) {
@@ -543,9 +566,10 @@ void PuppyBootstrap::flash_firmware(Dock dock, fingerprints_t &fw_fingerprints,
 
 void PuppyBootstrap::wait_for_fingerprint(uint32_t calculation_start) {
     constexpr uint32_t WAIT_TIME = 1000; // Puppies should calculate fingerprint in 330 ms, but it all takes almost 600 ms
+    constexpr int MIN_ATTEMPTS = 3; // The calculation may have started long before this wait, still tolerate a hiccup on the first polls
     uint16_t protocol_version;
 
-    while (1) {
+    for (int attempt = 1;; ++attempt) {
         BootloaderProtocol::status_t status = flasher.get_protocolversion(protocol_version); // Test if puppy is communicating
 
         if (status == BootloaderProtocol::status_t::COMMAND_OK) // Any response from puppy means it is ready
@@ -553,7 +577,7 @@ void PuppyBootstrap::wait_for_fingerprint(uint32_t calculation_start) {
             return; // Done
         }
 
-        if (ticks_diff(calculation_start + WAIT_TIME, ticks_ms()) < 0) {
+        if (attempt >= MIN_ATTEMPTS && ticks_diff(calculation_start + WAIT_TIME, ticks_ms()) < 0) {
             fatal_error(ErrCode::ERR_SYSTEM_PUPPY_FINGERPRINT_TIMEOUT);
         }
 
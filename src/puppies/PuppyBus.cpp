@@ -15,6 +15,7 @@ namespace puppies {
     osMutexDef(puppyMutex);
     static osMutexId puppyMutexId;
     uint32_t PuppyBus::last_operation_time_us = 0;
+    std::atomic<uint8_t> PuppyBus::priority_traffic = 0;
 
     void PuppyBus::Open() {
         assert(puppyMutexId == nullptr);
@@ -106,5 +107,17 @@ namespace puppies {
             UNUSED(res);
         }
     }
+
+    PuppyBus::PriorityLane::PriorityLane() {
+        priority_traffic.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    PuppyBus::PriorityLane::~PriorityLane() {
+        priority_traffic.fetch_sub(1, std::memory_order_relaxed);
+    }
+
+    bool PuppyBus::HasPriorityTraffic() {
+        return priority_traffic.load(std::memory_order_relaxed) > 0;
+    }
 } // namespace puppies
 } // namespace buddy
@@ -255,6 +255,21 @@ CommunicationStatus PuppyModbus::read_input(uint8_t unit, uint16_t *data, uint16
     return CommunicationStatus::OK;
 }
 
+CommunicationStatus PuppyModbus::read_input_merged(uint8_t unit, uint16_t *data, uint16_t count, uint16_t address, RequestTiming *const timing, uint32_t &first_timestamp_ms, uint32_t &second_timestamp_ms, uint32_t max_age_ms) {
+    // Skip only when both blocks are fresh, a single request refreshes them both
+    if (max_age_ms && last_ticks_ms() - first_timestamp_ms < max_age_ms && last_ticks_ms() - second_timestamp_ms < max_age_ms) {
+        return CommunicationStatus::SKIPPED;
+    }
+
+    uint32_t timestamp_ms = 0;
+    const CommunicationStatus status = read_input(unit, data, count, address, timing, timestamp_ms, 0);
+    if (status == CommunicationStatus::OK) {
+        first_timestamp_ms = timestamp_ms;
+        second_timestamp_ms = timestamp_ms;
+    }
+    return status;
+}
+
 CommunicationStatus PuppyModbus::read_holding(uint8_t unit, uint16_t *data, uint16_t count, uint16_t address, uint32_t &timestamp_ms, uint32_t max_age_ms) {
     if (max_age_ms && last_ticks_ms() - timestamp_ms < max_age_ms) {
         return CommunicationStatus::SKIPPED;
@@ -34,6 +34,13 @@ void Decoder::decode(Callbacks &callbacks) {
         case MessageType::accelerometer_sampling_rate:
             make_call(callbacks, &Callbacks::decode_accelerometer_freq);
             break;
+        case MessageType::fifo_stream_status:
+            // Keep a copy for more() besides calling the callback
+            if (can_get<FifoStreamStatus>()) {
+                stream_status = get<FifoStreamStatus>();
+                callbacks.decode_fifo_stream_status(*stream_status);
+            }
+            break;
         default:
             assert(false);
         }
@@ -41,8 +48,13 @@ void Decoder::decode(Callbacks &callbacks) {
 }
 
 bool Decoder::more() const {
-    // TODO: FIFO needs info about how many bytes are in it and clear it by another channel.
-    // Until fixed: If another item wouldn't fit the message, we assume there is more in FIFO.
+    if (stream_status.has_value()) {
+        // The transfer told us exactly how much data is still waiting
+        return stream_status->pending_bytes > 0;
+    }
+
+    // No stream status trailer fit in the transfer - fall back to guessing:
+    // If another item wouldn't fit the message, we assume there is more in FIFO.
     return (sizeof(std::array<uint16_t, MODBUS_FIFO_LEN>) - len) // Remainder of the packet
         < sizeof(Header) + std::max(sizeof(LogData), sizeof(LoadcellRecord)); // Size of the biggest item
 }
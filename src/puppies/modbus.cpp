@@ -1,5 +1,6 @@
 // Include configuration before implementation
 #include "puppies/modbus.h"
+#include "puppies/crc16.hpp"
 
 #pragma GCC diagnostic push
 #pragma GCC diagnostic ignored "-Wunused-parameter"
@@ -9,3 +10,12 @@
 #include <lightmodbus/lightmodbus.h>
 
 #pragma GCC diagnostic pop
+
+// Non-const on purpose: the initializer is constant, so the tables land in the
+// .data section and get copied to zero-wait-state RAM on startup. Random
+// accesses into flash would pay wait states on every frame.
+common::puppies::crc::crc_tables_t buddy::puppies::crc_tables = common::puppies::crc::make_crc_tables();
+
+uint16_t modbusCRC(const uint8_t *data, uint16_t length) {
+    return common::puppies::crc::compute(buddy::puppies::crc_tables, data, length);
+}
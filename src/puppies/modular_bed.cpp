@@ -73,6 +73,7 @@ CommunicationStatus ModularBed::initial_scan() {
     // Reset dirty flag / schedule rewrite for important registers
     print_fan_active.dirty = true;
     bedlet_target_temp.dirty = true;
+    bedlet_target_temp.shadow_valid = false; // the bed may have rebooted, the shadow image no longer matches
 
     return status;
 }
@@ -89,12 +90,11 @@ CommunicationStatus ModularBed::refresh() {
         &ModularBed::write_print_fan_active,
         &ModularBed::read_general_status,
         &ModularBed::read_general_ready,
-        &ModularBed::read_currents,
         &ModularBed::read_bedlet_data,
         &ModularBed::read_general_fault,
         &ModularBed::write_bedlet_target_temp,
         &ModularBed::read_bedlet_measured_max_current,
-        &ModularBed::read_mcu_temperature,
+        &ModularBed::read_currents_and_mcu_temperature,
     };
     if (++refresh_nr >= std::size(funcs)) {
         refresh_nr = 0;
@@ -149,8 +149,9 @@ CommunicationStatus ModularBed::read_general_ready() {
     return status;
 }
 
-CommunicationStatus ModularBed::read_currents() {
-    CommunicationStatus status = bus.read(unit, currents, MAX_UNREAD_MS);
+CommunicationStatus ModularBed::read_currents_and_mcu_temperature() {
+    // The registers are adjacent, fetch both blocks in a single request
+    CommunicationStatus status = bus.read(unit, currents, mcu_temperature, MAX_UNREAD_MS);
     if (status != CommunicationStatus::OK) {
         return status;
     }
@@ -165,6 +166,10 @@ CommunicationStatus ModularBed::read_currents() {
         ",n=1 v=%.3f,e=%.3f",
         static_cast<double>(currents.value.B_measured) / MODBUS_CURRENT_REGISTERS_SCALE,
         static_cast<double>(currents.value.B_expected) / MODBUS_CURRENT_REGISTERS_SCALE);
+
+    log_debug(ModularBed, "MCU Temperature: %d", mcu_temperature.value);
+    metric_record_float(&metric_mcu_temperature, mcu_temperature.value);
+    sensor_data().mbedMCUTemperature = mcu_temperature.value;
     return status;
 }
 
@@ -285,18 +290,6 @@ CommunicationStatus ModularBed::read_bedlet_measured_max_current() {
     return status;
 }
 
-CommunicationStatus ModularBed::read_mcu_temperature() {
-    CommunicationStatus status = bus.read(unit, mcu_temperature, MAX_UNREAD_MS);
-    if (status != CommunicationStatus::OK) {
-        return status;
-    }
-
-    log_debug(ModularBed, "MCU Temperature: %d", mcu_temperature.value);
-    metric_record_float(&metric_mcu_temperature, mcu_temperature.value);
-    sensor_data().mbedMCUTemperature = mcu_temperature.value;
-    return status;
-}
-
 void ModularBed::clear_fault() {
     Lock guard(mutex);
     clear_fault_status.value = true;
@@ -45,6 +45,12 @@ bool download_dump_into_file(std::span<uint8_t> buffer,
         return false;
     }
 
+    // The dump arrives in packets of at most MAX_RESPONSE_DATA_LEN bytes and
+    // writing each packet straight to the internal filesystem pays the flash
+    // block overhead per packet. Let stdio batch the packets into larger writes.
+    static constexpr size_t dump_file_buffer_size { 2048 };
+    setvbuf(dump_file.get(), nullptr, _IOFBF, dump_file_buffer_size);
+
     for (uint32_t cur_offset = 0; cur_offset < fw_descriptor.dump_size; cur_offset += buffer.size()) {
         const uint32_t read_sz = std::min(fw_descriptor.dump_size - cur_offset,
             std::min(static_cast<uint32_t>(buffer.size()), static_cast<uint32_t>(BootloaderProtocol::MAX_RESPONSE_DATA_LEN)));
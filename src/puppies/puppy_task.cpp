@@ -10,6 +10,8 @@
 #include <puppies/Dwarf.hpp>
 #include <option/has_xbuddy_extension.h>
 #include "puppies/PuppyBootstrap.hpp"
+#include "puppies/PuppyBus.hpp"
+#include <common/loop_latency_monitor.hpp>
 #include "timing.h"
 #include "Marlin/src/module/stepper.h"
 #include "Marlin/src/module/prusa/toolchanger.h"
@@ -99,12 +101,16 @@ static void puppy_task_loop() {
     size_t slow_stage = 0; ///< Switch slow action
 #endif
 
+    static buddy::LoopLatencyMonitor loop_latency_monitor("puppy");
+
     // periodically update puppies until there is a failure
     while (true) {
         if (stop_request) {
             return;
         }
 
+        loop_latency_monitor.tick();
+
         [[maybe_unused]] uint32_t cycle_ticks = ticks_ms(); ///< Only one tick read per cycle, value will be reused by last_ticks_ms()
         // One slow action
         bool worked = false;
@@ -130,6 +136,29 @@ static void puppy_task_loop() {
             osDelay(1); // No dwarf is selected, wait a bit
         }
 
+        // Priority lane: discrete status reads requested by other threads
+        // (tool park/pick detection during a toolchange) are served ahead
+        // of the background telemetry round-robin
+        for (Dwarf &dwarf : dwarfs) {
+            if (!dwarf.is_enabled()) {
+                continue;
+            }
+            CommunicationStatus status = dwarf.refresh_requested_status();
+            if (status == CommunicationStatus::ERROR) {
+                return;
+            }
+            worked |= status == CommunicationStatus::OK;
+        }
+#endif
+
+        // Preemption point: while another thread is waiting with a motion-critical
+        // request, yield the bus instead of starting another background transaction
+        if (PuppyBus::HasPriorityTraffic()) {
+            osDelay(1);
+            continue;
+        }
+
+#if ENABLED(PRUSA_TOOLCHANGER)
         size_t orig_stage = slow_stage;
         do {
             // Increment stage, there are 2 actions per dwarf and one modular bed
@@ -1,6 +1,8 @@
 #include "puppies/time_sync.hpp"
 
+#include <algorithm>
 #include <cassert>
+#include <cstdlib>
 #include <math.h>
 
 #include "timing.h"
@@ -10,6 +12,9 @@
 
 using namespace buddy::puppies;
 
+METRIC_DEF(metric_puppy_sync_bound, "puppy_sync_err", METRIC_VALUE_CUSTOM, 0, METRIC_DISABLED);
+METRIC_DEF(metric_puppy_sync_interval, "puppy_sync_ivl", METRIC_VALUE_CUSTOM, 0, METRIC_DISABLED);
+
 #ifdef TIME_SYNC_DEBUG
 METRIC_DEF(metric_buddy_time_us, "buddy_t", METRIC_VALUE_INTEGER, 0, METRIC_ENABLED);
 METRIC_DEF(metric_puppy_time_us, "puppy_t", METRIC_VALUE_CUSTOM, 0, METRIC_ENABLED);
@@ -23,7 +28,9 @@ METRIC_DEF(metric_puppy_average_drift_ppb, "puppy_adrif", METRIC_VALUE_CUSTOM, 0
 TimeSync::TimeSync(const uint8_t id)
     : id(id)
     , drift_filter(120000, 120000, 0.01)
-    , offset_filter(100, 100, 0.1, [this](double value, uint32_t now_us) { return correct_offset(value, now_us); }) {
+    , offset_filter(100, 100, 0.1, [this](int64_t last_estimate_q, uint32_t now_us) {
+        return last_estimate_q + (static_cast<int64_t>(drift_correction_us(now_us)) << Filter::frac_bits);
+    }) {
     init();
 }
 
@@ -34,6 +41,23 @@ void TimeSync::init() {
     average_drift_ppb = std::numeric_limits<int32_t>::max();
     average_puppy_offset_us = std::numeric_limits<int32_t>::max();
     average_roundtrip_us = std::numeric_limits<uint32_t>::max();
+    sync_interval_us = MIN_SYNC_INTERVAL_US;
+}
+
+bool TimeSync::sync_due() const {
+    if (!is_time_sync_valid()) {
+        return true;
+    }
+    return ticks_us() - last_sync_us >= sync_interval_us;
+}
+
+uint32_t TimeSync::accuracy_bound_us(const uint32_t now_us) const {
+    if (!is_time_sync_valid()) {
+        return std::numeric_limits<uint32_t>::max();
+    }
+    // Offset uncertainty grows with the drift uncertainty over the time since the last sync round
+    const uint32_t elapsed_us = now_us - last_sync_us;
+    return offset_filter.get_error_estimate() + static_cast<int64_t>(elapsed_us) * drift_filter.get_error_estimate() / 1'000'000'000;
 }
 
 void TimeSync::sync(const uint32_t puppy_time_us, const RequestTiming timing) {
@@ -54,14 +78,22 @@ void TimeSync::sync(const uint32_t puppy_time_us, const RequestTiming timing) {
 
     // Compute raw offset info
     const int32_t puppy_offset_us = puppy_time_us - buddy_time_us;
-    const uint32_t sync_interval_us = buddy_time_us - last_sync_us;
+    const uint32_t elapsed_us = buddy_time_us - last_sync_us;
 
     // Compute filtered offset and drift
     if (last_offset_us != std::numeric_limits<int32_t>::max()) {
         average_puppy_offset_us = offset_filter.filter(puppy_offset_us, buddy_time_us);
-        const int32_t puppy_drift_ppb = 1'000'000'000 * static_cast<int64_t>(puppy_offset_us - last_offset_us) / sync_interval_us;
+        const int32_t puppy_drift_ppb = 1'000'000'000 * static_cast<int64_t>(puppy_offset_us - last_offset_us) / elapsed_us;
         average_drift_ppb = drift_filter.filter(puppy_drift_ppb, buddy_time_us);
 
+        // Adapt the sync cadence: back off while rounds agree with the drift model, tighten when one doesn't
+        if (std::abs(puppy_drift_ppb - average_drift_ppb) < DRIFT_STABLE_BAND_PPB) {
+            sync_interval_us = std::min(2 * sync_interval_us, MAX_SYNC_INTERVAL_US);
+        } else {
+            sync_interval_us = MIN_SYNC_INTERVAL_US;
+        }
+        metric_record_custom(&metric_puppy_sync_interval, ",n=%d v=%u", id, sync_interval_us);
+
 #ifdef TIME_SYNC_DEBUG
         metric_record_custom(&metric_sync_roundtrip_us, ",n=%d v=%d", id, roundtrip_us);
         metric_record_custom(&metric_puppy_time_us, ",n=%d v=%d", id, puppy_time_us);
@@ -75,15 +107,22 @@ void TimeSync::sync(const uint32_t puppy_time_us, const RequestTiming timing) {
 
     last_offset_us = puppy_offset_us;
     last_sync_us = buddy_time_us;
+
+    if (is_time_sync_valid()) {
+        metric_record_custom(&metric_puppy_sync_bound, ",n=%d v=%u", id, accuracy_bound_us(timing.end_us));
+    }
 }
 
 int32_t TimeSync::correct_offset(const int32_t offset_us, const uint32_t now_us) const {
+    return offset_us + drift_correction_us(now_us);
+}
+
+int32_t TimeSync::drift_correction_us(const uint32_t now_us) const {
     uint32_t diff = now_us - last_sync_us;
     if (!diff) {
-        return offset_us;
+        return 0;
     }
-    const int32_t correction_us = diff * static_cast<int64_t>(average_drift_ppb) / 1'000'000'000;
-    return offset_us + correction_us;
+    return diff * static_cast<int64_t>(average_drift_ppb) / 1'000'000'000;
 }
 
 bool TimeSync::is_time_sync_valid() const {
@@ -189,6 +189,7 @@ CommunicationStatus XBuddyExtension::initial_scan() {
 
     const auto input = refresh_input(0);
     requirement.dirty = true;
+    requirement.shadow_valid = false; // the extension board may have rebooted, the shadow image no longer matches
     return input;
 }
 
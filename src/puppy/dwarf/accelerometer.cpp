@@ -203,6 +203,11 @@ size_t dwarf::accelerometer::get_num_samples() {
     return sample_buffer.size();
 }
 
+size_t dwarf::accelerometer::dropped_samples() {
+    freertos::CriticalSection critical_section;
+    return overflown_count;
+}
+
 float dwarf::accelerometer::measured_sampling_rate() {
     uint32_t duration = ticks_diff(last_sample_timestamp, first_sample_timestamp);
     if (duration == 0 || samples_extracted == 0) {
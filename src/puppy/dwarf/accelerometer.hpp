@@ -7,6 +7,9 @@ namespace dwarf::accelerometer {
 
 bool accelerometer_get_sample(AccelerometerRecord &sample);
 size_t get_num_samples();
+
+/// Number of samples dropped due to a full buffer since the last enable
+size_t dropped_samples();
 float measured_sampling_rate();
 void enable();
 void disable();
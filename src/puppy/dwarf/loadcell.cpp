@@ -26,6 +26,9 @@ CircularBuffer<LoadcellRecord, LOADCELL_BUFFER_RECORDS_NUM> sample_buffer;
 // indicator that sample_buffer was full
 uint32_t buffer_overflown = 0;
 
+// total number of samples that didn't fit since boot, for the stream status trailer
+uint32_t samples_dropped_total = 0;
+
 // Running average sample value
 LoadcellSample_t running_average = 0;
 
@@ -74,6 +77,7 @@ void loadcell_irq() {
     const bool write_buffer_success = sample_buffer.try_put(record);
     if (!write_buffer_success) {
         buffer_overflown++;
+        samples_dropped_total++;
     }
 }
 
@@ -102,6 +106,16 @@ bool get_loadcell_sample(LoadcellRecord &sample) {
     }
 }
 
+size_t get_num_samples() {
+    freertos::CriticalSection critical_section;
+    return sample_buffer.size();
+}
+
+uint32_t dropped_samples() {
+    freertos::CriticalSection critical_section;
+    return samples_dropped_total;
+}
+
 void loadcell_set_enable(bool enable) {
     // set status
     loadcell_is_enabled = enable;
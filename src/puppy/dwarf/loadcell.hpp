@@ -11,6 +11,12 @@ using namespace common::puppies::fifo;
 void loadcell_init();
 void loadcell_loop();
 bool get_loadcell_sample(LoadcellRecord &sample);
+
+/// Number of samples waiting in the buffer
+size_t get_num_samples();
+
+/// Number of samples dropped due to a full buffer since boot
+uint32_t dropped_samples();
 void loadcell_irq();
 void loadcell_set_enable(bool enable);
 } // namespace dwarf::loadcell
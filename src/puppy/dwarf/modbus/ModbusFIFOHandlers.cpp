@@ -123,6 +123,22 @@ size_t handle_encoded_fifo(std::array<uint16_t, MODBUS_FIFO_LEN> &fifo) {
         }
     }
 
+    // Append the stream status so the buddy knows exactly whether to keep
+    // pulling and how many samples were lost to full buffers. When the
+    // transfer is packed too full for the trailer there clearly is more data
+    // pending and the buddy assumes so on its own.
+    if (encoder.can_encode<FifoStreamStatus>()) {
+        const size_t accelerometer_pending = dwarf::accelerometer::get_num_samples() / std::tuple_size<AccelerometerFastData>::value * (sizeof(Header) + sizeof(AccelerometerFastData));
+        const size_t loadcell_pending = dwarf::loadcell::get_num_samples() * (sizeof(Header) + sizeof(LoadcellRecord));
+        const FifoStreamStatus status {
+            .pending_bytes = static_cast<uint16_t>(accelerometer_pending + loadcell_pending),
+            .dropped_samples = static_cast<uint16_t>(dwarf::accelerometer::dropped_samples() + dwarf::loadcell::dropped_samples()),
+        };
+        if (!encoder.encode(status)) {
+            failed_to_encode();
+        }
+    }
+
     encoder.padd();
 
     return encoder.position();
@@ -228,6 +228,24 @@ static bool copy_file(const Path &source_path, const Path &target_path, Bootstra
     }
 }
 
+static bool file_hashes_match(const Path &source_path, const Path &target_path) {
+    struct stat source_stat;
+    struct stat target_stat;
+
+    if (stat(target_path.get(), &target_stat) != 0 || !S_ISREG(target_stat.st_mode)) {
+        return false;
+    }
+    if (stat(source_path.get(), &source_stat) != 0 || source_stat.st_size != target_stat.st_size) {
+        return false;
+    }
+
+    buddy::resources::Hash source_hash;
+    buddy::resources::Hash target_hash;
+    return buddy::resources::calculate_file_hash(source_hash, source_path.get())
+        && buddy::resources::calculate_file_hash(target_hash, target_path.get())
+        && source_hash == target_hash;
+}
+
 [[nodiscard]] static bool remove_directory_recursive(Path &path) {
     while (true) {
         errno = 0;
@@ -308,6 +326,97 @@ static bool remove_recursive_if_exists(Path &path) {
     }
 }
 
+/// Remove items under target which the source does not contain (or whose type
+/// changed), so that syncing the source over it ends up with the exact source
+/// content.
+[[nodiscard]] static bool remove_stale_items(Path &source, Path &target) {
+    std::optional<long> last_dir_location;
+
+    while (true) {
+        errno = 0;
+        // get info about the next item in the directory
+        std::unique_ptr<DIR, DIRDeleter> dir(opendir(target.get()));
+
+        if (dir.get() == nullptr) {
+            return false;
+        } else if (last_dir_location.has_value()) {
+            seekdir(dir.get(), last_dir_location.value());
+            if (errno != 0) {
+                log_error(Resources, "seekdir() failed: %i", errno);
+                return false;
+            }
+        }
+
+        struct dirent *entry = readdir(dir.get());
+        if (!entry && errno != 0) {
+            return false;
+        } else if (!entry) {
+            break;
+        }
+
+        // save current position
+        last_dir_location = telldir(dir.get());
+        if (errno != 0) {
+            return false;
+        }
+
+        // skip the entry immediately if "." or ".."
+        if (entry->d_type == DT_DIR && (strcmp(entry->d_name, ".") == 0 || strcmp(entry->d_name, "..") == 0)) {
+            continue;
+        }
+
+        // save info and close the dir to save resources
+        source.push(entry->d_name);
+        target.push(entry->d_name);
+        auto d_type = entry->d_type;
+        dir.reset();
+
+        // keep the item if the source has it with the same type, remove it otherwise
+        bool success;
+        bool removed = false;
+        struct stat sb;
+        const bool in_source = stat(source.get(), &sb) == 0;
+        if (d_type == DT_REG) {
+            if (in_source && S_ISREG(sb.st_mode)) {
+                success = true;
+            } else {
+                log_info(Resources, "Removing stale file %s", target.get());
+                success = remove(target.get()) == 0;
+                removed = true;
+            }
+        } else if (d_type == DT_DIR) {
+            if (in_source && S_ISDIR(sb.st_mode)) {
+                success = remove_stale_items(source, target);
+            } else {
+                log_info(Resources, "Removing stale directory %s", target.get());
+                success = remove_directory_recursive(target);
+                removed = true;
+            }
+        } else {
+            log_warning(Resources, "Unexpected item %hhu: %s; skipping", d_type, target.get());
+            success = true;
+        }
+
+        // restore previous state
+        source.pop();
+        target.pop();
+
+        if (!success) {
+            log_error(Resources, "Error when removing stale items under %s (errno %i)", target.get(), errno);
+            return false;
+        }
+
+        // removing an entry shifts the positions of those after it, so the
+        // saved location is no longer valid; rescan from the beginning (the
+        // already-checked entries pass the check again quickly)
+        if (removed) {
+            last_dir_location = std::nullopt;
+        }
+    }
+
+    return true;
+}
+
 static bool copy_resources_directory(Path &source, Path &target, BootstrapProgressReporter &reporter) {
     std::optional<long> last_dir_location;
 
@@ -356,9 +465,20 @@ static bool copy_resources_directory(Path &source, Path &target, BootstrapProgre
         // copy the item
         bool success;
         if (d_type == DT_REG) {
-            // copy file
-            log_info(Resources, "Copying file %s", source.get());
-            success = copy_file(source, target, reporter);
+            if (file_hashes_match(source, target)) {
+                // identical content already installed; count it as done
+                // without rewriting (flash wear, and reading is much faster)
+                log_info(Resources, "Keeping file %s", target.get());
+                struct stat fs;
+                if (stat(source.get(), &fs) == 0) {
+                    reporter.did_copy_bytes(fs.st_size);
+                }
+                success = true;
+            } else {
+                // copy file
+                log_info(Resources, "Copying file %s", source.get());
+                success = copy_file(source, target, reporter);
+            }
             reporter.did_copy_file();
         } else if (d_type == DT_DIR) {
             log_info(Resources, "Copying directory %s", source.get());
@@ -538,17 +658,29 @@ static bool do_bootstrap(const buddy::resources::Revision &revision, buddy::reso
         return false;
     }
 
-    // clear installed resources
+    // invalidate the installed revision; if the sync below gets interrupted,
+    // the halfway-updated mix must not be considered installed
     Path target_path("/internal/res");
     buddy::resources::InstalledRevision::clear();
-    if (remove_recursive_if_exists(target_path) == false) {
-        log_error(Resources, "Failed to remove the /internal/res directory");
-        return false;
+
+    // remove whatever the bbf does not contain; the rest stays in place and
+    // the sync below rewrites only the files whose content changed
+    source_path.set("/bbf");
+    struct stat target_stat;
+    if (stat(target_path.get(), &target_stat) == 0) {
+        if (!S_ISDIR(target_stat.st_mode)) {
+            if (remove_recursive_if_exists(target_path) == false) {
+                log_error(Resources, "Failed to remove the /internal/res file");
+                return false;
+            }
+        } else if (!remove_stale_items(source_path, target_path)) {
+            log_error(Resources, "Failed to remove stale items from /internal/res");
+            return false;
+        }
     }
 
-    // copy the resources
+    // sync the resources
     reporter.update_stage(BootstrapStage::CopyingFiles);
-    source_path.set("/bbf");
     if (!copy_resources_directory(source_path, target_path, reporter)) {
         log_error(Resources, "Failed to copy resources");
         return false;
@@ -563,6 +695,11 @@ static bool do_bootstrap(const buddy::resources::Revision &revision, buddy::reso
 
     if (revision.hash != current_hash) {
         log_error(Resources, "Installed resources but the hash does not match!");
+        // drop everything so the retry starts from a clean full copy instead
+        // of trusting the files the delta sync decided to keep
+        if (remove_recursive_if_exists(target_path) == false) {
+            log_error(Resources, "Failed to remove the /internal/res directory");
+        }
         return false;
     }
 
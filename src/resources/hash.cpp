@@ -148,6 +148,34 @@ static bool update_hash_with_directory(const char *root, Path &path, HashContext
     return true;
 }
 
+bool buddy::resources::calculate_file_hash(Hash &hash, const char *filepath) {
+    HashContext sha_ctx;
+
+    unique_file_ptr file(fopen(filepath, "rb"));
+    if (file.get() == nullptr) {
+        return false;
+    }
+
+    // hash just the file content (no path, no marks), so the result can be
+    // compared between two copies of the file living under different roots
+    uint8_t buffer[128];
+    while (true) {
+        int read = fread(buffer, 1, sizeof(buffer), file.get());
+        if (read > 0) {
+            sha_ctx.append_data(buffer, read);
+        }
+        if (ferror(file.get())) {
+            return false;
+        }
+        if (feof(file.get())) {
+            break;
+        }
+    }
+
+    sha_ctx.finish(hash);
+    return true;
+}
+
 bool buddy::resources::calculate_directory_hash(Hash &hash, const char *root) {
     HashContext sha_ctx;
     const Path root_dir(root);
@@ -2,6 +2,7 @@
 #include <tcpip.h>
 
 #include <lwip/udp.h>
+#include <lwip/sys.h>
 #include <dns.h>
 #include <common/tcpip_callback_nofail.hpp>
 #include <common/pbuf_deleter.hpp>
@@ -26,6 +27,22 @@ LWIP_MEMPOOL_DECLARE(SYSLOG_MSGS, 4, sizeof(Msg), "Syslog messages waiting for b
 
 std::atomic<bool> pool_initialized = false;
 
+// How often to re-run the DNS query for a working endpoint. The resolver's
+// cache honors the record's TTL, so as long as that still runs, the query is
+// answered locally and this just keeps the cache entry warm; once it does go
+// to the network, it also picks up a moved endpoint.
+constexpr uint32_t dns_refresh_ms = 5 * 60 * 1000;
+
+// How long a failed resolution stays failed. A negative answer is almost
+// certainly still valid a few seconds later, no need to fire a new query for
+// every single message.
+constexpr uint32_t dns_retry_ms = 10 * 1000;
+
+// Occupancy of the shared pool and the number of messages lost anywhere in
+// the transport, so the users can tell a quiet link from a drowning one.
+std::atomic<uint8_t> in_flight = 0;
+std::atomic<uint32_t> dropped = 0;
+
 void release(Msg *msg) {
     if (msg) {
         if (msg->message != nullptr) {
@@ -34,6 +51,7 @@ void release(Msg *msg) {
         }
 
         LWIP_MEMPOOL_FREE(SYSLOG_MSGS, msg);
+        in_flight.fetch_sub(1, std::memory_order_relaxed);
     }
 }
 } // namespace
@@ -103,12 +121,15 @@ void SyslogTransport::send(const char *message, int message_len) {
     if (!msg) {
         // Out of memory for the messages (there are too many in
         // flight already)
+        dropped.fetch_add(1, std::memory_order_relaxed);
         return;
     }
+    in_flight.fetch_add(1, std::memory_order_relaxed);
 
     msg->me = this;
     msg->message = pbuf_alloc(PBUF_TRANSPORT, message_len, PBUF_RAM);
     if (msg->message == nullptr) {
+        dropped.fetch_add(1, std::memory_order_relaxed);
         return release(msg);
     }
 
@@ -124,17 +145,32 @@ void SyslogTransport::send(const char *message, int message_len) {
 
     if (post != ERR_OK) {
         // We failed to send the message. Therefore it is up to us to return the buffer.
+        dropped.fetch_add(1, std::memory_order_relaxed);
         release(msg);
     }
 }
 
+uint8_t SyslogTransport::queue_occupancy() {
+    return in_flight.load(std::memory_order_relaxed);
+}
+
+uint32_t SyslogTransport::dropped_count() {
+    return dropped.load(std::memory_order_relaxed);
+}
+
 void SyslogTransport::do_send(pbuf *message) {
     if (remote_port == 0) {
         // Transport disabled
         return;
     }
 
-    if (dns_resolved == DnsState::None) {
+    const uint32_t now = sys_now();
+    const bool failed_recently = dns_queried_at != 0 && now - dns_queried_at < dns_retry_ms;
+    const bool refresh_due = now - dns_queried_at >= dns_refresh_ms;
+
+    if ((dns_resolved == DnsState::None && !failed_recently) || (dns_resolved == DnsState::Resolved && refresh_due)) {
+        const bool refresh = dns_resolved == DnsState::Resolved;
+        dns_queried_at = now;
         // resolve hostname
         ip_addr_t ip4_addr;
         err_t dns_result = dns_gethostbyname(
@@ -147,18 +183,20 @@ void SyslogTransport::do_send(pbuf *message) {
             dns_done_callback(&ip4_addr);
             break;
         case ERR_INPROGRESS:
-            dns_resolved = DnsState::Progress;
-            // Callback will be called.
+            // Callback will be called. When refreshing, keep sending to the
+            // old address in the meantime.
+            dns_resolved = refresh ? DnsState::Refresh : DnsState::Progress;
             break;
         default:
             // Should not happen
-            dns_resolved = DnsState::None;
+            dns_resolved = refresh ? DnsState::Resolved : DnsState::None;
             break;
         }
     }
 
-    if (dns_resolved != DnsState::Resolved) {
+    if (dns_resolved != DnsState::Resolved && dns_resolved != DnsState::Refresh) {
         // Still waiting for the IP address. Drop the message, try next time.
+        dropped.fetch_add(1, std::memory_order_relaxed);
         return;
     }
 
@@ -166,9 +204,11 @@ void SyslogTransport::do_send(pbuf *message) {
         socket.reset(udp_new());
         if (!socket) {
             // Not enough memory for the UDP socket, try next time.
+            dropped.fetch_add(1, std::memory_order_relaxed);
             return;
         }
         if (udp_bind(socket.get(), IP_ADDR_ANY, 0) != ERR_OK) {
+            dropped.fetch_add(1, std::memory_order_relaxed);
             socket.reset();
             return;
         }
@@ -176,12 +216,16 @@ void SyslogTransport::do_send(pbuf *message) {
 
     switch (udp_sendto(socket.get(), message, &addr, remote_port)) {
     case ERR_OK:
+        break;
     case ERR_MEM:
     case ERR_RTE:
         // These don't mean the PCB is broken, so keep it around.
+        // The message is gone either way though.
+        dropped.fetch_add(1, std::memory_order_relaxed);
         break;
     default:
         // Some other (unknown) error, better kill the PCB and start fresh next time.
+        dropped.fetch_add(1, std::memory_order_relaxed);
         close();
         socket.reset();
         break;
@@ -190,13 +234,17 @@ void SyslogTransport::do_send(pbuf *message) {
 
 void SyslogTransport::close() {
     dns_resolved = DnsState::None;
+    dns_queried_at = 0;
 }
 
 void SyslogTransport::dns_done_callback(const ip_addr_t *ip) {
-    if (ip == nullptr) {
-        dns_resolved = DnsState::None;
-    } else {
+    if (ip != nullptr) {
         addr = *ip;
         dns_resolved = DnsState::Resolved;
+    } else if (dns_resolved == DnsState::Refresh) {
+        // The refresh failed, but the old address is still our best bet.
+        dns_resolved = DnsState::Resolved;
+    } else {
+        dns_resolved = DnsState::None;
     }
 }
@@ -22,9 +22,15 @@ private:
         None,
         Resolved,
         Progress,
+        // A still-valid resolved address, with a refresh query running in
+        // the background. Sending is allowed in this state.
+        Refresh,
     };
 
     DnsState dns_resolved = DnsState::None;
+    // sys_now() of the last query we started, successful or not. Drives
+    // both the periodic refresh and the backoff after a failure.
+    uint32_t dns_queried_at = 0;
     ip_addr_t addr;
     char remote_host[config_store_ns::connect_host_size + 1] = "";
     uint16_t remote_port = 0;
@@ -48,6 +54,22 @@ public:
      */
     void send(const char *message, int message_len);
 
+    /**
+     * How many messages currently sit in the shared in-flight pool.
+     *
+     * The pool (and therefore this number) is shared by all instances.
+     * Callers may use it to shed low-priority traffic before the pool
+     * overflows and starts dropping indiscriminately.
+     */
+    static uint8_t queue_occupancy();
+
+    /**
+     * How many messages the transport itself has dropped since boot
+     * (out of buffers, unresolved DNS, no route, ...). Shared by all
+     * instances, same as the pool.
+     */
+    static uint32_t dropped_count();
+
 private:
     void close();
 
@@ -133,6 +133,11 @@ void ChangedPath::ensure_chain_init() {
     }
 }
 
+uint32_t ChangedPath::change_generation() {
+    ensure_chain_init();
+    return changed_chain_hash_base.load();
+}
+
 uint32_t ChangedPath::change_chain_hash(const char *path) {
     uint32_t crc = changed_chain_hash_base.load();
     crc = crc32_calc_ex(crc, reinterpret_cast<const uint8_t *>(path), strlen(path));
@@ -121,6 +121,14 @@ public:
     ///   done so, to make sure the RNG is initialized at that point).
     uint32_t change_chain_hash(const char *dirpath);
 
+    /// An opaque value that changes whenever any filesystem change (or a
+    /// media insert/removal) is recorded here.
+    ///
+    /// Usable as a cheap generation counter by caches built on top of
+    /// directory listings ‒ it is the base of the change chain hash above,
+    /// without any path mixed in.
+    uint32_t change_generation();
+
     /// Track the state of a media being inserted.
     ///
     /// Shall be called often enough by someone, based on the info in marlin
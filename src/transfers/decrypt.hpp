@@ -44,6 +44,11 @@ public:
     // Decrypts some data from in-buffer to the out-buffer.
     //
     // Returns how much was consumed of each buffer. Will make at least some progress.
+    //
+    // There is no internal working buffer and in == out is fine (AES-CTR can
+    // run in place). The download path passes the lwip pbuf payload as the
+    // in-buffer and the PartialFile sector buffer as the out-buffer directly,
+    // so each downloaded byte is touched exactly once on its way to the USB.
     std::tuple<size_t, size_t> decrypt(const uint8_t *in, size_t in_size, uint8_t *out, size_t out_size);
 };
 
@@ -1,5 +1,6 @@
 #include "download.hpp"
 #include "files.hpp"
+#include "transfer.hpp"
 
 #include <freertos/binary_semaphore.hpp>
 #include <common/http/resp_parser.h>
@@ -63,6 +64,10 @@ constexpr size_t MAX_REQ_SIZE = 512;
 // (hopefully).
 constexpr uint32_t INLINE_SEGMENT_SIZE = 512 * 512;
 
+// Ranges smaller than this are not worth the overhead of a second parallel
+// connection (the connection setup takes roughly one round trip too).
+constexpr uint32_t PARALLEL_MIN_RANGE = 1024 * 1024;
+
 } // namespace
 
 namespace transfers {
@@ -104,19 +109,31 @@ public:
 
         Splice(Async *owner, size_t transfer_rest)
             : owner(owner)
-            , transfer_rest(transfer_rest) {}
+            , transfer_rest(transfer_rest) {
+            file_cursor = owner->write_cursor;
+        }
 
         virtual PartialFile *file() const override {
             return owner->destination.get();
         }
 
         virtual tuple<size_t, size_t> write(const uint8_t *in, size_t in_size, uint8_t *out, size_t out_size) override {
+            // Ask the rate governor first, so we don't starve the media
+            // prefetch of a running print. Claiming nothing means we report
+            // would-block and the data waits in the TCP queue.
+            in_size = DownloadThrottle::instance.take(in_size);
+            if (in_size == 0) {
+                return make_tuple(0, 0);
+            }
             return owner->decryptor->decrypt(in, in_size, out, out_size);
         }
 
         virtual optional<tuple<Status, const char *>> done() override {
             bool success = (transfer_rest == 0);
             if (success) {
+                // Flushes only our own cursor; the other connection of a
+                // parallel download (if any) syncs its one when it finishes.
+                owner->destination->select_cursor(file_cursor);
                 success = owner->destination->sync();
             } // else - we potentially have an incomplete segment and we don't want to store that one.
             owner->done(success ? DownloadStep::Finished : DownloadStep::FailedNetwork);
@@ -135,11 +152,18 @@ public:
     PartialFile::Ptr destination;
     // TODO: Make it in-place inside phase_payload instead of passing in?
     std::unique_ptr<Decryptor> decryptor;
+    // PartialFile write cursor we write through (a parallel download runs one
+    // Async per connection, each with its own cursor)
+    const uint8_t write_cursor;
+    // Do we require the 206 Partial Content response (we asked for a range not starting at 0)?
+    const bool expect_partial_content;
 
-    Async(const char *hostname, uint16_t port, const char *path, PartialFile::Ptr destination, std::unique_ptr<Decryptor> decryptor, uint32_t start_range, optional<uint32_t> end_range)
+    Async(const char *hostname, uint16_t port, const char *path, PartialFile::Ptr destination, std::unique_ptr<Decryptor> decryptor, uint32_t start_range, optional<uint32_t> end_range, uint8_t write_cursor)
         : phase_payload(Request { {}, port, {}, start_range, end_range, {} })
         , destination(move(destination))
-        , decryptor(move(decryptor)) {
+        , decryptor(move(decryptor))
+        , write_cursor(write_cursor)
+        , expect_partial_content(start_range != 0) {
         auto &request = get<Request>(phase_payload);
         strlcpy(request.hostname, hostname, sizeof request.hostname);
         strlcpy(request.path, path, sizeof request.path);
@@ -231,7 +255,7 @@ public:
             return ERR_ABRT;
         }
 
-        if (destination->tell() != 0 && status != Status::PartialContent) {
+        if (expect_partial_content && status != Status::PartialContent) {
             done(DownloadStep::FailedRemote);
             return ERR_ABRT;
         }
@@ -443,18 +467,50 @@ void Download::AsyncDeleter::operator()(Async *a) {
     }
 }
 
-Download::Download(const Request &request, PartialFile::Ptr destination, uint32_t start_range, optional<uint32_t> end_range) {
+Download::Download(const Request &request, PartialFile::Ptr destination, uint32_t start_range, optional<uint32_t> end_range, unsigned max_connections) {
     if (const auto *encrypted = get_if<Request::Encrypted>(&request.data); encrypted) {
         assert(encrypted->encryption);
         size_t file_size = encrypted->encryption->orig_size;
-        auto decryptor = make_unique<Decryptor>(encrypted->encryption->key, encrypted->encryption->nonce, start_range, file_size - start_range);
         assert(destination);
 
+        // Where to split the range between two parallel connections (if at all).
+        //
+        // Sector-aligned, so neither connection ends up with a partially
+        // buffered sector inside the other one's region.
+        optional<uint32_t> split;
+        const uint32_t range_end = end_range.has_value() ? *end_range + 1 : file_size;
+        if (max_connections >= 2 && PartialFile::WRITE_CURSORS >= 2 && range_end - start_range >= PARALLEL_MIN_RANGE) {
+            const uint32_t mid = start_range + (range_end - start_range) / 2;
+            split = mid / PartialFile::SECTOR_SIZE * PartialFile::SECTOR_SIZE;
+        }
+
+        auto decryptor = make_unique<Decryptor>(encrypted->encryption->key, encrypted->encryption->nonce, start_range, split.value_or(file_size) - start_range);
+
+        // Position the cursors before the connections start - once they do,
+        // the cursors belong to the tcpip thread.
         destination->seek(start_range);
-        AsyncPtr async(new Async(encrypted->host, encrypted->port, encrypted->url_path, move(destination), move(decryptor), start_range, end_range));
+        if (split.has_value()) {
+            destination->select_cursor(1);
+            destination->seek(*split);
+            destination->select_cursor(0);
+        }
+
+        AsyncPtr async(new Async(encrypted->host, encrypted->port, encrypted->url_path, destination, move(decryptor), start_range, split.has_value() ? optional<uint32_t>(*split - 1) : end_range, /*write_cursor=*/0));
         Async *async_raw = async.get();
         engine = std::move(async);
+
+        Async *secondary_raw = nullptr;
+        if (split.has_value()) {
+            auto secondary_decryptor = make_unique<Decryptor>(encrypted->encryption->key, encrypted->encryption->nonce, *split, file_size - *split);
+            AsyncPtr secondary_async(new Async(encrypted->host, encrypted->port, encrypted->url_path, move(destination), move(secondary_decryptor), *split, end_range, /*write_cursor=*/1));
+            secondary_raw = secondary_async.get();
+            secondary = std::move(secondary_async);
+        }
+
         tcpip_callback_nofail(Async::start_wrapped, async_raw);
+        if (secondary_raw != nullptr) {
+            tcpip_callback_nofail(Async::start_wrapped, secondary_raw);
+        }
     } else {
         const auto &in = get<Request::Inline>(request.data);
         destination->seek(start_range);
@@ -478,7 +534,19 @@ Download::Download(const Request &request, PartialFile::Ptr destination, uint32_
 
 DownloadStep Download::step() {
     if (auto *async = get_if<AsyncPtr>(&engine); async != nullptr) {
-        return (*async)->status();
+        DownloadStep status = (*async)->status();
+        if (secondary) {
+            const DownloadStep secondary_status = secondary->status();
+            if (status == DownloadStep::Continue || status == DownloadStep::Finished) {
+                if (secondary_status != DownloadStep::Finished) {
+                    // An error on the second connection fails the whole
+                    // download; Finished needs both halves to be done.
+                    // (Errors on the primary take precedence.)
+                    status = secondary_status;
+                }
+            }
+        }
+        return status;
     } else {
         const auto &in = get<InlinePtr>(engine);
         if (in->status != DownloadStep::Continue) {
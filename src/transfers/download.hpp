@@ -151,6 +151,9 @@ private:
     using InlinePtr = std::unique_ptr<Inline>;
     using Engine = std::variant<AsyncPtr, InlinePtr>;
     Engine engine;
+    // Second connection of the parallel download (downloading the latter half
+    // of the range); null in the usual single-connection case.
+    AsyncPtr secondary;
 
 public:
     /// Makes an HTTP request.
@@ -158,8 +161,14 @@ public:
     /// \param request The request to make.
     /// \param destination The destination file. If PartialFile is provided, it has to match the final file size. If a string is provided, the PartialFile will be created with the same name.
     /// \param offset The offset to start the download from.
+    /// \param max_connections If 2 (and the range is large enough, and the printer has a second PartialFile
+    ///        write cursor), the range is split between two parallel connections - the first one grows the
+    ///        valid head of the file, the second one the valid tail. This helps the throughput on
+    ///        high-latency links, where a single connection can't fill the pipe. Only for the encrypted
+    ///        (non-inline) requests; the caller must make sure the regions map onto the head/tail tracking
+    ///        of the PartialFile (eg. no pre-existing valid tail).
     /// \return A Download object if the request was successful and the caller is expected to call step() in a loop to continue with the download.
-    Download(const Request &request, PartialFile::Ptr destination, uint32_t start_range = 0, std::optional<uint32_t> end_range = std::nullopt);
+    Download(const Request &request, PartialFile::Ptr destination, uint32_t start_range = 0, std::optional<uint32_t> end_range = std::nullopt, unsigned max_connections = 1);
     Download(Download &&other) = default;
     Download(const Download &other) = delete;
     Download &operator=(Download &&other) = default;
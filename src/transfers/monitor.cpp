@@ -20,6 +20,28 @@ size_t strlcpy(char *, const char *, size_t);
 
 namespace transfers {
 
+namespace {
+
+    double estimate_progress(size_t valid_size, size_t expected) {
+        if (expected > 0) {
+            return static_cast<double>(valid_size) / static_cast<double>(expected);
+        } else {
+            return 0;
+        }
+    }
+
+    uint32_t estimate_time_remaining(uint32_t elapsed, double progress) {
+        if (progress > 0.0) {
+            double total_expected = elapsed / progress;
+            return total_expected - elapsed;
+        } else {
+            // No estimate yet, just give them a 0
+            return 0;
+        }
+    }
+
+} // namespace
+
 Monitor::Slot::Slot(Monitor &owner)
     : owner(owner)
     , live(true) {}
@@ -59,26 +81,34 @@ Monitor::Slot &Monitor::Slot::operator=([[maybe_unused]] Slot &&other) {
 void Monitor::Slot::update_expected_size(size_t expected) {
     Lock lock(owner.main_mutex);
 
+    owner.snapshot_write_begin();
     owner.expected = expected;
+    owner.snapshot_write_end();
 }
 
 void Monitor::Slot::progress(PartialFile::State download_progress, bool has_issue) {
     Lock lock(owner.main_mutex);
 
+    owner.snapshot_write_begin();
     owner.download_progress = download_progress;
     owner.download_has_issue = has_issue;
+    owner.snapshot_write_end();
 }
 
 void Monitor::Slot::progress(size_t add_bytes) {
     Lock lock(owner.main_mutex);
 
+    owner.snapshot_write_begin();
     owner.download_progress.extend_head(add_bytes);
+    owner.snapshot_write_end();
 }
 
 void Monitor::Slot::reset_progress() {
     Lock lock(owner.main_mutex);
 
+    owner.snapshot_write_begin();
     owner.download_progress = PartialFile::State();
+    owner.snapshot_write_end();
 }
 
 const char *Monitor::Slot::destination() {
@@ -133,6 +163,53 @@ optional<Monitor::Status> Monitor::status(bool allow_stale) const {
     return result;
 }
 
+void Monitor::snapshot_write_begin() {
+    // Odd value = write in progress. Updates are rare and short, so we go for
+    // the obviously correct sequentially consistent increments instead of
+    // playing games with weaker orderings.
+    snapshot_seq.fetch_add(1);
+}
+
+void Monitor::snapshot_write_end() {
+    snapshot_seq.fetch_add(1);
+}
+
+optional<Monitor::Snapshot> Monitor::snapshot(bool allow_stale) const {
+    Snapshot result;
+
+    for (;;) {
+        const uint32_t seq_before = snapshot_seq.load();
+        if (seq_before % 2 == 1) {
+            // A write is in progress right now, try again.
+            continue;
+        }
+
+        // Note: We may race with a writer and copy torn data here. That's
+        // fine ‒ the sequence re-check below detects it and we throw such a
+        // copy away and retry.
+        const bool was_used = used;
+        const bool active = transfer_active;
+        result.type = type;
+        result.id = current_id;
+        result.start = start;
+        result.expected = expected;
+        result.print_after_upload = print_after_upload;
+        result.download_progress = download_progress;
+        result.download_has_issue = download_has_issue;
+        static_assert(sizeof result.destination_path == sizeof destination_path);
+        memcpy(result.destination_path, destination_path, sizeof result.destination_path);
+
+        if (snapshot_seq.load() == seq_before) {
+            // Nobody wrote in the meantime, the copy is consistent.
+            if (!was_used || (!allow_stale && !active)) {
+                return nullopt;
+            }
+
+            return result;
+        }
+    }
+}
+
 optional<Monitor::Outcome> Monitor::outcome(TransferId id) const {
     Lock lock(history_mutex);
 
@@ -185,6 +262,8 @@ optional<Monitor::Slot> Monitor::allocate(Type type, const char *dest, size_t ex
         current_id = rand_u();
     }
 
+    snapshot_write_begin();
+
     // Order matters, these are atomics, and observable from another thread.
     // First change the ID before „activating“ the transfer.
     if (override_id.has_value()) {
@@ -213,6 +292,8 @@ optional<Monitor::Slot> Monitor::allocate(Type type, const char *dest, size_t ex
         destination_path[0] = '\0';
     }
 
+    snapshot_write_end();
+
     return Slot(*this);
 }
 
@@ -246,27 +327,27 @@ const char *to_str(Monitor::Type type) {
 }
 
 double Monitor::Status::progress_estimate() const {
-    if (expected > 0) {
-        return static_cast<double>(download_progress.get_valid_size()) / static_cast<double>(expected);
-    } else {
-        return 0;
-    }
+    return estimate_progress(download_progress.get_valid_size(), expected);
 }
 
 uint32_t Monitor::Status::time_remaining_estimate() const {
-    uint32_t elapsed = ticks_s() - start;
-    double progress = progress_estimate();
-    if (progress > 0.0) {
-        double total_expected = elapsed / progress;
-        return total_expected - elapsed;
-    } else {
-        // No estimate yet, just give them a 0
-        return 0;
-    }
+    return estimate_time_remaining(ticks_s() - start, progress_estimate());
 }
 
 uint32_t Monitor::Status::time_transferring() const {
     return ticks_s() - start;
 }
 
+double Monitor::Snapshot::progress_estimate() const {
+    return estimate_progress(download_progress.get_valid_size(), expected);
+}
+
+uint32_t Monitor::Snapshot::time_remaining_estimate() const {
+    return estimate_time_remaining(ticks_s() - start, progress_estimate());
+}
+
+uint32_t Monitor::Snapshot::time_transferring() const {
+    return ticks_s() - start;
+}
+
 } // namespace transfers
@@ -74,6 +74,9 @@ using Timestamp = uint32_t;
 ///   long as the Status itself is alive.
 /// * The outcome and current_id are independent of the main locking and
 ///   never deadlock.
+/// * A Snapshot is exempt from all of the above ‒ it holds no lock, may be
+///   kept alive for arbitrarily long and can be taken even while the same
+///   thread holds a Slot or a Status.
 class Monitor {
 private:
     using Mutex = freertos::Mutex;
@@ -160,6 +163,43 @@ public:
         uint32_t time_transferring() const;
     };
 
+    /// A read-only snapshot of the running transfer.
+    ///
+    /// Unlike Status, this holds no lock ‒ it is a plain copy of the data,
+    /// acquired through a seqlock, so obtaining one never blocks the transfer
+    /// thread and it may be kept alive for as long as needed. The price is
+    /// that it doesn't follow any updates happening after it was taken.
+    ///
+    /// Meant for pollers (the nhttp status endpoints, GUI) that only render
+    /// the progress and don't need to coordinate with the transfer itself.
+    class Snapshot {
+    private:
+        friend class Monitor;
+        char destination_path[FILE_PATH_BUFFER_LEN + FILE_NAME_MAX_LEN];
+
+    public:
+        /// The fields have the same meaning as in Status.
+        Type type;
+        TransferId id;
+        Timestamp start;
+        size_t expected;
+        bool print_after_upload;
+        PartialFile::State download_progress;
+        bool download_has_issue;
+
+        /// The path where the transfer will be stored (once it's done).
+        ///
+        /// Unlike Status::destination, this points into the snapshot itself,
+        /// so it stays valid (and unchanged) for its whole lifetime.
+        const char *destination() const {
+            return destination_path[0] != '\0' ? destination_path : nullptr;
+        }
+
+        double progress_estimate() const;
+        uint32_t time_remaining_estimate() const;
+        uint32_t time_transferring() const;
+    };
+
     /// An allocated transfer slot.
     ///
     /// Keep alive while the transfer is running.
@@ -227,6 +267,17 @@ private:
     std::atomic<bool> transfer_active = false;
     std::atomic<TransferId> current_id = 0;
 
+    // Sequence counter of the seqlock protecting lock-free reads of the
+    // transfer-related fields below (odd while a write is in progress).
+    // Writers hold main_mutex anyway; they additionally bump this around any
+    // modification so that snapshot() can read without taking the mutex.
+    std::atomic<uint32_t> snapshot_seq = 0;
+
+    // Bracket any modification of the transfer-related fields with these
+    // (while holding main_mutex).
+    void snapshot_write_begin();
+    void snapshot_write_end();
+
     // Transfer related
     bool used = false;
     bool stopped = false;
@@ -275,6 +326,13 @@ public:
     /// advised to compare the original transfer ID with the new one and decide
     /// what to do if they are different.
     std::optional<Status> status(bool allow_stale = false) const;
+
+    /// Like status(), but returns a lock-free copy of the data.
+    ///
+    /// Never blocks the transfer thread (it may retry the read a few times if
+    /// an update happens concurrently, but updates are short). See Snapshot
+    /// for details; allow_stale works the same way as in status().
+    std::optional<Snapshot> snapshot(bool allow_stale = false) const;
     /// The outcome of a past transfer.
     ///
     /// It is possible to request an outcome of already complete transfer by
@@ -4,6 +4,7 @@
 #include <buddy/filesystem_fatfs.h>
 #include <common/unique_file_ptr.hpp>
 #include <common/bsod.h>
+#include <common/metric.h>
 #include <logging/log.hpp>
 
 #include <algorithm>
@@ -21,20 +22,24 @@ using std::variant;
 static_assert(PartialFile::SECTOR_SIZE == FF_MAX_SS);
 static_assert(PartialFile::SECTOR_SIZE == FF_MIN_SS);
 
+// Write coalescing: how many USB write requests / sectors the incoming bytes
+// turned into (the write amplification of the transfer).
+METRIC_DEF(metric_transfer_usb_write, "pfile_write", METRIC_VALUE_CUSTOM, 1000, METRIC_ENABLED);
+
 PartialFile::PartialFile(UsbhMscRequest::LunNbr lun, UsbhMscRequest::SectorNbr first_sector, State state, int file_lock)
     : sector_pool(lun, usb_msc_write_finished_callback, this)
     , write_error(false)
     , first_sector_nbr(first_sector)
-    , current_sector(nullptr)
-    , current_offset(0)
     , state(state)
     , last_progress_percent(-1)
     , file_lock(file_lock) {
 }
 
 PartialFile::~PartialFile() {
-    // the current sector may contain incomplete content, so we must avoid overwriting potentially valid data
-    discard_current_sector();
+    // the cursors' sectors may contain incomplete content, so we must avoid overwriting potentially valid data
+    for (auto &cursor : cursors) {
+        discard_current_sector(cursor);
+    }
     // synchronization is required due to the validity of callback pointers
     sector_pool.sync(0, true);
     if (file_lock != -1) {
@@ -70,38 +75,46 @@ variant<const char *, PartialFile::Ptr> PartialFile::create(const char *path, si
     return PartialFile::convert(path, std::move(file), State());
 }
 
-variant<const char *, PartialFile::Ptr> PartialFile::open(const char *path, State state, bool ignore_opened) {
+variant<const char *, PartialFile::Ptr> PartialFile::open(const char *path, State state, bool ignore_opened, std::optional<UsbhMscRequest::SectorNbr> expected_first_sector) {
     unique_file_ptr file(fopen(path, ignore_opened ? "rb" : "rb+"));
 
     if (!file) {
         return "Failed to open file";
     }
 
-    return PartialFile::convert(path, std::move(file), state);
+    return PartialFile::convert(path, std::move(file), state, expected_first_sector);
 }
 
-variant<const char *, PartialFile::Ptr> PartialFile::convert(const char *path, unique_file_ptr file, State state) {
+variant<const char *, PartialFile::Ptr> PartialFile::convert(const char *path, unique_file_ptr file, State state, std::optional<UsbhMscRequest::SectorNbr> expected_first_sector) {
     FIL *fatfs_file = filesystem_fastfs_get_underlying_struct(file.get());
     if (!fatfs_file) {
         return "Failed to open file";
     }
 
+    // get first sector
+    auto drive = fatfs_file->obj.fs->pdrv;
+    auto lba = fatfs_file->obj.fs->database + fatfs_file->obj.fs->csize * (fatfs_file->obj.sclust - 2);
+
     // check file contiguity
-    int is_contiguous = 0;
-    auto result = fatfs_test_contiguous_file(fatfs_file, &is_contiguous);
-    if (result != FR_OK) {
-        return "Failed to check file contiguity";
-    }
-    if (!is_contiguous) {
-        return "File is not contiguous";
+    //
+    // The check walks the whole cluster chain, reading through the FAT bit by
+    // bit, which on big files takes long enough for the printer to look hung.
+    // If the caller recorded where the file started when it passed the check
+    // before and the file still starts there, it is the very same allocation
+    // (FAT doesn't move chains around) and we can skip the walk.
+    if (!expected_first_sector.has_value() || *expected_first_sector != lba) {
+        int is_contiguous = 0;
+        auto result = fatfs_test_contiguous_file(fatfs_file, &is_contiguous);
+        if (result != FR_OK) {
+            return "Failed to check file contiguity";
+        }
+        if (!is_contiguous) {
+            return "File is not contiguous";
+        }
     }
 
     state.total_size = f_size(fatfs_file);
 
-    // get first sector
-    auto drive = fatfs_file->obj.fs->pdrv;
-    auto lba = fatfs_file->obj.fs->database + fatfs_file->obj.fs->csize * (fatfs_file->obj.sclust - 2);
-
     // We want to keep a *read only* file open for our lifetime to prevent
     // someone from deleting it (and us then writing into sectors no longer
     // allocated for the file and other funny things).
@@ -134,8 +147,8 @@ size_t PartialFile::get_offset(UsbhMscRequest::SectorNbr sector_nbr) {
 }
 
 bool PartialFile::write_current_sector() {
-    assert(current_sector != nullptr);
-    log_debug(transfers, "Sending sector over USB %" PRIu32 " (%.20s)", current_sector->sector_nbr, current_sector->data);
+    assert(cursor().sector != nullptr);
+    log_debug(transfers, "Sending sector over USB %" PRIu32 " (%.20s)", cursor().sector->sector_nbr, cursor().sector->data);
     if (lseek(file_lock, 0, SEEK_SET) == -1) {
         // Safety measure. It is possible that between creation of this
         // PartialFile and current call to write_sector, the USB got unplugged
@@ -155,12 +168,12 @@ bool PartialFile::write_current_sector() {
         // to do so.
         return false;
     }
-    const uint32_t slot_idx = reinterpret_cast<uint32_t>(current_sector->callback_param2);
-    auto start = get_offset(current_sector->sector_nbr);
-    auto end = current_offset;
+    const uint32_t slot_idx = reinterpret_cast<uint32_t>(cursor().sector->callback_param2);
+    auto start = get_offset(cursor().sector->sector_nbr);
+    auto end = cursor().offset;
     auto len = end - start;
     // Round up to full sectors
-    current_sector->count = (len + SECTOR_SIZE - 1) / SECTOR_SIZE;
+    cursor().sector->count = (len + SECTOR_SIZE - 1) / SECTOR_SIZE;
     // Synchronized through release-acquire pair through the queue into USB thread
     future_extend[slot_idx] = ValidPart { start, end };
     // This _in theory_ can block, which we don't like. But, as the queue for
@@ -170,58 +183,68 @@ bool PartialFile::write_current_sector() {
     //
     // So we don't complicate the things and keep it this way (at worst, we
     // will stall tcpip thread for a short bit).
-    auto result = usbh_msc_submit_request(current_sector);
+    auto result = usbh_msc_submit_request(cursor().sector);
     if (result != USBH_OK) {
         return false;
     }
+
+    const uint32_t requests = stat_write_requests.fetch_add(1, std::memory_order_relaxed) + 1;
+    const uint32_t sectors = stat_write_sectors.fetch_add(cursor().sector->count, std::memory_order_relaxed) + cursor().sector->count;
+    metric_record_custom(&metric_transfer_usb_write, " req=%" PRIu32 "i,sect=%" PRIu32 "i,recv=%" PRIu32 "i", requests, sectors, stat_bytes_accepted.load(std::memory_order_relaxed));
+
     return true;
 }
 
+void PartialFile::select_cursor(size_t idx) {
+    assert(idx < cursors.size());
+    active_cursor_idx = idx;
+}
+
 bool PartialFile::seek(size_t offset) {
     auto new_sector = get_sector_nbr(offset);
 
-    if (current_sector && current_sector->sector_nbr == new_sector) {
-        current_offset = offset;
+    if (cursor().sector && cursor().sector->sector_nbr == new_sector) {
+        cursor().offset = offset;
         return true;
     }
 
-    if (current_sector && current_sector->sector_nbr != new_sector) {
-        log_warning(transfers, "Discarding buffered data for sector %" PRIu32, current_sector->sector_nbr);
+    if (cursor().sector && cursor().sector->sector_nbr != new_sector) {
+        log_warning(transfers, "Discarding buffered data for sector %" PRIu32, cursor().sector->sector_nbr);
     }
 
-    current_offset = offset;
-    discard_current_sector();
+    cursor().offset = offset;
+    discard_current_sector(cursor());
     return true;
 }
 
-void PartialFile::discard_current_sector() {
-    if (current_sector) {
-        sector_pool.release(reinterpret_cast<uint32_t>(current_sector->callback_param2));
-        current_sector = nullptr;
+void PartialFile::discard_current_sector(WriteCursor &cursor) {
+    if (cursor.sector) {
+        sector_pool.release(reinterpret_cast<uint32_t>(cursor.sector->callback_param2));
+        cursor.sector = nullptr;
     }
 }
 
 PartialFile::BufferPeek PartialFile::get_current_buffer(bool block_waiting) {
-    if (!current_sector) {
-        if (current_offset >= state.total_size) {
+    if (!cursor().sector) {
+        if (cursor().offset >= state.total_size) {
             return OutOfRange {};
         }
-        const auto sector_nbr = get_sector_nbr(current_offset);
+        const auto sector_nbr = get_sector_nbr(cursor().offset);
 
-        current_sector = sector_pool.acquire(block_waiting);
-        if (current_sector == nullptr) {
+        cursor().sector = sector_pool.acquire(block_waiting);
+        if (cursor().sector == nullptr) {
             if (block_waiting) {
                 return WriteError {};
             } else {
                 return WouldBlock {};
             }
         }
-        current_sector->sector_nbr = sector_nbr;
+        cursor().sector->sector_nbr = sector_nbr;
     }
 
-    const size_t buffer_offset = current_offset - get_offset(current_sector->sector_nbr);
+    const size_t buffer_offset = cursor().offset - get_offset(cursor().sector->sector_nbr);
     return BufferAndSizes {
-        current_sector->data,
+        cursor().sector->data,
         buffer_offset,
         allowed_write_size(),
     };
@@ -232,27 +255,28 @@ size_t PartialFile::allowed_write_size() const {
 }
 
 size_t PartialFile::allowed_sectors() const {
-    return SECTORS_PER_WRITE - (current_sector->sector_nbr % SECTORS_PER_WRITE);
+    return SECTORS_PER_WRITE - (cursor().sector->sector_nbr % SECTORS_PER_WRITE);
 }
 
 bool PartialFile::advance_written(size_t by) {
-    assert(current_sector);
-    const auto next_offset = current_offset + by;
+    assert(cursor().sector);
+    const auto next_offset = cursor().offset + by;
     const auto next_sector_nbr = get_sector_nbr(next_offset);
     if (next_offset > state.total_size) {
         fatal_error("Request to write past the end of file.", "transfers");
     }
-    if (next_sector_nbr < current_sector->sector_nbr || next_sector_nbr >= current_sector->sector_nbr + allowed_sectors()) {
-        current_offset = next_offset;
+    if (next_sector_nbr < cursor().sector->sector_nbr || next_sector_nbr >= cursor().sector->sector_nbr + allowed_sectors()) {
+        cursor().offset = next_offset;
         // TODO: We may need some non-blocking way?
         if (write_current_sector()) {
-            current_sector = nullptr;
+            cursor().sector = nullptr;
         } else {
             return false;
         }
     }
 
-    current_offset = next_offset;
+    cursor().offset = next_offset;
+    stat_bytes_accepted.fetch_add(by, std::memory_order_relaxed);
     return true;
 }
 
@@ -296,17 +320,24 @@ bool PartialFile::write(const uint8_t *data, size_t size) {
 
 bool PartialFile::sync() {
     uint32_t sync_avoid = 0;
-    if (current_sector) {
-        sync_avoid = 1;
+    // Sectors held by the other cursors are not ours to flush - their writers
+    // are still filling them.
+    for (const auto &other : cursors) {
+        if (&other != &cursor() && other.sector) {
+            sync_avoid++;
+        }
+    }
+    if (cursor().sector) {
+        sync_avoid++;
         auto copied_sector = sector_pool.acquire(true);
         if (!copied_sector) {
             return false;
         }
-        memcpy(copied_sector->data, current_sector->data, BUFFER_SIZE);
-        copied_sector->sector_nbr = current_sector->sector_nbr;
+        memcpy(copied_sector->data, cursor().sector->data, BUFFER_SIZE);
+        copied_sector->sector_nbr = cursor().sector->sector_nbr;
         auto status = write_current_sector();
         if (status) {
-            current_sector = copied_sector;
+            cursor().sector = copied_sector;
         } else {
             sector_pool.release(reinterpret_cast<uint32_t>(copied_sector->callback_param2));
             log_error(transfers, "Failed to write sector");
@@ -319,6 +350,14 @@ bool PartialFile::sync() {
     return !write_error;
 }
 
+PartialFile::WriteStats PartialFile::get_write_stats() const {
+    return WriteStats {
+        .requests = stat_write_requests.load(std::memory_order_relaxed),
+        .sectors = stat_write_sectors.load(std::memory_order_relaxed),
+        .bytes_accepted = stat_bytes_accepted.load(std::memory_order_relaxed),
+    };
+}
+
 void PartialFile::extend_valid_part(ValidPart new_part) {
     unique_lock lock(state_mutex);
     // extend head
@@ -471,7 +510,9 @@ bool PartialFile::SectorPool::sync(uint32_t avoid, bool force) {
 
 void PartialFile::release_file() {
     // Flush everything so we won't try writing through this later.
-    discard_current_sector();
+    for (auto &cursor : cursors) {
+        discard_current_sector(cursor);
+    }
     sector_pool.sync(0, true);
     // Prevent any future attempts to write here.
     write_error = true;
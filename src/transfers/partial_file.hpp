@@ -48,6 +48,16 @@ public:
 #endif
     // The size of one buffer (possibly multiple sectors)
     static const size_t BUFFER_SIZE = SECTOR_SIZE * SECTORS_PER_WRITE;
+#if PRINTER_IS_PRUSA_MINI()
+    // No parallel download on mini - a second cursor would need a bigger
+    // sector pool and we are low on RAM there.
+    static const size_t WRITE_CURSORS = 1;
+#else
+    // Cursor 0 is the default one all the single-writer code uses. The second
+    // cursor exists for the parallel (two-connection) download, where each
+    // connection appends to its own region of the file.
+    static const size_t WRITE_CURSORS = 2;
+#endif
 
     struct ValidPart {
         size_t start;
@@ -105,8 +115,10 @@ private:
     /// Pre-allocated request pool for usbh_msc_submit_request operation with dynamically
     /// allocated memory for sectors (needs DMA so not on stack that can be put into CCMRAM)
     struct SectorPool {
-        /// sync operations require a minimum of 2 slots and 32 is the maximum due to slot_mask
-        static constexpr uint32_t size = 2;
+        /// sync operations require a minimum of 2 slots and 32 is the maximum due to slot_mask.
+        /// With a second write cursor around, we need two more slots - one that the other
+        /// cursor may be holding and one more so the flushes of the two cursors can overlap.
+        static constexpr uint32_t size = WRITE_CURSORS >= 2 ? 4 : 2;
         static_assert(size >= 2 && size <= 32);
 
         SectorPool(UsbhMscRequest::LunNbr lun, UsbhMscRequestCallback callback, void *callback_param1);
@@ -157,11 +169,29 @@ private:
     /// USB sector number where the first data of the file are located
     UsbhMscRequest::SectorNbr first_sector_nbr;
 
-    /// Write buffer for the active sector the user is writing to
-    UsbhMscRequest *current_sector;
+    struct WriteCursor {
+        /// Write buffer for the active sector the cursor is writing to
+        UsbhMscRequest *sector = nullptr;
+
+        /// Offset ("ftell") within the file where the cursor will write next
+        size_t offset = 0;
+    };
+
+    /// The write cursors; all of them share the sector pool and the valid-part
+    /// tracking, but each keeps its own position and write buffer
+    std::array<WriteCursor, WRITE_CURSORS> cursors;
+
+    /// Index of the cursor the seek/tell/write family of methods currently operates on
+    size_t active_cursor_idx = 0;
+
+    /// Write-coalescing counters; atomics, as the writers and the readers of
+    /// the stats may live in different threads
+    std::atomic<uint32_t> stat_write_requests = 0;
+    std::atomic<uint32_t> stat_write_sectors = 0;
+    std::atomic<uint32_t> stat_bytes_accepted = 0;
 
-    /// Offset ("ftell") within the file where the user will write next
-    size_t current_offset;
+    WriteCursor &cursor() { return cursors[active_cursor_idx]; }
+    const WriteCursor &cursor() const { return cursors[active_cursor_idx]; }
 
     /// Valid parts of the file
     State state;
@@ -177,11 +207,11 @@ private:
     /// Translate sector number to file offset
     size_t get_offset(UsbhMscRequest::SectorNbr sector_nbr);
 
-    /// Write current sector over USB to the FatFS drive
+    /// Write the active cursor's sector over USB to the FatFS drive
     bool write_current_sector();
 
-    /// Discard current sector - it is necessary to release it from the sector_pool
-    void discard_current_sector();
+    /// Discard the given cursor's sector - it is necessary to release it from the sector_pool
+    void discard_current_sector(WriteCursor &cursor);
 
     /// Extend the valid_head and/or valid_tail to include the new_part
     void extend_valid_part(ValidPart new_part);
@@ -225,19 +255,36 @@ public:
     ///
     /// * ignore_opened: If set to true, it'll open the file (for writing) even
     ///   if there's a reader somewhere else.
-    static Result open(const char *path, State state, bool ignore_opened);
+    /// * expected_first_sector: If set and the file still starts at that
+    ///   sector, the (expensive) contiguity check is skipped - see convert.
+    static Result open(const char *path, State state, bool ignore_opened, std::optional<UsbhMscRequest::SectorNbr> expected_first_sector = std::nullopt);
 
     /// Convert an open FILE * into this.
     ///
     /// state.total_size is updated according to what is found on the disk and overwritten.
-    static Result convert(const char *path, unique_file_ptr file, State state);
+    ///
+    /// Verifies the file is stored in contiguous sectors, which means walking
+    /// its whole FAT cluster chain - on large files that takes long enough to
+    /// be user-visible. A caller that already verified the file earlier (eg.
+    /// transfer recovery with its backup file) can pass the first sector it
+    /// recorded back in expected_first_sector; if the file still starts there,
+    /// it is the same allocation as before and the walk is skipped.
+    static Result convert(const char *path, unique_file_ptr file, State state, std::optional<UsbhMscRequest::SectorNbr> expected_first_sector = std::nullopt);
+
+    /// Selects which write cursor the seek/tell/write family of methods operates on.
+    ///
+    /// Each cursor keeps its own position and write buffer, so several writers
+    /// can append to disjoint regions of the file - but the selection is
+    /// shared, so the writers must not race with each other (the parallel
+    /// download drives all its cursors from the tcpip thread).
+    void select_cursor(size_t idx);
 
     /// Seek to a given offset within the file
     bool seek(size_t offset);
 
     /// Position in the file
     size_t tell() {
-        return current_offset;
+        return cursor().offset;
     }
 
     struct WouldBlock {};
@@ -284,9 +331,34 @@ public:
     /// No further writes will succeed or be made and the file lock is released.
     void release_file();
 
+    /// Counters for watching how well the sector buffering coalesces the
+    /// incoming data into USB writes.
+    ///
+    /// The ideal is one request per BUFFER_SIZE of payload; every sync() of a
+    /// partially filled buffer re-writes its sectors later and pushes the
+    /// ratio (the write amplification) up.
+    struct WriteStats {
+        /// Number of usbh write requests submitted
+        uint32_t requests = 0;
+
+        /// Number of sectors covered by those requests
+        uint32_t sectors = 0;
+
+        /// Number of payload bytes accepted from the writers
+        uint32_t bytes_accepted = 0;
+    };
+
+    WriteStats get_write_stats() const;
+
     /// Get the final size of the file
     size_t final_size() const { return get_state().total_size; }
 
+    /// Get the sector where the file's data starts on the drive.
+    ///
+    /// Constant for the lifetime of the file; meant to be recorded and later
+    /// passed to open() as expected_first_sector.
+    UsbhMscRequest::SectorNbr get_first_sector_nbr() const { return first_sector_nbr; }
+
     /// Get the valid part of the file starting at offset 0
     std::optional<ValidPart> get_valid_head() const { return get_state().valid_head; }
 
@@ -16,6 +16,13 @@
 #include <common/scope_guard.hpp>
 #include <state/printer_state.hpp>
 #include <option/has_human_interactions.h>
+#include <option/development_items.h>
+
+#if !defined(UNITTESTS)
+    // Not available in unit tests, it drags in lots of dependencies
+    #include <marlin_vars.hpp>
+    #include <media_prefetch_instance.hpp>
+#endif
 
 #include <logging/log.hpp>
 #include <type_traits>
@@ -32,6 +39,59 @@ using namespace transfers;
 using std::is_same_v;
 using std::optional;
 
+DownloadThrottle DownloadThrottle::instance;
+
+size_t DownloadThrottle::take(size_t wanted) {
+    if (!engaged.load()) {
+        return wanted;
+    }
+
+    size_t avail = tokens.load();
+    for (;;) {
+        const size_t granted = std::min(wanted, avail);
+        if (granted == 0) {
+            return 0;
+        }
+        if (tokens.compare_exchange_weak(avail, avail - granted)) {
+            return granted;
+        }
+        // Someone claimed tokens in between, avail got reloaded, try again.
+    }
+}
+
+void DownloadThrottle::update(bool is_printing) {
+#if defined(UNITTESTS)
+    (void)is_printing;
+#else
+    uint8_t occupancy = 100;
+    if (is_printing) {
+        occupancy = marlin_server::media_prefetch.get_metrics().buffer_occupancy_percent;
+    }
+
+    if (occupancy < occupancy_low) {
+        engaged = true;
+    } else if (occupancy >= occupancy_high) {
+        engaged = false;
+    }
+
+    const uint32_t now = ticks_ms();
+    if (!engaged.load()) {
+        // Keep the bucket full, so engaging the throttle later doesn't stall
+        // the very next write.
+        tokens = bucket_cap;
+        last_refill = now;
+        return;
+    }
+
+    const uint32_t elapsed = now - last_refill;
+    last_refill = now;
+    const size_t add = throttled_rate * elapsed / 1000;
+    size_t avail = tokens.load();
+    while (!tokens.compare_exchange_weak(avail, std::min(bucket_cap, avail + add))) {
+    }
+#endif
+}
+
 Transfer::PlainGcodeDownloadOrder::PlainGcodeDownloadOrder(const PartialFile &file) {
     if (file.has_valid_tail(TailSize)) {
         state = State::DownloadingBody;
@@ -40,9 +100,18 @@ Transfer::PlainGcodeDownloadOrder::PlainGcodeDownloadOrder(const PartialFile &fi
     }
 }
 
-Transfer::Action Transfer::PlainGcodeDownloadOrder::step(const PartialFile &file) {
+Transfer::Action Transfer::PlainGcodeDownloadOrder::step(const PartialFile &file, optional<size_t> print_position) {
+    const auto head = file.get_valid_head();
+    const size_t head_end = head.has_value() ? head->end : 0;
+
     switch (state) {
     case State::DownloadingTail:
+        if (print_position.has_value() && head_end < *print_position + PrintLeadLow) {
+            // The print is about to run out of downloaded data, the body is
+            // more urgent than the tail right now.
+            state = State::DownloadingBody;
+            return Action::RangeJump;
+        }
         if (file.has_valid_tail(TailSize)) {
             state = State::DownloadingBody;
             return Action::RangeJump;
@@ -51,9 +120,14 @@ Transfer::Action Transfer::PlainGcodeDownloadOrder::step(const PartialFile &file
     case State::DownloadingBody:
         if (file.final_size() == file.get_state().get_valid_size()) {
             return Action::Finished;
-        } else {
-            return Action::Continue;
         }
+        if (!file.has_valid_tail(TailSize) && print_position.has_value() && head_end >= *print_position + PrintLeadHigh) {
+            // The tail is still missing, but we have a comfortable lead ahead
+            // of the print, so go fetch it now.
+            state = State::DownloadingTail;
+            return Action::RangeJump;
+        }
+        return Action::Continue;
     default:
         fatal_error("unhandled state", "download");
     }
@@ -75,7 +149,7 @@ size_t Transfer::PlainGcodeDownloadOrder::get_next_offset(const PartialFile &fil
     }
 }
 
-Transfer::Action Transfer::GenericFileDownloadOrder::step(const PartialFile &file) {
+Transfer::Action Transfer::GenericFileDownloadOrder::step(const PartialFile &file, optional<size_t>) {
     if (file.final_size() == file.get_state().get_valid_size()) {
         return Action::Finished;
     } else {
@@ -144,7 +218,7 @@ Transfer::BeginResult Transfer::begin(const char *destination_path, const Downlo
         return Storage { e };
     };
     partial_file = get<PartialFile::Ptr>(move(preallocated));
-    if (Transfer::make_backup(backup.get(), request, partial_file->get_state(), *slot) == false) {
+    if (Transfer::make_backup(backup.get(), request, partial_file->get_state(), partial_file->get_first_sector_nbr(), *slot) == false) {
         return Storage { "Failed to fill the backup file" };
     }
 
@@ -184,12 +258,13 @@ bool Transfer::restart_download() {
     // We try to reinicialize the PartialFile, in case the USB got re-plugged or something.
     const size_t check_size = partial_file->final_size();
     const PartialFile::State old_state = partial_file->get_state();
+    const auto old_first_sector = partial_file->get_first_sector_nbr();
     // We can't really deallocate it completely (if we do next
     // restart_download, we need to keep the state and size), but we want to
     // make sure we don't hold the file actually open so the next open can
     // succeed.
     partial_file->release_file();
-    if (auto open_result = PartialFile::open(path.as_partial(), old_state, true); holds_alternative<PartialFile::Ptr>(open_result)) {
+    if (auto open_result = PartialFile::open(path.as_partial(), old_state, true, old_first_sector); holds_alternative<PartialFile::Ptr>(open_result)) {
         auto new_file = move(get<PartialFile::Ptr>(open_result));
         if (new_file->final_size() != check_size) {
             return false;
@@ -216,7 +291,23 @@ bool Transfer::restart_download() {
         }
     }
 
-    download.emplace(*request, partial_file, position, end_range);
+    // Opt-in (development builds only for now): download through two parallel
+    // connections, each filling half of the range. A single connection can't
+    // fill the pipe on high-latency links, this roughly doubles the
+    // throughput there.
+    //
+    // Only safe when we're linearly extending the valid head and there's no
+    // valid tail yet - then the two connections' regions map exactly onto the
+    // head/tail tracking of the PartialFile.
+    unsigned max_connections = 1;
+    if constexpr (option::development_items) {
+        const auto head = partial_file->get_valid_head();
+        if (!partial_file->get_valid_tail().has_value() && position <= (head.has_value() ? head->end : 0)) {
+            max_connections = 2;
+        }
+    }
+
+    download.emplace(*request, partial_file, position, end_range, max_connections);
 
     return true;
 }
@@ -300,7 +391,7 @@ Transfer::RecoverResult Transfer::recover(const char *destination_path) {
     // reopen the partial file
     PartialFile::Ptr partial_file = nullptr;
     {
-        auto partial_file_result = PartialFile::open(path.as_partial(), partial_file_state, true);
+        auto partial_file_result = PartialFile::open(path.as_partial(), partial_file_state, true, backup->get_partial_file_first_sector());
         if (auto *err = get_if<const char *>(&partial_file_result); err != nullptr) {
             log_error(transfers, "Failed to open partial file: %s", *err);
             return Storage { *err };
@@ -330,10 +421,28 @@ Transfer::Transfer(Monitor::Slot &&slot, PartialFile::Ptr partial_file)
     assert(partial_file.get() != nullptr);
 }
 
+optional<size_t> Transfer::printed_file_position() const {
+#if defined(UNITTESTS)
+    return std::nullopt;
+#else
+    // The media path is stored as SFN, our destination is LFN.
+    char sfn_path[FILE_PATH_BUFFER_LEN];
+    get_SFN_path_copy(slot.destination(), sfn_path, sizeof(sfn_path));
+    if (!marlin_vars().media_SFN_path.equals(sfn_path)) {
+        // Either not printing at all or printing some other file.
+        return std::nullopt;
+    }
+    return marlin_vars().media_position.get();
+#endif
+}
+
 Transfer::State Transfer::step(bool is_printing) {
     switch (state) {
     case State::Downloading:
     case State::Retrying: {
+        // Let the downloads run only as fast as the media prefetch of a
+        // possibly running print can afford.
+        DownloadThrottle::instance.update(is_printing);
         if (slot.is_stopped()) {
             done(State::Failed, Monitor::Outcome::Stopped);
         } else if (download.has_value()) {
@@ -352,7 +461,8 @@ Transfer::State Transfer::step(bool is_printing) {
                 update_backup(/*force=*/true);
             } else {
                 init_download_order_if_needed();
-                Transfer::Action next_step = std::visit([&](auto &&arg) { return arg.step(*partial_file); }, *order);
+                const optional<size_t> print_position = is_printing ? printed_file_position() : std::nullopt;
+                Transfer::Action next_step = std::visit([&](auto &&arg) { return arg.step(*partial_file, print_position); }, *order);
 
                 switch (next_step) {
                 case Transfer::Action::Continue:
@@ -553,6 +663,10 @@ void Transfer::done(State state, Monitor::Outcome outcome) {
         // Unlike the success, we do not early-notify the removal.
         cleanup_remove(path);
     }
+    // The manipulations above change what transfer_check answers for us and
+    // not all of them are guaranteed to pass through ChangedPath (eg. when
+    // the file is being printed and can't be removed yet).
+    transfer_check_cache_invalidate(path.as_destination());
     slot.done(outcome);
 
     log_info(transfers, "Transfer %s", state == State::Failed ? "failed" : "finished");
@@ -18,6 +18,58 @@ inline constexpr size_t MAX_RETRIES = 5;
 
 struct NoTransferSlot {};
 
+/// A token-bucket rate governor for download writes.
+///
+/// A background download shares the USB storage (and the CPU) with the media
+/// prefetch of a running print. When both run at full speed, the prefetch can
+/// underrun and stall the print. This throttles the downloads whenever the
+/// prefetch buffer runs low and lets them loose again once the print has a
+/// comfortable reserve.
+///
+/// The bucket is refilled from the transfer thread (Transfer::step reads the
+/// prefetch buffer occupancy), the tokens are claimed by the download
+/// connections on the tcpip thread. An empty bucket translates into the
+/// would-block result of the splice write, so the TCP window provides the
+/// actual backpressure towards the server.
+class DownloadThrottle {
+public:
+    /// Below this prefetch-buffer occupancy (in percent) the throttle engages.
+    static constexpr uint8_t occupancy_low = 25;
+    /// At this occupancy it disengages again (hysteresis in between, so it
+    /// doesn't flip on and off on every step).
+    static constexpr uint8_t occupancy_high = 50;
+    /// Download bandwidth allowed while throttled, in bytes per second.
+    static constexpr size_t throttled_rate = 16 * 1024;
+    /// Upper bound on the accumulated tokens, so a pause in the download
+    /// doesn't turn into a burst afterwards.
+    static constexpr size_t bucket_cap = 8 * 1024;
+
+    /// Claim up to \p wanted bytes worth of tokens.
+    ///
+    /// \returns how much the caller may actually process right now (\p wanted
+    /// itself whenever the throttle is disengaged).
+    ///
+    /// Called from the tcpip thread.
+    size_t take(size_t wanted);
+
+    /// Re-read the prefetch buffer occupancy and refill the bucket
+    /// accordingly.
+    ///
+    /// Called periodically from the transfer thread. Not printing means no
+    /// prefetch to protect, so the throttle is disengaged in that case.
+    void update(bool is_printing);
+
+    /// The global instance (the downloads and the transfer thread need to
+    /// meet somewhere).
+    static DownloadThrottle instance;
+
+private:
+    std::atomic<size_t> tokens = 0;
+    std::atomic<bool> engaged = false;
+    /// Timestamp of the last refill, in ms. Only touched by update().
+    uint32_t last_refill = 0;
+};
+
 /// Represents a transfer of a file from Connect to the printer.
 ///
 /// It is initiated via Transfer::begin() with a given download request and a destination path.
@@ -52,11 +104,24 @@ private:
     };
 
     /// Downloads the beginning and ending of the file first (so it can be scanned by GcodeInfo) and print can be started.
+    ///
+    /// When the file is being printed while still downloading (print_position
+    /// is set), the body takes priority over the tail whenever the print gets
+    /// close to the end of the downloaded data, so the print doesn't pause
+    /// waiting for bytes while we fetch data it doesn't need yet.
     class PlainGcodeDownloadOrder {
         // TODO: Use values based on GCodeInfo
         static constexpr size_t HeadSize = 400 * 1024;
         static constexpr size_t TailSize = 50000;
 
+        /// If the print position gets this close to the end of the valid
+        /// head, the body is more urgent than the tail.
+        static constexpr size_t PrintLeadLow = 1024 * 1024;
+        /// Only once the head is this far ahead of the print position do we
+        /// go (back) for the tail. Larger than PrintLeadLow so we don't
+        /// ping-pong between the two on slow connections.
+        static constexpr size_t PrintLeadHigh = 2 * 1024 * 1024;
+
         enum class State {
             DownloadingTail,
             DownloadingBody,
@@ -70,7 +135,9 @@ private:
 
         PlainGcodeDownloadOrder(const PartialFile &partial_file);
 
-        Action step(const PartialFile &file);
+        /// * print_position: Read position of the print consuming this very
+        ///   file, if there is one.
+        Action step(const PartialFile &file, std::optional<size_t> print_position);
 
         /// Returns offset from where to continue downloading the file
         size_t get_next_offset(const PartialFile &file) const;
@@ -78,7 +145,9 @@ private:
 
     class GenericFileDownloadOrder {
     public:
-        Action step(const PartialFile &);
+        /// The print position is not used here - we download linearly from
+        /// the start, which never gets behind a (also linear) print.
+        Action step(const PartialFile &, std::optional<size_t> print_position);
 
         /// Returns offset from where to continue downloading the file
         size_t get_next_offset(const PartialFile &file) const;
@@ -150,6 +219,15 @@ public:
     };
 
 private:
+    /// Put a fully downloaded transfer into its final place.
+    ///
+    /// This is a couple of renames, deliberately O(1) ‒ no re-reading or
+    /// re-hashing of the (possibly huge) file from the slow USB media
+    /// happens here, so a queued print can start right away. Integrity is
+    /// already ensured while streaming: the data is decrypted chunk by chunk
+    /// on its way into the sector buffers and USB write errors surface
+    /// immediately through PartialFile's write_error, so there is nothing
+    /// left to verify once the last byte lands.
     static bool cleanup_finalize(Path &transfer_path);
     static bool cleanup_remove(Path &transfer_path);
 
@@ -165,17 +243,24 @@ public:
 
         PartialFile::State partial_file_state;
 
+        UsbhMscRequest::SectorNbr partial_file_first_sector;
+
         std::unique_ptr<char[]> data_buffer;
         size_t data_buffer_size;
 
         const void *get_data_ptr(size_t offset, size_t size);
 
     public:
-        RestoredTransfer(FILE *file, PartialFile::State partial_file_state, TransferId id);
+        RestoredTransfer(FILE *file, PartialFile::State partial_file_state, UsbhMscRequest::SectorNbr partial_file_first_sector, TransferId id);
 
         /// Returns the PartialFile::State that was stored in the backup file.
         PartialFile::State get_partial_file_state() { return partial_file_state; }
 
+        /// Returns the first sector of the partial file as recorded in the
+        /// backup, to be passed to PartialFile::open() so it can skip the
+        /// contiguity check.
+        UsbhMscRequest::SectorNbr get_partial_file_first_sector() { return partial_file_first_sector; }
+
         /// Returns the Download::Request that was stored in the backup file.
         /// Warning: The returned request is valid only for the lifetime of the RestoredTransfer instance.
         std::optional<Download::Request> get_download_request();
@@ -184,8 +269,10 @@ public:
     };
 
     /// Store given Download::Request and PartialFile::State to the given file.
+    /// The first sector of the partial file is stored too, so a later recovery
+    /// can reopen the file without re-checking its contiguity.
     /// The file's content is overriden (in case the file exists) and ftell() on return is undefined.
-    static bool make_backup(FILE *file, const Download::Request &request, const PartialFile::State &state, const Monitor::Slot &slot);
+    static bool make_backup(FILE *file, const Download::Request &request, const PartialFile::State &state, UsbhMscRequest::SectorNbr partial_file_first_sector, const Monitor::Slot &slot);
 
     /// Updates a backup file created with make_backup() with the given PartialFile::State.
     static bool update_backup(FILE *file, const PartialFile::State &state);
@@ -282,6 +369,10 @@ private:
     /// TODO: We have to better handle errors here (distinguish between recoverable and non-recoverable ones)
     bool restart_download();
 
+    /// Byte position of the print reader, if the file of this transfer is the
+    /// one currently being printed. Used to prioritize the download order.
+    std::optional<size_t> printed_file_position() const;
+
     void done(State state, Monitor::Outcome outcome);
 
     /// For some reasons we might not have a download order from the very beginning.
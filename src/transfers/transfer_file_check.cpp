@@ -1,12 +1,123 @@
 #include <sys/stat.h>
 
+#include <cstring>
+#include <mutex>
+#include <optional>
+
+#include <freertos/mutex.hpp>
 #include <stat_retry.hpp>
+// Why is the FILE_PATH_BUFFER_LEN in gui?
+#include <gui/file_list_defs.h>
 
+#include "changed_path.hpp"
 #include "filename_type.hpp"
 #include "transfer_file_check.hpp"
 
+extern "C" {
+
+// Inject for tests, which are compiled on systems without it in the header.
+size_t strlcpy(char *, const char *, size_t);
+}
+
 namespace transfers {
 
+namespace {
+
+    /// A small cache of recent transfer_check() results.
+    ///
+    /// The file browser, Link and Connect all tend to enumerate the same
+    /// directories in short succession and each entry costs several stat
+    /// lookups (tens of ms each). We remember a handful of recent results,
+    /// keyed by the path.
+    ///
+    /// Instead of watching individual files, an entry stays valid only as
+    /// long as ChangedPath records no change at all (its generation counter).
+    /// That's coarse, but changes are rare compared to the listings and a
+    /// false miss only costs the stats we would have done anyway.
+    class CheckCache {
+    public:
+        static constexpr size_t capacity = 4;
+
+        std::optional<TransferCheckResult> lookup(const char *path, TransferCheckValidOnly check_valid_only) {
+            const uint32_t generation = ChangedPath::instance.change_generation();
+            std::lock_guard lock(mutex);
+
+            for (auto &entry : entries) {
+                if (entry.path[0] == '\0' || strcmp(entry.path, path) != 0) {
+                    continue;
+                }
+                if (entry.generation != generation) {
+                    // Outlived by some filesystem change, forget it.
+                    entry.path[0] = '\0';
+                    return std::nullopt;
+                }
+                if (entry.valid_only && check_valid_only == TransferCheckValidOnly::no) {
+                    // A valid-only result is incomplete, it can't answer the
+                    // full query (the other way around works fine).
+                    return std::nullopt;
+                }
+                return entry.result;
+            }
+
+            return std::nullopt;
+        }
+
+        /// \param generation shall be sampled _before_ the stats producing
+        ///     \p result, so a change in between doesn't get cached over.
+        void store(const char *path, TransferCheckValidOnly check_valid_only, uint32_t generation, const TransferCheckResult &result) {
+            std::lock_guard lock(mutex);
+
+            Entry *target = nullptr;
+            for (auto &entry : entries) {
+                if (strcmp(entry.path, path) == 0) {
+                    target = &entry;
+                    break;
+                }
+            }
+            if (target == nullptr) {
+                target = &entries[next_evict];
+                next_evict = (next_evict + 1) % entries.size();
+            }
+
+            if (strlcpy(target->path, path, sizeof target->path) >= sizeof target->path) {
+                // Too long to cache (shouldn't happen with our buffers).
+                target->path[0] = '\0';
+                return;
+            }
+            target->result = result;
+            target->generation = generation;
+            target->valid_only = check_valid_only == TransferCheckValidOnly::yes;
+        }
+
+        void invalidate(const char *path) {
+            std::lock_guard lock(mutex);
+            for (auto &entry : entries) {
+                if (strcmp(entry.path, path) == 0) {
+                    entry.path[0] = '\0';
+                }
+            }
+        }
+
+    private:
+        struct Entry {
+            char path[FILE_PATH_BUFFER_LEN] = "";
+            TransferCheckResult result;
+            /// The ChangedPath generation the result was computed at.
+            uint32_t generation = 0;
+            /// See lookup() about incomplete valid-only results.
+            bool valid_only = false;
+        };
+
+        freertos::Mutex mutex;
+        std::array<Entry, capacity> entries;
+        /// Round-robin eviction.
+        size_t next_evict = 0;
+    };
+
+    CheckCache check_cache;
+
+} // namespace
+
 TransferCheckResult transfer_check(const MutablePath &filepath, TransferCheckValidOnly check_valid_only) {
     TransferCheckResult r;
 
@@ -15,10 +126,17 @@ TransferCheckResult transfer_check(const MutablePath &filepath, TransferCheckVal
         return r;
     }
 
+    if (auto cached = check_cache.lookup(filepath.get(), check_valid_only); cached.has_value()) {
+        return *cached;
+    }
+
+    const uint32_t generation = ChangedPath::instance.change_generation();
+
     r.partial_file_found = filepath.execute_with_pushed(partial_filename, stat_retry, &r.partial_file_stat) == 0 && S_ISREG(r.partial_file_stat.st_mode);
 
     // Partial file not found -> definitely not valid, we can return early
     if (!r.partial_file_found && check_valid_only == TransferCheckValidOnly::yes) {
+        check_cache.store(filepath.get(), check_valid_only, generation, r);
         return r;
     }
 
@@ -26,9 +144,15 @@ TransferCheckResult transfer_check(const MutablePath &filepath, TransferCheckVal
     r.backup_file_found = filepath.execute_with_pushed(backup_filename, stat_retry, &backup_file_stat) == 0 && S_ISREG(backup_file_stat.st_mode);
     r.backup_file_empty = r.backup_file_found && backup_file_stat.st_size == 0;
 
+    check_cache.store(filepath.get(), check_valid_only, generation, r);
+
     return r;
 }
 
+void transfer_check_cache_invalidate(const char *destination_path) {
+    check_cache.invalidate(destination_path);
+}
+
 bool is_valid_file_or_transfer(const MutablePath &file) {
     struct stat st;
 
@@ -63,4 +63,12 @@ inline bool is_valid_transfer(const MutablePath &filepath) {
 /// \returns whether the \p file is an existing file or a valid transfer
 bool is_valid_file_or_transfer(const MutablePath &file);
 
+/// Forget any cached transfer_check() result for the given destination path.
+///
+/// transfer_check() caches a few recent results (the stat lookups behind it
+/// are expensive and directory listings repeat them a lot). The cache watches
+/// ChangedPath for invalidation, so this is needed only by code that
+/// manipulates the p/d layout without reporting the change there.
+void transfer_check_cache_invalidate(const char *destination_path);
+
 } // namespace transfers
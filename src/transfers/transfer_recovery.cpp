@@ -45,6 +45,11 @@ struct SerializedTransfer {
     // crc of the partial file state only
     uint32_t partial_file_state_crc;
 
+    // where the partial file starts on the drive; recovery passes it back to
+    // PartialFile::open so it doesn't have to walk the whole cluster chain
+    // again (a corrupted value simply won't match and the walk happens)
+    UsbhMscRequest::SectorNbr partial_file_first_sector = 0;
+
     // for compatibility check
     SerializedString fw_version;
 
@@ -72,7 +77,7 @@ using EndOfDataCRC = uint32_t;
 
 } // namespace
 
-bool Transfer::make_backup(FILE *file, const Download::Request &request, const PartialFile::State &state, const Monitor::Slot &slot) {
+bool Transfer::make_backup(FILE *file, const Download::Request &request, const PartialFile::State &state, UsbhMscRequest::SectorNbr partial_file_first_sector, const Monitor::Slot &slot) {
     SerializedTransfer transfer;
     // Initialize all the bits, so even the padding ones are defined and the CRC works.
     memset((void *)&transfer, 0, sizeof(SerializedTransfer));
@@ -82,6 +87,7 @@ bool Transfer::make_backup(FILE *file, const Download::Request &request, const P
 
     transfer.partial_file_state = state;
     transfer.partial_file_state_crc = crc32_calc((const uint8_t *)&state, sizeof(state));
+    transfer.partial_file_first_sector = partial_file_first_sector;
     transfer.fw_version = SerializedString::serialize(version::project_version_full, file, error);
     if (const auto *encrypted = get_if<Download::Request::Encrypted>(&request.data); encrypted != nullptr) {
         transfer.host = SerializedString::serialize(encrypted->host, file, error);
@@ -197,7 +203,7 @@ std::optional<Transfer::RestoredTransfer> Transfer::restore(FILE *file) {
         }
     }
 
-    return RestoredTransfer(file, transfer.partial_file_state, transfer.transfer_id);
+    return RestoredTransfer(file, transfer.partial_file_state, transfer.partial_file_first_sector, transfer.transfer_id);
 }
 
 std::variant<Transfer::Error, Transfer::Complete, PartialFile::State> Transfer::load_state(const char *path) {
@@ -252,9 +258,10 @@ std::variant<Transfer::Error, Transfer::Complete, PartialFile::State> Transfer::
     return transfer->get_partial_file_state();
 }
 
-Transfer::RestoredTransfer::RestoredTransfer(FILE *file, PartialFile::State state, TransferId id)
+Transfer::RestoredTransfer::RestoredTransfer(FILE *file, PartialFile::State state, UsbhMscRequest::SectorNbr partial_file_first_sector, TransferId id)
     : file(file)
     , partial_file_state(state)
+    , partial_file_first_sector(partial_file_first_sector)
     , data_buffer(nullptr)
     , data_buffer_size(0)
     , id(id) {
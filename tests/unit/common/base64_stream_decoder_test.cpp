@@ -0,0 +1,101 @@
+#include "catch2/catch.hpp"
+#include "base64_stream_decoder.h"
+
+#include <cstring>
+#include <random>
+#include <string>
+#include <vector>
+
+namespace {
+
+/// Reference decode through the single-character state machine,
+/// with the same skip set the gcode thumbnail reader used to apply
+std::vector<uint8_t> decode_per_char(const std::string &input) {
+    Base64StreamDecoder decoder;
+    std::vector<uint8_t> result;
+    for (char c : input) {
+        if (c == '\r' || c == '\n' || c == ' ' || c == ';') {
+            continue;
+        }
+        uint8_t byte;
+        switch (decoder.ConsumeChar(c, &byte)) {
+        case 1:
+            result.push_back(byte);
+            break;
+        case 0:
+            break;
+        default:
+            FAIL("per-char decode error");
+        }
+    }
+    return result;
+}
+
+std::vector<uint8_t> decode_block(const std::string &input, size_t chunk_size) {
+    Base64StreamDecoder decoder;
+    std::vector<uint8_t> result;
+    std::vector<uint8_t> out((chunk_size * 3) / 4 + 2);
+    for (size_t pos = 0; pos < input.size(); pos += chunk_size) {
+        const size_t len = std::min(chunk_size, input.size() - pos);
+        size_t base64_chars = 0;
+        const int decoded = decoder.ConsumeBlock(input.data() + pos, len, out.data(), base64_chars);
+        REQUIRE(decoded >= 0);
+        result.insert(result.end(), out.begin(), out.begin() + decoded);
+    }
+    return result;
+}
+
+} // namespace
+
+TEST_CASE("Base64StreamDecoder block decode", "[base64]") {
+    SECTION("plain quads") {
+        // "Many hands make light work."
+        const std::string input = "TWFueSBoYW5kcyBtYWtlIGxpZ2h0IHdvcmsu";
+        const auto decoded = decode_block(input, input.size());
+        REQUIRE(std::string(decoded.begin(), decoded.end()) == "Many hands make light work.");
+    }
+
+    SECTION("whitespace and comment prefixes are skipped") {
+        const std::string input = "; TWFueSBo\r\n; YW5kcyBtYWtlIGxpZ2h0\n; IHdvcmsu\n";
+        const auto decoded = decode_block(input, input.size());
+        REQUIRE(std::string(decoded.begin(), decoded.end()) == "Many hands make light work.");
+    }
+
+    SECTION("counts only base64 characters") {
+        const std::string input = "; TWFu\n";
+        Base64StreamDecoder decoder;
+        uint8_t out[8];
+        size_t base64_chars = 0;
+        REQUIRE(decoder.ConsumeBlock(input.data(), input.size(), out, base64_chars) == 3);
+        REQUIRE(base64_chars == 4);
+    }
+
+    SECTION("invalid character fails the decode") {
+        const std::string input = "TW@u";
+        Base64StreamDecoder decoder;
+        uint8_t out[8];
+        size_t base64_chars = 0;
+        REQUIRE(decoder.ConsumeBlock(input.data(), input.size(), out, base64_chars) == -1);
+    }
+
+    SECTION("matches the per-character decoder on random chunked input") {
+        static constexpr char alphabet[] = "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
+        std::minstd_rand rand(42);
+
+        for (int trial = 0; trial < 100; trial++) {
+            // random base64 payload broken into "; "-prefixed lines, like a thumbnail
+            std::string input;
+            const size_t chars = rand() % 300;
+            for (size_t i = 0; i < chars; i++) {
+                if (i % 78 == 0) {
+                    input += "\n; ";
+                }
+                input += alphabet[rand() % 64];
+            }
+
+            const auto reference = decode_per_char(input);
+            const size_t chunk_size = 1 + rand() % 64;
+            REQUIRE(decode_block(input, chunk_size) == reference);
+        }
+    }
+}
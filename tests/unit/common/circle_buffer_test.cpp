@@ -180,3 +180,65 @@ TEST_CASE("CircleBuffer basics", "[circle_buffer]") {
         CHECK(out == in);
     }
 }
+
+TEST_CASE("CircleBuffer bulk operations", "[circle_buffer]") {
+    // Power-of-two capacity, so this also exercises the mask-based indexing
+    CircleBuffer<int, 8> cb;
+    int in[10];
+    int out[10];
+    for (int i = 0; i < 10; i++) {
+        in[i] = i;
+    }
+
+    SECTION("push and consume within capacity") {
+        CHECK(cb.push_back_multiple(in, 5) == 5);
+        CHECK(cb.size() == 5);
+
+        CHECK(cb.consume_multiple(out, 10) == 5);
+        CHECK(cb.size() == 0);
+        for (int i = 0; i < 5; i++) {
+            CHECK(out[i] == i);
+        }
+    }
+
+    SECTION("push past capacity does not overwrite") {
+        // Can fit only 7 elements
+        CHECK(cb.push_back_multiple(in, 10) == 7);
+        CHECK(cb.size() == 7);
+        CHECK(cb.push_back_multiple(in, 1) == 0);
+
+        CHECK(cb.consume_multiple(out, 10) == 7);
+        for (int i = 0; i < 7; i++) {
+            CHECK(out[i] == i);
+        }
+    }
+
+    SECTION("copies across the wrap") {
+        // Shift the positions so that both the push and the consume wrap
+        for (int i = 0; i < 6; i++) {
+            cb.push_back(0);
+            int dummy;
+            CHECK(cb.ConsumeFirst(dummy));
+        }
+
+        CHECK(cb.push_back_multiple(in, 7) == 7);
+        CHECK(cb.consume_multiple(out, 7) == 7);
+        for (int i = 0; i < 7; i++) {
+            CHECK(out[i] == i);
+        }
+    }
+
+    SECTION("interleaves with single-element operations") {
+        cb.push_back(42);
+        CHECK(cb.push_back_multiple(in, 3) == 3);
+        CHECK(cb.size() == 4);
+
+        int elem;
+        CHECK(cb.ConsumeFirst(elem));
+        CHECK(elem == 42);
+        CHECK(cb.consume_multiple(out, 10) == 3);
+        for (int i = 0; i < 3; i++) {
+            CHECK(out[i] == i);
+        }
+    }
+}
@@ -83,3 +83,50 @@ TEST_CASE("CircularBuffer basics", "[circular_buffer]") {
         CHECK(cb.try_put(dummy));
     }
 }
+
+TEST_CASE("SpscCircularBuffer basics", "[circular_buffer]") {
+
+    SECTION("empty on construction") {
+        SpscCircularBuffer<uint32_t, 4> cb;
+        CHECK(cb.size() == 0);
+
+        uint32_t dummy;
+        CHECK(!cb.try_get(dummy));
+    }
+
+    SECTION("what goes in goes out, in order") {
+        SpscCircularBuffer<uint32_t, 4> cb;
+
+        CHECK(cb.try_put(0x11111111));
+        CHECK(cb.try_put(0x22222222));
+        CHECK(cb.size() == 2);
+
+        uint32_t out;
+        CHECK(cb.try_get(out));
+        CHECK(out == 0x11111111);
+        CHECK(cb.try_get(out));
+        CHECK(out == 0x22222222);
+        CHECK(cb.size() == 0);
+        CHECK(!cb.try_get(out));
+    }
+
+    SECTION("full buffer rejects, wraps around") {
+        SpscCircularBuffer<uint32_t, 4> cb;
+
+        // capacity is N-1
+        CHECK(cb.try_put(1));
+        CHECK(cb.try_put(2));
+        CHECK(cb.try_put(3));
+        CHECK(!cb.try_put(4));
+
+        // keep it saturated across several wraps of the indices
+        uint32_t out;
+        for (uint32_t i = 4; i < 20; i++) {
+            CHECK(cb.try_get(out));
+            CHECK(out == i - 3);
+            CHECK(cb.try_put(i));
+            CHECK(!cb.try_put(i));
+            CHECK(cb.size() == 3);
+        }
+    }
+}
@@ -1,10 +1,10 @@
 #include <catch2/catch.hpp>
-#include <mmu2/mmu2_bootloader_coroutine.hpp>
+#include <common/coro/task.hpp>
 #include <memory_resource>
 
-using namespace MMU2::bootloader;
+using namespace coro;
 
-TEST_CASE("MMU2::coroutine") {
+TEST_CASE("coro::Task") {
     class Manager {
 
     public:
@@ -0,0 +1,4 @@
+// Intentionally left black.
+//
+// Just replace the system-wide config.h with test-specific one that enables
+// nothing.
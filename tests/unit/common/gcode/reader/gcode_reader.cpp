@@ -216,6 +216,49 @@ TEST_CASE("stream restore at offset", "[GcodeReader]") {
     }
 }
 
+TEST_CASE("stream restore via block index", "[GcodeReader]") {
+    // Streaming a bgcode file populates the process-wide block index,
+    // so a fresh reader has to be able to restore at an arbitrary offset
+    // even without any restore info.
+
+    const std::vector<const char *> binary_test_files = { BINARY_NO_COMPRESSION_FILE, BINARY_MEATPACK_FILE, BINARY_HEATSHRINK_FILE, BINARY_HEATSHRINK_MEATPACK_FILE };
+
+    for (auto &filename : binary_test_files) {
+        SECTION(std::string("Test-file: ") + filename) {
+            // Read the whole stream with one reader - this also builds the index
+            std::string contents;
+            {
+                auto reader = AnyGcodeFormatReader(filename);
+                REQUIRE(reader.is_open());
+                REQUIRE(reader.get()->stream_gcode_start(0) == IGcodeReader::Result_t::RESULT_OK);
+
+                char c;
+                while (reader.get()->stream_getc(c) == IGcodeReader::Result_t::RESULT_OK) {
+                    contents.push_back(c);
+                }
+            }
+            REQUIRE(contents.size() > 0);
+
+            for (const size_t offset : { size_t(1), contents.size() / 3, contents.size() / 2, contents.size() - 1 }) {
+                CAPTURE(offset);
+
+                // A fresh reader without restore info has to restore through the block index (or by walking the blocks)
+                auto reader = AnyGcodeFormatReader(filename);
+                REQUIRE(reader.is_open());
+                REQUIRE(reader.get()->stream_gcode_start(offset) == IGcodeReader::Result_t::RESULT_OK);
+
+                std::string rest;
+                char c;
+                while (reader.get()->stream_getc(c) == IGcodeReader::Result_t::RESULT_OK) {
+                    rest.push_back(c);
+                }
+
+                REQUIRE(rest == contents.substr(offset));
+            }
+        }
+    }
+}
+
 TEST_CASE("copy & move operators", "[GcodeReader]") {
     GcodeBuffer buffer;
 
@@ -506,12 +549,14 @@ TEST_CASE("Reader: Error in long, discard") {
 TEST_CASE("Reader CRC: incorrect before gcode") {
     AnyGcodeFormatReader reader("test_bad_crc_intro.bgcode");
     REQUIRE(reader.is_open());
+    REQUIRE_FALSE(reader.get()->verify_file(IGcodeReader::FileVerificationLevel::full));
     REQUIRE(reader.get()->stream_gcode_start() == IGcodeReader::Result_t::RESULT_CORRUPT);
 }
 
 TEST_CASE("Reader CRC: incorrect on first gcode") {
     AnyGcodeFormatReader reader("test_bad_crc_first_gcode.bgcode");
     REQUIRE(reader.is_open());
+    REQUIRE_FALSE(reader.get()->verify_file(IGcodeReader::FileVerificationLevel::full));
     // The first gcode block is checked during the start
     REQUIRE(reader.get()->stream_gcode_start() == IGcodeReader::Result_t::RESULT_CORRUPT);
 }
@@ -519,6 +564,8 @@ TEST_CASE("Reader CRC: incorrect on first gcode") {
 TEST_CASE("Reader CRC: incorrect on another gcode") {
     AnyGcodeFormatReader reader("test_bad_crc_gcode.bgcode");
     REQUIRE(reader.is_open());
+    // Unlike the streamed checks below, the full verification walks all the blocks and finds the damage
+    REQUIRE_FALSE(reader.get()->verify_file(IGcodeReader::FileVerificationLevel::full));
     // This checks only the beginning, not the whole gcode and so far we didn't find the "broken" part yet.
     REQUIRE(reader.get()->stream_gcode_start() == IGcodeReader::Result_t::RESULT_OK);
 
@@ -1,7 +1,9 @@
 #include <http/websocket.hpp>
+#include <http/resp_parser.h>
 
 #include <catch2/catch.hpp>
 #include <cstring>
+#include <string>
 
 using namespace http;
 
@@ -22,3 +24,55 @@ public:
 TEST_CASE("Websocket key exchange") {
     TestKey test_key; // Test done in the constructor
 }
+
+TEST_CASE("Websocket upgrade extension negotiation") {
+    const bool with_compression = GENERATE(false, true);
+
+    std::string resp = "HTTP/1.1 101 Switching Protocols\r\n"
+                       "Upgrade: websocket\r\n"
+                       "Connection: Upgrade\r\n"
+                       "Sec-WebSocket-Accept: HSmrc0sMlYUkAGmm5OPpG2HaGWk=\r\n"
+                       "Sec-WebSocket-Protocol: prusa-connect\r\n";
+    if (with_compression) {
+        resp += "Sec-WebSocket-Extensions: heatshrink\r\n";
+    }
+    resp += "\r\n";
+
+    TestKey key;
+    WebSocketAccept accept(key);
+    parser::ResponseParser parser(&accept);
+    parser.consume(resp);
+
+    REQUIRE(parser.status_code == 101);
+    REQUIRE(accept.key_matched());
+    REQUIRE(accept.all_supported());
+    // The compression extension is optional, unlike the above.
+    REQUIRE(accept.heatshrink_negotiated() == with_compression);
+}
+
+TEST_CASE("Websocket payload masking") {
+    const uint8_t key_bytes[4] = { 0xde, 0xad, 0xbe, 0xef };
+    uint32_t key;
+    memcpy(&key, key_bytes, sizeof key);
+
+    uint8_t data[131];
+    for (size_t i = 0; i < sizeof data; i++) {
+        data[i] = static_cast<uint8_t>(i * 31 + 7);
+    }
+
+    // Sizes exercising both the word-sized bulk and all the possible tails.
+    const size_t size = GENERATE(size_t(0), 1, 3, 4, 5, 8, 31, 131);
+
+    uint8_t masked[sizeof data];
+    memcpy(masked, data, sizeof data);
+    WebSocket::mask_payload(key, masked, size);
+
+    // Matches the byte-by-byte definition from the RFC.
+    for (size_t i = 0; i < size; i++) {
+        REQUIRE(masked[i] == (data[i] ^ key_bytes[i % 4]));
+    }
+
+    // Masking is its own inverse and doesn't run past the size.
+    WebSocket::mask_payload(key, masked, size);
+    REQUIRE(memcmp(masked, data, sizeof data) == 0);
+}
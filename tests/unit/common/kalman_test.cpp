@@ -0,0 +1,80 @@
+#include "catch2/catch.hpp"
+
+#include <cmath>
+#include <cstdint>
+
+#include <filters/kalman.hpp>
+
+namespace {
+
+/// Deterministic pseudo-random noise in [-amplitude, amplitude]
+int32_t noise(uint32_t &seed, int32_t amplitude) {
+    seed = seed * 1103515245 + 12345;
+    return static_cast<int32_t>(seed >> 16) % (2 * amplitude + 1) - amplitude;
+}
+
+} // namespace
+
+TEST_CASE("fixed-point kalman filter tracks the float version", "[kalman]") {
+    KalmanFilter reference(100, 100, 0.1);
+    FixedPointKalmanFilter<12> fixed(100, 100, 0.1);
+
+    uint32_t seed = 42;
+    uint32_t now_us = 0;
+
+    SECTION("constant signal with noise") {
+        for (int i = 0; i < 1000; ++i) {
+            const int32_t value = 5000 + noise(seed, 100);
+            now_us += 250'000;
+            const double expected = reference.filter(value, now_us);
+            const int32_t actual = fixed.filter(value, now_us);
+            // Q12 state plus integer output rounding: allow one unit on top
+            // of the float result for every sample
+            CHECK(std::abs(actual - expected) <= 1.0 + std::abs(expected) * 1e-3);
+        }
+        CHECK(std::abs(fixed.get_error_estimate() - reference.get_error_estimate()) <= 1.0 + reference.get_error_estimate() * 1e-2);
+    }
+
+    SECTION("step response") {
+        for (int i = 0; i < 200; ++i) {
+            const int32_t value = (i < 100) ? 0 : 100'000;
+            now_us += 250'000;
+            const double expected = reference.filter(value, now_us);
+            const int32_t actual = fixed.filter(value, now_us);
+            // the gain quantization shows the most right after the step, allow 1 % there
+            CHECK(std::abs(actual - expected) <= 1.0 + std::abs(expected) * 1e-2);
+        }
+    }
+
+    SECTION("large values stay within Q12 headroom") {
+        FixedPointKalmanFilter<12> drift_like(120000, 120000, 0.01);
+        KalmanFilter drift_reference(120000, 120000, 0.01);
+        for (int i = 0; i < 500; ++i) {
+            const int32_t value = 50'000'000 + noise(seed, 1'000'000);
+            now_us += 250'000;
+            const double expected = drift_reference.filter(value, now_us);
+            const int32_t actual = drift_like.filter(value, now_us);
+            CHECK(std::abs(actual - expected) <= 1.0 + std::abs(expected) * 1e-3);
+        }
+    }
+}
+
+TEST_CASE("fixed-point kalman filter applies the predictor", "[kalman]") {
+    using Filter = FixedPointKalmanFilter<12>;
+
+    // Predictor shifting the estimate by a constant per step, the way
+    // time_sync corrects the offset estimate by the expected drift
+    const int32_t correction = 10;
+    KalmanFilter reference(100, 100, 0.1, [&](double last_estimate, uint32_t) { return last_estimate + correction; });
+    Filter fixed(100, 100, 0.1, [&](int64_t last_estimate_q, uint32_t) { return last_estimate_q + (static_cast<int64_t>(correction) << Filter::frac_bits); });
+
+    uint32_t seed = 7;
+    uint32_t now_us = 0;
+    for (int i = 0; i < 500; ++i) {
+        const int32_t value = 10 * i + noise(seed, 20);
+        now_us += 250'000;
+        const double expected = reference.filter(value, now_us);
+        const int32_t actual = fixed.filter(value, now_us);
+        CHECK(std::abs(actual - expected) <= 1.0 + std::abs(expected) * 1e-3);
+    }
+}
@@ -118,6 +118,7 @@ TEST_CASE("Json Big Buffer - no split") {
     const auto [result, written] = renderer.render(buff, BUF_SIZE);
 
     REQUIRE(result == JsonResult::Complete);
+    REQUIRE(renderer.suspends() == 0);
     const string_view out(reinterpret_cast<char *>(buff), written);
     REQUIRE(out == EXPECTED);
 }
@@ -140,6 +141,7 @@ TEST_CASE("Json split buffer") {
 
     string response;
     auto result = JsonResult::Incomplete;
+    size_t incomplete_cnt = 0;
 
     while (result != JsonResult::Complete) {
         uint8_t buffer[increment];
@@ -148,9 +150,14 @@ TEST_CASE("Json split buffer") {
         REQUIRE(written > 0);
         response += string_view(reinterpret_cast<char *>(buffer), written);
         result = result_partial;
+        if (result == JsonResult::Incomplete) {
+            incomplete_cnt++;
+        }
     }
 
     REQUIRE(response == EXPECTED);
+    // Each suspension is one retried field.
+    REQUIRE(renderer.suspends() == incomplete_cnt);
 }
 
 TEST_CASE("Json with inner renderer") {
@@ -0,0 +1,109 @@
+#include "catch2/catch.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <vector>
+
+#include <filters/sliding_median.hpp>
+
+namespace {
+
+/// Deterministic pseudo-random sample stream
+int32_t next_sample(uint32_t &seed) {
+    seed = seed * 1103515245 + 12345;
+    return static_cast<int32_t>(seed >> 16) % 10'000;
+}
+
+/// Median of the last `window` entries of `history` computed the obvious way
+template <size_t window>
+int32_t reference_median(const std::vector<int32_t> &history) {
+    const size_t count = std::min(history.size(), window);
+    std::vector<int32_t> sorted(history.end() - count, history.end());
+    std::sort(sorted.begin(), sorted.end());
+    return sorted[count / 2];
+}
+
+} // namespace
+
+TEMPLATE_TEST_CASE_SIG("sliding median matches a naive recompute", "[sliding_median]", ((size_t W), W), 15, 31, 63) {
+    SlidingMedian<W> filter;
+    std::vector<int32_t> history;
+    uint32_t seed = 42;
+
+    for (int i = 0; i < 1000; ++i) {
+        int32_t sample = next_sample(seed);
+        history.push_back(sample);
+        const bool valid = filter.filter(sample);
+        CHECK(valid == (history.size() >= W));
+        CHECK(sample == reference_median<W>(history));
+    }
+}
+
+TEST_CASE("sliding median handles duplicates and monotonic input", "[sliding_median]") {
+    SlidingMedian<15> filter;
+
+    SECTION("all equal") {
+        for (int i = 0; i < 50; ++i) {
+            int32_t sample = 7;
+            filter.filter(sample);
+            CHECK(sample == 7);
+        }
+    }
+
+    SECTION("monotonically increasing") {
+        int32_t sample = 0;
+        for (int i = 0; i < 50; ++i) {
+            sample = i;
+            filter.filter(sample);
+        }
+        // median of 35..49 is 42
+        CHECK(sample == 42);
+    }
+
+    SECTION("reset starts over") {
+        for (int i = 0; i < 20; ++i) {
+            int32_t sample = 1000;
+            filter.filter(sample);
+        }
+        filter.reset();
+        int32_t sample = 5;
+        CHECK(filter.filter(sample) == false);
+        CHECK(sample == 5);
+    }
+}
+
+// Opt-in benchmark (run with "[.][sliding_median_benchmark]"); compares the
+// incremental filter against recomputing the median of the window per sample
+TEST_CASE("sliding median benchmark", "[.][sliding_median_benchmark]") {
+    constexpr size_t W = 63;
+    constexpr int samples = 100'000;
+
+    uint32_t seed = 42;
+    std::vector<int32_t> input;
+    for (int i = 0; i < samples; ++i) {
+        input.push_back(next_sample(seed));
+    }
+
+    const auto incremental_start = std::chrono::steady_clock::now();
+    SlidingMedian<W> filter;
+    int64_t incremental_check = 0;
+    for (int32_t sample : input) {
+        filter.filter(sample);
+        incremental_check += sample;
+    }
+    const auto incremental_us = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - incremental_start).count();
+
+    const auto naive_start = std::chrono::steady_clock::now();
+    std::vector<int32_t> window;
+    int64_t naive_check = 0;
+    for (size_t i = 0; i < input.size(); ++i) {
+        const size_t begin = (i + 1 > W) ? i + 1 - W : 0;
+        window.assign(input.begin() + begin, input.begin() + i + 1);
+        std::nth_element(window.begin(), window.begin() + window.size() / 2, window.end());
+        naive_check += window[window.size() / 2];
+    }
+    const auto naive_us = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - naive_start).count();
+
+    CHECK(incremental_check == naive_check);
+    WARN("window " << W << ": incremental " << incremental_us << " us, naive recompute " << naive_us << " us for " << samples << " samples");
+}
@@ -0,0 +1,56 @@
+#include "catch2/catch.hpp"
+#include "wall_clock.hpp"
+
+/// Controllable local tick timer for the test
+static int64_t test_local_us = 0;
+
+extern "C" int64_t get_timestamp_us() {
+    return test_local_us;
+}
+
+static constexpr int64_t million = 1'000'000;
+
+TEST_CASE("wall_clock basics", "[wall_clock]") {
+    // The service keeps global state, so run the scenarios in sequence
+    // within one test case
+
+    // Before the first sample there is nothing to report
+    REQUIRE_FALSE(wall_clock::is_synced());
+    REQUIRE(wall_clock::now_us() == 0);
+
+    // First sample steps the clock
+    test_local_us = 100 * million;
+    const int64_t epoch = int64_t { 1'700'000'000 } * million;
+    wall_clock::sync_from_sntp(1'700'000'000, 0);
+    REQUIRE(wall_clock::is_synced());
+    REQUIRE(wall_clock::now_us() == epoch);
+
+    // Between samples the clock follows the local timer
+    test_local_us += 10 * million;
+    REQUIRE(wall_clock::now_us() == epoch + 10 * million);
+
+    // A small offset in the next sample is slewed in, not stepped:
+    // right after the sync nothing changes...
+    test_local_us += 300 * million;
+    wall_clock::sync_from_sntp(1'700'000'310, 200'000); // we are 200 ms behind
+    const int64_t at_sync = wall_clock::now_us();
+    REQUIRE(at_sync == epoch + 310 * million);
+
+    // ...and the correction is absorbed gradually and monotonically
+    int64_t previous = at_sync;
+    for (int i = 0; i < 1000; i++) {
+        test_local_us += million;
+        const int64_t now = wall_clock::now_us();
+        REQUIRE(now > previous);
+        // never faster than local time + slew rate + drift allowance
+        REQUIRE(now - previous < million + million / 1000);
+        previous = now;
+    }
+    // 200 ms at 500 ppm take 400 s, by now the clock caught up completely
+    REQUIRE(previous == epoch + (310 + 1000) * million + 200'000);
+
+    // A gross error is stepped, even backwards
+    test_local_us += 3600 * million;
+    wall_clock::sync_from_sntp(1'700'000'000, 0);
+    REQUIRE(wall_clock::now_us() == epoch);
+}
@@ -6,7 +6,7 @@ std::variant<const char *, PartialFile::Ptr> PartialFile::create(const char *pat
     return "not implemented";
 }
 
-std::variant<const char *, PartialFile::Ptr> PartialFile::open(const char *path, PartialFile::State state, bool ignore_opened) {
+std::variant<const char *, PartialFile::Ptr> PartialFile::open(const char *path, PartialFile::State state, bool ignore_opened, std::optional<UsbhMscRequest::SectorNbr> expected_first_sector) {
     return "not implemented";
 }
 
@@ -18,6 +18,8 @@ bool PartialFile::seek(size_t offset) {
     return true;
 }
 
+void PartialFile::select_cursor(size_t idx) {}
+
 bool PartialFile::has_valid_head(size_t bytes) const {
     return true;
 }
@@ -152,6 +152,36 @@ TEST_CASE("Unknown / broken command refused") {
     test.consume_telemetry();
 }
 
+TEST_CASE("Command preempts regenerable event") {
+    Test test;
+
+    test.consume_telemetry();
+
+    // A state change plans a StateChanged event...
+    test.params.state = printer_state::DeviceState::Printing;
+    test.event_type(EventType::StateChanged);
+    // ... but before it goes out, a command arrives on the socket.
+    test.planner.notify_command_waiting();
+
+    // The command gets through first - the event can regenerate later.
+    const auto action = test.planner.next_action(buffer, nullptr);
+    REQUIRE(holds_alternative<ReadCommand>(action));
+    test.planner.command(Command {
+        1,
+        UnknownCommand {},
+    });
+
+    // The response to the command goes out...
+    test.event_type(EventType::Rejected);
+    test.planner.action_done(ActionResult::Ok);
+
+    // ... and the dropped state event is planned again afterwards.
+    test.event_type(EventType::StateChanged);
+    test.planner.action_done(ActionResult::Ok);
+
+    test.consume_telemetry();
+}
+
 TEST_CASE("Send info request") {
     Test test;
 
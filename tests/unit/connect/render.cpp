@@ -53,6 +53,8 @@ TEST_CASE("Render") {
     Action action;
     optional<Monitor::Slot> transfer_slot = nullopt;
     optional<CommandId> background_command_id = nullopt;
+    // Lives here so the pointer inside the action stays valid until rendering.
+    Printer::TelemetryCache telemetry_cache;
 
     SECTION("Telemetry - reduced") {
         params.emplace(params_printing());
@@ -69,6 +71,54 @@ TEST_CASE("Render") {
         // clang-format on
     }
 
+    SECTION("Telemetry - differential") {
+        params.emplace(params_printing());
+        telemetry_cache = params->telemetry_cache();
+        // Only these two changed since the last delivered telemetry, the
+        // rest of the full fields shall be left out.
+        params->slots[0].temp_nozzle = 205;
+        params->target_nozzle = 210;
+        action = SendTelemetry { SendTelemetry::Mode::Differential, &telemetry_cache };
+        // clang-format off
+        expected = "{"
+            "\"job_id\":42,"
+            "\"time_printing\":0,"
+            "\"time_remaining\":0,"
+            "\"filament_change_in\":0,"
+            "\"progress\":12,"
+            "\"temp_nozzle\":205.0,"
+            "\"target_nozzle\":210.0,"
+            "\"state\":\"PRINTING\""
+        "}";
+        // clang-format on
+    }
+
+    SECTION("Telemetry - differential without cache") {
+        // Without the last delivered values to diff against, everything goes out.
+        params.emplace(params_printing());
+        action = SendTelemetry { SendTelemetry::Mode::Differential };
+        // clang-format off
+        expected = "{"
+            "\"job_id\":42,"
+            "\"time_printing\":0,"
+            "\"time_remaining\":0,"
+            "\"filament_change_in\":0,"
+            "\"progress\":12,"
+            "\"temp_nozzle\":200.0,"
+            "\"temp_bed\":65.0,"
+            "\"target_nozzle\":195.0,"
+            "\"target_bed\":70.0,"
+            "\"speed\":0,"
+            "\"flow\":0,"
+            "\"axis_z\":0.00,"
+            "\"fan_extruder\":0,"
+            "\"fan_print\":0,"
+            "\"filament\":0.0,"
+            "\"state\":\"PRINTING\""
+        "}";
+        // clang-format on
+    }
+
     SECTION("Telemetry - printing") {
         params.emplace(params_printing());
         action = SendTelemetry { SendTelemetry::Mode::Full };
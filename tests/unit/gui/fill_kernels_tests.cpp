@@ -0,0 +1,70 @@
+/// fill_kernels tests
+
+#include <array>
+#include <cstring>
+
+#include <catch2/catch.hpp>
+
+#include "fill_kernels.hpp"
+
+namespace {
+
+/// naive reference the kernels must match byte for byte
+void reference_fill(uint8_t *p, uint32_t v, size_t pixel_size, size_t count) {
+    while (count--) {
+        for (size_t nth_byte = 0; nth_byte < pixel_size; ++nth_byte) {
+            *p++ = uint8_t(v >> (8 * nth_byte));
+        }
+    }
+}
+
+constexpr uint8_t sentinel = 0xA5;
+
+} // namespace
+
+TEST_CASE("fill_kernels::match reference", "[fill_kernels]") {
+    // odd offsets and counts to exercise the alignment head/tail paths
+    const size_t offset = GENERATE(0, 1, 2, 3, 4, 5);
+    const size_t count = GENERATE(0, 1, 2, 3, 4, 5, 7, 8, 31, 100);
+    const uint32_t color = 0x00C0FFEE;
+
+    alignas(4) std::array<uint8_t, 512> buff;
+    alignas(4) std::array<uint8_t, 512> ref_buff;
+
+    SECTION("2 byte pixels") {
+        buff.fill(sentinel);
+        ref_buff.fill(sentinel);
+        fill_pixels<2>(buff.data() + 2 * offset, color, count);
+        reference_fill(ref_buff.data() + 2 * offset, color, 2, count);
+        CHECK(buff == ref_buff);
+    }
+
+    SECTION("3 byte pixels") {
+        buff.fill(sentinel);
+        ref_buff.fill(sentinel);
+        fill_pixels<3>(buff.data() + 3 * offset, color, count);
+        reference_fill(ref_buff.data() + 3 * offset, color, 3, count);
+        CHECK(buff == ref_buff);
+    }
+
+    SECTION("4 byte pixels") {
+        buff.fill(sentinel);
+        ref_buff.fill(sentinel);
+        fill_pixels<4>(buff.data() + 4 * offset, color, count);
+        reference_fill(ref_buff.data() + 4 * offset, color, 4, count);
+        CHECK(buff == ref_buff);
+    }
+}
+
+TEST_CASE("fill_kernels::3 byte pixels keep byte order", "[fill_kernels]") {
+    alignas(4) std::array<uint8_t, 64> buff;
+    buff.fill(sentinel);
+
+    fill_pixels_3b(buff.data(), 0x00112233, 8);
+    for (size_t i = 0; i < 8; i++) {
+        CHECK(buff[3 * i + 0] == 0x33);
+        CHECK(buff[3 * i + 1] == 0x22);
+        CHECK(buff[3 * i + 2] == 0x11);
+    }
+    CHECK(buff[3 * 8] == sentinel);
+}
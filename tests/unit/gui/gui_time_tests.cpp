@@ -26,3 +26,18 @@ SECTION("actualization") {
 }
 }
 ;
+
+TEST_CASE("gui frame budget", "[gui_time]") {
+    tick = 1000;
+    gui::StartDraw();
+    tick += 10; // 10 ms frame, within the 40 ms budget
+    gui::EndDraw();
+    REQUIRE_FALSE(gui::ConsumeFrameOverBudget());
+
+    gui::StartDraw();
+    tick += 50; // 50 ms frame, over budget
+    gui::EndDraw();
+    REQUIRE(gui::ConsumeFrameOverBudget());
+    // the flag is consumed, only one roll tick gets deferred per frame
+    REQUIRE_FALSE(gui::ConsumeFrameOverBudget());
+}
@@ -136,6 +136,33 @@ TEST_CASE("LazyDirView::SortByName test", "[LazyDirView]") {
         CHECK(ldv_files(ldv) == StringList { "..", "fw", "old", "png-decode", "01.g", "02.g", "03.g", "04.g", "05.g" });
     }
 }
+TEST_CASE("LazyDirView::Adopt test", "[LazyDirView]") {
+    using LDV = LazyDirView<9>;
+
+    testFiles0 = {
+        { "old", UINT_LEAST64_MAX, true },
+        { "fw", 3, true },
+        { "01.g", 1, false },
+        { "02.g", 2, false },
+        { "03.g", 3, false }
+    };
+
+    LDV scratch;
+    scratch.ChangeDirectory("path",
+        LDV::SortPolicy::BY_NAME,
+        nullptr);
+
+    // Adopting must transfer the entries, window position and total count,
+    // and the adopted view must stay fully functional (scrolling etc.)
+    LDV ldv;
+    ldv.adopt(scratch);
+    CHECK(ldv.TotalFilesCount() == scratch.TotalFilesCount());
+    CHECK(ldv.window_offset() == scratch.window_offset());
+    CHECK(ldv_files(ldv) == StringList { "..", "fw", "old", "01.g", "02.g", "03.g" });
+    CHECK(ldv.MoveDown() == false); // everything fits the window
+    CHECK(ldv_files(ldv) == StringList { "..", "fw", "old", "01.g", "02.g", "03.g" });
+}
+
 TEST_CASE("LazyDirView::SortByCrModDateTime test", "[LazyDirView]") {
     using LDV = LazyDirView<9>;
 
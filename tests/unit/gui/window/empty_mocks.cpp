@@ -23,6 +23,9 @@ void notify_server_about_knob_click() {}
 } // namespace marlin_client
 
 FILE *img::get_resource_file() { return nullptr; }
+void img::prefetch_icon(const img::Resource &) {}
+FILE *img::open_cached_icon(const img::Resource &) { return nullptr; }
+void img::reset_icon_cache() {}
 
 void _bsod(const char *fmt, const char *fine_name, int line_number, ...) {
     while (1)
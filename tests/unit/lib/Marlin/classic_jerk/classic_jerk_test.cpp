@@ -0,0 +1,185 @@
+#include "catch2/catch.hpp"
+
+#include <array>
+#include <chrono>
+#include <cstdio>
+#include <random>
+
+#include "planner_jerk.h"
+
+using std::array;
+
+namespace {
+
+// Reference implementation: verbatim transcription of the loops formerly
+// inlined in Planner::_populate_block(), kept here to pin the extracted
+// kernel to the original behavior.
+template <int num_jerk_axes>
+float reference_junction(const float nominal_speed, const float previous_nominal_speed,
+    const array<float, 4> &current_speed, const array<float, 4> &previous_speed,
+    const array<float, 4> &max_jerk,
+    float &safe_speed_out, const float previous_safe_speed) {
+    float safe_speed = nominal_speed;
+
+    uint8_t limited = 0;
+    for (int i = 0; i < num_jerk_axes; ++i) {
+        const float jerk = std::abs(current_speed[i]),
+                    maxj = max_jerk[i];
+        if (jerk > maxj) {
+            if (limited) {
+                const float mjerk = nominal_speed * maxj;
+                if (jerk * safe_speed > mjerk) {
+                    safe_speed = mjerk / jerk;
+                }
+            } else {
+                safe_speed *= maxj / jerk;
+                ++limited;
+            }
+        }
+    }
+    safe_speed_out = safe_speed;
+
+    if (previous_nominal_speed == 0) {
+        return safe_speed;
+    }
+
+    float v_factor = 1;
+    limited = 0;
+
+    float vmax_junction = std::min(nominal_speed, previous_nominal_speed);
+
+    const float smaller_speed_factor = vmax_junction / previous_nominal_speed;
+    for (int axis = 0; axis < num_jerk_axes; ++axis) {
+        float v_exit = previous_speed[axis] * smaller_speed_factor,
+              v_entry = current_speed[axis];
+        if (limited) {
+            v_exit *= v_factor;
+            v_entry *= v_factor;
+        }
+
+        const float jerk = (v_exit > v_entry)
+            ? ((v_entry > 0 || v_exit < 0) ? (v_exit - v_entry) : std::max(v_exit, -v_entry))
+            : ((v_entry < 0 || v_exit > 0) ? (v_entry - v_exit) : std::max(-v_exit, v_entry));
+
+        if (jerk > max_jerk[axis]) {
+            v_factor *= max_jerk[axis] / jerk;
+            ++limited;
+        }
+    }
+    if (limited) {
+        vmax_junction *= v_factor;
+    }
+    const float vmax_junction_threshold = vmax_junction * 0.99f;
+    if (previous_safe_speed > vmax_junction_threshold && safe_speed > vmax_junction_threshold) {
+        vmax_junction = safe_speed;
+    }
+    return vmax_junction;
+}
+
+// MK4/XL jerk defaults (DEFAULT_XJERK/YJERK/ZJERK/EJERK)
+constexpr array<float, 4> default_jerk { 8.f, 8.f, 2.f, 5.f };
+
+struct Segment {
+    float nominal_speed;
+    array<float, 4> speed;
+};
+
+template <class Rng>
+Segment random_segment(Rng &rng) {
+    std::uniform_real_distribution<float> speed_dist(1.f, 400.f);
+    std::uniform_real_distribution<float> dir_dist(-1.f, 1.f);
+    Segment s;
+    s.nominal_speed = speed_dist(rng);
+    float norm = 0;
+    for (auto &c : s.speed) {
+        c = dir_dist(rng);
+        norm += c * c;
+    }
+    norm = std::sqrt(norm);
+    for (auto &c : s.speed) {
+        c *= s.nominal_speed / norm;
+    }
+    return s;
+}
+
+} // namespace
+
+TEMPLATE_TEST_CASE_SIG("classic jerk kernel matches reference", "[Marlin][ClassicJerk]",
+    ((int num_jerk_axes), num_jerk_axes), 3, 4) {
+    std::mt19937 rng(42);
+
+    Segment prev = random_segment(rng);
+    float prev_safe_speed = classic_jerk::safe_halt_speed<num_jerk_axes>(prev.nominal_speed, prev.speed, default_jerk);
+
+    for (int i = 0; i < 100000; ++i) {
+        const Segment cur = random_segment(rng);
+
+        const float safe_speed = classic_jerk::safe_halt_speed<num_jerk_axes>(cur.nominal_speed, cur.speed, default_jerk);
+        const float vmax = classic_jerk::junction_speed<num_jerk_axes>(
+            cur.nominal_speed, prev.nominal_speed,
+            cur.speed, prev.speed,
+            default_jerk, safe_speed, prev_safe_speed);
+
+        float ref_safe_speed;
+        const float ref_vmax = reference_junction<num_jerk_axes>(
+            cur.nominal_speed, prev.nominal_speed,
+            cur.speed, prev.speed,
+            default_jerk, ref_safe_speed, prev_safe_speed);
+
+        REQUIRE(safe_speed == Approx(ref_safe_speed).epsilon(1e-6f));
+        REQUIRE(vmax == Approx(ref_vmax).epsilon(1e-6f));
+        // The kernel may fall back to the safe halt speed, which is bounded
+        // by the current nominal speed only.
+        REQUIRE(vmax <= cur.nominal_speed + 1e-4f);
+        REQUIRE(vmax >= 0);
+
+        prev = cur;
+        prev_safe_speed = safe_speed;
+    }
+}
+
+TEST_CASE("classic jerk kernel: first segment starts from safe speed", "[Marlin][ClassicJerk]") {
+    // A segment whose axis speeds are all within the jerk limits may halt
+    // from its nominal speed.
+    const array<float, 4> slow_speed { 3.f, 3.f, 0.f, 1.f };
+    REQUIRE(classic_jerk::safe_halt_speed<4>(5.f, slow_speed, default_jerk) == 5.f);
+
+    // A diagonal move exceeding the jerk limits is scaled down by the most
+    // limiting axis.
+    const array<float, 4> fast_speed { 100.f, 100.f, 0.f, 0.f };
+    const float safe = classic_jerk::safe_halt_speed<4>(141.42f, fast_speed, default_jerk);
+    REQUIRE(safe == Approx(141.42f * (8.f / 100.f)).epsilon(1e-4f));
+}
+
+// Throughput measurement for the per-block junction computation, hidden from
+// the default run. Execute with:
+//   ./Marlin_ClassicJerk_tests "[.benchmark]"
+TEMPLATE_TEST_CASE_SIG("classic jerk kernel throughput", "[.benchmark]",
+    ((int num_jerk_axes), num_jerk_axes), 3, 4) {
+    std::mt19937 rng(7);
+
+    constexpr size_t num_segments = 4096;
+    std::array<Segment, num_segments> segments;
+    std::array<float, num_segments> safe_speeds;
+    for (size_t i = 0; i < num_segments; ++i) {
+        segments[i] = random_segment(rng);
+        safe_speeds[i] = classic_jerk::safe_halt_speed<num_jerk_axes>(segments[i].nominal_speed, segments[i].speed, default_jerk);
+    }
+
+    constexpr int iterations = 2000000;
+    float sink = 0; // defeat dead-code elimination
+    const auto start = std::chrono::steady_clock::now();
+    for (int i = 0; i < iterations; ++i) {
+        const size_t cur = i % num_segments, prev = (i + num_segments - 1) % num_segments;
+        const float safe_speed = classic_jerk::safe_halt_speed<num_jerk_axes>(segments[cur].nominal_speed, segments[cur].speed, default_jerk);
+        sink += classic_jerk::junction_speed<num_jerk_axes>(
+            segments[cur].nominal_speed, segments[prev].nominal_speed,
+            segments[cur].speed, segments[prev].speed,
+            default_jerk, safe_speed, safe_speeds[prev]);
+    }
+    const auto elapsed = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+    printf("classic jerk kernel (%d axes): %.0f blocks/sec (sink=%f)\n",
+        num_jerk_axes, iterations / elapsed, double(sink));
+    REQUIRE(sink > 0);
+}
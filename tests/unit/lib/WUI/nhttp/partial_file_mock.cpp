@@ -14,6 +14,8 @@ bool PartialFile::sync() {
     return true;
 }
 
+void PartialFile::select_cursor(size_t idx) {}
+
 bool PartialFile::advance_written(size_t by) {
     return true;
 }
@@ -0,0 +1,70 @@
+#include "catch2/catch.hpp"
+#include <logging/log_dest_bufflog.hpp>
+
+#include <cstring>
+#include <string>
+
+using namespace logging;
+
+static Component component = { "test", Severity::debug };
+
+static void log_message(const char *message, TaskId task_id = 1) {
+    FormattedEvent event {
+        .timestamp = { 0, 1000 },
+        .task_id = task_id,
+        .component = &component,
+        .severity = Severity::info,
+        .message = message,
+    };
+    bufflog_log_event(&event);
+}
+
+/// Drain the ring in small fragments the way the modbus FIFO handler does.
+static std::string pickup_all() {
+    std::string result;
+    for (;;) {
+        char fragment[8];
+        const size_t picked = bufflog_pickup(fragment, sizeof(fragment));
+        if (picked == 0) {
+            return result;
+        }
+        result.append(fragment, picked);
+    }
+}
+
+TEST_CASE("bufflog delivers formatted events", "[logging]") {
+    pickup_all(); // start with an empty ring
+
+    log_message("hello");
+    const std::string picked = pickup_all();
+    REQUIRE(picked == std::string("0.001s [INFO  - test:1] hello") + char(BUFFLOG_TERMINATION_CHAR));
+}
+
+TEST_CASE("bufflog keeps events in order", "[logging]") {
+    pickup_all();
+
+    log_message("first");
+    log_message("second");
+    const std::string picked = pickup_all();
+    REQUIRE(picked.find("first") < picked.find("second"));
+    REQUIRE(picked.find("second") != std::string::npos);
+}
+
+TEST_CASE("bufflog drops whole events when full and counts them", "[logging]") {
+    pickup_all();
+
+    const uint32_t dropped_before = bufflog_dropped_count(7);
+    for (int i = 0; i < 50; ++i) {
+        log_message("some rather long message that occupies several cells", 7);
+    }
+    REQUIRE(bufflog_dropped_count(7) > dropped_before);
+
+    // every event that did make it through is properly terminated
+    const std::string picked = pickup_all();
+    REQUIRE(!picked.empty());
+    REQUIRE(picked.back() == char(BUFFLOG_TERMINATION_CHAR));
+
+    // and the ring keeps working after the overflow
+    log_message("after overflow");
+    REQUIRE(pickup_all().find("after overflow") != std::string::npos);
+}
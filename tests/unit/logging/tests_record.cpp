@@ -0,0 +1,92 @@
+#include "catch2/catch.hpp"
+#include <logging/log_record.hpp>
+
+#include <cstdarg>
+#include <cstdio>
+#include <string>
+
+static bool captured;
+
+static std::string roundtrip(const char *fmt, ...) {
+    logging::Record record;
+
+    va_list args;
+    va_start(args, fmt);
+    captured = record.capture(fmt, args);
+    va_end(args);
+
+    if (!captured) {
+        return "";
+    }
+
+    char out[128];
+    record.render(out, sizeof(out));
+    return out;
+}
+
+TEST_CASE("record captures and renders common conversions", "[logging]") {
+    REQUIRE(roundtrip("no arguments at all") == "no arguments at all");
+    REQUIRE(roundtrip("int %d, uint %u", -42, 42u) == "int -42, uint 42");
+    REQUIRE(roundtrip("hex %x %X", 0xbeefu, 0xBEEFu) == "hex beef BEEF");
+    REQUIRE(roundtrip("long %ld, llong %lld", 123456789L, -9876543210LL) == "long 123456789, llong -9876543210");
+    REQUIRE(roundtrip("size %zu", (size_t)321) == "size 321");
+    REQUIRE(roundtrip("float %f", 1.5) == "float 1.500000");
+    REQUIRE(roundtrip("char %c", 'x') == "char x");
+    REQUIRE(roundtrip("str %s", "hello") == "str hello");
+    REQUIRE(roundtrip("ptr %p", (void *)nullptr) == [] {
+        char reference[32];
+        snprintf(reference, sizeof(reference), "ptr %p", (void *)nullptr);
+        return std::string(reference);
+    }());
+}
+
+TEST_CASE("record handles flags, width and precision", "[logging]") {
+    REQUIRE(roundtrip("[%5d]", 42) == "[   42]");
+    REQUIRE(roundtrip("[%-5d]", 42) == "[42   ]");
+    REQUIRE(roundtrip("[%05u]", 42u) == "[00042]");
+    REQUIRE(roundtrip("[%.2f]", 3.14159) == "[3.14]");
+    REQUIRE(roundtrip("[%8.3f]", 3.14159) == "[   3.142]");
+    REQUIRE(roundtrip("[%*d]", 6, 42) == "[    42]");
+    REQUIRE(roundtrip("[%.*s]", 3, "hello") == "[hel]");
+    REQUIRE(roundtrip("100%%") == "100%");
+}
+
+TEST_CASE("record survives edge cases", "[logging]") {
+    REQUIRE(roundtrip("null %s", (const char *)nullptr) == "null (null)");
+
+    // several arguments of mixed types
+    REQUIRE(roundtrip("%s=%d (%x, %.1f)", "v", 7, 255u, 0.5) == "v=7 (ff, 0.5)");
+}
+
+TEST_CASE("record refuses what it cannot capture", "[logging]") {
+    // unsupported conversion
+    roundtrip("chars written %n", (int *)nullptr);
+    REQUIRE(!captured);
+
+    // string too long for the argument buffer
+    roundtrip("%s", "this string is definitely longer than the record argument buffer can hold");
+    REQUIRE(!captured);
+
+    // too many arguments to fit
+    roundtrip("%d %d %d %d %d %d %d", 1, 2, 3, 4, 5, 6, 7);
+    REQUIRE(!captured);
+}
+
+static std::string roundtrip_into(size_t out_size, const char *fmt, ...) {
+    logging::Record record;
+
+    va_list args;
+    va_start(args, fmt);
+    captured = record.capture(fmt, args);
+    va_end(args);
+    REQUIRE(captured);
+
+    char out[128];
+    record.render(out, out_size);
+    return out;
+}
+
+TEST_CASE("record render truncates to the output buffer", "[logging]") {
+    REQUIRE(roundtrip_into(10, "a rather long message %d", 123) == "a rather ");
+    REQUIRE(roundtrip_into(10, "%s", "truncated right inside the argument") == "truncated");
+}
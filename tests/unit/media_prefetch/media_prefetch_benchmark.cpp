@@ -0,0 +1,106 @@
+// Throughput benchmark of the media prefetch -> gcode parser pipeline, fed
+// with the reference sliced files from data/compression_ratio.
+//
+// Hidden behind the [.][benchmark] tag, so it is not part of the regular test
+// run; execute it per commit via the run_media_prefetch_benchmark target (or
+// `media_prefetch_tests "[benchmark]"` directly).
+//
+// The stubbed AsyncJob runs fetches synchronously, so the absolute numbers
+// differ from the printer. What is comparable across commits is the relative
+// cost of the fetch + decode + parse path and the starvation count - each
+// starvation is a point where the reader drained the buffer, which on the
+// device translates to the planner waiting for the prefetch worker.
+
+#include <catch2/catch.hpp>
+
+#include <media_prefetch.hpp>
+#include <gcode_basic_parser.hpp>
+
+#include "test_tools/gcode_provider.hpp"
+
+#include <chrono>
+#include <cinttypes>
+#include <filesystem>
+#include <fstream>
+#include <vector>
+
+using S = MediaPrefetchManager::Status;
+
+namespace {
+
+// Replicate each reference file up to this size, so that a single run takes
+// long enough to give a stable commands/sec figure
+constexpr size_t workload_size = 4 * 1024 * 1024;
+
+} // namespace
+
+TEST_CASE("media_prefetch::benchmark", "[.][benchmark]") {
+    std::vector<std::filesystem::path> files;
+    for (const auto &entry : std::filesystem::directory_iterator("data/compression_ratio")) {
+        files.push_back(entry.path());
+    }
+    std::sort(files.begin(), files.end());
+    REQUIRE(files.size() > 0);
+
+    for (const auto &path : files) {
+        std::ifstream f(path, std::ios::in | std::ios::ate);
+        REQUIRE(f.is_open());
+
+        const auto file_size = f.tellg();
+        std::string str(file_size, '\0');
+        f.seekg(0);
+        REQUIRE(f.read(&str[0], file_size));
+
+        StubGcodeProviderMemory p;
+        for (size_t total = 0; total < workload_size; total += str.size()) {
+            p.add_gcode(str);
+        }
+
+        MediaPrefetchManager mp;
+        mp.start(p.filename(), {});
+
+        GCodeBasicParser parser;
+        MediaPrefetchManager::ReadResult command;
+        uint32_t commands = 0;
+        uint32_t starvations = 0;
+        uint32_t parse_errors = 0;
+        bool end_of_file = false;
+
+        const auto start_time = std::chrono::steady_clock::now();
+        mp.issue_fetch();
+
+        while (!end_of_file) {
+            switch (mp.read_command(command)) {
+
+            case S::ok:
+                commands++;
+                if (command.gcode[0] != '\0' && !parser.parse(command.gcode)) {
+                    parse_errors++;
+                }
+                break;
+
+            case S::end_of_buffer:
+                // The reader drained the buffer - on the device, the planner
+                // would now be starving until the fetch catches up
+                starvations++;
+                mp.issue_fetch();
+                break;
+
+            case S::end_of_file:
+                end_of_file = true;
+                break;
+
+            default:
+                FAIL("Unexpected read_command status");
+            }
+        }
+
+        const auto elapsed_us = std::max<int64_t>(std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start_time).count(), 1);
+        const auto commands_per_s = static_cast<uint64_t>(commands) * 1'000'000 / elapsed_us;
+
+        printf("file=%s commands=%" PRIu32 " starvations=%" PRIu32 " parse_errors=%" PRIu32 " elapsed_us=%" PRIi64 " commands_per_s=%" PRIu64 "\n",
+            path.filename().c_str(), commands, starvations, parse_errors, static_cast<int64_t>(elapsed_us), commands_per_s);
+
+        CHECK(commands > 0);
+    }
+}
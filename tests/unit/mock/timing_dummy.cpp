@@ -3,3 +3,7 @@
 uint32_t ticks_ms() {
     return 0;
 }
+
+uint32_t ticks_us() {
+    return 0;
+}
@@ -327,6 +327,39 @@ TEST_CASE("journal::EEPROM::Test transaction creation") {
         REQUIRE(state == Backend::BankState::Valid);
         REQUIRE(num_of_transactions == 1);
     }
+
+    SECTION("Nested transaction guards") {
+        journal.transaction_start();
+        journal.transaction_start(); // inner guard joins the running transaction
+        journal.save(1, data);
+        journal.transaction_end();
+        REQUIRE(journal.transaction.has_value()); // the outer guard still owns it
+        journal.save(2, data);
+        journal.transaction_end();
+        REQUIRE_FALSE(journal.transaction.has_value());
+
+        // both writes ended up in a single journal record
+        auto const [state, num_of_transactions, end_of_last_transaction] = journal.validate_transactions(Backend::BANK_HEADER_SIZE_WITH_CRC);
+        REQUIRE(state == Backend::BankState::Valid);
+        REQUIRE(num_of_transactions == 1);
+    }
+
+    SECTION("RAM mirror seqlock") {
+        const uint32_t seq = journal.ram_mirror_read_begin();
+        REQUIRE((seq & 1) == 0);
+        REQUIRE_FALSE(journal.ram_mirror_read_retry(seq));
+
+        {
+            auto write_guard = journal.ram_mirror_write_guard();
+            // a write is in flight - any read overlapping it must be retried
+            REQUIRE((journal.ram_mirror_read_begin() & 1) == 1);
+            REQUIRE(journal.ram_mirror_read_retry(journal.ram_mirror_read_begin()));
+            REQUIRE(journal.ram_mirror_read_retry(seq));
+        }
+
+        REQUIRE(journal.ram_mirror_read_retry(seq)); // the data may have changed since the original snapshot
+        REQUIRE_FALSE(journal.ram_mirror_read_retry(journal.ram_mirror_read_begin()));
+    }
 }
 
 inline constexpr TestStruct default_test_struct {};
@@ -373,6 +406,9 @@ TEST_CASE("journal::EEPROM::Config Store") {
 
         local_store->init();
         local_store->load_all();
+        // boot leaves the fragmented bank in place, compaction is deferred
+        REQUIRE(Test_EEPROM_journal().current_address == Test_EEPROM_journal().start_address + 32);
+        Test_EEPROM_journal().compact_if_needed();
         REQUIRE(Test_EEPROM_journal().current_address == Test_EEPROM_journal().start_address + Test_EEPROM_journal().bank_size + 21);
         REQUIRE(Test_EEPROM_journal().journal_state == Backend::JournalState::ValidStart);
         REQUIRE(local_store->int_item.get() == 12);
@@ -383,6 +419,8 @@ TEST_CASE("journal::EEPROM::Config Store") {
 
         local_store->init();
         local_store->load_all();
+        REQUIRE(Test_EEPROM_journal().current_address == Test_EEPROM_journal().start_address + Test_EEPROM_journal().bank_size + 32);
+        Test_EEPROM_journal().compact_if_needed();
         REQUIRE(Test_EEPROM_journal().current_address == Test_EEPROM_journal().start_address + 21);
         REQUIRE(Test_EEPROM_journal().journal_state == Backend::JournalState::ValidStart);
         REQUIRE(local_store->int_item.get() == 13);
@@ -404,6 +442,9 @@ TEST_CASE("journal::EEPROM::Config Store") {
 
         local_store->init();
         local_store->load_all();
+        // compaction of the fragmented bank is deferred from boot
+        REQUIRE(Test_EEPROM_journal().get_next_bank_start_address() == Test_EEPROM_journal().start_address + Test_EEPROM_journal().bank_size);
+        Test_EEPROM_journal().compact_if_needed();
         REQUIRE(Test_EEPROM_journal().get_next_bank_start_address() == Test_EEPROM_journal().start_address);
         REQUIRE(Test_EEPROM_journal().journal_state == Backend::JournalState::ValidStart);
         REQUIRE(local_store->int_item.get() == 12);
@@ -416,12 +457,36 @@ TEST_CASE("journal::EEPROM::Config Store") {
         local_store->init();
         local_store->load_all();
 
+        REQUIRE(Test_EEPROM_journal().get_next_bank_start_address() == Test_EEPROM_journal().start_address);
+        Test_EEPROM_journal().compact_if_needed();
         REQUIRE(Test_EEPROM_journal().get_next_bank_start_address() == Test_EEPROM_journal().start_address + Test_EEPROM_journal().bank_size);
         REQUIRE(Test_EEPROM_journal().journal_state == Backend::JournalState::ValidStart);
         REQUIRE(local_store->int_item.get() == 14);
         REQUIRE(local_store->struct_item.get() == test_struct);
         REQUIRE(local_store->nested_struct_item.get() == nested_struct);
     }
+
+    SECTION("Background compaction of a nearly full bank") {
+        // nothing is pending right after a cold start, so this is a no-op
+        const auto bank_before = Test_EEPROM_journal().get_next_bank_start_address();
+        Test_EEPROM_journal().compact_if_needed();
+        REQUIRE(Test_EEPROM_journal().get_next_bank_start_address() == bank_before);
+
+        // fill the current bank over the nearly-full threshold
+        int32_t value = 0;
+        while (Test_EEPROM_journal().get_free_space_in_current_bank() >= Test_EEPROM_journal().bank_size / 4) {
+            local_store->int_item.set(++value);
+        }
+
+        Test_EEPROM_journal().compact_if_needed();
+        REQUIRE(Test_EEPROM_journal().get_next_bank_start_address() != bank_before);
+        REQUIRE(local_store->int_item.get() == value);
+
+        // no new writes since the rewrite, so another call must not migrate again
+        const auto bank_after = Test_EEPROM_journal().get_next_bank_start_address();
+        Test_EEPROM_journal().compact_if_needed();
+        REQUIRE(Test_EEPROM_journal().get_next_bank_start_address() == bank_after);
+    }
 }
 TEST_CASE("journal::EEPROM::Config store - cold start") {
     eeprom_chip.clear();
@@ -495,6 +560,8 @@ TEST_CASE("journal::EEPROM::Config store - error states") {
         local_store = std::make_unique<Store<TestEEPROMJournalConfigV0, TestDeprecatedEEPROMJournalItemsV0, test_migration_functions_span_v0>>();
         local_store->init();
         local_store->load_all();
+        // the fragmented bank is only rewritten by the deferred compaction
+        Test_EEPROM_journal().compact_if_needed();
         REQUIRE(Test_EEPROM_journal().get_current_bank_start_address() == Test_EEPROM_journal().start_address + Test_EEPROM_journal().bank_size);
         REQUIRE(Test_EEPROM_journal().current_address == Test_EEPROM_journal().get_current_bank_start_address() + 21);
 
@@ -519,6 +586,7 @@ TEST_CASE("journal::EEPROM::Config store - error states") {
             local_store = std::make_unique<Store<TestEEPROMJournalConfigV0, TestDeprecatedEEPROMJournalItemsV0, test_migration_functions_span_v0>>();
             local_store->init();
             local_store->load_all();
+            Test_EEPROM_journal().compact_if_needed();
 
             REQUIRE(Test_EEPROM_journal().current_address == Test_EEPROM_journal().get_current_bank_start_address() + 21);
             REQUIRE(Test_EEPROM_journal().journal_state == journal::Backend::JournalState::ValidStart);
@@ -532,6 +600,7 @@ TEST_CASE("journal::EEPROM::Config store - error states") {
             local_store = std::make_unique<Store<TestEEPROMJournalConfigV0, TestDeprecatedEEPROMJournalItemsV0, test_migration_functions_span_v0>>();
             local_store->init();
             local_store->load_all();
+            Test_EEPROM_journal().compact_if_needed();
 
             REQUIRE(Test_EEPROM_journal().get_current_bank_start_address() == Test_EEPROM_journal().start_address);
             REQUIRE(Test_EEPROM_journal().current_address == Test_EEPROM_journal().get_current_bank_start_address() + 21);
@@ -544,6 +613,7 @@ TEST_CASE("journal::EEPROM::Config store - error states") {
             local_store = std::make_unique<Store<TestEEPROMJournalConfigV0, TestDeprecatedEEPROMJournalItemsV0, test_migration_functions_span_v0>>();
             local_store->init();
             local_store->load_all();
+            Test_EEPROM_journal().compact_if_needed();
 
             REQUIRE(Test_EEPROM_journal().get_current_bank_start_address() == Test_EEPROM_journal().start_address + Test_EEPROM_journal().bank_size);
             REQUIRE(Test_EEPROM_journal().current_address == Test_EEPROM_journal().get_current_bank_start_address() + 21);
@@ -0,0 +1,88 @@
+#include <catch2/catch.hpp>
+
+#include <chrono>
+#include <cstdint>
+#include <random>
+#include <vector>
+
+#include "puppies/crc16.hpp"
+
+using namespace common::puppies::crc;
+
+/// Reference bit-by-bit implementation as used by liblightmodbus and the Modbus specification
+static uint16_t reference_crc(const uint8_t *data, size_t length, uint16_t crc = 0xffff) {
+    for (size_t i = 0; i < length; i++) {
+        crc ^= data[i];
+        for (int j = 0; j < 8; j++) {
+            crc = (crc & 1) ? (crc >> 1) ^ 0xA001 : (crc >> 1);
+        }
+    }
+    return crc;
+}
+
+TEST_CASE("Known Modbus CRC vectors") {
+    // "123456789" -> 0x4B37 is the standard CRC-16/MODBUS check value
+    const uint8_t check[] = { '1', '2', '3', '4', '5', '6', '7', '8', '9' };
+    CHECK(compute(flash_crc_tables, check, sizeof(check)) == 0x4B37);
+
+    // Empty buffer leaves the initial value untouched
+    CHECK(compute(flash_crc_tables, check, 0) == 0xffff);
+}
+
+TEST_CASE("Table CRC matches bitwise reference") {
+    std::mt19937 gen(42);
+    std::uniform_int_distribution<int> byte(0, 255);
+
+    std::vector<uint8_t> data(300);
+    for (auto &b : data) {
+        b = byte(gen);
+    }
+
+    // All lengths around and below typical frame sizes, all word alignments
+    for (size_t offset = 0; offset < 4; ++offset) {
+        for (size_t len = 0; len + offset <= data.size(); ++len) {
+            REQUIRE(compute(flash_crc_tables, data.data() + offset, len) == reference_crc(data.data() + offset, len));
+        }
+    }
+}
+
+TEST_CASE("Chained CRC computation") {
+    const uint8_t data[] = { 0x01, 0x04, 0x80, 0x60, 0x00, 0x15, 0x30, 0x2a };
+
+    // Computing in two chunks has to match one pass, whatever the split
+    for (size_t split = 0; split <= sizeof(data); ++split) {
+        const uint16_t head = compute(flash_crc_tables, data, split);
+        CHECK(compute(flash_crc_tables, data + split, sizeof(data) - split, head) == compute(flash_crc_tables, data, sizeof(data)));
+    }
+}
+
+TEST_CASE("Modbus CRC microbenchmark", "[.benchmark]") {
+    // Run explicitly with: ./crc16_tests "[.benchmark]"
+    constexpr size_t FRAME_SIZE = 256; // maximum Modbus frame
+    constexpr int ROUNDS = 100000;
+
+    std::mt19937 gen(1);
+    std::uniform_int_distribution<int> byte(0, 255);
+    std::vector<uint8_t> frame(FRAME_SIZE);
+    for (auto &b : frame) {
+        b = byte(gen);
+    }
+
+    const auto throughput = [&](auto crc_fn) {
+        uint16_t sink = 0;
+        const auto start = std::chrono::steady_clock::now();
+        for (int i = 0; i < ROUNDS; ++i) {
+            frame[0] = static_cast<uint8_t>(i); // defeat result caching
+            sink ^= crc_fn(frame.data(), frame.size());
+        }
+        const auto elapsed = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+        CHECK(sink != 1); // keep the loop observable
+        return FRAME_SIZE * ROUNDS / elapsed / 1e6;
+    };
+
+    const double bitwise_mbps = throughput([](const uint8_t *d, size_t l) { return reference_crc(d, l); });
+    const double table_mbps = throughput([](const uint8_t *d, size_t l) { return compute(flash_crc_tables, d, l); });
+
+    WARN("bitwise: " << bitwise_mbps << " MB/s, table: " << table_mbps << " MB/s, speedup: " << table_mbps / bitwise_mbps << "x");
+    CHECK(table_mbps > bitwise_mbps);
+}
@@ -18,6 +18,8 @@ uint32_t ticks_us() {
     return current_ticks_us;
 }
 
+extern "C" void metric_record_custom(void *, const char *, ...) {}
+
 struct Times {
     uint32_t buddy_time_us;
     uint32_t puppy_time_us;
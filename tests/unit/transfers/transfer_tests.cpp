@@ -32,7 +32,8 @@ TEST_CASE("Serialization and Deserialization of a Transfer", "[transfers]") {
         partial_file_state.valid_tail = GENERATE(std::optional<transfers::PartialFile::ValidPart>(std::nullopt), transfers::PartialFile::ValidPart { 200, 300 });
 
         // make a backup
-        REQUIRE(Transfer::make_backup(temp_file, request, partial_file_state, slot) == true);
+        const UsbhMscRequest::SectorNbr first_sector = 0x1234;
+        REQUIRE(Transfer::make_backup(temp_file, request, partial_file_state, first_sector, slot) == true);
         std::cout << "temp_file_path: " << temp_file_path << std::endl;
 
         SECTION("Deserialization has the right data") {
@@ -42,6 +43,8 @@ TEST_CASE("Serialization and Deserialization of a Transfer", "[transfers]") {
             auto restored_partial_file_state = restored->get_partial_file_state();
             REQUIRE(memcmp(&restored_partial_file_state, &partial_file_state, sizeof(PartialFile::State)) == 0);
 
+            REQUIRE(restored->get_partial_file_first_sector() == first_sector);
+
             auto restored_request = restored->get_download_request();
             REQUIRE(restored_request.has_value());
             auto encrypted = get_if<Download::Request::Encrypted>(&request.data);
@@ -282,6 +282,19 @@ def ws_protocol_header():
     }, 'WsProtocol')
 
 
+def ws_extensions_header():
+    """
+    The Sec-WebSocket-Extensions, looking for our heatshrink compression.
+
+    The server may in theory list several extensions here; same as with the
+    connection header, we cheat a bit and only recognize ours when it comes
+    first, which is what our server does.
+    """
+    return keyworded_header({
+        'heatshrink': 'WsHeatshrink',
+    }, 'WsExtensions')
+
+
 def accept_header():
     """
     Looking at the accept header.
@@ -295,6 +308,22 @@ def accept_header():
     })
 
 
+def content_encoding_header():
+    """
+    Parse a Content-Encoding header.
+
+    Besides the implicit identity, we understand only the heatshrink
+    compression (we already carry the decoder for bgcode anyway). Anything
+    else is reported just as "the header was there", so the handler can
+    refuse the body instead of storing it undecoded.
+    """
+    return keyworded_header(
+        {
+            'heatshrink': 'ContentEncodingHeatshrink',
+            'identity': 'ContentEncodingIdentity',
+        }, 'ContentEncodingHeader')
+
+
 def content_encryption_mode_header():
     """
     Content encryption mode decoder.
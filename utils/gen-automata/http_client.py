@@ -1,4 +1,4 @@
-from http import connection_header, content_type, read_header_value, response, content_encryption_mode_header, upgrade_header, ws_protocol_header
+from http import connection_header, content_type, read_header_value, response, content_encryption_mode_header, upgrade_header, ws_protocol_header, ws_extensions_header
 
 if __name__ == "__main__":
     want_headers = {
@@ -9,6 +9,7 @@ if __name__ == "__main__":
         'Connection': connection_header(),
         'Upgrade': upgrade_header(),
         'Sec-WebSocket-Protocol': ws_protocol_header(),
+        'Sec-WebSocket-Extensions': ws_extensions_header(),
         'Token': read_header_value('Token'),
         'Sec-WebSocket-Accept': read_header_value('WebSocketAccept'),
         'Content-Encryption-Mode': content_encryption_mode_header(),
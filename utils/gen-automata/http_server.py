@@ -1,10 +1,12 @@
-from http import accept_header, connection_header, create_folder_header, read_boundary, read_header_value, request, print_after_upload_header, overwrite_file_header, authorization_header
+from http import accept_header, connection_header, content_encoding_header, create_folder_header, read_boundary, read_header_value, request, print_after_upload_header, overwrite_file_header, authorization_header
 
 if __name__ == "__main__":
     want_headers = {
         'X-Api-Key': read_header_value('XApiKey'),
         'Authorization': authorization_header(),
         'Content-Length': read_header_value('ContentLength'),
+        'Content-Encoding': content_encoding_header(),
+        'Uncompressed-Length': read_header_value('UncompressedLength'),
         'If-None-Match': read_header_value('IfNoneMatch'),
         'Print-After-Upload': print_after_upload_header(),
         'Overwrite': overwrite_file_header(),
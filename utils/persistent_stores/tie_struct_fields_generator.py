@@ -0,0 +1,47 @@
+import argparse
+
+
+def main():
+    parser = argparse.ArgumentParser(prog="tie_struct_fields_generator")
+    parser.add_argument("num_of_cases",
+                        type=int,
+                        help="Number of cases to generate")
+    args = parser.parse_args()
+    num_of_cases = args.num_of_cases
+
+    with open("tie_struct_fields.hpp", "w") as file:
+        file.write(f"""
+// Auto-generated by tie_struct_fields_generator.py
+
+#pragma once
+
+#include <tuple>
+
+#include <common/aggregate_arity.hpp>
+
+/// Returns a tuple of references to all struct members
+template <typename T>
+constexpr auto tie_struct_fields(T &t) {{
+	static constexpr auto arity = aggregate_arity<T>();
+    static_assert(arity < {num_of_cases}, "tie_struct_fields_generator needs to be called with with larger arity");
+
+ 	""")
+
+        for i in range(1, num_of_cases):
+            params = ", ".join([f"p{j}" for j in range(i)])
+            if i > 1:
+                file.write(" else")
+
+            file.write(f""" if constexpr(arity == {i}) {{
+		auto &[{params}] = t;
+		return std::tie({params});
+
+	}}""")
+
+        file.write(f"""
+}}
+""")
+
+
+if __name__ == "__main__":
+    main()